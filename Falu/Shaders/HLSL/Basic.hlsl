@@ -1,11 +1,28 @@
 //Basic.hlsl - {IȒ_EsNZVF[_[
 
 //萔obt@
+#ifdef MATERIAL_TABLE
+// 1IuWFNg256oCgBAIuWFNg܂Ƃ߂ăoChASV_InstanceIDň
+struct ObjectData
+{
+    matrix World;
+    matrix WorldInvTranspose;
+    uint4 Params;// x: }eAID
+    float4 Reserved[7];
+};
+
+cbuffer PerObjectBuffer : register(b0)
+{
+    ObjectData Objects[256];
+}
+#else
 cbuffer PerObjectBuffer : register(b0)
 {
     matrix World;
     matrix WorldInvTranspose;
+    uint4 ObjectParams;
 }
+#endif
 
 cbuffer PerFrameBuffer : register(b1)
 {
@@ -34,7 +51,75 @@ cbuffer LightBuffer : register(b3)
     float4 LightParams;// x: intensity, y: range, z: type, w: unused
 }
 
+// NX^[hCeBO(LightClusters.h)B|Cg/X|bgCg͂
+struct ClusterLight
+{
+    float3 Position;
+    float Range;
+    float3 Direction;
+    float CosOuter;// |CgCg -2
+    float3 Color;// x|ς
+    float CosInner;
+};
+
+StructuredBuffer<ClusterLight> ClusterLights : register(t13);
+StructuredBuffer<uint2> ClusterRanges : register(t14);// x: ItZbg, y: 
+StructuredBuffer<uint> ClusterLightIndices : register(t15);
+
+cbuffer ClusterBuffer : register(b4)
+{
+    uint4 ClusterGrid;// x: ^C, y: c^C, z: XCX, w: Cg
+    float4 ClusterDepth;// x: near, y: far, z: scale, w: bias (XCX = log([x) * scale + bias)
+    float4 ClusterViewport;// xy: r[|[g̍, zw: 1 / TCY
+}
+
+// JXP[hVhE(ShadowCascades.h)BfBNViCgɊ|
+cbuffer ShadowBuffer : register(b5)
+{
+    matrix CascadeViewProjection[4];
+    float4 CascadeParams[4];// x: eNZ̃[hTCY, y/z: r[[x͈̔
+    float4 ShadowParams;// x: JXP[h(0ȂeȂ), y: 1 / 𑜓x, z: [xoCAX, w: @ItZbg(eNZ)
+}
+
+Texture2DArray<float> ShadowMap : register(t16);
+SamplerComparisonState ShadowSampler : register(s1);
+
+#ifdef MATERIAL_TABLE
+// MaterialTable.h  MaterialTableEntry Ɠ
+struct MaterialData
+{
+    float4 Albedo;
+    float4 Properties;//x: metallic, y:roughness, z: ao, w: unused
+    float4 Emissive;
+    uint4 Textures;// albedo, normal, metallic, roughness: (zԍ << 16) | XCX, 0xFFFFFFFF = Ȃ
+};
+
+StructuredBuffer<MaterialData> MaterialTable : register(t4);
+
+// TCỸeNX`܂Ƃ߂z(SM5.0ł͓ICfbNXłȂ̂ŕĐ錾)
+Texture2DArray MaterialTextures0 : register(t5);
+Texture2DArray MaterialTextures1 : register(t6);
+Texture2DArray MaterialTextures2 : register(t7);
+Texture2DArray MaterialTextures3 : register(t8);
+Texture2DArray MaterialTextures4 : register(t9);
+Texture2DArray MaterialTextures5 : register(t10);
+Texture2DArray MaterialTextures6 : register(t11);
+Texture2DArray MaterialTextures7 : register(t12);
+#endif
+
 //_VF[_[
+#ifdef COMPACT_VERTEX
+// RpNg_(VertexFormat.h)BʒuUV̌`̈Ⴂ͓̓CAEgz
+struct VS_INPUT
+{
+    float3 Position : POSITION;// ʎqAABB0..1(Worldɏݍݍς)
+    float2 Normal : NORMAL;// ʑ̃GR[h
+    float2 TexCoord : TEXCOORD;
+#ifdef VERTEX_COLOR
+    float4 Color : COLOR;
+#endif
+};
+#else
 struct VS_INPUT
 {
     float3 Position : POSITION;
@@ -42,6 +127,7 @@ struct VS_INPUT
     float2 TexCoord : TEXCOORD;
     float4 Color : COLOR;
 };
+#endif
 
 //sNZVF[_[
 struct PS_INPUT
@@ -51,6 +137,10 @@ struct PS_INPUT
     float3 Normal : NORMAL;
     float2 TexCoord : TEXCOORD1;
     float4 Color : COLOR;
+    float ViewDepth : TEXCOORD2;// NX^[̃XCXIp
+#ifdef MATERIAL_TABLE
+    nointerpolation uint MaterialId : MATERIALID;
+#endif
 };
 
 //eNX`ƃTv[
@@ -60,16 +150,182 @@ Texture2D MetallicTexture : register(t2);
 Texture2D RoughnessTexture : register(t3);
 SamplerState DefaultSampler : register(s0);
 
+// }eA̒l(e[ułƒ萔obt@ł̍z)
+struct SurfaceMaterial
+{
+    float4 Albedo;
+    float4 Properties;
+    float4 Emissive;
+};
+
+#ifdef MATERIAL_TABLE
+float4 SampleMaterialTexture(uint packed, float2 uv)
+{
+    float3 coord = float3(uv, (float)(packed & 0xFFFF));
+    [branch]
+    switch (packed >> 16)
+    {
+        case 0: return MaterialTextures0.Sample(DefaultSampler, coord);
+        case 1: return MaterialTextures1.Sample(DefaultSampler, coord);
+        case 2: return MaterialTextures2.Sample(DefaultSampler, coord);
+        case 3: return MaterialTextures3.Sample(DefaultSampler, coord);
+        case 4: return MaterialTextures4.Sample(DefaultSampler, coord);
+        case 5: return MaterialTextures5.Sample(DefaultSampler, coord);
+        case 6: return MaterialTextures6.Sample(DefaultSampler, coord);
+        default: return MaterialTextures7.Sample(DefaultSampler, coord);
+    }
+}
+#endif
+
+// AxheNX`|}eAԂ
+SurfaceMaterial GetSurfaceMaterial(PS_INPUT input)
+{
+    SurfaceMaterial material;
+#ifdef MATERIAL_TABLE
+    MaterialData data = MaterialTable[input.MaterialId];
+    material.Albedo = data.Albedo * input.Color;
+    material.Properties = data.Properties;
+    material.Emissive = data.Emissive;
+    if (data.Textures.x != 0xFFFFFFFF)
+    {
+        material.Albedo *= SampleMaterialTexture(data.Textures.x, input.TexCoord);
+    }
+#else
+    material.Albedo = MaterialAlbedo * input.Color;
+    material.Properties = MaterialProperties;
+    material.Emissive = MaterialEmissive;
+    if (MaterialProperties.w > 0.5f)
+    {
+        material.Albedo *= AlbedoTexture.Sample(DefaultSampler, input.TexCoord);
+    }
+#endif
+    return material;
+}
+
+
+#ifdef COMPACT_VERTEX
+// ʑ̃GR[hꂽ@߂(VertexFormat.cpp  EncodeOctahedral ̋t)
+float3 DecodeOctahedral(float2 e)
+{
+    float3 n = float3(e.x, e.y, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.x += (n.x >= 0.0f) ? -t : t;
+    n.y += (n.y >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+#endif
+
+float3 GetVertexNormal(VS_INPUT input)
+{
+#ifdef COMPACT_VERTEX
+    return DecodeOctahedral(input.Normal);
+#else
+    return input.Normal;
+#endif
+}
+
+float4 GetVertexColor(VS_INPUT input)
+{
+#if defined(COMPACT_VERTEX) && !defined(VERTEX_COLOR)
+    return float4(1.0f, 1.0f, 1.0f, 1.0f);
+#else
+    return input.Color;
+#endif
+}
+
+// fBNViCg̓͂(0: e, 1: Ȃ)B
+// JXP[h͓eʒu}bvɎ܂ŏ̂̂ĝŁACȊÕr[
+float ComputeShadow(float3 worldPos, float3 normal)
+{
+    uint cascadeCount = (uint)ShadowParams.x;
+    for (uint c = 0; c < cascadeCount; ++c)
+    {
+        // @ɏ炵Ďȉêɂ݂}(eNZ傫JXP[hقǑ傫)
+        float3 offsetPos = worldPos + normal * CascadeParams[c].x * ShadowParams.w;
+        float4 shadowPos = mul(float4(offsetPos, 1.0f), CascadeViewProjection[c]);
+        float2 uv = shadowPos.xy * float2(0.5f, -0.5f) + 0.5f;
+        if (any(uv < 0.0f) || any(uv > 1.0f) || shadowPos.z > 1.0f)
+            continue;
+
+        // 3x3 PCF
+        float depth = shadowPos.z - ShadowParams.z;
+        float lit = 0.0f;
+        [unroll]
+        for (int y = -1; y <= 1; ++y)
+        {
+            [unroll]
+            for (int x = -1; x <= 1; ++x)
+            {
+                float2 offset = float2(x, y) * ShadowParams.y;
+                lit += ShadowMap.SampleCmpLevelZero(ShadowSampler, float3(uv + offset, c), depth);
+            }
+        }
+        return lit / 9.0f;
+    }
+    return 1.0f;
+}
+
+// sNZNX^[̔ԍ
+uint GetClusterIndex(float2 pixel, float viewDepth)
+{
+    float2 uv = saturate((pixel - ClusterViewport.xy) * ClusterViewport.zw);
+    uint2 tile = min((uint2)(uv * ClusterGrid.xy), ClusterGrid.xy - 1);
+    float slice = log(max(viewDepth, ClusterDepth.x)) * ClusterDepth.z + ClusterDepth.w;
+    uint z = min((uint)max(slice, 0.0f), ClusterGrid.z - 1);
+    return (z * ClusterGrid.y + tile.y) * ClusterGrid.x + tile.x;
+}
+
+// NX^[Ɋ蓖Ăꂽ|Cg/X|bgCg̍v(o[g + Blinn-Phong)
+float3 ComputeClusterLighting(PS_INPUT input, float3 normal, float3 viewDir, float3 albedo, float specularScale)
+{
+    float3 result = 0.0f;
+    if (ClusterGrid.w == 0)
+        return result;
+
+    uint2 range = ClusterRanges[GetClusterIndex(input.Position.xy, input.ViewDepth)];
+    for (uint i = 0; i < range.y; ++i)
+    {
+        ClusterLight light = ClusterLights[ClusterLightIndices[range.x + i]];
+        float3 toLight = light.Position - input.WorldPos;
+        float distance = length(toLight);
+        float3 lightDir = toLight / max(distance, 1e-4f);
+
+        // ͈͂̒[0ɂȂ錸
+        float ratio = distance / light.Range;
+        float attenuation = saturate(1.0f - ratio * ratio);
+        attenuation *= attenuation;
+
+        // X|bg͓O̊pxɌĎ߂
+        if (light.CosOuter > -1.5f)
+        {
+            attenuation *= smoothstep(light.CosOuter, light.CosInner, dot(-lightDir, light.Direction));
+        }
+        if (attenuation <= 0.0f)
+            continue;
+
+        float diffuseFactor = max(dot(normal, lightDir), 0.0f);
+        float3 halfVector = normalize(lightDir + viewDir);
+        float specularFactor = pow(max(dot(normal, halfVector), 0.0f), 32.0f);
+        result += light.Color * attenuation * (diffuseFactor * albedo + specularFactor * specularScale);
+    }
+    return result;
+}
 
 //*********************************************
 //
 // _VF[_[
 //
 //*********************************************
-PS_INPUT VS_Main(VS_INPUT input)
+PS_INPUT VS_Main(VS_INPUT input, uint instanceId : SV_InstanceID)
 {
     PS_INPUT output;
     
+#ifdef MATERIAL_TABLE
+    matrix World = Objects[instanceId].World;
+    matrix WorldInvTranspose = Objects[instanceId].WorldInvTranspose;
+    output.MaterialId = Objects[instanceId].Params.x;
+#endif
+    
     //[hWϊ
     float4 worldPos = mul(float4(input.Position, 1.0f), World);
     output.WorldPos = worldPos.xyz;
@@ -77,13 +333,14 @@ PS_INPUT VS_Main(VS_INPUT input)
     // r[EvWFNVϊ
     float4 viewPos = mul(worldPos, View);
     output.Position = mul(viewPos, Projection);
+    output.ViewDepth = viewPos.z;
     
     // @̃[hϊ
-    output.Normal = normalize(mul(input.Normal, (float3x3) WorldInvTranspose));
+    output.Normal = normalize(mul(GetVertexNormal(input), (float3x3) WorldInvTranspose));
     
     // eNX`Wƒ_J[
     output.TexCoord = input.TexCoord;
-    output.Color = input.Color;
+    output.Color = GetVertexColor(input);
     
     return output;
 }
@@ -104,30 +361,30 @@ float4 PS_Main(PS_INPUT input) : SV_TARGET
     // J
     float3 viewDir = normalize(CameraPosition.xyz - input.WorldPos);
     
-    // AxhigUːFj
-    float4 albedo = MaterialAlbedo * input.Color;
-    
-    // eNX`΃TvO
-    if(MaterialProperties.w > 0.5f)
-    {
-        float4 texColor = AlbedoTexture.Sample(DefaultSampler, input.TexCoord);
-        albedo *= texColor;
-    }
+    // AxhigUːFjBeNX`΃TvOς
+    SurfaceMaterial material = GetSurfaceMaterial(input);
+    float4 albedo = material.Albedo;
     
     // ArGgCg
     float3 ambient = AmbientLight.rgb * AmbientLight.a * albedo.rgb;
     
+    // fBNViCg̉e
+    float shadow = ComputeShadow(input.WorldPos, normal);
+    
     // fBt[YCeBOio[gj
     float diffuseFactor = max(dot(normal, lightDir), 0.0f);
-    float3 diffuse = diffuseFactor * LightColor.rgb * LightParams.x * albedo.rgb;
+    float3 diffuse = diffuseFactor * LightColor.rgb * LightParams.x * albedo.rgb * shadow;
     
     // X؃LCeBOiBlinn-Phongj
     float3 halfVector = normalize(lightDir + viewDir);
     float specularFactor = pow(max(dot(normal, halfVector), 0.0f), 32.0f);
-    float3 specular = specularFactor * LightColor.rgb * LightParams.x * (1.0f - MaterialProperties.y);
+    float3 specular = specularFactor * LightColor.rgb * LightParams.x * (1.0f - material.Properties.y) * shadow;
+    
+    // |Cg/X|bgCg(NX^[)
+    float3 local = ComputeClusterLighting(input, normal, viewDir, albedo.rgb, 1.0f - material.Properties.y);
     
     // ŏIJ[
-    float3 finalColor = ambient + diffuse + specular + MaterialEmissive.rgb;
+    float3 finalColor = ambient + diffuse + specular + local + material.Emissive.rgb;
     
     return float4(finalColor, albedo.a);
 }
@@ -139,14 +396,7 @@ float4 PS_Main(PS_INPUT input) : SV_TARGET
 //**********************************************
 float4 PS_Unlit(PS_INPUT input) : SV_TARGET
 {
-    float4 albedo = MaterialAlbedo * input.Color;
-    if(MaterialProperties.w > 0.5f)
-    {
-        float4 texColor = AlbedoTexture.Sample(DefaultSampler, input.TexCoord);
-        albedo *= texColor;
-    }
-    
-    return albedo;
+    return GetSurfaceMaterial(input).Albedo;
 }
 
 //**********************************************
@@ -5,12 +5,10 @@ cbuffer OutlineBuffer : register(b0)
     float4 OutlineColor;
 };
 
+// Only the position is read, so the same shader works with every VertexFormat layout
 struct VS_INPUT
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL;
-    float2 TexCoord : TEXCOORD0;
-    float4 Color : COLOR;
 };
 
 struct PS_INPUT
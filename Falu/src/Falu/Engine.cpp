@@ -10,15 +10,37 @@
 #include "Window.h"
 #include "TimeManager.h"
 #include "InputManager.h"
+#include "JobSystem.h"
 #include "../Renderer/Renderer.h"
 #include "../Scene/SceneManager.h"
+#include "Scene/MeshRenderer.h"
 #include "Renderer/Camera.h"
 #include "Renderer/Shader.h"
+#include "Renderer/Light.h"
+#include "Renderer/ModelLoader.h"
 
 #include "imgui.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace Falu
 {
+	namespace
+	{
+		// J̃LbVς݂̍sƎXibvVbg֎ʂ
+		void SnapshotCamera(const Camera& camera, CameraSnapshot& snapshot)
+		{
+			using namespace DirectX;
+			XMStoreFloat4x4(&snapshot.view, camera.GetViewMatrix());
+			XMStoreFloat4x4(&snapshot.projection, camera.GetProjectionMatrix());
+			XMStoreFloat4x4(&snapshot.viewProjection, camera.GetViewProjectionMatrix());
+			snapshot.frustum = camera.GetFrustum();
+			snapshot.position = camera.GetTransform().GetPosition();
+			snapshot.valid = true;
+		}
+	}
+
 	Engine& Engine::GetInstance()
 	{
 		static Engine instance;
@@ -27,6 +49,12 @@ namespace Falu
 
 	Engine::Engine()
 		: m_isRunning(false)
+		, m_gizmoClicked(false)
+		, m_showGizmo(false)
+		, m_renderThreadRunning(false)
+		, m_renderedFrameIndex(0)
+		, m_frameIndex(0)
+		, m_uiTextureFrameIndex(0)
 	{
 
 	}
@@ -45,6 +73,9 @@ namespace Falu
 			return false;
 		}
 
+		// [J[Xbh̋N(_[̕L^)
+		JobSystem::GetInstance().Initialize();
+
 		//_[̏
 		RenderSettings settings;
 		settings.enableVSync = true;
@@ -96,6 +127,12 @@ namespace Falu
 		);
 		if (outlineShader)
 		{
+			// RpNg_̃bVɂAEgCo悤AS_`̃CAEgpӂ
+			for (uint32_t format = 1; format < VertexFormat::kCount; ++format)
+			{
+				if (VertexFormat::IsValid(format))
+					outlineShader->CreateInputLayout(device, format);
+			}
 			m_renderer->SetOutlineShader(outlineShader);
 		}
 
@@ -125,6 +162,8 @@ namespace Falu
 
 	void Engine::Run()
 	{
+		StartRenderThread();
+
 		while (m_isRunning)
 		{
 			// bZ[WǗ
@@ -144,13 +183,24 @@ namespace Falu
 			// XV
 			Update(deltaTime);
 
-			// `
-			Render();
+			// UI
+			UpdateUI();
+
+			// `f[^`Xbh֓n
+			PublishRenderFrame();
 		}
+
+		StopRenderThread();
 	}
 
 	void Engine::Update(float deltaTime)
 	{
+		// 񓯊ǂݍݒ̃f GPU \[XAt[Ƃ̗\Z͈̔͂ō
+		if (m_renderer)
+		{
+			ModelLoader::GetInstance().Update(m_renderer->GetDevice());
+		}
+
 		// V[̍XV
 		if (m_sceneManager)
 		{
@@ -169,42 +219,15 @@ namespace Falu
 		HandleCameraInput(deltaTime);
 	}
 
-	void Engine::Render()
+	void Engine::UpdateUI()
 	{
-		m_renderer->BeginFrame();
-
-		// V[̃_O
-		if (m_sceneManager)
+		// tHgeNX`̍쐬/XVv`Xbhŏ܂ŎImGuit[n߂Ȃ
+		while (m_renderThreadRunning.load(std::memory_order_acquire) &&
+			m_renderedFrameIndex.load(std::memory_order_acquire) < m_uiTextureFrameIndex)
 		{
-			m_sceneManager->Render();
+			std::this_thread::yield();
 		}
 
-		// Selected Object Outline
-		if (m_imguiManager)
-		{
-			GameObject* selectedObject = m_imguiManager->GetSelectedObject();
-			if (selectedObject)
-			{
-				m_renderer->RenderOutline(selectedObject, Math::Color(1, 1, 0, 1), 0.02f);
-			}
-		}
-
-		// Gizmo Render
-		if (m_showGizmo && m_gizmo && m_imguiManager)
-		{
-			GameObject* selectedObject = m_imguiManager->GetSelectedObject();
-			if (selectedObject)
-			{
-				auto scene = m_sceneManager->GetCurrentScene();
-				if (scene)
-				{
-					Camera* camera = scene->GetMainCamera();
-					m_gizmo->Render(m_renderer->GetContext(), camera, selectedObject);
-				}
-			}
-		}
-
-		// ImGui Render
 		m_imguiManager->BeginFrame();
 
 		// Debug Render
@@ -243,18 +266,213 @@ namespace Falu
 		}
 
 		m_imguiManager->EndFrame();
-		m_imguiManager->Render();
+	}
+
+	void Engine::ExtractRenderFrame(RenderFrame& frame)
+	{
+		using namespace DirectX;
+
+		frame.Reset();
+		frame.frameIndex = ++m_frameIndex;
+		frame.time = m_timeManager->GetTotalTime();
+		frame.deltaTime = m_timeManager->GetDeltaTime();
+
+		Scene* scene = m_sceneManager ? m_sceneManager->GetCurrentScene() : nullptr;
+		Camera* camera = scene ? scene->GetMainCamera() : nullptr;
+
+		// Jƃr[B0Ԃ̓CJAȍ~̓V[ɓo^ꂽr[
+		if (camera)
+		{
+			SnapshotCamera(*camera, frame.camera);
+
+			RenderView* mainView = frame.AddView();
+			mainView->camera = frame.camera;
+			mainView->viewport = scene->GetMainViewport();
+
+			for (const RenderViewDesc& desc : scene->GetViews())
+			{
+				if (!desc.enabled || !desc.camera)
+					continue;
+
+				RenderView* view = frame.AddView();
+				if (!view)
+					break;
+				SnapshotCamera(*desc.camera, view->camera);
+				view->viewport = desc.viewport;
+				view->target = desc.target;
+				view->clear = desc.clear;
+				view->clearColor = desc.clearColor;
+			}
+		}
+
+		// CgBfBNVi͏ɁA|Cg/X|bg͂ꂩ̃r[̎ɓ͂̂
+		LightManager& lightManager = LightManager::GetInstance();
+		lightManager.Update();
+
+		m_visibleLights.clear();
+		for (uint32_t v = 0; v < frame.viewCount; ++v)
+		{
+			lightManager.LightsAffecting(frame.views[v].camera.frustum, m_visibleLights, false);
+		}
+		if (frame.viewCount > 1)
+		{
+			std::sort(m_visibleLights.begin(), m_visibleLights.end());
+			m_visibleLights.erase(std::unique(m_visibleLights.begin(), m_visibleLights.end()), m_visibleLights.end());
+		}
+		m_visibleLights.insert(m_visibleLights.begin(),
+			lightManager.GetDirectionalLights().begin(), lightManager.GetDirectionalLights().end());
+
+		// eBŏ̃fBNViCg̃JXP[hCr[ɍ킹
+		if (camera && m_shadowSettings.enabled && !lightManager.GetDirectionalLights().empty())
+		{
+			Math::Matrix4 cameraView;
+			Math::Matrix4 cameraProjection;
+			memcpy(cameraView.m, &frame.camera.view, sizeof(cameraView.m));
+			memcpy(cameraProjection.m, &frame.camera.projection, sizeof(cameraProjection.m));
+
+			const Light* sun = lightManager.GetDirectionalLights().front();
+			frame.shadowSettings = m_shadowSettings;
+			frame.shadowCascadeCount = ShadowCascades::Fit(cameraView, cameraProjection,
+				sun->GetTransform().GetForward(), m_shadowSettings, frame.shadowCascades);
+		}
+
+		for (const Light* light : m_visibleLights)
+		{
+			LightSnapshot snapshot;
+			snapshot.type = light->GetType();
+			snapshot.position = light->GetTransform().GetPosition();
+			snapshot.direction = light->GetTransform().GetForward();
+			snapshot.color = light->GetColor();
+			snapshot.intensity = light->GetIntensity();
+			snapshot.range = light->GetRange();
+			snapshot.spotAngle = light->GetSpotAngle();
+			frame.lights.push_back(snapshot);
+		}
+
+		// V[
+		if (m_sceneManager)
+		{
+			m_sceneManager->ExtractRenderData(frame);
+		}
+		// Sr[̎ƃJXP[hł܂Ƃ߂ăJOACr[͎Օ̗ƂĂA
+		// 1̃\[gr[EJXP[hƂ̃L[
+		frame.BuildViewQueues(&m_occlusionCuller);
+
+		GameObject* selectedObject = m_imguiManager ? m_imguiManager->GetSelectedObject() : nullptr;
+
+		// Selected Object Outline
+		if (selectedObject)
+		{
+			MeshRenderer* meshRenderer = selectedObject->GetComponent<MeshRenderer>();
+			if (meshRenderer && meshRenderer->GetMesh() && meshRenderer->GetMaterial())
+			{
+				frame.outline.enabled = true;
+				frame.outline.mesh = meshRenderer->GetMesh().get();
+				frame.outline.material = frame.AddMaterial(meshRenderer->GetMaterial().get());
+				XMStoreFloat4x4(&frame.outline.world, selectedObject->GetTransform().GetWorldMatrix().ToXMMATRIX());
+				frame.outline.color = Math::Color(1, 1, 0, 1);
+				frame.outline.width = 0.02f;
+			}
+		}
+
+		// Gizmo
+		if (m_showGizmo && m_gizmo && camera)
+		{
+			m_gizmo->ExtractRenderState(selectedObject, frame.gizmo);
+		}
+
+		// ImGui
+		if (m_imguiManager)
+		{
+			m_imguiManager->CaptureDrawData(frame.ui);
+		}
+	}
+
+	void Engine::PublishRenderFrame()
+	{
+		RenderFrame& frame = m_renderFrames.GetWriteBuffer();
+		ExtractRenderFrame(frame);
+
+		if (frame.ui.HasTextureRequests())
+		{
+			m_uiTextureFrameIndex = frame.frameIndex;
+		}
+
+		// Õt[󂯎܂ő҂(V~[V͕`1t[܂)
+		while (m_renderFrames.HasPending() && m_renderThreadRunning.load(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+
+		m_renderFrames.Publish();
+	}
+
+	void Engine::StartRenderThread()
+	{
+		if (m_renderThreadRunning.load())
+			return;
+
+		m_renderThreadRunning.store(true, std::memory_order_release);
+		m_renderThread = std::thread(&Engine::RenderThreadMain, this);
+	}
+
+	void Engine::StopRenderThread()
+	{
+		m_renderThreadRunning.store(false, std::memory_order_release);
+		if (m_renderThread.joinable())
+		{
+			m_renderThread.join();
+		}
+	}
+
+	void Engine::RenderThreadMain()
+	{
+		while (m_renderThreadRunning.load(std::memory_order_acquire))
+		{
+			if (!m_renderFrames.Acquire())
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			const RenderFrame& frame = m_renderFrames.GetReadBuffer();
+			Render(frame);
+			m_renderedFrameIndex.store(frame.frameIndex, std::memory_order_release);
+		}
+	}
+
+	void Engine::Render(const RenderFrame& frame)
+	{
+		m_renderer->BeginFrame();
+
+		// V[̃_O(AEgC܂)
+		m_renderer->DrawFrame(frame);
+
+		// Gizmo Render
+		if (m_gizmo)
+		{
+			m_gizmo->Render(m_renderer->GetContext(), frame.camera, frame.gizmo);
+		}
+
+		// ImGui Render
+		m_imguiManager->Render(frame.ui);
 
 		m_renderer->EndFrame();
 	}
 
 	void Engine::Shutdown()
 	{
+		// ǂݍݓr̃f̓[J[̋؂Ŏ~߂
+		ModelLoader::GetInstance().CancelLoads();
+		StopRenderThread();
+
 		m_imguiManager.reset();
 		m_sceneManager.reset();
 		m_inputManager.reset();
 		m_renderer.reset();
 		m_window.reset();
+
+		JobSystem::GetInstance().Shutdown();
 	}
 
 	void Engine::HandleMousePicking()
@@ -295,15 +513,29 @@ namespace Falu
 			);
 
 			// Ray Cast
-			GameObject* hitObject = scene->RayCast(ray);
+			RayHit hit;
+			GameObject* hitObject = scene->RayCast(ray, 1000.0f, RayCastMode::Precise, &hit);
 
 			if (hitObject)
 			{
 				char msg[256];
-				sprintf_s(msg, "[Engine] Clicked: %s (ID:%d)\n",
-					hitObject->GetName().c_str(),
-					hitObject->GetID()
-					);
+				if (hit.mesh)
+				{
+					sprintf_s(msg, "[Engine] Clicked: %s (ID:%d) triangle %u, submesh %d, distance %.3f\n",
+						hitObject->GetName().c_str(),
+						hitObject->GetID(),
+						hit.triangleIndex,
+						hit.subMeshIndex,
+						hit.distance
+						);
+				}
+				else
+				{
+					sprintf_s(msg, "[Engine] Clicked: %s (ID:%d)\n",
+						hitObject->GetName().c_str(),
+						hitObject->GetID()
+						);
+				}
 				OutputDebugStringA(msg);
 
 				// Notify ImguiManager
@@ -10,8 +10,14 @@
 #include <Windows.h>
 #include <memory>
 #include <string>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <vector>
 #include "Include/Utils/ImGuiManager.h"
 #include "Include/Utils/Gizmo.h"
+#include "Include/Utils/TripleBuffer.h"
+#include "Renderer/RenderFrame.h"
 
 namespace Falu
 {
@@ -20,6 +26,7 @@ namespace Falu
 	class InputManager;
 	class SceneManager;
 	class TimeManager;
+	class Light;
 
 	class Engine
 	{
@@ -36,6 +43,13 @@ namespace Falu
 		SceneManager* GetSceneManager() const { return m_sceneManager.get(); }
 		TimeManager* GetTimeManager() const { return m_timeManager.get(); }
 
+		// fBNViCg̃JXP[hVhE(ɒot[甽f)
+		void SetShadowSettings(const ShadowSettings& settings) { m_shadowSettings = settings; }
+		const ShadowSettings& GetShadowSettings() const { return m_shadowSettings; }
+		// Cr[ CPU IN[WJO(ɒot[甽f)
+		void SetOcclusionSettings(const OcclusionSettings& settings) { m_occlusionCuller.SetSettings(settings); }
+		const OcclusionSettings& GetOcclusionSettings() const { return m_occlusionCuller.GetSettings(); }
+
 		bool IsRunning() const { return m_isRunning; }
 		void Quit() { m_isRunning = false; }
 
@@ -46,7 +60,16 @@ namespace Falu
 		Engine& operator=(const Engine&) = delete;
 
 		void Update(float deltaTime);
-		void Render();
+		void UpdateUI();
+
+		//=== Render Pipeline ===
+		// V~[VXbht[N`Xbh֓nĂԂN+1
+		void ExtractRenderFrame(RenderFrame& frame);
+		void PublishRenderFrame();
+		void StartRenderThread();
+		void StopRenderThread();
+		void RenderThreadMain();
+		void Render(const RenderFrame& frame);
 
 		//=== Mouse Picking === 
 		void HandleMousePicking();
@@ -79,5 +102,19 @@ namespace Falu
 
 		std::unique_ptr<Gizmo> m_gizmo;
 		bool m_showGizmo;
+
+		// `Xbh
+		TripleBuffer<RenderFrame> m_renderFrames;
+		std::thread m_renderThread;
+		std::atomic<bool> m_renderThreadRunning;
+		std::atomic<uint64_t> m_renderedFrameIndex;
+		uint64_t m_frameIndex;
+		uint64_t m_uiTextureFrameIndex;	// ImGuĩeNX`v܂ލŌ̃t[
+
+		// ꂩ̃r[ɓ͂Cg(oƂɎg)
+		std::vector<Light*> m_visibleLights;
+		ShadowSettings m_shadowSettings;
+		// oXbhg([xobt@͖t[g)
+		OcclusionCuller m_occlusionCuller;
 	};
 }
@@ -0,0 +1,168 @@
+/*****************************************************************//**
+ * \file   JobSystem.cpp
+ * \brief  JobSystem ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "JobSystem.h"
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+namespace Falu
+{
+	namespace
+	{
+		// 1  ParallelFor ŌĂяoƂׂĂ̕⏕WuLB
+		// [vIĂ瓮o⏕WuɂGꂸAĂяõX^bNɂ͐GȂ
+		struct ParallelForState
+		{
+			std::atomic<uint32_t> next{ 0 };
+			std::atomic<uint32_t> done{ 0 };
+			uint32_t count = 0;
+			const std::function<void(uint32_t)>* func = nullptr;
+
+			void Run()
+			{
+				for (;;)
+				{
+					uint32_t index = next.fetch_add(1, std::memory_order_relaxed);
+					if (index >= count)
+						return;
+
+					(*func)(index);
+					done.fetch_add(1, std::memory_order_release);
+				}
+			}
+		};
+	}
+
+	JobSystem& JobSystem::GetInstance()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+	JobSystem::JobSystem()
+		: m_running(false)
+	{
+	}
+
+	JobSystem::~JobSystem()
+	{
+		Shutdown();
+	}
+
+	bool JobSystem::Initialize(uint32_t workerCount)
+	{
+		if (m_running)
+			return true;
+
+		if (workerCount == 0)
+		{
+			uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+		}
+
+		m_running = true;
+		m_workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i)
+		{
+			m_workers.emplace_back(&JobSystem::WorkerMain, this);
+		}
+		return true;
+	}
+
+	void JobSystem::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_running)
+				return;
+			m_running = false;
+		}
+		m_condition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			if (worker.joinable())
+			{
+				worker.join();
+			}
+		}
+		m_workers.clear();
+		m_queue.clear();
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func)
+	{
+		if (count == 0)
+			return;
+
+		// L̂Ȃ̂ł̏Ŏs
+		if (count == 1 || m_workers.empty())
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				func(i);
+			}
+			return;
+		}
+
+		auto state = std::make_shared<ParallelForState>();
+		state->count = count;
+		state->func = &func;
+
+		uint32_t helperCount = std::min<uint32_t>(count - 1, GetWorkerCount());
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (uint32_t i = 0; i < helperCount; ++i)
+			{
+				m_queue.emplace_back([state]() { state->Run(); });
+			}
+		}
+		m_condition.notify_all();
+
+		state->Run();
+
+		while (state->done.load(std::memory_order_acquire) < count)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::Schedule(std::function<void()> job)
+	{
+		if (m_workers.empty())
+		{
+			job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_queue.emplace_back(std::move(job));
+		}
+		m_condition.notify_one();
+	}
+
+	void JobSystem::WorkerMain()
+	{
+		for (;;)
+		{
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return !m_running || !m_queue.empty(); });
+				if (!m_running)
+					return;
+
+				job = std::move(m_queue.front());
+				m_queue.pop_front();
+			}
+			job();
+		}
+	}
+}
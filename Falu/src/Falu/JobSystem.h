@@ -0,0 +1,54 @@
+/*****************************************************************//**
+ * \file   JobSystem.h
+ * \brief  GW̃f[^񏈗p̃[J[Xbhv[
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace Falu
+{
+	class JobSystem
+	{
+	public:
+		static JobSystem& GetInstance();
+
+		// workerCount 0 = n[hEFAXbh - 1
+		bool Initialize(uint32_t workerCount = 0);
+		void Shutdown();
+
+		uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+		// [0, count) ׂ̂Ă index ɂ func(index) ĂԁB
+		// ĂяoXbhɉAׂĂ index IĂ߂
+		void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func);
+
+		// job [J[ 1 sAɖ߂BĂяo~߂Ă͂ȂpB
+		// [J[Ȃ΂̏ŎsBShutdown ̎_ő҂ĂWû͎Ă
+		void Schedule(std::function<void()> job);
+
+	private:
+		JobSystem();
+		~JobSystem();
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		void WorkerMain();
+
+	private:
+		std::vector<std::thread> m_workers;
+		std::deque<std::function<void()>> m_queue;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_running;
+	};
+}
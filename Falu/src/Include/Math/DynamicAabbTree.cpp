@@ -0,0 +1,276 @@
+/*****************************************************************//**
+ * \file   DynamicAabbTree.cpp
+ * \brief  DynamicAabbTree ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "DynamicAabbTree.h"
+
+#include <algorithm>
+
+namespace Falu
+{
+	namespace Math
+	{
+		namespace
+		{
+			AABB Union(const AABB& a, const AABB& b)
+			{
+				return AABB(Min(a.min, b.min), Max(a.max, b.max));
+			}
+
+			// \ʐς̔Bׂ邾Ȃ̂ 2 {͏Ȃ
+			float Cost(const AABB& box)
+			{
+				Vector3 size = box.GetSize();
+				return size.x * size.y + size.y * size.z + size.z * size.x;
+			}
+
+			bool Contains(const AABB& outer, const AABB& inner)
+			{
+				return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+					outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+			}
+		}
+
+		DynamicAabbTree::DynamicAabbTree(float margin)
+			: m_root(kNullProxy)
+			, m_freeList(kNullProxy)
+			, m_proxyCount(0)
+			, m_margin(margin)
+		{
+
+		}
+
+		uint32_t DynamicAabbTree::CreateProxy(const AABB& bounds, void* userData)
+		{
+			uint32_t proxy = AllocateNode();
+			Vector3 margin(m_margin, m_margin, m_margin);
+			m_nodes[proxy].bounds = AABB(bounds.min - margin, bounds.max + margin);
+			m_nodes[proxy].userData = userData;
+			m_nodes[proxy].height = 0;
+			InsertLeaf(proxy);
+			++m_proxyCount;
+			return proxy;
+		}
+
+		void DynamicAabbTree::DestroyProxy(uint32_t proxy)
+		{
+			if (proxy >= m_nodes.size() || !m_nodes[proxy].IsLeaf() || m_nodes[proxy].height < 0)
+				return;
+
+			RemoveLeaf(proxy);
+			FreeNode(proxy);
+			--m_proxyCount;
+		}
+
+		bool DynamicAabbTree::MoveProxy(uint32_t proxy, const AABB& bounds)
+		{
+			if (Contains(m_nodes[proxy].bounds, bounds))
+				return false;
+
+			RemoveLeaf(proxy);
+			Vector3 margin(m_margin, m_margin, m_margin);
+			m_nodes[proxy].bounds = AABB(bounds.min - margin, bounds.max + margin);
+			InsertLeaf(proxy);
+			return true;
+		}
+
+		void DynamicAabbTree::Clear()
+		{
+			m_nodes.clear();
+			m_root = kNullProxy;
+			m_freeList = kNullProxy;
+			m_proxyCount = 0;
+		}
+
+		uint32_t DynamicAabbTree::AllocateNode()
+		{
+			uint32_t index;
+			if (m_freeList != kNullProxy)
+			{
+				index = m_freeList;
+				m_freeList = m_nodes[index].parent;
+			}
+			else
+			{
+				index = static_cast<uint32_t>(m_nodes.size());
+				m_nodes.emplace_back();
+			}
+
+			Node& node = m_nodes[index];
+			node.userData = nullptr;
+			node.parent = kNullProxy;
+			node.child1 = kNullProxy;
+			node.child2 = kNullProxy;
+			node.height = 0;
+			return index;
+		}
+
+		void DynamicAabbTree::FreeNode(uint32_t node)
+		{
+			m_nodes[node].parent = m_freeList;
+			m_nodes[node].height = -1;
+			m_freeList = node;
+		}
+
+		void DynamicAabbTree::InsertLeaf(uint32_t leaf)
+		{
+			if (m_root == kNullProxy)
+			{
+				m_root = leaf;
+				m_nodes[leaf].parent = kNullProxy;
+				return;
+			}
+
+			// c[Ŝ̖ʐςԑȂZɌč~Ă
+			const AABB leafBounds = m_nodes[leaf].bounds;
+			uint32_t index = m_root;
+			while (!m_nodes[index].IsLeaf())
+			{
+				const Node& node = m_nodes[index];
+				float area = Cost(node.bounds);
+				float combinedArea = Cost(Union(node.bounds, leafBounds));
+
+				// ŐVe
+				float cost = 2.0f * combinedArea;
+				// ̃m[hׂ͂ē傫Ȃ
+				float inheritance = 2.0f * (combinedArea - area);
+
+				auto descendCost = [&](uint32_t child)
+				{
+					AABB combined = Union(leafBounds, m_nodes[child].bounds);
+					if (m_nodes[child].IsLeaf())
+						return Cost(combined) + inheritance;
+					return Cost(combined) - Cost(m_nodes[child].bounds) + inheritance;
+				};
+				float cost1 = descendCost(node.child1);
+				float cost2 = descendCost(node.child2);
+
+				if (cost < cost1 && cost < cost2)
+					break;
+				index = cost1 < cost2 ? node.child1 : node.child2;
+			}
+
+			uint32_t sibling = index;
+			uint32_t oldParent = m_nodes[sibling].parent;
+			uint32_t newParent = AllocateNode();
+			m_nodes[newParent].parent = oldParent;
+			m_nodes[newParent].bounds = Union(leafBounds, m_nodes[sibling].bounds);
+			m_nodes[newParent].height = m_nodes[sibling].height + 1;
+			m_nodes[newParent].child1 = sibling;
+			m_nodes[newParent].child2 = leaf;
+			m_nodes[sibling].parent = newParent;
+			m_nodes[leaf].parent = newParent;
+
+			if (oldParent == kNullProxy)
+			{
+				m_root = newParent;
+			}
+			else if (m_nodes[oldParent].child1 == sibling)
+			{
+				m_nodes[oldParent].child1 = newParent;
+			}
+			else
+			{
+				m_nodes[oldParent].child2 = newParent;
+			}
+
+			FixUpwards(m_nodes[leaf].parent);
+		}
+
+		void DynamicAabbTree::RemoveLeaf(uint32_t leaf)
+		{
+			if (leaf == m_root)
+			{
+				m_root = kNullProxy;
+				return;
+			}
+
+			// Z킪ëʒuɓ
+			uint32_t parent = m_nodes[leaf].parent;
+			uint32_t grandParent = m_nodes[parent].parent;
+			uint32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+			if (grandParent == kNullProxy)
+			{
+				m_root = sibling;
+				m_nodes[sibling].parent = kNullProxy;
+				FreeNode(parent);
+				return;
+			}
+
+			if (m_nodes[grandParent].child1 == parent)
+				m_nodes[grandParent].child1 = sibling;
+			else
+				m_nodes[grandParent].child2 = sibling;
+			m_nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			FixUpwards(grandParent);
+		}
+
+		void DynamicAabbTree::FixUpwards(uint32_t node)
+		{
+			while (node != kNullProxy)
+			{
+				node = Balance(node);
+
+				Node& current = m_nodes[node];
+				const Node& child1 = m_nodes[current.child1];
+				const Node& child2 = m_nodes[current.child2];
+				current.height = 1 + std::max(child1.height, child2.height);
+				current.bounds = Union(child1.bounds, child2.bounds);
+
+				node = current.parent;
+			}
+		}
+
+		uint32_t DynamicAabbTree::Balance(uint32_t a)
+		{
+			Node& nodeA = m_nodes[a];
+			if (nodeA.IsLeaf() || nodeA.height < 2)
+				return a;
+
+			uint32_t b = nodeA.child1;
+			uint32_t c = nodeA.child2;
+			int balance = m_nodes[c].height - m_nodes[b].height;
+			if (balance >= -1 && balance <= 1)
+				return a;
+
+			// ̎q a ̈ʒuɏオAa ͂̒Ⴂ̑
+			uint32_t up = balance > 1 ? c : b;
+			uint32_t stay = balance > 1 ? b : c;
+			Node& nodeUp = m_nodes[up];
+			uint32_t f = nodeUp.child1;
+			uint32_t g = nodeUp.child2;
+
+			nodeUp.child1 = a;
+			nodeUp.parent = nodeA.parent;
+			nodeA.parent = up;
+
+			if (nodeUp.parent == kNullProxy)
+				m_root = up;
+			else if (m_nodes[nodeUp.parent].child1 == a)
+				m_nodes[nodeUp.parent].child1 = up;
+			else
+				m_nodes[nodeUp.parent].child2 = up;
+
+			uint32_t tall = m_nodes[f].height > m_nodes[g].height ? f : g;
+			uint32_t shortChild = tall == f ? g : f;
+			nodeUp.child2 = tall;
+			if (balance > 1)
+				nodeA.child2 = shortChild;
+			else
+				nodeA.child1 = shortChild;
+			m_nodes[shortChild].parent = a;
+
+			nodeA.bounds = Union(m_nodes[stay].bounds, m_nodes[shortChild].bounds);
+			nodeA.height = 1 + std::max(m_nodes[stay].height, m_nodes[shortChild].height);
+			nodeUp.bounds = Union(nodeA.bounds, m_nodes[tall].bounds);
+			nodeUp.height = 1 + std::max(nodeA.height, m_nodes[tall].height);
+			return up;
+		}
+	}
+}
@@ -0,0 +1,118 @@
+/*****************************************************************//**
+ * \file   DynamicAabbTree.h
+ * \brief  oEfBOp̒XV AABB c[
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Ray.h"
+#include "Frustum.h"
+
+namespace Falu
+{
+	namespace Math
+	{
+		// t(vLV)łǉA폜Aړł AABB c[B
+		// t̓}[WōLoEfBO̂ŁAȈړł̓vLVXV邾Ńc[ɂ͐GȂB
+		// ǉ͕\ʐς̃RXgԏZIсA]Ńc[̒ނ荇ۂ
+		class DynamicAabbTree
+		{
+		public:
+			static constexpr uint32_t kNullProxy = UINT32_MAX;
+
+			explicit DynamicAabbTree(float margin = 0.1f);
+
+			// vLV ID ԂBID  DestroyProxy ܂ŗL
+			uint32_t CreateProxy(const AABB& bounds, void* userData);
+			void DestroyProxy(uint32_t proxy);
+			// bounds LoEfBO͂ݏoƂvLV꒼B꒼ true
+			bool MoveProxy(uint32_t proxy, const AABB& bounds);
+			void Clear();
+
+			void* GetUserData(uint32_t proxy) const { return m_nodes[proxy].userData; }
+			const AABB& GetFatBounds(uint32_t proxy) const { return m_nodes[proxy].bounds; }
+			size_t GetProxyCount() const { return m_proxyCount; }
+			int GetHeight() const { return m_root == kNullProxy ? 0 : m_nodes[m_root].height; }
+			float GetMargin() const { return m_margin; }
+
+			// LoEfBO overlaps(AABB) ʂvLVƂ visit(proxy) ĂԁB̍i荞݂͌Ăяoōs
+			template<typename Overlaps, typename Visit>
+			void QueryIf(Overlaps&& overlaps, Visit&& visit) const;
+
+			template<typename Visit>
+			void Query(const AABB& bounds, Visit&& visit) const
+			{
+				QueryIf([&bounds](const AABB& node) { return node.Intersects(bounds); }, visit);
+			}
+
+			template<typename Visit>
+			void Query(const Frustum& frustum, Visit&& visit) const
+			{
+				QueryIf([&frustum](const AABB& node) { return frustum.Intersects(node); }, visit);
+			}
+
+		private:
+			struct Node
+			{
+				AABB bounds;
+				void* userData;
+				uint32_t parent;	// 󂫃XgɂԂ͎̋󂫃m[h
+				uint32_t child1;	// tł kNullProxy
+				uint32_t child2;
+				int height;			// t 0A󂫂̊Ԃ -1
+
+				bool IsLeaf() const { return child1 == kNullProxy; }
+			};
+
+			// 2^32 ̗t̒ނ荇c[ł̐[ɂ͓͂Ȃ
+			static constexpr int kMaxStackDepth = 256;
+
+			uint32_t AllocateNode();
+			void FreeNode(uint32_t node);
+			void InsertLeaf(uint32_t leaf);
+			void RemoveLeaf(uint32_t leaf);
+			// q̍̍ 1 傫 node ̎q]BV؂̍Ԃ
+			uint32_t Balance(uint32_t node);
+			// node 獪܂ŃoEfBOƍvZArŒނ荇
+			void FixUpwards(uint32_t node);
+
+		private:
+			std::vector<Node> m_nodes;
+			uint32_t m_root;
+			uint32_t m_freeList;
+			size_t m_proxyCount;
+			float m_margin;
+		};
+
+		template<typename Overlaps, typename Visit>
+		void DynamicAabbTree::QueryIf(Overlaps&& overlaps, Visit&& visit) const
+		{
+			if (m_root == kNullProxy)
+				return;
+
+			uint32_t stack[kMaxStackDepth];
+			int top = 0;
+			stack[top++] = m_root;
+			while (top > 0)
+			{
+				const Node& node = m_nodes[stack[--top]];
+				if (!overlaps(node.bounds))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					visit(static_cast<uint32_t>(&node - m_nodes.data()));
+				}
+				else if (top + 2 <= kMaxStackDepth)
+				{
+					stack[top++] = node.child1;
+					stack[top++] = node.child2;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,75 @@
+/*****************************************************************//**
+ * \file   Frustum.h
+ * \brief  ̕ʂƃoEfBO̔
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include "Vector.h"
+#include "Matrix.h"
+#include "Ray.h"
+
+namespace Falu
+{
+	namespace Math
+	{
+		// ɐK 6 ̕(Dot(n, p) + d >= 0 )Bos̋ԂŎB
+		// Ԃ͍AEAAAjAAt@[
+		struct Frustum
+		{
+			enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+
+			Vector4 planes[PlaneCount];
+
+			// sxNg`̃r[vWFNV Gribb-Hartmann ̕@Ŏo(D3D ̃Nbv z  [0, 1])
+			static Frustum FromMatrix(const Matrix4& viewProjection)
+			{
+				const float(&m)[4][4] = viewProjection.m;
+				auto column = [&](int j) { return Vector4(m[0][j], m[1][j], m[2][j], m[3][j]); };
+
+				Frustum frustum;
+				frustum.planes[Left] = column(3) + column(0);
+				frustum.planes[Right] = column(3) - column(0);
+				frustum.planes[Bottom] = column(3) + column(1);
+				frustum.planes[Top] = column(3) - column(1);
+				frustum.planes[Near] = column(2);
+				frustum.planes[Far] = column(3) - column(2);
+
+				for (Vector4& plane : frustum.planes)
+				{
+					float length = Length(plane.XYZ());
+					if (length > 0.0f)
+						plane = plane / length;
+				}
+				return frustum;
+			}
+
+			// ێIȔB{bNX 1 ̕ʂ̊SɌɂƂ false
+			bool Intersects(const AABB& box) const
+			{
+				for (const Vector4& plane : planes)
+				{
+					// ʂ̖@Ɉԉp
+					Vector3 p(plane.x >= 0.0f ? box.max.x : box.min.x,
+						plane.y >= 0.0f ? box.max.y : box.min.y,
+						plane.z >= 0.0f ? box.max.z : box.min.z);
+					if (Dot(plane.XYZ(), p) + plane.w < 0.0f)
+						return false;
+				}
+				return true;
+			}
+
+			bool Intersects(const Vector3& center, float radius) const
+			{
+				for (const Vector4& plane : planes)
+				{
+					if (Dot(plane.XYZ(), center) + plane.w < -radius)
+						return false;
+				}
+				return true;
+			}
+		};
+	}
+}
@@ -0,0 +1,145 @@
+/*****************************************************************//**
+ * \file   Matrix.h
+ * \brief  DirectX ̍sxNgK 4x4 sBDirectXMath ɈˑȂ
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include "Vector.h"
+#include "Quaternion.h"
+
+namespace Falu
+{
+	namespace Math
+	{
+		// sxNgɊ|(v * M)sD 4x4 sBXMMATRIX ƓB
+		// ̕т XMFLOAT4X4 ƓŁAa * b  a ɁAb ɓKp
+		struct Matrix4
+		{
+			float m[4][4];
+
+			constexpr Matrix4()
+				: m{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } } {}
+			constexpr Matrix4(
+				float m00, float m01, float m02, float m03,
+				float m10, float m11, float m12, float m13,
+				float m20, float m21, float m22, float m23,
+				float m30, float m31, float m32, float m33)
+				: m{ { m00, m01, m02, m03 }, { m10, m11, m12, m13 }, { m20, m21, m22, m23 }, { m30, m31, m32, m33 } } {}
+
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			DirectX::XMMATRIX ToXMMATRIX() const
+			{
+				return DirectX::XMLoadFloat4x4(reinterpret_cast<const DirectX::XMFLOAT4X4*>(m));
+			}
+			static Matrix4 FromXMMATRIX(DirectX::FXMMATRIX matrix)
+			{
+				Matrix4 result;
+				DirectX::XMStoreFloat4x4(reinterpret_cast<DirectX::XMFLOAT4X4*>(result.m), matrix);
+				return result;
+			}
+#endif
+
+			static constexpr Matrix4 Identity() { return Matrix4(); }
+
+			static constexpr Matrix4 Translation(const Vector3& t)
+			{
+				return Matrix4(
+					1.0f, 0.0f, 0.0f, 0.0f,
+					0.0f, 1.0f, 0.0f, 0.0f,
+					0.0f, 0.0f, 1.0f, 0.0f,
+					t.x, t.y, t.z, 1.0f);
+			}
+
+			static constexpr Matrix4 Scaling(const Vector3& s)
+			{
+				return Matrix4(
+					s.x, 0.0f, 0.0f, 0.0f,
+					0.0f, s.y, 0.0f, 0.0f,
+					0.0f, 0.0f, s.z, 0.0f,
+					0.0f, 0.0f, 0.0f, 1.0f);
+			}
+
+			// XMMatrixRotationQuaternion Ɠs
+			static constexpr Matrix4 Rotation(const Quaternion& q)
+			{
+				float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+				float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+				float xw = q.x * q.w, yw = q.y * q.w, zw = q.z * q.w;
+				return Matrix4(
+					1.0f - 2.0f * (yy + zz), 2.0f * (xy + zw), 2.0f * (xz - yw), 0.0f,
+					2.0f * (xy - zw), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + xw), 0.0f,
+					2.0f * (xz + yw), 2.0f * (yz - xw), 1.0f - 2.0f * (xx + yy), 0.0f,
+					0.0f, 0.0f, 0.0f, 1.0f);
+			}
+
+			// gA]Asړ̏(]̌_Ȃ XMMatrixAffineTransformation)
+			static constexpr Matrix4 TRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
+			{
+				Matrix4 r = Rotation(rotation);
+				return Matrix4(
+					r.m[0][0] * scale.x, r.m[0][1] * scale.x, r.m[0][2] * scale.x, 0.0f,
+					r.m[1][0] * scale.y, r.m[1][1] * scale.y, r.m[1][2] * scale.y, 0.0f,
+					r.m[2][0] * scale.z, r.m[2][1] * scale.z, r.m[2][2] * scale.z, 0.0f,
+					translation.x, translation.y, translation.z, 1.0f);
+			}
+
+			constexpr Vector3 GetRow(int row) const { return Vector3(m[row][0], m[row][1], m[row][2]); }
+			constexpr Vector3 GetTranslation() const { return GetRow(3); }
+		};
+
+		constexpr Matrix4 operator*(const Matrix4& a, const Matrix4& b)
+		{
+			Matrix4 r(
+				0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 4; ++j)
+					r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + a.m[i][3] * b.m[3][j];
+			}
+			return r;
+		}
+
+		constexpr Matrix4 Transpose(const Matrix4& a)
+		{
+			return Matrix4(
+				a.m[0][0], a.m[1][0], a.m[2][0], a.m[3][0],
+				a.m[0][1], a.m[1][1], a.m[2][1], a.m[3][1],
+				a.m[0][2], a.m[1][2], a.m[2][2], a.m[3][2],
+				a.m[0][3], a.m[1][3], a.m[2][3], a.m[3][3]);
+		}
+
+		// ]qɂʂ̋tsBقȍsł͒Pʍsƍs 0 Ԃ
+		Matrix4 Inverse(const Matrix4& a, float* determinant = nullptr);
+
+		// w = 1  v * MBZ͂Ȃ(AtBsp)
+		constexpr Vector3 TransformPoint(const Vector3& v, const Matrix4& a)
+		{
+			return Vector3(
+				v.x * a.m[0][0] + v.y * a.m[1][0] + v.z * a.m[2][0] + a.m[3][0],
+				v.x * a.m[0][1] + v.y * a.m[1][1] + v.z * a.m[2][1] + a.m[3][1],
+				v.x * a.m[0][2] + v.y * a.m[1][2] + v.z * a.m[2][2] + a.m[3][2]);
+		}
+
+		// w = 0  v * M(pB@ɂ͋t]us񂪗v)
+		constexpr Vector3 TransformVector(const Vector3& v, const Matrix4& a)
+		{
+			return Vector3(
+				v.x * a.m[0][0] + v.y * a.m[1][0] + v.z * a.m[2][0],
+				v.x * a.m[0][1] + v.y * a.m[1][1] + v.z * a.m[2][1],
+				v.x * a.m[0][2] + v.y * a.m[1][2] + v.z * a.m[2][2]);
+		}
+
+		constexpr Vector4 Transform(const Vector4& v, const Matrix4& a)
+		{
+			return Vector4(
+				v.x * a.m[0][0] + v.y * a.m[1][0] + v.z * a.m[2][0] + v.w * a.m[3][0],
+				v.x * a.m[0][1] + v.y * a.m[1][1] + v.z * a.m[2][1] + v.w * a.m[3][1],
+				v.x * a.m[0][2] + v.y * a.m[1][2] + v.z * a.m[2][2] + v.w * a.m[3][2],
+				v.x * a.m[0][3] + v.y * a.m[1][3] + v.z * a.m[2][3] + v.w * a.m[3][3]);
+		}
+	}
+}
@@ -0,0 +1,137 @@
+/*****************************************************************//**
+ * \file   Quaternion.h
+ * \brief  ]̃NH[^jIBDirectXMath ɈˑȂ
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include "Vector.h"
+
+namespace Falu
+{
+	namespace Math
+	{
+		// PʃNH[^jI(x, y, z =  * sin(px / 2)Aw = cos(px / 2))B
+		// XMVECTOR ̃NH[^jIƕтKȂ̂ŁÂ܂܃Rs[ŕϊł
+		struct Quaternion
+		{
+			float x, y, z, w;
+
+			constexpr Quaternion() :x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+			constexpr Quaternion(float x, float y, float z, float w) :x(x), y(y), z(z), w(w) {}
+
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			DirectX::XMVECTOR ToXMVECTOR() const { return DirectX::XMVectorSet(x, y, z, w); }
+			static Quaternion FromXMVECTOR(DirectX::FXMVECTOR q)
+			{
+				DirectX::XMFLOAT4 stack;
+				DirectX::XMStoreFloat4(&stack, q);
+				return Quaternion(stack.x, stack.y, stack.z, stack.w);
+			}
+#endif
+
+			static constexpr Quaternion Identity() { return Quaternion(); }
+
+			// nB̐悩猩낷Ɛ̊pxŎvɉ(XMQuaternionRotationAxis)
+			static Quaternion FromAxisAngle(const Vector3& axis, float radians)
+			{
+				Vector3 n = Normalize(axis);
+				float s = std::sin(radians * 0.5f);
+				return Quaternion(n.x * s, n.y * s, n.z * s, std::cos(radians * 0.5f));
+			}
+
+			// [(Z)Asb`(X)A[(Y)̏BXMQuaternionRotationRollPitchYaw Ɠ
+			static Quaternion FromEuler(float pitch, float yaw, float roll);
+			static Quaternion FromEuler(const Vector3& radians) { return FromEuler(radians.x, radians.y, radians.z); }
+
+			// FromEuler ̋t(x, y, z Ƀsb`A[A[)Bsb` +-90 xɎ߂
+			Vector3 ToEuler() const;
+		};
+
+		constexpr float Dot(const Quaternion& a, const Quaternion& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+		constexpr Quaternion Conjugate(const Quaternion& q) { return Quaternion(-q.x, -q.y, -q.z, q.w); }
+
+		inline Quaternion Normalize(const Quaternion& q)
+		{
+			float length = std::sqrt(Dot(q, q));
+			if (length <= 0.0f)
+				return Quaternion();
+			return Quaternion(q.x / length, q.y / length, q.z / length, q.w / length);
+		}
+
+		// ] a ̌ɉ] b(XMQuaternionMultiply sxNg̍sƓ)
+		constexpr Quaternion operator*(const Quaternion& a, const Quaternion& b)
+		{
+			return Quaternion(
+				b.w * a.x + b.x * a.w + b.y * a.z - b.z * a.y,
+				b.w * a.y - b.x * a.z + b.y * a.w + b.z * a.x,
+				b.w * a.z + b.x * a.y - b.y * a.x + b.z * a.w,
+				b.w * a.w - b.x * a.x - b.y * a.y - b.z * a.z);
+		}
+
+		inline Quaternion& operator*=(Quaternion& a, const Quaternion& b) { a = a * b; return a; }
+		constexpr bool operator==(const Quaternion& a, const Quaternion& b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+		constexpr bool operator!=(const Quaternion& a, const Quaternion& b) { return !(a == b); }
+
+		// PʃNH[^jI v 
+		constexpr Vector3 Rotate(const Vector3& v, const Quaternion& q)
+		{
+			Vector3 u(q.x, q.y, q.z);
+			Vector3 t = Cross(u, v) * 2.0f;
+			return v + t * q.w + Cross(u, t);
+		}
+
+		// ŒZoH̋ʕԁBa  b قړΐK`Ԃɂ
+		inline Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t)
+		{
+			float cosTheta = Dot(a, b);
+			Quaternion target = b;
+			if (cosTheta < 0.0f)
+			{
+				cosTheta = -cosTheta;
+				target = Quaternion(-b.x, -b.y, -b.z, -b.w);
+			}
+
+			float wa = 1.0f - t;
+			float wb = t;
+			if (cosTheta < 0.9995f)
+			{
+				float theta = std::acos(cosTheta);
+				float sinTheta = std::sin(theta);
+				wa = std::sin(wa * theta) / sinTheta;
+				wb = std::sin(wb * theta) / sinTheta;
+			}
+			return Normalize(Quaternion(a.x * wa + target.x * wb, a.y * wa + target.y * wb,
+				a.z * wa + target.z * wb, a.w * wa + target.w * wb));
+		}
+
+		inline Quaternion Quaternion::FromEuler(float pitch, float yaw, float roll)
+		{
+			Quaternion qPitch(std::sin(pitch * 0.5f), 0.0f, 0.0f, std::cos(pitch * 0.5f));
+			Quaternion qYaw(0.0f, std::sin(yaw * 0.5f), 0.0f, std::cos(yaw * 0.5f));
+			Quaternion qRoll(0.0f, 0.0f, std::sin(roll * 0.5f), std::cos(roll * 0.5f));
+			return qRoll * qPitch * qYaw;
+		}
+
+		inline Vector3 Quaternion::ToEuler() const
+		{
+			// epxo]s(sxNg̏)̗vf
+			float m21 = 2.0f * (y * z - x * w);		// -sin(sb`)
+			float m20 = 2.0f * (x * z + y * w);
+			float m22 = 1.0f - 2.0f * (x * x + y * y);
+			float m01 = 2.0f * (x * y + z * w);
+			float m11 = 1.0f - 2.0f * (x * x + z * z);
+
+			float pitch = std::asin(Clamp(-m21, -1.0f, 1.0f));
+			if (std::fabs(m21) < 0.99999f)
+				return Vector3(pitch, std::atan2(m20, m22), std::atan2(m01, m11));
+
+			// WobNB[ƃ[ɂȂ̂ŁAׂă[ɓ
+			float m00 = 1.0f - 2.0f * (y * y + z * z);
+			float m02 = 2.0f * (x * z - y * w);
+			return Vector3(pitch, std::atan2(-m02, m00), 0.0f);
+		}
+	}
+}
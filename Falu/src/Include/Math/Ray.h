@@ -7,9 +7,11 @@
  *********************************************************************/
 #pragma once
 
-#include "MathHelper.h"
-#include <DirectXMath.h>
+#include "Vector.h"
+#include "Matrix.h"
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
 
 namespace Falu
 {
@@ -28,11 +30,7 @@ namespace Falu
 			// Set Position in Param
 			inline Vector3 GetPoint(float t) const
 			{
-				return Vector3(
-					origin.x + direction.x * t,
-					origin.y + direction.y * t,
-					origin.z + direction.z * t
-				);
+				return origin + direction * t;
 			}
 		};
 
@@ -144,47 +142,40 @@ namespace Falu
 				return true;
 			}
 
-			// AABB After Apply Transform
-			inline AABB Transform(const DirectX::XMMATRIX& matrix) const
+			// gXtH[(AtBs)Kp AABBB
+			// S͍sŕϊA傫͍s̐Βl[J̑傫ŏdݕtaɂȂ
+			inline AABB Transform(const Matrix4& matrix) const
 			{
-				using namespace DirectX;
-
-				// Convert eight Vertex
-				Vector3 corners[8] = {
-					Vector3(min.x,min.y,min.z),
-					Vector3(min.x,min.y,max.z),
-					Vector3(min.x,max.y,min.z),
-					Vector3(min.x,max.y,max.z),
-					Vector3(max.x,min.y,min.z),
-					Vector3(max.x,min.y,max.z),
-					Vector3(max.x,max.y,min.z),
-					Vector3(max.x,max.y,max.z)
-				};
-
-				AABB result;
-
-				result.min = Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
-				result.max = Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+				const float(&m)[4][4] = matrix.m;
+				Vector3 center = GetCenter();
+				Vector3 half = GetSize() * 0.5f;
 
-				for (int i = 0; i < 8; ++i) 
+				float c[3], e[3];
+				for (int j = 0; j < 3; ++j)
 				{
-					XMVECTOR v = XMVectorSet(corners[i].x, corners[i].y, corners[i].z, 1.0f);
-					v = XMVector3Transform(v, matrix);
-
-					XMFLOAT3 transformed;
-					XMStoreFloat3(&transformed, v);
+					c[j] = center.x * m[0][j] + center.y * m[1][j] + center.z * m[2][j] + m[3][j];
+					e[j] = std::fabs(m[0][j]) * half.x + std::fabs(m[1][j]) * half.y + std::fabs(m[2][j]) * half.z;
+				}
+				return AABB(Vector3(c[0] - e[0], c[1] - e[1], c[2] - e[2]), Vector3(c[0] + e[0], c[1] + e[1], c[2] + e[2]));
+			}
 
-					result.min.x = std::min(result.min.x, transformed.x);
-					result.min.y = std::min(result.min.y, transformed.y);
-					result.min.z = std::min(result.min.z, transformed.z);
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			inline AABB Transform(const DirectX::XMMATRIX& matrix) const
+			{
+				using namespace DirectX;
 
-					result.max.x = std::max(result.max.x, transformed.x);
-					result.max.y = std::max(result.max.y, transformed.y);
-					result.max.z = std::max(result.max.z, transformed.z);
-				}
+				XMVECTOR center = XMVectorSet((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f, 1.0f);
+				XMVECTOR extents = XMVectorMultiply(XMVectorAbs(matrix.r[0]), XMVectorReplicate((max.x - min.x) * 0.5f));
+				extents = XMVectorMultiplyAdd(XMVectorAbs(matrix.r[1]), XMVectorReplicate((max.y - min.y) * 0.5f), extents);
+				extents = XMVectorMultiplyAdd(XMVectorAbs(matrix.r[2]), XMVectorReplicate((max.z - min.z) * 0.5f), extents);
+				center = XMVector3Transform(center, matrix);
 
-				return result;
+				XMFLOAT3 newMin, newMax;
+				XMStoreFloat3(&newMin, XMVectorSubtract(center, extents));
+				XMStoreFloat3(&newMax, XMVectorAdd(center, extents));
+				return AABB(Vector3(newMin.x, newMin.y, newMin.z), Vector3(newMax.x, newMax.y, newMax.z));
 			}
+#endif
 		};
 	}
 }
@@ -0,0 +1,104 @@
+/*****************************************************************//**
+ * \file   RayPacket.h
+ * \brief  SoA ` 4 {̃C 4 {̃Xu
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include "Ray.h"
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FALU_RAYPACKET_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace Falu
+{
+	namespace Math
+	{
+		// ܂Ƃ߂Ăǂő 4 {̃CBactiveMask ɓĂȂ[ɂ͊Q̂Ȃ̃C
+		struct alignas(16) RayPacket
+		{
+			static constexpr int kWidth = 4;
+			static constexpr uint32_t kFullMask = (1u << kWidth) - 1;
+
+			float ox[kWidth], oy[kWidth], oz[kWidth];
+			float dx[kWidth], dy[kWidth], dz[kWidth];
+			// 1 / directionB0 ̐ɂ͑傫ȗLlAXu 0 * inf oȂ悤ɂ
+			float invDx[kWidth], invDy[kWidth], invDz[kWidth];
+			uint32_t activeMask = 0;
+
+			RayPacket()
+			{
+				for (int lane = 0; lane < kWidth; ++lane)
+					SetLane(lane, Ray());
+				activeMask = 0;
+			}
+
+			void SetLane(int lane, const Ray& ray)
+			{
+				ox[lane] = ray.origin.x; oy[lane] = ray.origin.y; oz[lane] = ray.origin.z;
+				dx[lane] = ray.direction.x; dy[lane] = ray.direction.y; dz[lane] = ray.direction.z;
+				invDx[lane] = SafeInverse(ray.direction.x);
+				invDy[lane] = SafeInverse(ray.direction.y);
+				invDz[lane] = SafeInverse(ray.direction.z);
+				activeMask |= 1u << lane;
+			}
+
+			Ray GetLane(int lane) const
+			{
+				return Ray(Vector3(ox[lane], oy[lane], oz[lane]), Vector3(dx[lane], dy[lane], dz[lane]));
+			}
+
+			static float SafeInverse(float v)
+			{
+				return std::fabs(v) > 1e-30f ? 1.0f / v : (v < 0.0f ? -1e30f : 1e30f);
+			}
+		};
+
+		// ׂẴ[ 1 ̃{bNXɑ΂āAƂ̕ȂŃXu肷B
+		// e[̓鋗Əo鋗(_Ȃ tNear ͕ɂȂ肤)A
+		// activeMask ̂ [max(tNear, 0), tFar] łȂ tLimit OŎn܂郌[Ԃ
+		inline uint32_t IntersectAABB(const RayPacket& packet, const Vector3& boundsMin, const Vector3& boundsMax,
+			const float tLimit[RayPacket::kWidth], float tNear[RayPacket::kWidth], float tFar[RayPacket::kWidth])
+		{
+#ifdef FALU_RAYPACKET_SSE
+			__m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boundsMin.x), _mm_load_ps(packet.ox)), _mm_load_ps(packet.invDx));
+			__m128 tx2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boundsMax.x), _mm_load_ps(packet.ox)), _mm_load_ps(packet.invDx));
+			__m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boundsMin.y), _mm_load_ps(packet.oy)), _mm_load_ps(packet.invDy));
+			__m128 ty2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boundsMax.y), _mm_load_ps(packet.oy)), _mm_load_ps(packet.invDy));
+			__m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boundsMin.z), _mm_load_ps(packet.oz)), _mm_load_ps(packet.invDz));
+			__m128 tz2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boundsMax.z), _mm_load_ps(packet.oz)), _mm_load_ps(packet.invDz));
+
+			__m128 entry = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx1, tx2), _mm_min_ps(ty1, ty2)), _mm_min_ps(tz1, tz2));
+			__m128 leave = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx1, tx2), _mm_max_ps(ty1, ty2)), _mm_max_ps(tz1, tz2));
+
+			__m128 hit = _mm_cmpge_ps(leave, _mm_max_ps(entry, _mm_setzero_ps()));
+			hit = _mm_and_ps(hit, _mm_cmplt_ps(entry, _mm_loadu_ps(tLimit)));
+
+			_mm_storeu_ps(tNear, entry);
+			_mm_storeu_ps(tFar, leave);
+			return static_cast<uint32_t>(_mm_movemask_ps(hit)) & packet.activeMask;
+#else
+			uint32_t mask = 0;
+			for (int lane = 0; lane < RayPacket::kWidth; ++lane)
+			{
+				float tx1 = (boundsMin.x - packet.ox[lane]) * packet.invDx[lane], tx2 = (boundsMax.x - packet.ox[lane]) * packet.invDx[lane];
+				float ty1 = (boundsMin.y - packet.oy[lane]) * packet.invDy[lane], ty2 = (boundsMax.y - packet.oy[lane]) * packet.invDy[lane];
+				float tz1 = (boundsMin.z - packet.oz[lane]) * packet.invDz[lane], tz2 = (boundsMax.z - packet.oz[lane]) * packet.invDz[lane];
+
+				tNear[lane] = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+				tFar[lane] = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+				if (tFar[lane] >= std::max(tNear[lane], 0.0f) && tNear[lane] < tLimit[lane])
+					mask |= 1u << lane;
+			}
+			return mask & packet.activeMask;
+#endif
+		}
+	}
+}
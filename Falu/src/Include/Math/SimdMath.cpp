@@ -0,0 +1,261 @@
+/*****************************************************************//**
+ * \file   SimdMath.cpp
+ * \brief  SimdMath ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "SimdMath.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FALU_SIMD_SSE 1
+#include <xmmintrin.h>
+#endif
+#if defined(FALU_SIMD_SSE) && defined(__AVX__)
+#define FALU_SIMD_AVX 1
+#include <immintrin.h>
+#endif
+
+namespace Falu
+{
+	namespace Math
+	{
+		namespace Simd
+		{
+			namespace
+			{
+#ifdef FALU_SIMD_SSE
+				// 4  Vector3(12  float) <-> Ƃ 1 ̃WX^
+				void Load4(const Vector3* p, __m128& x, __m128& y, __m128& z)
+				{
+					const float* f = &p->x;
+					__m128 a = _mm_loadu_ps(f);			// x0 y0 z0 x1
+					__m128 b = _mm_loadu_ps(f + 4);		// y1 z1 x2 y2
+					__m128 c = _mm_loadu_ps(f + 8);		// z2 x3 y3 z3
+					__m128 t1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));		// x2 y2 z2 x3
+					__m128 t2 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));		// y0 z0 y1 z1
+					__m128 t3 = _mm_shuffle_ps(t1, c, _MM_SHUFFLE(3, 2, 2, 1));		// y2 z2 y3 z3
+					x = _mm_shuffle_ps(a, t1, _MM_SHUFFLE(3, 0, 3, 0));
+					y = _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+					z = _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 1, 3, 1));
+				}
+
+				void Store4(Vector3* p, __m128 x, __m128 y, __m128 z)
+				{
+					float* f = &p->x;
+					__m128 xyLo = _mm_unpacklo_ps(x, y);							// x0 y0 x1 y1
+					__m128 xyHi = _mm_unpackhi_ps(x, y);							// x2 y2 x3 y3
+					__m128 zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));		// z0 z0 x1 x1
+					__m128 yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(2, 1, 2, 1));		// y1 y2 z1 z2
+					__m128 zxy = _mm_shuffle_ps(z, xyHi, _MM_SHUFFLE(3, 2, 3, 2));	// z2 z3 x3 y3
+					_mm_storeu_ps(f, _mm_shuffle_ps(xyLo, zx, _MM_SHUFFLE(2, 0, 1, 0)));
+					_mm_storeu_ps(f + 4, _mm_shuffle_ps(yz, xyHi, _MM_SHUFFLE(1, 0, 2, 0)));
+					_mm_storeu_ps(f + 8, _mm_shuffle_ps(zxy, zxy, _MM_SHUFFLE(1, 3, 2, 0)));
+				}
+
+				struct Sse
+				{
+					using Reg = __m128;
+					static constexpr size_t kWidth = 4;
+
+					static Reg Set(float v) { return _mm_set1_ps(v); }
+					static Reg Zero() { return _mm_setzero_ps(); }
+					static Reg Add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+					static Reg Sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+					static Reg Mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+					static Reg Div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+					static Reg Sqrt(Reg a) { return _mm_sqrt_ps(a); }
+					// mask ? a : 0
+					static Reg GreaterThanZeroOr0(Reg test, Reg a) { return _mm_and_ps(_mm_cmpgt_ps(test, _mm_setzero_ps()), a); }
+					static void Load(const Vector3* p, Reg& x, Reg& y, Reg& z) { Load4(p, x, y, z); }
+					static void Store(Vector3* p, Reg x, Reg y, Reg z) { Store4(p, x, y, z); }
+					static void StoreFloats(float* p, Reg a) { _mm_storeu_ps(p, a); }
+				};
+#endif
+
+#ifdef FALU_SIMD_AVX
+				struct Avx
+				{
+					using Reg = __m256;
+					static constexpr size_t kWidth = 8;
+
+					static Reg Set(float v) { return _mm256_set1_ps(v); }
+					static Reg Zero() { return _mm256_setzero_ps(); }
+					static Reg Add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+					static Reg Sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+					static Reg Mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+					static Reg Div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+					static Reg Sqrt(Reg a) { return _mm256_sqrt_ps(a); }
+					static Reg GreaterThanZeroOr0(Reg test, Reg a) { return _mm256_and_ps(_mm256_cmp_ps(test, _mm256_setzero_ps(), _CMP_GT_OQ), a); }
+
+					// SSE ̓]u 2 񕪂 256 rbg̃WX^ɂȂ
+					static void Load(const Vector3* p, Reg& x, Reg& y, Reg& z)
+					{
+						__m128 x0, y0, z0, x1, y1, z1;
+						Load4(p, x0, y0, z0);
+						Load4(p + 4, x1, y1, z1);
+						x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+						y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+						z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+					}
+
+					static void Store(Vector3* p, Reg x, Reg y, Reg z)
+					{
+						Store4(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+						Store4(p + 4, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+					}
+
+					static void StoreFloats(float* p, Reg a) { _mm256_storeu_ps(p, a); }
+				};
+				using Wide = Avx;
+#elif defined(FALU_SIMD_SSE)
+				using Wide = Sse;
+#endif
+
+#ifdef FALU_SIMD_SSE
+				// eJ[l Wide::kWidth Pʂ̂܂Ƃ܂肾AԂ
+				template<typename S, bool kPoint>
+				size_t TransformKernel(const Matrix4& matrix, const Vector3* in, Vector3* out, size_t count)
+				{
+					using Reg = typename S::Reg;
+					const Reg m00 = S::Set(matrix.m[0][0]), m01 = S::Set(matrix.m[0][1]), m02 = S::Set(matrix.m[0][2]);
+					const Reg m10 = S::Set(matrix.m[1][0]), m11 = S::Set(matrix.m[1][1]), m12 = S::Set(matrix.m[1][2]);
+					const Reg m20 = S::Set(matrix.m[2][0]), m21 = S::Set(matrix.m[2][1]), m22 = S::Set(matrix.m[2][2]);
+					const Reg m30 = S::Set(matrix.m[3][0]), m31 = S::Set(matrix.m[3][1]), m32 = S::Set(matrix.m[3][2]);
+
+					size_t i = 0;
+					for (; i + S::kWidth <= count; i += S::kWidth)
+					{
+						Reg x, y, z;
+						S::Load(in + i, x, y, z);
+						Reg rx = S::Add(S::Add(S::Mul(x, m00), S::Mul(y, m10)), S::Mul(z, m20));
+						Reg ry = S::Add(S::Add(S::Mul(x, m01), S::Mul(y, m11)), S::Mul(z, m21));
+						Reg rz = S::Add(S::Add(S::Mul(x, m02), S::Mul(y, m12)), S::Mul(z, m22));
+						if (kPoint)
+						{
+							rx = S::Add(rx, m30);
+							ry = S::Add(ry, m31);
+							rz = S::Add(rz, m32);
+						}
+						S::Store(out + i, rx, ry, rz);
+					}
+					return i;
+				}
+
+				template<typename S>
+				size_t NormalizeKernel(const Vector3* in, Vector3* out, size_t count)
+				{
+					using Reg = typename S::Reg;
+					size_t i = 0;
+					for (; i + S::kWidth <= count; i += S::kWidth)
+					{
+						Reg x, y, z;
+						S::Load(in + i, x, y, z);
+						Reg length = S::Sqrt(S::Add(S::Add(S::Mul(x, x), S::Mul(y, y)), S::Mul(z, z)));
+						// 0 / 0 ̃[̓}XN 0 ɖ߂
+						S::Store(out + i,
+							S::GreaterThanZeroOr0(length, S::Div(x, length)),
+							S::GreaterThanZeroOr0(length, S::Div(y, length)),
+							S::GreaterThanZeroOr0(length, S::Div(z, length)));
+					}
+					return i;
+				}
+
+				template<typename S>
+				size_t DotKernel(const Vector3* a, const Vector3* b, float* out, size_t count)
+				{
+					using Reg = typename S::Reg;
+					size_t i = 0;
+					for (; i + S::kWidth <= count; i += S::kWidth)
+					{
+						Reg ax, ay, az, bx, by, bz;
+						S::Load(a + i, ax, ay, az);
+						S::Load(b + i, bx, by, bz);
+						S::StoreFloats(out + i, S::Add(S::Add(S::Mul(ax, bx), S::Mul(ay, by)), S::Mul(az, bz)));
+					}
+					return i;
+				}
+
+				template<typename S>
+				size_t CrossKernel(const Vector3* a, const Vector3* b, Vector3* out, size_t count)
+				{
+					using Reg = typename S::Reg;
+					size_t i = 0;
+					for (; i + S::kWidth <= count; i += S::kWidth)
+					{
+						Reg ax, ay, az, bx, by, bz;
+						S::Load(a + i, ax, ay, az);
+						S::Load(b + i, bx, by, bz);
+						S::Store(out + i,
+							S::Sub(S::Mul(ay, bz), S::Mul(az, by)),
+							S::Sub(S::Mul(az, bx), S::Mul(ax, bz)),
+							S::Sub(S::Mul(ax, by), S::Mul(ay, bx)));
+					}
+					return i;
+				}
+#endif
+			}
+
+			const char* GetInstructionSet()
+			{
+#if defined(FALU_SIMD_AVX)
+				return "AVX";
+#elif defined(FALU_SIMD_SSE)
+				return "SSE";
+#else
+				return "Scalar";
+#endif
+			}
+
+			void TransformPoints(const Matrix4& matrix, const Vector3* in, Vector3* out, size_t count)
+			{
+				size_t i = 0;
+#ifdef FALU_SIMD_SSE
+				i = TransformKernel<Wide, true>(matrix, in, out, count);
+#endif
+				for (; i < count; ++i)
+					out[i] = TransformPoint(in[i], matrix);
+			}
+
+			void TransformVectors(const Matrix4& matrix, const Vector3* in, Vector3* out, size_t count)
+			{
+				size_t i = 0;
+#ifdef FALU_SIMD_SSE
+				i = TransformKernel<Wide, false>(matrix, in, out, count);
+#endif
+				for (; i < count; ++i)
+					out[i] = TransformVector(in[i], matrix);
+			}
+
+			void Normalize(const Vector3* in, Vector3* out, size_t count)
+			{
+				size_t i = 0;
+#ifdef FALU_SIMD_SSE
+				i = NormalizeKernel<Wide>(in, out, count);
+#endif
+				for (; i < count; ++i)
+					out[i] = Math::Normalize(in[i]);
+			}
+
+			void Dot(const Vector3* a, const Vector3* b, float* out, size_t count)
+			{
+				size_t i = 0;
+#ifdef FALU_SIMD_SSE
+				i = DotKernel<Wide>(a, b, out, count);
+#endif
+				for (; i < count; ++i)
+					out[i] = Math::Dot(a[i], b[i]);
+			}
+
+			void Cross(const Vector3* a, const Vector3* b, Vector3* out, size_t count)
+			{
+				size_t i = 0;
+#ifdef FALU_SIMD_SSE
+				i = CrossKernel<Wide>(a, b, out, count);
+#endif
+				for (; i < count; ++i)
+					out[i] = Math::Cross(a[i], b[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,38 @@
+/*****************************************************************//**
+ * \file   SimdMath.h
+ * \brief  Vector3 ̔zɑ΂J[l(ϊAKAρAO)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include "Vector.h"
+#include "Matrix.h"
+
+namespace Falu
+{
+	namespace Math
+	{
+		// Vector3 ̊֐̈ꊇŁBz͕iǂ AoS ̂܂܂ŁAJ[l 4 (SSE) 8 (rh AVX
+		// ̂Ƃ)WX^ɓ]uA[̓XJ[ł̊֐ŕЕtBe[̓XJ[łƓZ
+		// ōsBin  out ͓zł悢
+		namespace Simd
+		{
+			// "AVX"A"SSE"A"Scalar" ̂ꂩBOx`}[Np
+			const char* GetInstructionSet();
+
+			// out[i] = TransformPoint(in[i], matrix)
+			void TransformPoints(const Matrix4& matrix, const Vector3* in, Vector3* out, size_t count);
+			// out[i] = TransformVector(in[i], matrix)
+			void TransformVectors(const Matrix4& matrix, const Vector3* in, Vector3* out, size_t count);
+			// out[i] = Normalize(in[i])(0  0 ̂܂)
+			void Normalize(const Vector3* in, Vector3* out, size_t count);
+			// out[i] = Dot(a[i], b[i])
+			void Dot(const Vector3* a, const Vector3* b, float* out, size_t count);
+			// out[i] = Cross(a[i], b[i])
+			void Cross(const Vector3* a, const Vector3* b, Vector3* out, size_t count);
+		}
+	}
+}
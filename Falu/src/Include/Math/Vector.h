@@ -0,0 +1,236 @@
+/*****************************************************************//**
+ * \file   Vector.h
+ * \brief  w̒萔AVector2/3/4  Color ƉZqBDirectXMath ɈˑȂ
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cmath>
+
+// XMFLOAT / XMVECTOR Ƃ̕ΐA DirectXMath CN[hĂƂg(MathHelper.h ͂Ă)B
+// ȊO͂ C++ Ȃ̂ŁAǂ̃vbgtH[ł GCC / Clang Ńrhł
+#if defined(DIRECTX_MATH_VERSION)
+#define FALU_MATH_DIRECTX_INTEROP 1
+#endif
+
+namespace Falu
+{
+	namespace Math
+	{
+		//==== Constants ====
+		constexpr float PI = 3.14159265358979323846f;
+		constexpr float TWO_PI = 6.28318530717958647692f;
+		constexpr float PI_DEV_2 = 1.57079632679489661923f;
+		constexpr float PI_DEV_4 = 0.78539816339744830962f;
+
+		//==== Scalar helpers ====
+		constexpr float ToRadians(float degrees)
+		{
+			return degrees * (PI / 180.0f);
+		}
+
+		constexpr float ToDegrees(float radians)
+		{
+			return radians * (180.0f / PI);
+		}
+
+		constexpr float Lerp(float a, float b, float t)
+		{
+			return a + (b - a) * t;
+		}
+
+		constexpr float Clamp(float value, float min, float max)
+		{
+			return value < min ? min : (value > max ? max : value);
+		}
+
+		struct Vector2
+		{
+			float x, y;
+
+			constexpr Vector2() :x(0.0f), y(0.0f){}
+			constexpr Vector2(float x, float y) :x(x), y(y){}
+
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			DirectX::XMFLOAT2 ToXMFLOAT2() const { return DirectX::XMFLOAT2(x, y); }
+			DirectX::XMVECTOR ToXMVECTOR() const {
+				DirectX::XMFLOAT2 stack = ToXMFLOAT2();
+				return DirectX::XMLoadFloat2(&stack);
+			}
+#endif
+
+			static constexpr Vector2 Zero()		{ return Vector2(0.0f, 0.0f); }
+			static constexpr Vector2 One()		{ return Vector2(1.0f, 1.0f); }
+			static constexpr Vector2 Up()		{ return Vector2(0.0f, 1.0f); }
+			static constexpr Vector2 Right()	{ return Vector2(1.0f, 0.0f); }
+		};
+
+		struct Vector3
+		{
+			float x, y, z;
+
+			constexpr Vector3() :x(0.0f), y(0.0f), z(0.0f) {}
+			constexpr Vector3(float x,float y,float z) :x(x), y(y), z(z) {}
+
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			DirectX::XMFLOAT3 ToXMFLOAT3() const { return DirectX::XMFLOAT3(x, y, z); }
+			DirectX::XMVECTOR ToXMVECTOR() const {
+				DirectX::XMFLOAT3 stack = ToXMFLOAT3();
+				return DirectX::XMLoadFloat3(&stack);
+			}
+#endif
+
+			static constexpr Vector3 Zero()		{ return Vector3(0.0f, 0.0f, 0.0f); }
+			static constexpr Vector3 One()		{ return Vector3(1.0f, 1.0f, 1.0f); }
+			static constexpr Vector3 Up()		{ return Vector3(0.0f, 1.0f, 0.0f); }
+			static constexpr Vector3 Forward()	{ return Vector3(0.0f, 0.0f, 1.0f); }
+			static constexpr Vector3 Right()	{ return Vector3(1.0f, 0.0f, 0.0f); }
+		};
+
+		struct Vector4
+		{
+			float x, y, z, w;
+
+			constexpr Vector4() :x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+			constexpr Vector4(float x, float y, float z, float w) :x(x), y(y), z(z), w(w) {}
+			constexpr Vector4(const Vector3& v, float w) :x(v.x), y(v.y), z(v.z), w(w) {}
+
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			DirectX::XMFLOAT4 ToXMFLOAT4() const { return DirectX::XMFLOAT4(x, y, z, w); }
+			DirectX::XMVECTOR ToXMVECTOR() const {
+				DirectX::XMFLOAT4 stack = ToXMFLOAT4();
+				return DirectX::XMLoadFloat4(&stack);
+			}
+#endif
+
+			constexpr Vector3 XYZ() const { return Vector3(x, y, z); }
+		};
+
+		struct Color
+		{
+			float r, g, b, a;
+
+			constexpr Color() :r(1.0f), g(1.0f), b(1.0f), a(1.0f) {}
+			constexpr Color(float r, float g, float b, float a) :r(r), g(g), b(b), a(a) {}
+
+#ifdef FALU_MATH_DIRECTX_INTEROP
+			DirectX::XMFLOAT4 ToFloat4() const { return DirectX::XMFLOAT4(r, g, b, a); }
+#endif
+
+			static constexpr Color White()	{ return Color(1.0f, 1.0f, 1.0f, 1.0f); }
+			static constexpr Color Black()	{ return Color(0.0f, 0.0f, 0.0f, 1.0f); }
+			static constexpr Color Red()	{ return Color(1.0f, 0.0f, 0.0f, 1.0f); }
+			static constexpr Color Green()	{ return Color(0.0f, 1.0f, 0.0f, 1.0f); }
+			static constexpr Color Blue()	{ return Color(0.0f, 0.0f, 1.0f, 1.0f); }
+		};
+
+		//==== Vector2 operators ====
+		constexpr Vector2 operator+(const Vector2& a, const Vector2& b) { return Vector2(a.x + b.x, a.y + b.y); }
+		constexpr Vector2 operator-(const Vector2& a, const Vector2& b) { return Vector2(a.x - b.x, a.y - b.y); }
+		constexpr Vector2 operator*(const Vector2& a, const Vector2& b) { return Vector2(a.x * b.x, a.y * b.y); }
+		constexpr Vector2 operator*(const Vector2& v, float s) { return Vector2(v.x * s, v.y * s); }
+		constexpr Vector2 operator*(float s, const Vector2& v) { return Vector2(v.x * s, v.y * s); }
+		constexpr Vector2 operator/(const Vector2& v, float s) { return Vector2(v.x / s, v.y / s); }
+		constexpr Vector2 operator-(const Vector2& v) { return Vector2(-v.x, -v.y); }
+		inline Vector2& operator+=(Vector2& a, const Vector2& b) { a = a + b; return a; }
+		inline Vector2& operator-=(Vector2& a, const Vector2& b) { a = a - b; return a; }
+		inline Vector2& operator*=(Vector2& v, float s) { v = v * s; return v; }
+		inline Vector2& operator/=(Vector2& v, float s) { v = v / s; return v; }
+		constexpr bool operator==(const Vector2& a, const Vector2& b) { return a.x == b.x && a.y == b.y; }
+		constexpr bool operator!=(const Vector2& a, const Vector2& b) { return !(a == b); }
+
+		//==== Vector3 operators ====
+		constexpr Vector3 operator+(const Vector3& a, const Vector3& b) { return Vector3(a.x + b.x, a.y + b.y, a.z + b.z); }
+		constexpr Vector3 operator-(const Vector3& a, const Vector3& b) { return Vector3(a.x - b.x, a.y - b.y, a.z - b.z); }
+		constexpr Vector3 operator*(const Vector3& a, const Vector3& b) { return Vector3(a.x * b.x, a.y * b.y, a.z * b.z); }
+		constexpr Vector3 operator*(const Vector3& v, float s) { return Vector3(v.x * s, v.y * s, v.z * s); }
+		constexpr Vector3 operator*(float s, const Vector3& v) { return Vector3(v.x * s, v.y * s, v.z * s); }
+		constexpr Vector3 operator/(const Vector3& v, float s) { return Vector3(v.x / s, v.y / s, v.z / s); }
+		constexpr Vector3 operator-(const Vector3& v) { return Vector3(-v.x, -v.y, -v.z); }
+		inline Vector3& operator+=(Vector3& a, const Vector3& b) { a = a + b; return a; }
+		inline Vector3& operator-=(Vector3& a, const Vector3& b) { a = a - b; return a; }
+		inline Vector3& operator*=(Vector3& v, float s) { v = v * s; return v; }
+		inline Vector3& operator/=(Vector3& v, float s) { v = v / s; return v; }
+		constexpr bool operator==(const Vector3& a, const Vector3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+		constexpr bool operator!=(const Vector3& a, const Vector3& b) { return !(a == b); }
+
+		//==== Vector4 operators ====
+		constexpr Vector4 operator+(const Vector4& a, const Vector4& b) { return Vector4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+		constexpr Vector4 operator-(const Vector4& a, const Vector4& b) { return Vector4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+		constexpr Vector4 operator*(const Vector4& a, const Vector4& b) { return Vector4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+		constexpr Vector4 operator*(const Vector4& v, float s) { return Vector4(v.x * s, v.y * s, v.z * s, v.w * s); }
+		constexpr Vector4 operator*(float s, const Vector4& v) { return Vector4(v.x * s, v.y * s, v.z * s, v.w * s); }
+		constexpr Vector4 operator/(const Vector4& v, float s) { return Vector4(v.x / s, v.y / s, v.z / s, v.w / s); }
+		constexpr Vector4 operator-(const Vector4& v) { return Vector4(-v.x, -v.y, -v.z, -v.w); }
+		inline Vector4& operator+=(Vector4& a, const Vector4& b) { a = a + b; return a; }
+		inline Vector4& operator-=(Vector4& a, const Vector4& b) { a = a - b; return a; }
+		inline Vector4& operator*=(Vector4& v, float s) { v = v * s; return v; }
+		constexpr bool operator==(const Vector4& a, const Vector4& b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+		constexpr bool operator!=(const Vector4& a, const Vector4& b) { return !(a == b); }
+
+		//==== Color operators (linear, per channel) ====
+		constexpr Color operator+(const Color& a, const Color& b) { return Color(a.r + b.r, a.g + b.g, a.b + b.b, a.a + b.a); }
+		constexpr Color operator*(const Color& a, const Color& b) { return Color(a.r * b.r, a.g * b.g, a.b * b.b, a.a * b.a); }
+		constexpr Color operator*(const Color& c, float s) { return Color(c.r * s, c.g * s, c.b * s, c.a * s); }
+		constexpr bool operator==(const Color& a, const Color& b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; }
+		constexpr bool operator!=(const Color& a, const Color& b) { return !(a == b); }
+
+		//==== Functions ====
+		constexpr float Dot(const Vector2& a, const Vector2& b) { return a.x * b.x + a.y * b.y; }
+		constexpr float Dot(const Vector3& a, const Vector3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+		constexpr float Dot(const Vector4& a, const Vector4& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+		constexpr Vector3 Cross(const Vector3& a, const Vector3& b)
+		{
+			return Vector3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+		}
+
+		constexpr float LengthSquared(const Vector2& v) { return Dot(v, v); }
+		constexpr float LengthSquared(const Vector3& v) { return Dot(v, v); }
+		constexpr float LengthSquared(const Vector4& v) { return Dot(v, v); }
+		inline float Length(const Vector2& v) { return std::sqrt(LengthSquared(v)); }
+		inline float Length(const Vector3& v) { return std::sqrt(LengthSquared(v)); }
+		inline float Length(const Vector4& v) { return std::sqrt(LengthSquared(v)); }
+		inline float Distance(const Vector3& a, const Vector3& b) { return Length(a - b); }
+
+		//  0 ̓͂ NaN ɂ 0 ̂܂܂ɂ
+		inline Vector2 Normalize(const Vector2& v)
+		{
+			float length = Length(v);
+			return length > 0.0f ? v / length : Vector2();
+		}
+
+		inline Vector3 Normalize(const Vector3& v)
+		{
+			float length = Length(v);
+			return length > 0.0f ? v / length : Vector3();
+		}
+
+		inline Vector4 Normalize(const Vector4& v)
+		{
+			float length = Length(v);
+			return length > 0.0f ? v / length : Vector4();
+		}
+
+		constexpr Vector2 Lerp(const Vector2& a, const Vector2& b, float t) { return a + (b - a) * t; }
+		constexpr Vector3 Lerp(const Vector3& a, const Vector3& b, float t) { return a + (b - a) * t; }
+		constexpr Vector4 Lerp(const Vector4& a, const Vector4& b, float t) { return a + (b - a) * t; }
+
+		constexpr Vector3 Min(const Vector3& a, const Vector3& b)
+		{
+			return Vector3(a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z);
+		}
+
+		constexpr Vector3 Max(const Vector3& a, const Vector3& b)
+		{
+			return Vector3(a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z);
+		}
+
+		constexpr Vector3 Abs(const Vector3& v)
+		{
+			return Vector3(v.x < 0.0f ? -v.x : v.x, v.y < 0.0f ? -v.y : v.y, v.z < 0.0f ? -v.z : v.z);
+		}
+	}
+}
@@ -0,0 +1,37 @@
+/*****************************************************************//**
+ * \file   ArrayView.h
+ * \brief  AzLɎQƂr[
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Falu
+{
+	// ǂݎp̃|C^ƌBstd::span<const T> ̑(vWFNg C++17)B
+	// std::vector Öقɕϊł̂ŁA֐̓Rs[ɂǂł󂯎
+	template<typename T>
+	class ArrayView
+	{
+	public:
+		ArrayView() : m_data(nullptr), m_size(0) {}
+		ArrayView(const T* data, size_t size) : m_data(data), m_size(size) {}
+		ArrayView(const std::vector<T>& vector) : m_data(vector.data()), m_size(vector.size()) {}
+
+		const T* data() const { return m_data; }
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+
+		const T* begin() const { return m_data; }
+		const T* end() const { return m_data + m_size; }
+		const T& operator[](size_t i) const { return m_data[i]; }
+
+	private:
+		const T* m_data;
+		size_t m_size;
+	};
+}
@@ -10,6 +10,8 @@
 #include "Renderer/Camera.h"
 #include "Renderer/Mesh.h"
 #include "Renderer/Shader.h"
+#include "Renderer/RenderFrame.h"
+#include "Include/Math/Matrix.h"
 
 namespace Falu
 {
@@ -55,37 +57,44 @@ namespace Falu
 		return SUCCEEDED(hr);
 	}
 
-	void Gizmo::Render(ID3D11DeviceContext* context, Camera* camera, GameObject* target)
+	void Gizmo::ExtractRenderState(GameObject* target, GizmoRenderState& state) const
 	{
-		if (!target || !camera)
+		state.visible = (target != nullptr);
+		if (!target)
 			return;
 
-		Math::Vector3 position = target->GetTransform().GetPosition();
+		state.mode = m_mode;
+		state.selectedAxis = m_selectedAxis;
+		state.size = m_size;
+		state.position = target->GetTransform().GetPosition();
 
 		DirectX::XMMATRIX rotation;
 		if (m_space == GizmoSpace::Local)
 		{
-			rotation = DirectX::XMMatrixRotationRollPitchYaw(
-				target->GetTransform().GetRotation().x,
-				target->GetTransform().GetRotation().y,
-				target->GetTransform().GetRotation().z
-			);
+			rotation = Math::Matrix4::Rotation(target->GetTransform().GetOrientation()).ToXMMATRIX();
 		}
 		else
 		{
 			rotation = DirectX::XMMatrixIdentity();
 		}
+		DirectX::XMStoreFloat4x4(&state.rotation, rotation);
+	}
 
-		switch (m_mode)
+	void Gizmo::Render(ID3D11DeviceContext* context, const CameraSnapshot& camera, const GizmoRenderState& state)
+	{
+		if (!state.visible || !camera.valid)
+			return;
+
+		switch (state.mode)
 		{
 		case Falu::GizmoMode::Translate:
-			RenderTranslateGizmo(context, camera, position, rotation);
+			RenderTranslateGizmo(context, camera, state);
 			break;
 		case Falu::GizmoMode::Rotate:
-			RenderRotationGizmo(context, camera, position, rotation);
+			RenderRotationGizmo(context, camera, state);
 			break;
 		case Falu::GizmoMode::Scale:
-			RenderScaleGizmo(context, camera, position, rotation);
+			RenderScaleGizmo(context, camera, state);
 			break;
 		}
 	}
@@ -435,21 +444,23 @@ namespace Falu
 		return closestAxis;
 	}
 
-	void Gizmo::RenderTranslateGizmo(ID3D11DeviceContext* context, Camera* camera, 
-		const Math::Vector3& position, const DirectX::XMMATRIX& rotation)
+	void Gizmo::RenderTranslateGizmo(ID3D11DeviceContext* context, const CameraSnapshot& camera, 
+		const GizmoRenderState& state)
 	{
 		using namespace DirectX;
 
-		Math::Vector3 camPos = camera->GetTransform().GetPosition();
+		const Math::Vector3& position = state.position;
+		XMMATRIX rotation = XMLoadFloat4x4(&state.rotation);
+		const Math::Vector3& camPos = camera.position;
 		float distance = sqrtf(
 			(position.x - camPos.x) * (position.x - camPos.x) +
 			(position.y - camPos.y) * (position.y - camPos.y) +
 			(position.z - camPos.z) * (position.z - camPos.z)
 		);
-		float adjustedSize = m_size * distance * 0.1f;
+		float adjustedSize = state.size * distance * 0.1f;
 
 		// X red
-		Math::Color xColor = (m_selectedAxis == GizmoAxis::X) ? Math::Color(1, 1, 0, 1) : Math::Color(1, 0, 0, 1);
+		Math::Color xColor = (state.selectedAxis == GizmoAxis::X) ? Math::Color(1, 1, 0, 1) : Math::Color(1, 0, 0, 1);
 		XMVECTOR xDir = XMVector3TransformNormal(XMVectorSet(1, 0, 0, 0), rotation);
 		XMFLOAT3 xDirFloat;
 		XMStoreFloat3(&xDirFloat, xDir);
@@ -457,7 +468,7 @@ namespace Falu
 			xColor, adjustedSize);
 
 		// Y green
-		Math::Color yColor = (m_selectedAxis == GizmoAxis::Y) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 1, 0, 1);
+		Math::Color yColor = (state.selectedAxis == GizmoAxis::Y) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 1, 0, 1);
 		XMVECTOR yDir = XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotation);
 		XMFLOAT3 yDirFloat;
 		XMStoreFloat3(&yDirFloat, yDir);
@@ -465,7 +476,7 @@ namespace Falu
 			yColor, adjustedSize);
 
 		// Z blue
-		Math::Color zColor = (m_selectedAxis == GizmoAxis::Z) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 0, 1, 1);
+		Math::Color zColor = (state.selectedAxis == GizmoAxis::Z) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 0, 1, 1);
 		XMVECTOR zDir = XMVector3TransformNormal(XMVectorSet(0, 0, 1, 0), rotation);
 		XMFLOAT3 zDirFloat;
 		XMStoreFloat3(&zDirFloat, zDir);
@@ -473,52 +484,55 @@ namespace Falu
 			zColor, adjustedSize);
 	}
 
-	void Gizmo::RenderRotationGizmo(ID3D11DeviceContext* context, Camera* camera, 
-		const Math::Vector3& position, const DirectX::XMMATRIX& rotation)
+	void Gizmo::RenderRotationGizmo(ID3D11DeviceContext* context, const CameraSnapshot& camera, 
+		const GizmoRenderState& state)
 	{
 		using namespace DirectX;
 
-		Math::Vector3 camPos = camera->GetTransform().GetPosition();
+		const Math::Vector3& position = state.position;
+		const Math::Vector3& camPos = camera.position;
 		float distance = sqrtf(
 			(position.x - camPos.x) * (position.x - camPos.x) + 
 			(position.y - camPos.y) * (position.y - camPos.y) + 
 			(position.z - camPos.z) * (position.z - camPos.z)
 		);
-		float adjustedSize = m_size * distance * 0.15f;
+		float adjustedSize = state.size * distance * 0.15f;
 
 		// X Circle - YZ
 		
-		Math::Color xColor = (m_selectedAxis == GizmoAxis::X) ? Math::Color(1, 1, 0, 1) : Math::Color(1, 0, 0, 1);
+		Math::Color xColor = (state.selectedAxis == GizmoAxis::X) ? Math::Color(1, 1, 0, 1) : Math::Color(1, 0, 0, 1);
 		RenderCircle(context, camera, position, Math::Vector3(1, 0, 0), xColor, adjustedSize);
 
 		// Y Circle - XZ
-		Math::Color yColor = (m_selectedAxis == GizmoAxis::Y) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 1, 0, 1);
+		Math::Color yColor = (state.selectedAxis == GizmoAxis::Y) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 1, 0, 1);
 		RenderCircle(context, camera, position, Math::Vector3(0, 1, 0), yColor, adjustedSize);
 
 		// Z Circle - XY
-		Math::Color zColor = (m_selectedAxis == GizmoAxis::Z) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 0, 1, 1);
+		Math::Color zColor = (state.selectedAxis == GizmoAxis::Z) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 0, 1, 1);
 		RenderCircle(context, camera, position, Math::Vector3(0, 0, 1), zColor, adjustedSize);
 	}
 
-	void Gizmo::RenderScaleGizmo(ID3D11DeviceContext* context, Camera* camera, 
-		const Math::Vector3& position, const DirectX::XMMATRIX& rotation)
+	void Gizmo::RenderScaleGizmo(ID3D11DeviceContext* context, const CameraSnapshot& camera, 
+		const GizmoRenderState& state)
 	{
 		using namespace DirectX;
 
-		Math::Vector3 camPos = camera->GetTransform().GetPosition();
+		const Math::Vector3& position = state.position;
+		XMMATRIX rotation = XMLoadFloat4x4(&state.rotation);
+		const Math::Vector3& camPos = camera.position;
 		float distance = sqrtf(
 			(position.x - camPos.x) * (position.x - camPos.x) + 
 			(position.y - camPos.y) * (position.y - camPos.y) + 
 			(position.z - camPos.z) * (position.z - camPos.z)
 		);
-		float adjustedSize = m_size * distance * 0.1f;
+		float adjustedSize = state.size * distance * 0.1f;
 
 		// X Red
 		XMVECTOR xDir = XMVector3TransformNormal(XMVectorSet(1, 0, 0, 0), rotation);
 		XMFLOAT3 xDirFloat;
 		XMStoreFloat3(&xDirFloat, xDir);
 
-		Math::Color xColor = (m_selectedAxis == GizmoAxis::X) ? Math::Color(1, 1, 0, 1) : Math::Color(1,0,0,1);
+		Math::Color xColor = (state.selectedAxis == GizmoAxis::X) ? Math::Color(1, 1, 0, 1) : Math::Color(1,0,0,1);
 		RenderScaleAxis(context, camera, position, Math::Vector3(xDirFloat.x, xDirFloat.y, xDirFloat.z),
 			xColor,adjustedSize);
 
@@ -527,7 +541,7 @@ namespace Falu
 		XMFLOAT3 yDirFloat;
 		XMStoreFloat3(&yDirFloat, yDir);
 
-		Math::Color yColor = (m_selectedAxis == GizmoAxis::Y) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 1, 0, 1);
+		Math::Color yColor = (state.selectedAxis == GizmoAxis::Y) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 1, 0, 1);
 		RenderScaleAxis(context, camera, position, Math::Vector3(yDirFloat.x, yDirFloat.y, yDirFloat.z),
 			yColor, adjustedSize);
 
@@ -536,19 +550,19 @@ namespace Falu
 		XMFLOAT3 zDirFloat;
 		XMStoreFloat3(&zDirFloat, zDir);
 
-		Math::Color zColor = (m_selectedAxis == GizmoAxis::Z) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 0, 1, 1);
+		Math::Color zColor = (state.selectedAxis == GizmoAxis::Z) ? Math::Color(1, 1, 0, 1) : Math::Color(0, 0, 1, 1);
 		RenderScaleAxis(context, camera, position, Math::Vector3(zDirFloat.x, zDirFloat.y, zDirFloat.z),
 			zColor, adjustedSize);
 
 		if (m_cubeMesh)
 		{
-			Math::Color centerColor = (m_selectedAxis == GizmoAxis::XYZ) ?
+			Math::Color centerColor = (state.selectedAxis == GizmoAxis::XYZ) ?
 				Math::Color(1, 1, 0, 1) : Math::Color(1, 1, 1, 1);
 			RenderCube(context, camera, position, centerColor, adjustedSize * 0.1f);
 		}
 	}
 
-	void Gizmo::RenderAxis(ID3D11DeviceContext* context, Camera* camera, 
+	void Gizmo::RenderAxis(ID3D11DeviceContext* context, const CameraSnapshot& camera, 
 		const Math::Vector3& position, const Math::Vector3& direction, const Math::Color& color, float length)
 	{
 		using namespace DirectX;
@@ -607,7 +621,7 @@ namespace Falu
 		GizmoConstantBuffer cb;
 		XMStoreFloat4x4(&cb.world, XMMatrixTranspose(worldMatrix));
 		XMStoreFloat4x4(&cb.viewProjection,
-			XMMatrixTranspose(camera->GetViewProjectionMatrix()));
+			XMMatrixTranspose(XMLoadFloat4x4(&camera.viewProjection)));
 		cb.color = XMFLOAT4(color.r, color.g, color.b, color.a);
 
 		D3D11_MAPPED_SUBRESOURCE mappedResource;
@@ -626,7 +640,7 @@ namespace Falu
 		m_arrowMesh->Render(context);
 	}
 
-	void Gizmo::RenderCircle(ID3D11DeviceContext* context, Camera* camera, const Math::Vector3& position, const Math::Vector3& normal, const Math::Color& color, float radius)
+	void Gizmo::RenderCircle(ID3D11DeviceContext* context, const CameraSnapshot& camera, const Math::Vector3& position, const Math::Vector3& normal, const Math::Color& color, float radius)
 	{
 		using namespace DirectX;
 
@@ -673,7 +687,7 @@ namespace Falu
 		}
 	}
 
-	void Gizmo::RenderScaleAxis(ID3D11DeviceContext* context, Camera* camera, const Math::Vector3& position, const Math::Vector3& direction, const Math::Color& color, float length)
+	void Gizmo::RenderScaleAxis(ID3D11DeviceContext* context, const CameraSnapshot& camera, const Math::Vector3& position, const Math::Vector3& direction, const Math::Color& color, float length)
 	{
 		using namespace DirectX;
 
@@ -690,7 +704,7 @@ namespace Falu
 		RenderCube(context, camera, endPos, color, length * 0.08f);
 	}
 
-	void Gizmo::RenderLine(ID3D11DeviceContext* context, Camera* camera, const Math::Vector3& start, const Math::Vector3& end, const Math::Color& color, float thickness)
+	void Gizmo::RenderLine(ID3D11DeviceContext* context, const CameraSnapshot& camera, const Math::Vector3& start, const Math::Vector3& end, const Math::Color& color, float thickness)
 	{
 		using namespace DirectX;
 
@@ -749,7 +763,7 @@ namespace Falu
 		GizmoConstantBuffer cb;
 		XMStoreFloat4x4(&cb.world, XMMatrixTranspose(worldMatrix));
 		XMStoreFloat4x4(&cb.viewProjection,
-			XMMatrixTranspose(camera->GetViewProjectionMatrix()));
+			XMMatrixTranspose(XMLoadFloat4x4(&camera.viewProjection)));
 		cb.color = XMFLOAT4(color.r, color.g, color.b, color.a);
 
 		D3D11_MAPPED_SUBRESOURCE mappedResource;
@@ -766,7 +780,7 @@ namespace Falu
 		m_arrowMesh->Render(context);
 	}
 
-	void Gizmo::RenderCube(ID3D11DeviceContext* context, Camera* camera, const Math::Vector3& position, const Math::Color& color, float size)
+	void Gizmo::RenderCube(ID3D11DeviceContext* context, const CameraSnapshot& camera, const Math::Vector3& position, const Math::Color& color, float size)
 	{
 		using namespace DirectX;
 
@@ -779,7 +793,7 @@ namespace Falu
 		GizmoConstantBuffer cb;
 		XMStoreFloat4x4(&cb.world, XMMatrixTranspose(worldMatrix));
 		XMStoreFloat4x4(&cb.viewProjection,
-			XMMatrixTranspose(camera->GetViewProjectionMatrix()));
+			XMMatrixTranspose(XMLoadFloat4x4(&camera.viewProjection)));
 		cb.color = XMFLOAT4(color.r, color.g, color.b, color.a);
 
 		D3D11_MAPPED_SUBRESOURCE mappedResource;
@@ -21,6 +21,7 @@ namespace Falu
 	class Mesh;
 	class Shader;
 	class Camera;
+	struct CameraSnapshot;
 
 	// Gizmo Control mode
 	enum class GizmoMode
@@ -49,6 +50,17 @@ namespace Falu
 		XYZ = X | Y | Z
 	};
 
+	// `XbhgMỸXibvVbg
+	struct GizmoRenderState
+	{
+		bool visible = false;
+		GizmoMode mode = GizmoMode::Translate;
+		GizmoAxis selectedAxis = GizmoAxis::None;
+		float size = 1.0f;
+		Math::Vector3 position;
+		DirectX::XMFLOAT4X4 rotation;
+	};
+
 	class Gizmo
 	{
 	public:
@@ -56,7 +68,8 @@ namespace Falu
 		~Gizmo();
 
 		bool Initialize(ID3D11Device* device);
-		void Render(ID3D11DeviceContext* context, Camera* camera, GameObject* target);
+		void ExtractRenderState(GameObject* target, GizmoRenderState& state) const;
+		void Render(ID3D11DeviceContext* context, const CameraSnapshot& camera, const GizmoRenderState& state);
 
 		// Change Mode
 		void SetMode(GizmoMode mode) { m_mode = mode; }
@@ -112,30 +125,30 @@ namespace Falu
 		};
 		ComPtr<ID3D11Buffer> m_constantBuffer;
 
-		void RenderTranslateGizmo(ID3D11DeviceContext* context, Camera* camera,
-			const Math::Vector3& position, const DirectX::XMMATRIX& rotation);
-		void RenderRotationGizmo(ID3D11DeviceContext* context, Camera* camera,
-			const Math::Vector3& position, const DirectX::XMMATRIX& rotation);
-		void RenderScaleGizmo(ID3D11DeviceContext* context, Camera* camera,
-			const Math::Vector3& position, const DirectX::XMMATRIX& rotation);
+		void RenderTranslateGizmo(ID3D11DeviceContext* context, const CameraSnapshot& camera,
+			const GizmoRenderState& state);
+		void RenderRotationGizmo(ID3D11DeviceContext* context, const CameraSnapshot& camera,
+			const GizmoRenderState& state);
+		void RenderScaleGizmo(ID3D11DeviceContext* context, const CameraSnapshot& camera,
+			const GizmoRenderState& state);
 
-		void RenderAxis(ID3D11DeviceContext* context, Camera* camera,
+		void RenderAxis(ID3D11DeviceContext* context, const CameraSnapshot& camera,
 			const Math::Vector3& position, const Math::Vector3& direction,
 			const Math::Color& color,float length);
 
-		void RenderCircle(ID3D11DeviceContext* context, Camera* camera,
+		void RenderCircle(ID3D11DeviceContext* context, const CameraSnapshot& camera,
 			const Math::Vector3& position, const Math::Vector3& normal,
 			const Math::Color& color, float radius);
 
-		void RenderScaleAxis(ID3D11DeviceContext* context, Camera* camera,
+		void RenderScaleAxis(ID3D11DeviceContext* context, const CameraSnapshot& camera,
 			const Math::Vector3& position, const Math::Vector3& direction,
 			const Math::Color& color, float length);
 
-		void RenderLine(ID3D11DeviceContext* context, Camera* camera,
+		void RenderLine(ID3D11DeviceContext* context, const CameraSnapshot& camera,
 			const Math::Vector3& start, const Math::Vector3& end,
 			const Math::Color& color, float thickness);
 
-		void RenderCube(ID3D11DeviceContext* context, Camera* camera,
+		void RenderCube(ID3D11DeviceContext* context, const CameraSnapshot& camera,
 			const Math::Vector3& position, 
 			const Math::Color& color, float size);
 
@@ -10,6 +10,8 @@
 #include "imgui_impl_win32.h"
 #include "imgui_impl_dx11.h"
 
+// Scene ̃wb_[ DirectXMath ǂ݁AMath  XMMATRIX ϊLɂ
+#include "Include/Math/MathHelper.h"
 #include "Scene/SceneManager.h"
 #include "Scene/GameObject.h"
 #include "Scene/Transform.h"
@@ -24,6 +26,89 @@
 
 namespace Falu
 {
+	//=== ImGuiDrawSnapshot ===
+	namespace
+	{
+		template<typename T>
+		void CopyImVector(ImVector<T>& dst, const ImVector<T>& src)
+		{
+			// ImVector::operator= ƈႢAresize ͗eʂc
+			dst.resize(src.Size);
+			if (src.Size > 0)
+			{
+				memcpy(dst.Data, src.Data, (size_t)src.Size * sizeof(T));
+			}
+		}
+	}
+
+	ImGuiDrawSnapshot::ImGuiDrawSnapshot()
+		: m_drawData(std::make_unique<ImDrawData>())
+		, m_hasTextureRequests(false)
+	{
+	}
+
+	ImGuiDrawSnapshot::~ImGuiDrawSnapshot()
+	{
+		for (ImDrawList* list : m_drawLists)
+		{
+			IM_DELETE(list);
+		}
+		m_drawLists.clear();
+	}
+
+	void ImGuiDrawSnapshot::Capture(const ImDrawData* source)
+	{
+		Clear();
+		if (!source || !source->Valid)
+			return;
+
+		while ((int)m_drawLists.size() < source->CmdListsCount)
+		{
+			m_drawLists.push_back(IM_NEW(ImDrawList)(source->CmdLists[0]->_Data));
+		}
+
+		for (int i = 0; i < source->CmdListsCount; ++i)
+		{
+			const ImDrawList* src = source->CmdLists[i];
+			ImDrawList* dst = m_drawLists[i];
+			CopyImVector(dst->CmdBuffer, src->CmdBuffer);
+			CopyImVector(dst->IdxBuffer, src->IdxBuffer);
+			CopyImVector(dst->VtxBuffer, src->VtxBuffer);
+			dst->Flags = src->Flags;
+			m_drawData->CmdLists.push_back(dst);
+		}
+
+		m_drawData->Valid = true;
+		m_drawData->CmdListsCount = source->CmdListsCount;
+		m_drawData->TotalIdxCount = source->TotalIdxCount;
+		m_drawData->TotalVtxCount = source->TotalVtxCount;
+		m_drawData->DisplayPos = source->DisplayPos;
+		m_drawData->DisplaySize = source->DisplaySize;
+		m_drawData->FramebufferScale = source->FramebufferScale;
+
+		// eNX`̃Xg ImGui ̃ReLXgɂBGẂA̗vЕt܂
+		// V~[VXbh ImGui t[n߂ȂƂۏ؂Ă
+		m_drawData->Textures = source->Textures;
+		if (source->Textures)
+		{
+			for (ImTextureData* tex : *source->Textures)
+			{
+				if (tex->Status != ImTextureStatus_OK)
+				{
+					m_hasTextureRequests = true;
+					break;
+				}
+			}
+		}
+	}
+
+	void ImGuiDrawSnapshot::Clear()
+	{
+		m_drawData->Clear();
+		m_hasTextureRequests = false;
+	}
+
+	//=== ImGuiManager ===
 	ImGuiManager::ImGuiManager()
 		:m_initialized(false)
 		,m_selectedObject(nullptr)
@@ -167,9 +252,18 @@ namespace Falu
 		ImGui::Render();
 	}
 
-	void ImGuiManager::Render()
+	void ImGuiManager::CaptureDrawData(ImGuiDrawSnapshot& snapshot) const
 	{
-		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+		snapshot.Capture(ImGui::GetDrawData());
+	}
+
+	void ImGuiManager::Render(const ImGuiDrawSnapshot& snapshot)
+	{
+		ImDrawData* drawData = snapshot.GetDrawData();
+		if (drawData && drawData->Valid)
+		{
+			ImGui_ImplDX11_RenderDrawData(drawData);
+		}
 	}
 
 	void ImGuiManager::ShowDebugWindow(bool* open, float fps, float deltaTime)
@@ -186,6 +280,43 @@ namespace Falu
 
 		ImGui::Text("Application avarage %.3f ms/frame (%.1f FPS)",
 			1000.0f / fps, fps);
+
+		// `XbhŌɕ`t[̓v
+		if (Renderer* renderer = Engine::GetInstance().GetRenderer())
+		{
+			ImGui::Separator();
+			BindStats bindStats = renderer->GetLastFrameBindStats();
+			ImGui::Text("Binds: %u issued / %u skipped", bindStats.issued, bindStats.skipped);
+
+			Meshlets::CullStats meshletStats = renderer->GetLastFrameMeshletStats();
+			if (meshletStats.meshletCount > 0)
+			{
+				ImGui::Text("Meshlets: %u / %u visible (frustum %u, backface %u)",
+					meshletStats.GetVisibleCount(), meshletStats.meshletCount,
+					meshletStats.frustumCulled, meshletStats.backfaceCulled);
+			}
+
+			LightClusterStats clusterStats = renderer->GetLastFrameLightClusterStats();
+			if (clusterStats.lightCount > 0)
+			{
+				ImGui::Text("Clustered lights: %u (%u indices, max %u per cluster)",
+					clusterStats.lightCount, clusterStats.indexCount, clusterStats.maxClusterLights);
+			}
+
+			uint32_t shadowCasters = renderer->GetLastFrameShadowCasterCount();
+			if (shadowCasters > 0)
+			{
+				ImGui::Text("Shadow casters: %u draws", shadowCasters);
+			}
+
+			OcclusionStats occlusionStats = renderer->GetLastFrameOcclusionStats();
+			if (occlusionStats.occluderCount > 0)
+			{
+				ImGui::Text("Occlusion: %u / %u culled (%u occluders, %u triangles)",
+					occlusionStats.culledCount, occlusionStats.testedCount,
+					occlusionStats.occluderCount, occlusionStats.triangleCount);
+			}
+		}
 		ImGui::End();
 	}
 
@@ -227,9 +358,9 @@ namespace Falu
 
 			// Add MeshRenderer
 			auto meshRenderer = newObj->AddComponent<MeshRenderer>();
-			auto mesh = Mesh::CreateCube(device);
+			auto mesh = Mesh::CreateCube(device, MeshCpuAccess::Raycast);
 			meshRenderer->SetMesh(mesh);
-			newObj->SetBounds(mesh->CalculateBounds());
+			newObj->SetBounds(mesh->GetBounds());
 
 			// Set tentative Material
 			auto material = std::make_shared<Material>();
@@ -9,6 +9,10 @@
 
 #include <d3d11.h>
 #include <memory>
+#include <vector>
+
+struct ImDrawData;
+struct ImDrawList;
 
 namespace Falu
 {
@@ -16,6 +20,30 @@ namespace Falu
 	class Transform;
 	class Light;
 
+	// ImGui ̕`f[^̐[Rs[BV~[VXbh UI t[ĂԂ
+	// `Xbh`悤ɂ
+	class ImGuiDrawSnapshot
+	{
+	public:
+		ImGuiDrawSnapshot();
+		~ImGuiDrawSnapshot();
+		ImGuiDrawSnapshot(const ImGuiDrawSnapshot&) = delete;
+		ImGuiDrawSnapshot& operator=(const ImGuiDrawSnapshot&) = delete;
+
+		void Capture(const ImDrawData* source);
+		void Clear();
+
+		ImDrawData* GetDrawData() const { return m_drawData.get(); }
+
+		// 荞񂾃t[obNGhɃtHgeNX`̍쐬/XV߂Ă true
+		bool HasTextureRequests() const { return m_hasTextureRequests; }
+
+	private:
+		std::unique_ptr<ImDrawData> m_drawData;
+		std::vector<ImDrawList*> m_drawLists;	// 荞݂̂тɎg
+		bool m_hasTextureRequests;
+	};
+
 	class ImGuiManager
 	{
 	public:
@@ -27,7 +55,8 @@ namespace Falu
 
 		void BeginFrame();
 		void EndFrame();
-		void Render();
+		void CaptureDrawData(ImGuiDrawSnapshot& snapshot) const;
+		void Render(const ImGuiDrawSnapshot& snapshot);
 
 		// fobO\p
 		void ShowDebugWindow(bool* open, float fps, float deltaTime);
@@ -0,0 +1,129 @@
+/*****************************************************************//**
+ * \file   MappedFile.cpp
+ * \brief  MappedFile ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Falu
+{
+	MappedFile::MappedFile()
+		: m_data(nullptr)
+		, m_size(0)
+#ifdef _WIN32
+		, m_file(INVALID_HANDLE_VALUE)
+		, m_mapping(nullptr)
+#else
+		, m_file(-1)
+#endif
+	{
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+#ifdef _WIN32
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		int length = MultiByteToWideChar(CP_UTF8, 0, filepath.c_str(), static_cast<int>(filepath.length()), nullptr, 0);
+		std::wstring wfilepath(length, L'\0');
+		MultiByteToWideChar(CP_UTF8, 0, filepath.c_str(), static_cast<int>(filepath.length()), wfilepath.data(), length);
+
+		m_file = CreateFileW(wfilepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+
+		m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m_mapping)
+		{
+			Close();
+			return false;
+		}
+
+		m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!m_data)
+		{
+			Close();
+			return false;
+		}
+		m_size = static_cast<size_t>(size.QuadPart);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_data)
+			UnmapViewOfFile(m_data);
+		if (m_mapping)
+			CloseHandle(m_mapping);
+		if (m_file != INVALID_HANDLE_VALUE)
+			CloseHandle(m_file);
+
+		m_data = nullptr;
+		m_size = 0;
+		m_mapping = nullptr;
+		m_file = INVALID_HANDLE_VALUE;
+	}
+#else
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		m_file = open(filepath.c_str(), O_RDONLY);
+		if (m_file < 0)
+			return false;
+
+		struct stat status;
+		if (fstat(m_file, &status) != 0 || status.st_size == 0)
+		{
+			Close();
+			return false;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, m_file, 0);
+		if (data == MAP_FAILED)
+		{
+			Close();
+			return false;
+		}
+		m_data = static_cast<const uint8_t*>(data);
+		m_size = static_cast<size_t>(status.st_size);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_data)
+			munmap(const_cast<uint8_t*>(m_data), m_size);
+		if (m_file >= 0)
+			close(m_file);
+
+		m_data = nullptr;
+		m_size = 0;
+		m_file = -1;
+	}
+#endif
+}
@@ -0,0 +1,44 @@
+/*****************************************************************//**
+ * \file   MappedFile.h
+ * \brief  t@CŜ̓ǂݎp̃}bv
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Falu
+{
+	// IuWFNgĂԁAt@CǂݎpŃ}bvBy[W͍ŏɐGꂽƂɓǂݍ܂̂ŁA
+	// I/O ͎̂gBWin32 ̃t@C}bsOAȊOł mmap
+	class MappedFile
+	{
+	public:
+		MappedFile();
+		~MappedFile();
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// filepath  UTF-8Bt@CȂȂ false
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const { return m_data != nullptr; }
+		const uint8_t* GetData() const { return m_data; }
+		size_t GetSize() const { return m_size; }
+
+	private:
+		const uint8_t* m_data;
+		size_t m_size;
+#ifdef _WIN32
+		void* m_file;
+		void* m_mapping;
+#else
+		int m_file;
+#endif
+	};
+}
@@ -0,0 +1,71 @@
+/*****************************************************************//**
+ * \file   TripleBuffer.h
+ * \brief  bNȂ̃gvobt@( 1 XbhAǂݍ 1 Xbh)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Falu
+{
+	// 3 ̃Xbg 1 ̃Ag~bNȌŉ񂷁B
+	// ݑ͏݃XbgAǂݍݑ͓ǂݍ݃XbgAc 1 󂯓nɎgB
+	// ǂ̑҂Ȃ
+	template<typename T>
+	class TripleBuffer
+	{
+	public:
+		TripleBuffer()
+			: m_writeIndex(0)
+			, m_readIndex(1)
+			, m_shared(2)
+		{
+		}
+
+		TripleBuffer(const TripleBuffer&) = delete;
+		TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+		//=== Producer ===
+		T& GetWriteBuffer() { return m_buffers[m_writeIndex]; }
+
+		// ݃Xbgǂݍݑ֓nA󂯓np̃Xbg
+		void Publish()
+		{
+			uint32_t previous = m_shared.exchange(m_writeIndex | kPendingBit, std::memory_order_acq_rel);
+			m_writeIndex = previous & kIndexMask;
+		}
+
+		// ŌɓnXbg܂󂯎ĂȂ true
+		bool HasPending() const
+		{
+			return (m_shared.load(std::memory_order_acquire) & kPendingBit) != 0;
+		}
+
+		//=== Consumer ===
+		// ŐV̓nꂽXbgƓւBVnꂽ̂Ȃ false
+		bool Acquire()
+		{
+			if ((m_shared.load(std::memory_order_acquire) & kPendingBit) == 0)
+				return false;
+
+			uint32_t previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+			m_readIndex = previous & kIndexMask;
+			return true;
+		}
+
+		const T& GetReadBuffer() const { return m_buffers[m_readIndex]; }
+
+	private:
+		static constexpr uint32_t kIndexMask = 0x3;
+		static constexpr uint32_t kPendingBit = 0x4;
+
+		T m_buffers[3];
+		uint32_t m_writeIndex;				// ݑg
+		uint32_t m_readIndex;				// ǂݍݑg
+		std::atomic<uint32_t> m_shared;		// 󂯓nXbg̔ԍ | 󂯎rbg
+	};
+}
@@ -18,6 +18,7 @@
 #include "Renderer/Shader.h"
 #include "Renderer/Light.h"
 #include "Renderer/Texture.h"
+#include "Renderer/ModelLoader.h"
 
 using namespace Falu;
 
@@ -41,8 +42,6 @@ public:
 			100.0f
 		);
 		SetMainCamera(m_camera);
-		// _[ɃJݒ
-		Engine::GetInstance().GetRenderer()->SetCamera(m_camera);
 
 		// Cg̍쐬
 		Light* mainLight = LightManager::GetInstance().CreateLight(LightType::Directional);
@@ -81,6 +80,28 @@ public:
 			_countof(layout)
 		);
 
+		// }eAe[u(}eA܂ł܂Ƃ߂ĕ`ł)
+		Shader* tableShader = ShaderManager::GetInstance().LoadShader(
+			device,
+			"Basic_MaterialTable",
+			L"Shaders/HLSL/Basic.hlsl",
+			L"Shaders/HLSL/Basic.hlsl",
+			layout,
+			_countof(layout),
+			{ { "MATERIAL_TABLE", "1" } }
+		);
+		if (m_shader && tableShader)
+			m_shader->SetMaterialTableVariant(tableShader);
+
+		// RpNg_(ǂݍ񂾃fg)
+		ShaderManager::GetInstance().LoadVertexVariants(device, m_shader, "Basic",
+			L"Shaders/HLSL/Basic.hlsl", L"Shaders/HLSL/Basic.hlsl");
+		ShaderManager::GetInstance().LoadVertexVariants(device, tableShader, "Basic_MaterialTable",
+			L"Shaders/HLSL/Basic.hlsl", L"Shaders/HLSL/Basic.hlsl", { { "MATERIAL_TABLE", "1" } });
+		ModelLoader::GetInstance().SetDefaultShader(m_shader);
+		// NbNOp`Pʂōs߁AǂݍރbV BVH 点
+		ModelLoader::GetInstance().SetCpuAccess(MeshCpuAccess::Raycast);
+
 		// }eA̍쐬
 		m_material = std::make_shared<Material>();
 		m_material->Initialize(device);
@@ -103,7 +124,7 @@ public:
 			m_material->SetAlbedoTexture(texture);
 		}
 
-		m_mesh = Mesh::CreateCube(device);
+		m_mesh = Mesh::CreateCube(device, MeshCpuAccess::Raycast);
 
 		m_cubeObject = CreateGameObject("Cube");
 		auto meshRenderer = m_cubeObject->AddComponent<MeshRenderer>();
@@ -176,7 +197,6 @@ public:
 			100.0f
 		);
 		SetMainCamera(m_camera);
-		Engine::GetInstance().GetRenderer()->SetCamera(m_camera);
 
 		// Create Light
 		Light* mainLight = LightManager::GetInstance().CreateLight(LightType::Directional);
@@ -204,6 +224,39 @@ public:
 			layout,ARRAYSIZE(layout)
 		);
 
+		// }eAe[up̃oAg
+		Shader* tableShader = ShaderManager::GetInstance().LoadShader(
+			device,"Basic_MaterialTable",
+			L"Shaders/HLSL/Basic.hlsl",
+			L"Shaders/HLSL/Basic.hlsl",
+			layout,ARRAYSIZE(layout),
+			{ { "MATERIAL_TABLE", "1" } }
+		);
+		if (shader && tableShader)
+			shader->SetMaterialTableVariant(tableShader);
+
+		// RpNg_p̃oAg(C|[gfg)
+		ShaderManager::GetInstance().LoadVertexVariants(device, shader, "Basic",
+			L"Shaders/HLSL/Basic.hlsl", L"Shaders/HLSL/Basic.hlsl");
+		ShaderManager::GetInstance().LoadVertexVariants(device, tableShader, "Basic_MaterialTable",
+			L"Shaders/HLSL/Basic.hlsl", L"Shaders/HLSL/Basic.hlsl", { { "MATERIAL_TABLE", "1" } });
+		ModelLoader::GetInstance().SetDefaultShader(shader);
+		// sbLOoEfBO{bNXł͂ȂOp`ɓ悤 BVH 
+		ModelLoader::GetInstance().SetCpuAccess(MeshCpuAccess::Raycast);
+
+		// ^ォ猩sN`[CsN`[̃r[(V Ő؂ւ)
+		float aspectRatio = Engine::GetInstance().GetWindow()->GetAspectRatio();
+		m_topCamera = new Camera();
+		m_topCamera->GetTransform().SetPosition(0, 20, 0);
+		m_topCamera->GetTransform().SetRotation(Math::ToRadians(90.0f), 0, 0);
+		m_topCamera->SetOrthographic(12.0f * aspectRatio, 12.0f, 0.1f, 50.0f);
+
+		RenderViewDesc topView;
+		topView.camera = m_topCamera;
+		topView.viewport = ViewportRect(0.7f, 0.05f, 0.25f, 0.25f);
+		topView.enabled = false;
+		m_topViewIndex = AddView(topView);
+
 		// Create Multiple Cube
 		m_redCube = CreateCube(device, shader, "RedCube", Math::Vector3(-3, 0, 0), Math::Color(1, 0, 0, 1));
 		m_greenCube = CreateCube(device, shader, "GreenCube", Math::Vector3(0, 0, 0), Math::Color(0, 1, 0, 1));
@@ -225,6 +278,12 @@ public:
 		Scene::Update(deltaTime);
 
 		auto input = Engine::GetInstance().GetInputManager();
+
+		if (input->IsKeyPressed(KeyCode::V))
+		{
+			RenderViewDesc& topView = GetView(m_topViewIndex);
+			topView.enabled = !topView.enabled;
+		}
 		
 		// Object Animation
 		static float time = 0.0f;
@@ -266,6 +325,9 @@ public:
 	{
 		delete m_camera;
 		m_camera = nullptr;
+		ClearViews();
+		delete m_topCamera;
+		m_topCamera = nullptr;
 
 		m_redCube = m_greenCube = m_blueCube = nullptr;
 		m_yellowSphere = m_cyanSphere = m_magentaSphere = nullptr;
@@ -280,10 +342,10 @@ private:
 		obj->GetTransform().SetPosition(position);
 
 		auto meshRenderer = obj->AddComponent<MeshRenderer>();
-		auto mesh = Mesh::CreateCube(device);
+		auto mesh = Mesh::CreateCube(device, MeshCpuAccess::Raycast);
 		meshRenderer->SetMesh(mesh);
 
-		obj->SetBounds(mesh->CalculateBounds());
+		obj->SetBounds(mesh->GetBounds());
 
 		auto material = std::make_shared<Material>();
 		material->Initialize(device);
@@ -307,7 +369,7 @@ private:
 		obj->GetTransform().SetPosition(position);
 
 		auto meshRenderer = obj->AddComponent<MeshRenderer>();
-		auto mesh = Mesh::CreateSphere(device,32);
+		auto mesh = Mesh::CreateSphere(device, 32, MeshCpuAccess::Raycast);
 		meshRenderer->SetMesh(mesh);
 
 		auto material = std::make_shared<Material>();
@@ -332,7 +394,7 @@ private:
 		obj->GetTransform().SetPosition(position);
 
 		auto meshRenderer = obj->AddComponent<MeshRenderer>();
-		auto mesh = Mesh::CreatePlane(device,10.0f,10.0f,10);
+		auto mesh = Mesh::CreatePlane(device, 10.0f, 10.0f, 10, MeshCpuAccess::Raycast);
 		meshRenderer->SetMesh(mesh);
 
 		auto material = std::make_shared<Material>();
@@ -348,6 +410,8 @@ private:
 	}
 private:
 	Camera* m_camera = nullptr;
+	Camera* m_topCamera = nullptr;
+	size_t m_topViewIndex = 0;
 	GameObject* m_redCube = nullptr;
 	GameObject* m_greenCube = nullptr;
 	GameObject* m_blueCube = nullptr;
@@ -10,7 +10,10 @@
 namespace Falu
 {
 	Camera::Camera()
-		:m_projectionType(ProjectionType::Perspective)
+		:m_projectionVersion(0)
+		,m_cacheVersion(0)
+		,m_cacheValid(false)
+		,m_projectionType(ProjectionType::Perspective)
 		,m_fov(Math::ToRadians(60.0f))
 		,m_aspectRatio(16.0f/9.0f)
 		,m_nearZ(0.1f)
@@ -58,27 +61,52 @@ namespace Falu
 
 	DirectX::XMMATRIX Camera::GetViewMatrix() const
 	{
-		using namespace DirectX;
+		ValidateCache();
+		return m_viewMatrix;
+	}
 
-		Math::Vector3 pos = m_transform.GetPosition();
-		Math::Vector3 forward = m_transform.GetForward();
-		Math::Vector3 up = m_transform.GetUp();
+	DirectX::XMMATRIX Camera::GetViewProjectionMatrix() const
+	{
+		ValidateCache();
+		return m_viewProjectionMatrix;
+	}
 
-		XMVECTOR eyePosition = XMVectorSet(pos.x, pos.y, pos.z,1.0f);
-		XMVECTOR focusPosition = XMVectorSet(
-			pos.x + forward.x,
-			pos.y + forward.y,
-			pos.z + forward.z,
-			1.0f
-		);
+	DirectX::XMMATRIX Camera::GetInverseViewProjectionMatrix() const
+	{
+		ValidateCache();
+		return m_inverseViewProjectionMatrix;
+	}
 
-		XMVECTOR upDirection = XMVectorSet(up.x, up.y, up.z, 0.0f);
-		return XMMatrixLookAtLH(eyePosition,focusPosition,upDirection);
+	const Math::Frustum& Camera::GetFrustum() const
+	{
+		ValidateCache();
+		return m_frustum;
 	}
 
-	DirectX::XMMATRIX Camera::GetViewProjectionMatrix() const
+	void Camera::ValidateCache() const
 	{
-		return GetViewMatrix() * m_projectionMatrix;
+		using namespace DirectX;
+
+		uint32_t version = GetVersion();
+		if (m_cacheValid && m_cacheVersion == version)
+			return;
+
+		Math::Vector3 pos = m_transform.GetPosition();
+		const Transform::Directions& directions = m_transform.GetDirections();
+		const Math::Vector3& forward = directions.forward;
+		const Math::Vector3& up = directions.up;
+
+		XMVECTOR eyePosition = XMVectorSet(pos.x, pos.y, pos.z, 1.0f);
+		XMVECTOR eyeDirection = XMVectorSet(forward.x, forward.y, forward.z, 0.0f);
+		XMVECTOR upDirection = XMVectorSet(up.x, up.y, up.z, 0.0f);
+
+		m_viewMatrix = XMMatrixLookToLH(eyePosition, eyeDirection, upDirection);
+		m_viewProjectionMatrix = m_viewMatrix * m_projectionMatrix;
+		m_inverseViewProjectionMatrix = XMMatrixInverse(nullptr, m_viewProjectionMatrix);
+		m_frustum = Math::Frustum::FromMatrix(Math::Matrix4::FromXMMATRIX(m_viewProjectionMatrix));
+
+		m_cacheVersion = version;
+		m_cacheValid = true;
 	}
 
 	void Camera::LookAt(const Math::Vector3& target)
@@ -117,32 +145,17 @@ namespace Falu
 
 	void Camera::MoveForward(float distance)
 	{
-		Math::Vector3 forward = m_transform.GetForward();
-		m_transform.Translate(Math::Vector3(
-			forward.x * distance,
-			forward.y * distance,
-			forward.z * distance
-		));
+		m_transform.Translate(m_transform.GetForward() * distance);
 	}
 
 	void Camera::MoveRight(float distance)
 	{
-		Math::Vector3 right = m_transform.GetRight();
-		m_transform.Translate(Math::Vector3(
-			right.x * distance,
-			right.y * distance,
-			right.z * distance
-		));
+		m_transform.Translate(m_transform.GetRight() * distance);
 	}
 
 	void Camera::MoveUp(float distance)
 	{
-		Math::Vector3 up = m_transform.GetUp();
-		m_transform.Translate(Math::Vector3(
-			up.x * distance,
-			up.y * distance,
-			up.z * distance
-		));
+		m_transform.Translate(m_transform.GetUp() * distance);
 	}
 
 	void Camera::Rotate(float deltaPithch, float deltaYaw)
@@ -178,10 +191,7 @@ namespace Falu
 		XMVECTOR nearPoint = XMVectorSet(ndcX, ndcY, 0.0f, 1.0f);
 		XMVECTOR farPoint = XMVectorSet(ndcX, ndcY, 1.0f, 1.0f);
 
-		XMMATRIX viewMatrix = GetViewMatrix();
-		XMMATRIX projectionMatrix = m_projectionMatrix;
-		XMMATRIX viewProjMatrix = viewMatrix * projectionMatrix;
-		XMMATRIX invViewProj = XMMatrixInverse(nullptr, viewProjMatrix);
+		XMMATRIX invViewProj = GetInverseViewProjectionMatrix();
 
 		// NDC Convert to WorldPosition
 		nearPoint = XMVector3TransformCoord(nearPoint, invViewProj);
@@ -212,5 +222,6 @@ namespace Falu
 		{
 			m_projectionMatrix = XMMatrixOrthographicLH(m_orthoWidth, m_orthoHeight, m_nearZ, m_farZ);
 		}
+		++m_projectionVersion;
 	}
 }
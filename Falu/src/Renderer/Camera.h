@@ -10,6 +10,7 @@
 #include <DirectXMath.h>
 #include "Include/Math/MathHelper.h"
 #include "Include/Math/Ray.h"
+#include "Include/Math/Frustum.h"
 #include "Scene/Transform.h"
 
 namespace Falu
@@ -36,9 +37,16 @@ namespace Falu
 		void SetAspectRatio(float aspectRatio);
 
 		//=== Matrices ===
+		// r[n̓gXtH[ˉeςƂvZ(ȊO̓LbVԂ)
 		DirectX::XMMATRIX GetViewMatrix() const;
 		DirectX::XMMATRIX GetProjectionMatrix() const { return m_projectionMatrix; }
 		DirectX::XMMATRIX GetViewProjectionMatrix() const;
+		DirectX::XMMATRIX GetInverseViewProjectionMatrix() const;
+		// [hԂ̎(6)
+		const Math::Frustum& GetFrustum() const;
+
+		// gXtH[ˉeςƑ
+		uint32_t GetVersion() const { return m_transform.GetVersion() + m_projectionVersion; }
 
 		//=== Camera controls ===
 		void LookAt(const Math::Vector3& target);
@@ -68,10 +76,21 @@ namespace Falu
 
 	private:
 		void UpdateProjectionMatrix();
+		// LbVÂ΍蒼
+		void ValidateCache() const;
 
 	private:
 		Transform m_transform;
 		DirectX::XMMATRIX m_projectionMatrix;
+		uint32_t m_projectionVersion;
+
+		//=== LbV(GetVersion()  m_cacheVersion ƓԗL) ===
+		mutable DirectX::XMMATRIX m_viewMatrix;
+		mutable DirectX::XMMATRIX m_viewProjectionMatrix;
+		mutable DirectX::XMMATRIX m_inverseViewProjectionMatrix;
+		mutable Math::Frustum m_frustum;
+		mutable uint32_t m_cacheVersion;
+		mutable bool m_cacheValid;
 
 		//=== xp[^ ===
 		float m_rotateSensitivity = 0.003f;
@@ -0,0 +1,41 @@
+/*****************************************************************//**
+ * \file   CommandRecorder.cpp
+ * \brief  CommandRecorder ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "CommandRecorder.h"
+#include "Falu/JobSystem.h"
+
+#include <algorithm>
+
+namespace Falu
+{
+	//=== NullCommandRecorder ===
+	NullCommandRecorder::NullCommandRecorder(uint32_t maxChunks)
+		: m_maxChunks(maxChunks)
+		, m_recordedChunks(0)
+	{
+	}
+
+	void NullCommandRecorder::Record(uint32_t chunkCount, const RecordChunkFunc& record)
+	{
+		m_recordedChunks = std::min(chunkCount, m_maxChunks);
+
+		JobSystem::GetInstance().ParallelFor(m_recordedChunks, [&](uint32_t chunk)
+		{
+			record(chunk, nullptr);
+		});
+	}
+
+	void NullCommandRecorder::Execute()
+	{
+		m_executedChunks.clear();
+		for (uint32_t chunk = 0; chunk < m_recordedChunks; ++chunk)
+		{
+			m_executedChunks.push_back(chunk);
+		}
+		m_recordedChunks = 0;
+	}
+}
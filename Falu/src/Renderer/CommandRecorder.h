@@ -0,0 +1,76 @@
+/*****************************************************************//**
+ * \file   CommandRecorder.h
+ * \brief  R}hL^̃C^[tF[XƃfoCXgȂobNGh
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// nȂ̂ŁÃwb_[ <d3d11.h> ɈˑȂ(D3D11 ̃obNGh DeferredCommandRecorder.h)
+struct ID3D11DeviceContext;
+
+namespace Falu
+{
+	// chunkIndex: oł̈ʒu / context: L^(null ̃obNGhł nullptr)
+	using RecordChunkFunc = std::function<void(uint32_t chunkIndex, ID3D11DeviceContext* context)>;
+
+	// count ̍ڂ̃`NB1 `N minPerChunk ȏAő maxChunks ŁA0 ɂ͂ȂȂB
+	// minPerChunk <= 0 Ȃ炷ׂ 1 `Nɂ܂Ƃ߂
+	inline uint32_t CalculateChunkCount(size_t count, int minPerChunk, uint32_t maxChunks)
+	{
+		if (minPerChunk <= 0 || maxChunks <= 1)
+			return 1;
+
+		size_t chunks = count / static_cast<size_t>(minPerChunk);
+		if (chunks < 1)
+			return 1;
+		return chunks < maxChunks ? static_cast<uint32_t>(chunks) : maxChunks;
+	}
+
+	// chunkCount ̂ chunk Ԗڂ̘A [begin, end)B`N̏ڂ̏ɂȂ
+	inline void GetChunkRange(size_t count, uint32_t chunk, uint32_t chunkCount, size_t& begin, size_t& end)
+	{
+		begin = count * chunk / chunkCount;
+		end = count * (chunk + 1) / chunkCount;
+	}
+
+	// `L[`Nɕă[J[XbhŋL^AԂǂɍĐ
+	class ICommandRecorder
+	{
+	public:
+		virtual ~ICommandRecorder() = default;
+
+		virtual uint32_t GetMaxChunkCount() const = 0;
+
+		// chunkCount ̃`NɋL^BchunkCount  GetMaxChunkCount() ܂łɐ؂l߂
+		virtual void Record(uint32_t chunkCount, const RecordChunkFunc& record) = 0;
+
+		// O Record() ŋL^`N`NɍĐ
+		virtual void Execute() = 0;
+	};
+
+	// foCXgȂobNGhB`NWuVXeōsA
+	// Đ̏Ԃĉ GPU ȂŊm߂
+	class NullCommandRecorder : public ICommandRecorder
+	{
+	public:
+		explicit NullCommandRecorder(uint32_t maxChunks);
+
+		uint32_t GetMaxChunkCount() const override { return m_maxChunks; }
+		void Record(uint32_t chunkCount, const RecordChunkFunc& record) override;
+		void Execute() override;
+
+		const std::vector<uint32_t>& GetExecutedChunks() const { return m_executedChunks; }
+
+	private:
+		uint32_t m_maxChunks;
+		uint32_t m_recordedChunks;
+		std::vector<uint32_t> m_executedChunks;
+	};
+}
@@ -21,6 +21,7 @@ namespace Falu
 	{
 		DirectX::XMMATRIX world;
 		DirectX::XMMATRIX worldInvTranspose;
+		DirectX::XMUINT4 params; // x: }eAID(}eAe[ugp), yzw: unused
 	};
 
 	struct PerFrameConstantBuffer
@@ -43,6 +44,22 @@ namespace Falu
 		DirectX::XMFLOAT4 lightParam; // x: intensity, y: range, z:type, w: unused
 	};
 
+	// NX^[hCeBÕObh(Basic.hlsl  ClusterBuffer)
+	struct ClusterConstantBuffer
+	{
+		DirectX::XMUINT4 grid;		// x: tilesX, y: tilesY, z: slices, w: Cg
+		DirectX::XMFLOAT4 depth;	// x: near, y: far, z: scale, w: bias (XCX = log([x) * scale + bias)
+		DirectX::XMFLOAT4 viewport;	// xy: r[|[g̍, zw: 1 / TCY
+	};
+
+	// JXP[hVhE(Basic.hlsl  ShadowBuffer)
+	struct ShadowConstantBuffer
+	{
+		DirectX::XMMATRIX cascadeViewProjection[4];
+		DirectX::XMFLOAT4 cascadeParams[4];	// x: eNZ̃[hTCY
+		DirectX::XMFLOAT4 params;			// x: JXP[h, y: 1 / 𑜓x, z: [xoCAX, w: @ItZbg(eNZ)
+	};
+
 	//====== ėp萔obt@NX ======
 	template<typename T>
 	class ConstantBuffer
@@ -0,0 +1,226 @@
+/*****************************************************************//**
+ * \file   ConstantBufferRing.cpp
+ * \brief  ConstantBufferRing ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "ConstantBufferRing.h"
+
+#include <Windows.h>
+#include <cstdio>
+#include <thread>
+
+namespace Falu
+{
+	ConstantBufferRing::ConstantBufferRing()
+		: m_context(nullptr)
+		, m_noOverwrite(false)
+		, m_mapped(false)
+		, m_nextFence(1)
+		, m_completedFence(0)
+	{
+	}
+
+	ConstantBufferRing::~ConstantBufferRing()
+	{
+		Shutdown();
+	}
+
+	bool ConstantBufferRing::Initialize(ID3D11Device* device, ID3D11DeviceContext* context, uint32_t capacity)
+	{
+		if (!device || !context)
+			return false;
+
+		D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+		if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))) ||
+			!options.ConstantBufferOffsetting)
+		{
+			OutputDebugStringA("[ConstantBufferRing] constant buffer offsetting not supported\n");
+			return false;
+		}
+
+		ComPtr<ID3D11DeviceContext1> context1;
+		if (FAILED(context->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(context1.GetAddressOf()))))
+		{
+			OutputDebugStringA("[ConstantBufferRing] ID3D11DeviceContext1 not available\n");
+			return false;
+		}
+
+		capacity = capacity / kAlignment * kAlignment;
+		if (capacity == 0)
+			return false;
+
+		D3D11_BUFFER_DESC desc = {};
+		desc.Usage = D3D11_USAGE_DYNAMIC;
+		desc.ByteWidth = capacity;
+		desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		HRESULT hr = device->CreateBuffer(&desc, nullptr, &m_buffer);
+		if (FAILED(hr))
+		{
+			char msg[128];
+			sprintf_s(msg, "[ConstantBufferRing] ERROR: CreateBuffer failed (0x%08X)\n", (unsigned)hr);
+			OutputDebugStringA(msg);
+			return false;
+		}
+
+		D3D11_QUERY_DESC queryDesc = {};
+		queryDesc.Query = D3D11_QUERY_EVENT;
+		for (auto& fence : m_fences)
+		{
+			if (FAILED(device->CreateQuery(&queryDesc, &fence)))
+			{
+				Shutdown();
+				return false;
+			}
+		}
+
+		m_context = context;
+		m_noOverwrite = options.MapNoOverwriteOnDynamicConstantBuffer != FALSE;
+		m_allocator.Reset(capacity, kAlignment);
+		m_nextFence = 1;
+		m_completedFence = 0;
+		return true;
+	}
+
+	void ConstantBufferRing::Shutdown()
+	{
+		if (m_mapped)
+		{
+			Unmap();
+		}
+		for (auto& fence : m_fences)
+		{
+			fence.Reset();
+		}
+		m_buffer.Reset();
+		m_context = nullptr;
+	}
+
+	void ConstantBufferRing::BeginFrame()
+	{
+		if (!m_buffer)
+			return;
+
+		PollFences(false);
+		m_allocator.Retire(m_completedFence);
+	}
+
+	void* ConstantBufferRing::Map(uint32_t size, uint32_t& outOffset)
+	{
+		if (!m_buffer || m_mapped || size == 0)
+			return nullptr;
+
+		D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+		uint64_t offset = RingAllocator::kInvalidOffset;
+
+		if (!m_noOverwrite)
+		{
+			// DISCARD ̓obt@Ŝւ̂ŁAO͖t[ŏɂȂ
+			m_allocator.Reset(m_allocator.GetCapacity(), kAlignment);
+			offset = m_allocator.Allocate(size);
+			mapType = D3D11_MAP_WRITE_DISCARD;
+		}
+		else
+		{
+			offset = m_allocator.Allocate(size);
+			while (offset == RingAllocator::kInvalidOffset && m_allocator.GetOldestPendingFence() != 0)
+			{
+				// tBO܂ǂłԌÂt[҂
+				if (!PollFences(true))
+					break;
+				m_allocator.Retire(m_completedFence);
+				offset = m_allocator.Allocate(size);
+			}
+
+			if (!m_noOverwrite)
+			{
+				// ҂ĂԂɃtFXꂽBDISCARD ł蒼
+				m_allocator.Reset(m_allocator.GetCapacity(), kAlignment);
+				offset = m_allocator.Allocate(size);
+				mapType = D3D11_MAP_WRITE_DISCARD;
+			}
+			else if (offset == 0 && m_allocator.GetOldestPendingFence() == 0)
+			{
+				// ɏ̂̂Ȃ̂ DISCARD ͂ōς݁A^C̍ւ̏ԂPɕۂĂ
+				mapType = D3D11_MAP_WRITE_DISCARD;
+			}
+		}
+
+		if (offset == RingAllocator::kInvalidOffset)
+			return nullptr;
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		HRESULT hr = m_context->Map(m_buffer.Get(), 0, mapType, 0, &mapped);
+		if (FAILED(hr))
+			return nullptr;
+
+		m_mapped = true;
+		outOffset = (uint32_t)offset;
+		return static_cast<uint8_t*>(mapped.pData) + offset;
+	}
+
+	void ConstantBufferRing::Unmap()
+	{
+		if (!m_mapped)
+			return;
+
+		m_context->Unmap(m_buffer.Get(), 0);
+		m_mapped = false;
+	}
+
+	void ConstantBufferRing::EndFrame()
+	{
+		if (!m_buffer)
+			return;
+
+		// ̃tFX̃NG kMaxFramesInFlight t[Ɏg
+		while (m_nextFence - m_completedFence > kMaxFramesInFlight)
+		{
+			if (!PollFences(true))
+				break;
+		}
+
+		m_context->End(m_fences[m_nextFence % kMaxFramesInFlight].Get());
+		m_allocator.FinishFrame(m_nextFence);
+		++m_nextFence;
+	}
+
+	bool ConstantBufferRing::PollFences(bool wait)
+	{
+		while (m_completedFence + 1 < m_nextFence)
+		{
+			uint64_t fenceValue = m_completedFence + 1;
+			ID3D11Query* fence = m_fences[fenceValue % kMaxFramesInFlight].Get();
+
+			HRESULT hr = m_context->GetData(fence, nullptr, 0, wait ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
+			if (hr == S_OK)
+			{
+				m_completedFence = fenceValue;
+				if (wait)
+					return true;
+				continue;
+			}
+
+			if (FAILED(hr))
+			{
+				// ̃NG͂ʒmȂBtFXȂł NO_OVERWRITE ͊Ȃ̂ŁAȌ DISCARD ɂ
+				char msg[128];
+				sprintf_s(msg, "[ConstantBufferRing] WARNING: fence query failed (0x%08X), falling back to DISCARD\n", (unsigned)hr);
+				OutputDebugStringA(msg);
+				m_completedFence = m_nextFence - 1;
+				m_allocator.Retire(m_completedFence);
+				m_noOverwrite = false;
+				return false;
+			}
+
+			if (!wait)
+				return true;
+
+			std::this_thread::yield();
+		}
+		return true;
+	}
+}
@@ -0,0 +1,72 @@
+/*****************************************************************//**
+ * \file   ConstantBufferRing.h
+ * \brief  t[Ƃɐ؂蕪Ďg傫ȓI萔obt@(D3D11.1 ̃ItZbg)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11_1.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include "Renderer/RingAllocator.h"
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	// t[ׂ̂Ă̕`ŋL 1 ̑傫 D3D11_USAGE_DYNAMIC 萔obt@B
+	// t[̕ 1  Map ŏ݁Ae` *SetConstantBuffers1 
+	// 256 oCg̑oCh(RenderStateTracker Q)B
+	// gt[̍ŌɔsCxgNG GPU ʉ߂A
+	// ̗̈ėpB
+	class ConstantBufferRing
+	{
+	public:
+		// *SetConstantBuffers1 ɓnItZbg 16 oCg̒萔PʂŁA16 ̔{łȂ΂ȂȂ
+		static constexpr uint32_t kAlignment = 256;
+		static constexpr uint32_t kConstantSize = 16;
+		static constexpr uint32_t kMaxFramesInFlight = 4;
+
+		ConstantBufferRing();
+		~ConstantBufferRing();
+
+		// foCX萔obt@͈̔͂oChłȂ false(Ăяo͕`悲Ƃ̌oĤ܂)
+		bool Initialize(ID3D11Device* device, ID3D11DeviceContext* context, uint32_t capacity);
+		void Shutdown();
+
+		bool IsAvailable() const { return m_buffer != nullptr; }
+
+		// GPU gIt[Bt[̍ŏ 1 Ă
+		void BeginFrame();
+
+		// ̃t[p size oCgmۂă}bvBOɎ܂Ȃ nullptrB
+		// outOffset ɂ GetBuffer() ̒ł̃ubÑoCgItZbg
+		void* Map(uint32_t size, uint32_t& outOffset);
+		void Unmap();
+
+		// BeginFrame ȍ~ɊmۂׂĂ𕢂tFX𔭍s
+		void EndFrame();
+
+		ID3D11Buffer* GetBuffer() const { return m_buffer.Get(); }
+		uint32_t GetCapacity() const { return (uint32_t)m_allocator.GetCapacity(); }
+
+	private:
+		// NGs(foCX̍폜Ȃ) falseB̂Ƃ͖̃tFXׂĊƂ݂ȂA
+		// O DISCARD ɐ؂ւBtFX҂Ăяo͕K֐i߂
+		bool PollFences(bool wait);
+
+	private:
+		ComPtr<ID3D11Buffer> m_buffer;
+		ID3D11DeviceContext* m_context;
+		ComPtr<ID3D11Query> m_fences[kMaxFramesInFlight];
+		RingAllocator m_allocator;
+
+		// 萔obt@ NO_OVERWRITE ͔Cӂ̋@\BȂΖt[obt@Ŝ DISCARD 
+		bool m_noOverwrite;
+		bool m_mapped;
+		uint64_t m_nextFence;		// ̃t[ʒmtFX̒l
+		uint64_t m_completedFence;	// IƂ킩ĂŌ̃tFX̒l
+	};
+}
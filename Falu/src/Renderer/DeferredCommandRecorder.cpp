@@ -0,0 +1,87 @@
+/*****************************************************************//**
+ * \file   DeferredCommandRecorder.cpp
+ * \brief  DeferredCommandRecorder ̎
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "DeferredCommandRecorder.h"
+#include "Falu/JobSystem.h"
+
+#include <Windows.h>
+#include <algorithm>
+#include <cstdio>
+
+namespace Falu
+{
+	//=== DeferredCommandRecorder ===
+	DeferredCommandRecorder::DeferredCommandRecorder()
+		: m_immediateContext(nullptr)
+		, m_recordedChunks(0)
+	{
+	}
+
+	DeferredCommandRecorder::~DeferredCommandRecorder()
+	{
+		m_commandLists.clear();
+		m_deferredContexts.clear();
+	}
+
+	bool DeferredCommandRecorder::Initialize(ID3D11Device* device, ID3D11DeviceContext* immediateContext, uint32_t maxChunks)
+	{
+		if (!device || !immediateContext || maxChunks == 0)
+			return false;
+
+		// hCo[̃R}hXgȂ΃^C͕킷B͂邪̂͏Ȃ
+		D3D11_FEATURE_DATA_THREADING threading = {};
+		if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading, sizeof(threading))) &&
+			!threading.DriverCommandLists)
+		{
+			OutputDebugStringA("[CommandRecorder] WARNING: driver command lists not supported, using runtime emulation\n");
+		}
+
+		m_immediateContext = immediateContext;
+		m_deferredContexts.resize(maxChunks);
+		m_commandLists.resize(maxChunks);
+
+		for (uint32_t i = 0; i < maxChunks; ++i)
+		{
+			HRESULT hr = device->CreateDeferredContext(0, &m_deferredContexts[i]);
+			if (FAILED(hr))
+			{
+				char msg[128];
+				sprintf_s(msg, "[CommandRecorder] ERROR: CreateDeferredContext failed (0x%08X)\n", (unsigned)hr);
+				OutputDebugStringA(msg);
+				m_deferredContexts.clear();
+				m_commandLists.clear();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void DeferredCommandRecorder::Record(uint32_t chunkCount, const RecordChunkFunc& record)
+	{
+		m_recordedChunks = std::min(chunkCount, GetMaxChunkCount());
+
+		JobSystem::GetInstance().ParallelFor(m_recordedChunks, [&](uint32_t chunk)
+		{
+			ID3D11DeviceContext* context = m_deferredContexts[chunk].Get();
+			record(chunk, context);
+			context->FinishCommandList(FALSE, &m_commandLists[chunk]);
+		});
+	}
+
+	void DeferredCommandRecorder::Execute()
+	{
+		for (uint32_t chunk = 0; chunk < m_recordedChunks; ++chunk)
+		{
+			if (m_commandLists[chunk])
+			{
+				m_immediateContext->ExecuteCommandList(m_commandLists[chunk].Get(), FALSE);
+				m_commandLists[chunk].Reset();
+			}
+		}
+		m_recordedChunks = 0;
+	}
+}
@@ -0,0 +1,38 @@
+/*****************************************************************//**
+ * \file   DeferredCommandRecorder.h
+ * \brief  ICommandRecorder  D3D11 xReLXg̃obNGh
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <wrl/client.h>
+#include "Renderer/CommandRecorder.h"
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	// `NƂ 1 ̒xReLXgAReLXgŎs
+	class DeferredCommandRecorder : public ICommandRecorder
+	{
+	public:
+		DeferredCommandRecorder();
+		~DeferredCommandRecorder() override;
+
+		bool Initialize(ID3D11Device* device, ID3D11DeviceContext* immediateContext, uint32_t maxChunks);
+
+		uint32_t GetMaxChunkCount() const override { return static_cast<uint32_t>(m_deferredContexts.size()); }
+		void Record(uint32_t chunkCount, const RecordChunkFunc& record) override;
+		void Execute() override;
+
+	private:
+		ID3D11DeviceContext* m_immediateContext;
+		std::vector<ComPtr<ID3D11DeviceContext>> m_deferredContexts;
+		std::vector<ComPtr<ID3D11CommandList>> m_commandLists;
+		uint32_t m_recordedChunks;
+	};
+
+}
@@ -0,0 +1,111 @@
+/*****************************************************************//**
+ * \file   IndexData.h
+ * \brief  _ 16 rbgɋl߂ CPU ̃CfbNX
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Falu
+{
+	// CPU ̃CfbNX^̏BDXGI tH[}bg Mesh IԂ̂ŁÃwb_[̓foCXɈˑȂ
+	template<typename IndexT>
+	struct IndexFormat;
+
+	template<>
+	struct IndexFormat<uint16_t>
+	{
+		static constexpr uint32_t maxVertexCount = 0xFFFF;	// 0xFFFF ̓Xgbv̋؂̒lƂċ󂯂Ă
+	};
+
+	template<>
+	struct IndexFormat<uint32_t>
+	{
+		static constexpr uint32_t maxVertexCount = 0xFFFFFFFF;
+	};
+
+	// uint16_t  uint32_t ŎOp`Xg̃CfbNXBǂɂ邩 Assign()  1 񂾂߂B
+	// ^t̃ANZX Get<IndexT>() ÃxN^[ėp_ɓn Visit() gB
+	class IndexData
+	{
+	public:
+		IndexData() : m_is16Bit(false) {}
+
+		// ׂĂ̒_܂ 16 rbgɋl߂
+		template<typename SourceT>
+		void Assign(const SourceT* indices, size_t count, size_t vertexCount)
+		{
+			Clear();
+			m_is16Bit = vertexCount <= IndexFormat<uint16_t>::maxVertexCount;
+			if (m_is16Bit)
+				m_indices16.assign(indices, indices + count);
+			else
+				m_indices32.assign(indices, indices + count);
+		}
+
+		template<typename SourceT>
+		void Assign(const std::vector<SourceT>& indices, size_t vertexCount)
+		{
+			Assign(indices.data(), indices.size(), vertexCount);
+		}
+
+		// 32 rbĝ܂܂ȂxN^[̂܂܈
+		void Assign(std::vector<uint32_t>&& indices, size_t vertexCount)
+		{
+			if (vertexCount <= IndexFormat<uint16_t>::maxVertexCount)
+			{
+				Assign(indices.data(), indices.size(), vertexCount);
+				return;
+			}
+			Clear();
+			m_is16Bit = false;
+			m_indices32 = std::move(indices);
+		}
+
+		void Clear()
+		{
+			m_indices16.clear();
+			m_indices16.shrink_to_fit();
+			m_indices32.clear();
+			m_indices32.shrink_to_fit();
+		}
+
+		bool Is16Bit() const { return m_is16Bit; }
+		uint32_t GetStride() const { return m_is16Bit ? sizeof(uint16_t) : sizeof(uint32_t); }
+
+		size_t GetCount() const { return m_is16Bit ? m_indices16.size() : m_indices32.size(); }
+		bool IsEmpty() const { return GetCount() == 0; }
+		size_t GetSizeInBytes() const { return GetCount() * GetStride(); }
+		const void* GetData() const { return m_is16Bit ? static_cast<const void*>(m_indices16.data()) : m_indices32.data(); }
+
+		uint32_t operator[](size_t i) const { return m_is16Bit ? m_indices16[i] : m_indices32[i]; }
+
+		template<typename IndexT>
+		const std::vector<IndexT>& Get() const;
+
+		// f(const std::vector<uint16_t or uint32_t>&)
+		template<typename Func>
+		decltype(auto) Visit(Func&& f) const
+		{
+			if (m_is16Bit)
+				return f(m_indices16);
+			return f(m_indices32);
+		}
+
+	private:
+		bool m_is16Bit;
+		std::vector<uint16_t> m_indices16;
+		std::vector<uint32_t> m_indices32;
+	};
+
+	template<>
+	inline const std::vector<uint16_t>& IndexData::Get<uint16_t>() const { return m_indices16; }
+
+	template<>
+	inline const std::vector<uint32_t>& IndexData::Get<uint32_t>() const { return m_indices32; }
+}
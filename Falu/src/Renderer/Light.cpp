@@ -6,12 +6,15 @@
  * \date   2026/02/19
  *********************************************************************/
 #include "Light.h"
+#include <algorithm>
+#include <cmath>
 
 namespace Falu
 {
 	Light::Light(LightType type):
 		m_type(type),m_color(1.0f,1.0f,1.0f,1.0f),m_intensity(1.0f),
-		m_range(10.0f),m_spotAngle(45.0f),m_enabled(true)
+		m_range(10.0f),m_spotAngle(45.0f),m_enabled(true),m_version(0),
+		m_proxy(Math::DynamicAabbTree::kNullProxy),m_indexedVersion(0),m_indexedRange(0.0f)
 	{
 		// ftHg̕()
 		if (type == LightType::Directional)
@@ -23,12 +26,62 @@ namespace Falu
 	{
 	}
 
+	bool Light::GetWorldBounds(Math::AABB& outBounds) const
+	{
+		if (m_type == LightType::Directional)
+			return false;
+
+		Math::Vector3 position = m_transform.GetPosition();
+		Math::Vector3 extent(m_range, m_range, m_range);
+		outBounds = Math::AABB(position - extent, position + extent);
+
+		// X|bg͔p90xȂ~(_ + ̉~ + ʂ̕)ōi
+		float halfAngle = Math::ToRadians(m_spotAngle * 0.5f);
+		if (m_type != LightType::Spot || halfAngle >= Math::ToRadians(90.0f))
+			return true;
+
+		Math::Vector3 direction = Math::Normalize(m_transform.GetForward());
+		float cosHalf = std::cos(halfAngle);
+		float sinHalf = std::sin(halfAngle);
+		Math::Vector3 baseCenter = position + direction * (m_range * cosHalf);
+		float baseRadius = m_range * sinHalf;
+
+		float axisDirection[3] = { direction.x, direction.y, direction.z };
+		float apex[3] = { position.x, position.y, position.z };
+		float center[3] = { baseCenter.x, baseCenter.y, baseCenter.z };
+		float boundsMin[3];
+		float boundsMax[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			// ̉~̍L
+			float diskExtent = baseRadius * std::sqrt(std::max(1.0f - axisDirection[i] * axisDirection[i], 0.0f));
+			boundsMin[i] = std::min(apex[i], center[i] - diskExtent);
+			boundsMax[i] = std::max(apex[i], center[i] + diskExtent);
+			// ̌~̒Ȃ狅ʂ͈͂ς܂ŏo
+			if (axisDirection[i] >= cosHalf)
+				boundsMax[i] = apex[i] + m_range;
+			if (-axisDirection[i] >= cosHalf)
+				boundsMin[i] = apex[i] - m_range;
+		}
+		outBounds = Math::AABB(Math::Vector3(boundsMin[0], boundsMin[1], boundsMin[2]),
+			Math::Vector3(boundsMax[0], boundsMax[1], boundsMax[2]));
+		return true;
+	}
+
 	/**
 	 * 
 	 * LightManager
 	 * 
 	 */
 
+	// ԃCfbNX̗]B菬ړł͖؂gݑւȂ
+	static const float kLightBoundsMargin = 0.5f;
+
+	LightManager::LightManager()
+		:m_tree(kLightBoundsMargin)
+	{
+	}
+
 	LightManager& LightManager::GetInstance()
 	{
 		static LightManager instance;
@@ -41,11 +94,29 @@ namespace Falu
 		Light* ptr = light.get();
 		m_lights.push_back(std::move(light));
 
+		UpdateLight(ptr);
+		if (type == LightType::Directional)
+		{
+			m_directionalLights.push_back(ptr);
+		}
+
 		return ptr;
 	}
 
 	void LightManager::RemoveLight(Light* light)
 	{
+		if (!light)
+			return;
+
+		if (light->m_proxy != Math::DynamicAabbTree::kNullProxy)
+		{
+			m_tree.DestroyProxy(light->m_proxy);
+			light->m_proxy = Math::DynamicAabbTree::kNullProxy;
+		}
+		m_directionalLights.erase(
+			std::remove(m_directionalLights.begin(), m_directionalLights.end(), light),
+			m_directionalLights.end());
+
 		m_lights.erase(
 			std::remove_if(m_lights.begin(), m_lights.end(),
 				[light](const std::unique_ptr<Light>& l)
@@ -58,5 +129,93 @@ namespace Falu
 	void LightManager::Clear()
 	{
 		m_lights.clear();
+		m_directionalLights.clear();
+		m_tree.Clear();
+	}
+
+	void LightManager::Update()
+	{
+		// ςCgfBĂ]̒Ȃ؂͂̂܂
+		m_directionalLights.clear();
+		for (const auto& light : m_lights)
+		{
+			if (light->GetVersion() != light->m_indexedVersion)
+			{
+				UpdateLight(light.get());
+			}
+			if (light->IsEnabled() && light->GetType() == LightType::Directional)
+			{
+				m_directionalLights.push_back(light.get());
+			}
+		}
+	}
+
+	void LightManager::UpdateLight(Light* light)
+	{
+		light->m_indexedVersion = light->GetVersion();
+
+		Math::AABB bounds;
+		if (!light->IsEnabled() || !light->GetWorldBounds(bounds))
+		{
+			if (light->m_proxy != Math::DynamicAabbTree::kNullProxy)
+			{
+				m_tree.DestroyProxy(light->m_proxy);
+				light->m_proxy = Math::DynamicAabbTree::kNullProxy;
+			}
+			return;
+		}
+
+		light->m_indexedBounds = bounds;
+		light->m_indexedCenter = light->GetTransform().GetPosition();
+		light->m_indexedRange = light->GetRange();
+		if (light->m_proxy == Math::DynamicAabbTree::kNullProxy)
+		{
+			light->m_proxy = m_tree.CreateProxy(bounds, light);
+		}
+		else
+		{
+			m_tree.MoveProxy(light->m_proxy, bounds);
+		}
+	}
+
+	void LightManager::LightsAffecting(const Math::AABB& bounds, std::vector<Light*>& outLights, bool includeDirectional) const
+	{
+		if (includeDirectional)
+		{
+			outLights.insert(outLights.end(), m_directionalLights.begin(), m_directionalLights.end());
+		}
+
+		m_tree.Query(bounds, [&](uint32_t proxy)
+			{
+				Light* light = static_cast<Light*>(m_tree.GetUserData(proxy));
+				if (!light->m_indexedBounds.Intersects(bounds))
+					return;
+
+				// ͈͂̋AABB̋
+				const Math::Vector3& center = light->m_indexedCenter;
+				Math::Vector3 closest = Math::Min(Math::Max(center, bounds.min), bounds.max);
+				if (Math::LengthSquared(closest - center) <= light->m_indexedRange * light->m_indexedRange)
+				{
+					outLights.push_back(light);
+				}
+			});
+	}
+
+	void LightManager::LightsAffecting(const Math::Frustum& frustum, std::vector<Light*>& outLights, bool includeDirectional) const
+	{
+		if (includeDirectional)
+		{
+			outLights.insert(outLights.end(), m_directionalLights.begin(), m_directionalLights.end());
+		}
+
+		m_tree.Query(frustum, [&](uint32_t proxy)
+			{
+				Light* light = static_cast<Light*>(m_tree.GetUserData(proxy));
+				if (frustum.Intersects(light->m_indexedBounds) &&
+					frustum.Intersects(light->m_indexedCenter, light->m_indexedRange))
+				{
+					outLights.push_back(light);
+				}
+			});
 	}
 }
@@ -8,7 +8,9 @@
 #pragma once
 
 #include "Include/Math/MathHelper.h"
+#include "Include/Math/DynamicAabbTree.h"
 #include "Scene/Transform.h"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -38,20 +40,28 @@ namespace Falu
 		void SetIntensity(float intensity) { m_intensity = intensity; }
 		float GetIntensity() const { return m_intensity; }
 
-		void SetRange(float range) { m_range = range; }
+		void SetRange(float range) { m_range = range; ++m_version; }
 		float GetRange()const { return m_range; }
 
-		void SetSpotAngle(float angle) { m_spotAngle = angle; }
+		void SetSpotAngle(float angle) { m_spotAngle = angle; ++m_version; }
 		float GetSpotAngle()const { return m_spotAngle; }
 
-		void SetType(LightType type) { m_type = type; }
+		void SetType(LightType type) { m_type = type; ++m_version; }
 		LightType GetType()const { return m_type; }
 
 		// L/
-		void SetEnabled(bool enabled) { m_enabled = enabled; }
+		void SetEnabled(bool enabled) { m_enabled = enabled; ++m_version; }
 		bool IsEnabled()const { return m_enabled; }
 
+		// e͈(TransformEށÉ͈EpxEL)ς邽тɕς
+		uint32_t GetVersion() const { return m_transform.GetVersion() + m_version; }
+
+		// e͈͂͂ރ[hAABBBfBNViCg͔͈͂Ȃ̂false
+		bool GetWorldBounds(Math::AABB& outBounds) const;
+
 	private:
+		friend class LightManager;
+
 		Transform m_transform;
 		LightType m_type;
 		Math::Color m_color;
@@ -59,6 +69,14 @@ namespace Falu
 		float m_range;
 		float m_spotAngle;
 		bool m_enabled;
+		uint32_t m_version;
+
+		// LightManager ̋ԃCfbNX̏(Ōɔf_̒l)
+		uint32_t m_proxy;
+		uint32_t m_indexedVersion;
+		Math::AABB m_indexedBounds;
+		Math::Vector3 m_indexedCenter;
+		float m_indexedRange;
 	};
 
 	// CgǗ
@@ -72,14 +90,31 @@ namespace Falu
 		void Clear();
 
 		const std::vector<std::unique_ptr<Light>>& GetLights()const { return m_lights; }
+		// LȃfBNViCg(쐬)
+		const std::vector<Light*>& GetDirectionalLights()const { return m_directionalLights; }
+
+		// Cg̈ړύXԃCfbNXɔfB1t[1A₢킹̑OɌĂ
+		void Update();
+
+		// e͈͂͂LȃCg outLights ɒǉBfBNViCg includeDirectional ȂɊ܂
+		void LightsAffecting(const Math::AABB& bounds, std::vector<Light*>& outLights, bool includeDirectional = true) const;
+		void LightsAffecting(const Math::Frustum& frustum, std::vector<Light*>& outLights, bool includeDirectional = true) const;
+
+		const Math::DynamicAabbTree& GetSpatialIndex()const { return m_tree; }
 
 	private:
-		LightManager() = default;
+		LightManager();
 		~LightManager() = default;
 		LightManager(const LightManager&) = delete;
 		LightManager& operator=(const LightManager&) = delete;
 
+		// 1̃CgCfbNXɔf(fBNViEȃCg͊O)
+		void UpdateLight(Light* light);
+
 	private:
 		std::vector<std::unique_ptr<Light>> m_lights;
+		std::vector<Light*> m_directionalLights;
+		// |Cg/X|bgCg̉e͈͂AABB؁B̈ړł͖؂gݑւȂ
+		Math::DynamicAabbTree m_tree;
 	};
 }
@@ -0,0 +1,354 @@
+/*****************************************************************//**
+ * \file   LightClusterGrid.cpp
+ * \brief  LightClusterGrid ̎
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "LightClusterGrid.h"
+#include "Include/Math/SimdMath.h"
+#include "Falu/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FALU_CLUSTER_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace Falu
+{
+	namespace
+	{
+		// ߑ̃[͉ɂ锼a 0 ̃CgȂ̂ŁAǂ̔łO
+		const float kFarAway = 1e30f;
+
+		struct Bounds
+		{
+			float minX, minY, minZ;
+			float maxX, maxY, maxZ;
+		};
+
+		// |C^n܂ 4 ̂A i {bNXɏdȂ΃rbg i 
+		uint32_t SphereBoxMask(const float* x, const float* y, const float* z, const float* radius, const Bounds& box)
+		{
+#ifdef FALU_CLUSTER_SSE
+			__m128 cx = _mm_loadu_ps(x), cy = _mm_loadu_ps(y), cz = _mm_loadu_ps(z), r = _mm_loadu_ps(radius);
+			__m128 zero = _mm_setzero_ps();
+			// S{bNX܂ł̎Ƃ̋(Ȃ 0)
+			__m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(box.minX), cx), _mm_sub_ps(cx, _mm_set1_ps(box.maxX))), zero);
+			__m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(box.minY), cy), _mm_sub_ps(cy, _mm_set1_ps(box.maxY))), zero);
+			__m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(box.minZ), cz), _mm_sub_ps(cz, _mm_set1_ps(box.maxZ))), zero);
+			__m128 distanceSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(distanceSq, _mm_mul_ps(r, r))));
+#else
+			uint32_t mask = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				float dx = std::max(std::max(box.minX - x[i], x[i] - box.maxX), 0.0f);
+				float dy = std::max(std::max(box.minY - y[i], y[i] - box.maxY), 0.0f);
+				float dz = std::max(std::max(box.minZ - z[i], z[i] - box.maxZ), 0.0f);
+				if (dx * dx + dy * dy + dz * dz <= radius[i] * radius[i])
+					mask |= 1u << i;
+			}
+			return mask;
+#endif
+		}
+
+		// ~ i (center, sphereRadius)ɓ͂A[ i X|bgłȂ΃rbg i B
+		// NX^[̋E~̊px [0, range] ͈̔͂Ŕ肷
+		uint32_t ConeSphereMask(const float* x, const float* y, const float* z, const float* range,
+			const float* dirX, const float* dirY, const float* dirZ, const float* cosAngle, const float* sinAngle,
+			const float* spot, const Math::Vector3& center, float sphereRadius)
+		{
+#ifdef FALU_CLUSTER_SSE
+			__m128 vx = _mm_sub_ps(_mm_set1_ps(center.x), _mm_loadu_ps(x));
+			__m128 vy = _mm_sub_ps(_mm_set1_ps(center.y), _mm_loadu_ps(y));
+			__m128 vz = _mm_sub_ps(_mm_set1_ps(center.z), _mm_loadu_ps(z));
+			__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+			__m128 along = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_loadu_ps(dirX)), _mm_mul_ps(vy, _mm_loadu_ps(dirY))),
+				_mm_mul_ps(vz, _mm_loadu_ps(dirZ)));
+			__m128 across = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lengthSq, _mm_mul_ps(along, along)), _mm_setzero_ps()));
+			// ̒S~̖ʂ܂ł̕t
+			__m128 closest = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(cosAngle), across), _mm_mul_ps(along, _mm_loadu_ps(sinAngle)));
+
+			__m128 sr = _mm_set1_ps(sphereRadius);
+			__m128 hit = _mm_and_ps(_mm_cmple_ps(closest, sr),
+				_mm_and_ps(_mm_cmple_ps(along, _mm_add_ps(sr, _mm_loadu_ps(range))), _mm_cmpge_ps(along, _mm_sub_ps(_mm_setzero_ps(), sr))));
+			__m128 notSpot = _mm_cmple_ps(_mm_loadu_ps(spot), _mm_setzero_ps());
+			return static_cast<uint32_t>(_mm_movemask_ps(_mm_or_ps(hit, notSpot)));
+#else
+			uint32_t mask = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				if (spot[i] <= 0.0f)
+				{
+					mask |= 1u << i;
+					continue;
+				}
+				float vx = center.x - x[i], vy = center.y - y[i], vz = center.z - z[i];
+				float lengthSq = vx * vx + vy * vy + vz * vz;
+				float along = vx * dirX[i] + vy * dirY[i] + vz * dirZ[i];
+				float across = std::sqrt(std::max(lengthSq - along * along, 0.0f));
+				float closest = cosAngle[i] * across - along * sinAngle[i];
+				if (closest <= sphereRadius && along <= sphereRadius + range[i] && along >= -sphereRadius)
+					mask |= 1u << i;
+			}
+			return mask;
+#endif
+		}
+	}
+
+	//=== LightSoA ===
+
+	void LightClusterGrid::LightSoA::Clear()
+	{
+		x.clear(); y.clear(); z.clear(); radius.clear();
+		dirX.clear(); dirY.clear(); dirZ.clear(); cosAngle.clear(); sinAngle.clear();
+		spot.clear();
+		id.clear();
+	}
+
+	void LightClusterGrid::LightSoA::Add(const Math::Vector3& position, float range, const Math::Vector3& direction,
+		float cosOuter, bool isSpot, uint32_t lightId)
+	{
+		x.push_back(position.x);
+		y.push_back(position.y);
+		z.push_back(position.z);
+		radius.push_back(range);
+		dirX.push_back(direction.x);
+		dirY.push_back(direction.y);
+		dirZ.push_back(direction.z);
+		cosAngle.push_back(cosOuter);
+		sinAngle.push_back(std::sqrt(std::max(1.0f - cosOuter * cosOuter, 0.0f)));
+		spot.push_back(isSpot ? 1.0f : 0.0f);
+		id.push_back(lightId);
+	}
+
+	void LightClusterGrid::LightSoA::Push(const LightSoA& from, size_t i)
+	{
+		x.push_back(from.x[i]);
+		y.push_back(from.y[i]);
+		z.push_back(from.z[i]);
+		radius.push_back(from.radius[i]);
+		dirX.push_back(from.dirX[i]);
+		dirY.push_back(from.dirY[i]);
+		dirZ.push_back(from.dirZ[i]);
+		cosAngle.push_back(from.cosAngle[i]);
+		sinAngle.push_back(from.sinAngle[i]);
+		spot.push_back(from.spot[i]);
+		id.push_back(from.id[i]);
+	}
+
+	void LightClusterGrid::LightSoA::Pad()
+	{
+		while (id.size() % 4 != 0)
+			Add(Math::Vector3(kFarAway, kFarAway, kFarAway), 0.0f, Math::Vector3(0.0f, 0.0f, 1.0f), 1.0f, false, UINT32_MAX);
+	}
+
+	//=== LightClusterGrid ===
+
+	LightClusterGrid::LightClusterGrid(const LightClusterSettings& settings)
+		: m_settings(settings)
+		, m_nearZ(0.1f)
+		, m_farZ(100.0f)
+		, m_sliceScale(0.0f)
+		, m_sliceBias(0.0f)
+	{
+		m_settings.tilesX = std::max(1u, m_settings.tilesX);
+		m_settings.tilesY = std::max(1u, m_settings.tilesY);
+		m_settings.slices = std::max(1u, m_settings.slices);
+	}
+
+	void LightClusterGrid::SetupProjection(const Math::Matrix4& projection)
+	{
+		const float(&m)[4][4] = projection.m;
+		const uint32_t tilesX = m_settings.tilesX;
+		const uint32_t tilesY = m_settings.tilesY;
+		const uint32_t slices = m_settings.slices;
+
+		// D3D ̎ˉes񂩂jA/t@[o(_34 ͓e 1Ase 0)
+		bool perspective = m[2][3] != 0.0f;
+		m_nearZ = -m[3][2] / m[2][2];
+		m_farZ = perspective ? m[3][2] / (1.0f - m[2][2]) : (1.0f - m[3][2]) / m[2][2];
+		m_nearZ = std::max(m_nearZ, 1e-3f);
+		m_farZ = std::max(m_farZ, m_nearZ * 1.01f);
+
+		float logRatio = std::log(m_farZ / m_nearZ);
+		m_sliceScale = static_cast<float>(slices) / logRatio;
+		m_sliceBias = -static_cast<float>(slices) * std::log(m_nearZ) / logRatio;
+
+		m_sliceDepth.resize(slices + 1);
+		for (uint32_t k = 0; k <= slices; ++k)
+			m_sliceDepth[k] = m_nearZ * std::pow(m_farZ / m_nearZ, static_cast<float>(k) / slices);
+
+		// r[[x z ł NDC WɑΉr[Ԃ x / y(clip = v * P, ndc = clip / w ̋t)
+		auto viewX = [&](float ndc, float z) { return (ndc * (z * m[2][3] + m[3][3]) - z * m[2][0] - m[3][0]) / m[0][0]; };
+		auto viewY = [&](float ndc, float z) { return (ndc * (z * m[2][3] + m[3][3]) - z * m[2][1] - m[3][1]) / m[1][1]; };
+
+		m_columnMin.resize(slices * tilesX);
+		m_columnMax.resize(slices * tilesX);
+		m_rowMin.resize(slices * tilesY);
+		m_rowMax.resize(slices * tilesY);
+		for (uint32_t k = 0; k < slices; ++k)
+		{
+			float z0 = m_sliceDepth[k];
+			float z1 = m_sliceDepth[k + 1];
+			for (uint32_t i = 0; i < tilesX; ++i)
+			{
+				float left = -1.0f + 2.0f * i / tilesX;
+				float right = -1.0f + 2.0f * (i + 1) / tilesX;
+				float a = viewX(left, z0), b = viewX(left, z1), c = viewX(right, z0), d = viewX(right, z1);
+				m_columnMin[k * tilesX + i] = std::min(std::min(a, b), std::min(c, d));
+				m_columnMax[k * tilesX + i] = std::max(std::max(a, b), std::max(c, d));
+			}
+			// s 0 ͉ʂ̈ԏ(NDC y = +1)
+			for (uint32_t j = 0; j < tilesY; ++j)
+			{
+				float top = 1.0f - 2.0f * j / tilesY;
+				float bottom = 1.0f - 2.0f * (j + 1) / tilesY;
+				float a = viewY(top, z0), b = viewY(top, z1), c = viewY(bottom, z0), d = viewY(bottom, z1);
+				m_rowMin[k * tilesY + j] = std::min(std::min(a, b), std::min(c, d));
+				m_rowMax[k * tilesY + j] = std::max(std::max(a, b), std::max(c, d));
+			}
+		}
+	}
+
+	void LightClusterGrid::Build(const ClusterLight* lights, uint32_t lightCount,
+		const Math::Matrix4& view, const Math::Matrix4& projection)
+	{
+		SetupProjection(projection);
+
+		// Cg܂Ƃ߂ăr[Ԃ
+		m_positions.resize(lightCount);
+		m_directions.resize(lightCount);
+		for (uint32_t i = 0; i < lightCount; ++i)
+		{
+			m_positions[i] = lights[i].position;
+			m_directions[i] = lights[i].direction;
+		}
+		Math::Simd::TransformPoints(view, m_positions.data(), m_positions.data(), lightCount);
+		Math::Simd::TransformVectors(view, m_directions.data(), m_directions.data(), lightCount);
+
+		m_lights.Clear();
+		for (uint32_t i = 0; i < lightCount; ++i)
+		{
+			const ClusterLight& light = lights[i];
+			if (light.range <= 0.0f)
+				continue;
+			// ȏɊJ~͉~̔̌ʂ̂ŋƂĈ
+			bool isSpot = light.cosOuter > 0.0f;
+			m_lights.Add(m_positions[i], light.range, Math::Normalize(m_directions[i]),
+				isSpot ? light.cosOuter : 0.0f, isSpot, i);
+		}
+
+		const uint32_t slices = m_settings.slices;
+		m_slices.resize(slices);
+		JobSystem::GetInstance().ParallelFor(slices, [this](uint32_t slice) { BuildSlice(slice); });
+
+		// XCXȂ(ranges ̓NX^[ԍƓXCXɕ)
+		const uint32_t clustersPerSlice = m_settings.tilesX * m_settings.tilesY;
+		m_ranges.resize(GetClusterCount());
+		m_indices.clear();
+		m_stats = LightClusterStats();
+		m_stats.lightCount = static_cast<uint32_t>(m_lights.Size());
+		for (uint32_t k = 0; k < slices; ++k)
+		{
+			const SliceWork& work = m_slices[k];
+			uint32_t base = static_cast<uint32_t>(m_indices.size());
+			for (uint32_t c = 0; c < clustersPerSlice; ++c)
+			{
+				ClusterRange range = work.ranges[c];
+				range.offset += base;
+				m_ranges[k * clustersPerSlice + c] = range;
+			}
+			m_indices.insert(m_indices.end(), work.indices.begin(), work.indices.end());
+			m_stats.maxClusterLights = std::max(m_stats.maxClusterLights, work.maxClusterLights);
+		}
+		m_stats.indexCount = static_cast<uint32_t>(m_indices.size());
+	}
+
+	void LightClusterGrid::BuildSlice(uint32_t slice)
+	{
+		const uint32_t tilesX = m_settings.tilesX;
+		const uint32_t tilesY = m_settings.tilesY;
+		const float z0 = m_sliceDepth[slice];
+		const float z1 = m_sliceDepth[slice + 1];
+		const float* columnMin = &m_columnMin[slice * tilesX];
+		const float* columnMax = &m_columnMax[slice * tilesX];
+		const float* rowMin = &m_rowMin[slice * tilesY];
+		const float* rowMax = &m_rowMax[slice * tilesY];
+
+		SliceWork& work = m_slices[slice];
+		work.ranges.assign(tilesX * tilesY, ClusterRange{ 0, 0 });
+		work.indices.clear();
+		work.maxClusterLights = 0;
+
+		// iK 1: [x͈̔͂XCXɏdȂ郉Cg
+		LightSoA& sliceLights = work.sliceLights;
+		sliceLights.Clear();
+		for (size_t i = 0; i < m_lights.Size(); ++i)
+		{
+			if (m_lights.z[i] + m_lights.radius[i] >= z0 && m_lights.z[i] - m_lights.radius[i] <= z1)
+				sliceLights.Push(m_lights, i);
+		}
+		if (sliceLights.Size() == 0)
+			return;
+		sliceLights.Pad();
+
+		float sliceMinX = *std::min_element(columnMin, columnMin + tilesX);
+		float sliceMaxX = *std::max_element(columnMax, columnMax + tilesX);
+
+		LightSoA& rowLights = work.rowLights;
+		for (uint32_t j = 0; j < tilesY; ++j)
+		{
+			// iK 2: ^C̍sŜɐG郉Cg
+			Bounds rowBox = { sliceMinX, rowMin[j], z0, sliceMaxX, rowMax[j], z1 };
+			rowLights.Clear();
+			for (size_t g = 0; g < sliceLights.Size(); g += 4)
+			{
+				uint32_t mask = SphereBoxMask(&sliceLights.x[g], &sliceLights.y[g], &sliceLights.z[g], &sliceLights.radius[g], rowBox);
+				for (uint32_t lane = 0; lane < 4; ++lane)
+				{
+					if (mask & (1u << lane))
+						rowLights.Push(sliceLights, g + lane);
+				}
+			}
+			if (rowLights.Size() == 0)
+				continue;
+			rowLights.Pad();
+
+			// iK 3: s̊eNX^[
+			for (uint32_t i = 0; i < tilesX; ++i)
+			{
+				Bounds box = { columnMin[i], rowMin[j], z0, columnMax[i], rowMax[j], z1 };
+				Math::Vector3 center((box.minX + box.maxX) * 0.5f, (box.minY + box.maxY) * 0.5f, (box.minZ + box.maxZ) * 0.5f);
+				Math::Vector3 halfSize((box.maxX - box.minX) * 0.5f, (box.maxY - box.minY) * 0.5f, (box.maxZ - box.minZ) * 0.5f);
+				float sphereRadius = Math::Length(halfSize);
+
+				ClusterRange& range = work.ranges[j * tilesX + i];
+				range.offset = static_cast<uint32_t>(work.indices.size());
+				for (size_t g = 0; g < rowLights.Size() && range.count < m_settings.maxLightsPerCluster; g += 4)
+				{
+					uint32_t mask = SphereBoxMask(&rowLights.x[g], &rowLights.y[g], &rowLights.z[g], &rowLights.radius[g], box);
+					if (!mask)
+						continue;
+					mask &= ConeSphereMask(&rowLights.x[g], &rowLights.y[g], &rowLights.z[g], &rowLights.radius[g],
+						&rowLights.dirX[g], &rowLights.dirY[g], &rowLights.dirZ[g], &rowLights.cosAngle[g], &rowLights.sinAngle[g],
+						&rowLights.spot[g], center, sphereRadius);
+
+					for (uint32_t lane = 0; lane < 4 && range.count < m_settings.maxLightsPerCluster; ++lane)
+					{
+						if (mask & (1u << lane))
+						{
+							work.indices.push_back(rowLights.id[g + lane]);
+							++range.count;
+						}
+					}
+				}
+				work.maxClusterLights = std::max(work.maxClusterLights, range.count);
+			}
+		}
+	}
+}
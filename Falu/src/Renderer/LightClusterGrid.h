@@ -0,0 +1,128 @@
+/*****************************************************************//**
+ * \file   LightClusterGrid.h
+ * \brief  NX^[htH[hCeBO CPU ł̃Cg蓖(foCXgȂ)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Include/Math/Vector.h"
+#include "Include/Math/Matrix.h"
+
+namespace Falu
+{
+	// Basic.hlsl  ClusterLight ƓсB[hԂŁAcolor ɂ͋|Ă
+	struct ClusterLight
+	{
+		Math::Vector3 position;
+		float range;
+		Math::Vector3 direction;	// X|bg: ~̌
+		float cosOuter;				// X|bg: cos(O̔p)B|CgCg kNoCone
+		Math::Vector3 color;
+		float cosInner;				// X|bg: cos(̔p)B̓͌Ȃ
+
+		static constexpr float kNoCone = -2.0f;
+	};
+
+	// Basic.hlsl  uint2 ClusterRanges[] Ɠ
+	struct ClusterRange
+	{
+		uint32_t offset;	// CfbNXXg̈ʒu
+		uint32_t count;
+	};
+
+	struct LightClusterSettings
+	{
+		uint32_t tilesX = 16;
+		uint32_t tilesY = 9;
+		uint32_t slices = 24;
+		// 1 NX^[ł̐𒴂Cĝ͎Ă(CfbNXXgƃVF[_[̃[v̏)
+		uint32_t maxLightsPerCluster = 128;
+	};
+
+	struct LightClusterStats
+	{
+		uint32_t lightCount = 0;
+		uint32_t indexCount = 0;
+		uint32_t maxClusterLights = 0;
+	};
+
+	// 1 r[ CPU ł̃Cg蓖āB
+	//  tilesX x tilesY ̉ʃ^CƎwIɕׂ[xXCXɕA|Cg/X|bgCg
+	// ͂NX^[̃r[Ԃ͈̔͂Ɣׂ( AABBAX|bg͉~̔BSSE  4 )B
+	// XCX JobSystem ̃[J[ɕBfoCXgȂ̂ŃEBhEȂłvEeXgł
+	class LightClusterGrid
+	{
+	public:
+		explicit LightClusterGrid(const LightClusterSettings& settings = LightClusterSettings());
+
+		// view / projection ̓J̍sxNg`̍s(ełseł悢)
+		void Build(const ClusterLight* lights, uint32_t lightCount, const Math::Matrix4& view, const Math::Matrix4& projection);
+
+		const LightClusterSettings& GetSettings() const { return m_settings; }
+		uint32_t GetClusterCount() const { return m_settings.tilesX * m_settings.tilesY * m_settings.slices; }
+		// ranges[(slice * tilesY + y) * tilesX + x]By = 0 ԏ̍s
+		const std::vector<ClusterRange>& GetRanges() const { return m_ranges; }
+		const std::vector<uint32_t>& GetIndices() const { return m_indices; }
+		const LightClusterStats& GetStats() const { return m_stats; }
+
+		float GetNearZ() const { return m_nearZ; }
+		float GetFarZ() const { return m_farZ; }
+		// XCX = log(r[[x) * scale + bias
+		float GetSliceScale() const { return m_sliceScale; }
+		float GetSliceBias() const { return m_sliceBias; }
+
+	private:
+		// r[Ԃ̃Cg SoA ŎBɂȂCg 4 ̔{ɖ߂
+		struct LightSoA
+		{
+			std::vector<float> x, y, z, radius;
+			std::vector<float> dirX, dirY, dirZ, cosAngle, sinAngle;
+			std::vector<float> spot;	// X|bg 1A|CgCg 0(~̔Ȃ)
+			std::vector<uint32_t> id;
+
+			void Clear();
+			void Add(const Math::Vector3& position, float range, const Math::Vector3& direction,
+				float cosOuter, bool isSpot, uint32_t lightId);
+			void Push(const LightSoA& from, size_t i);
+			void Pad();
+			size_t Size() const { return id.size(); }
+		};
+
+		struct SliceWork
+		{
+			LightSoA sliceLights;
+			LightSoA rowLights;
+			std::vector<ClusterRange> ranges;	// indices ̒ł̈ʒu
+			std::vector<uint32_t> indices;
+			uint32_t maxClusterLights = 0;
+		};
+
+		void SetupProjection(const Math::Matrix4& projection);
+		void BuildSlice(uint32_t slice);
+
+	private:
+		LightClusterSettings m_settings;
+
+		float m_nearZ;
+		float m_farZ;
+		float m_sliceScale;
+		float m_sliceBias;
+		std::vector<float> m_sliceDepth;	// XCX + 1 ̋E
+		// XCXƂ́Ae^C̃r[ x ͈͂Ɗes y ͈
+		std::vector<float> m_columnMin, m_columnMax;
+		std::vector<float> m_rowMin, m_rowMax;
+
+		LightSoA m_lights;
+		std::vector<Math::Vector3> m_positions;
+		std::vector<Math::Vector3> m_directions;
+		std::vector<SliceWork> m_slices;
+
+		std::vector<ClusterRange> m_ranges;
+		std::vector<uint32_t> m_indices;
+		LightClusterStats m_stats;
+	};
+}
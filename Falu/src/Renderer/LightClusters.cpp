@@ -0,0 +1,138 @@
+/*****************************************************************//**
+ * \file   LightClusters.cpp
+ * \brief  LightClusterBuffers ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "LightClusters.h"
+#include "Renderer/RenderStateTracker.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Falu
+{
+	//=== LightClusterBuffers ===
+
+	LightClusterBuffers::LightClusterBuffers()
+		: m_device(nullptr)
+		, m_lightCount(0)
+	{
+
+	}
+
+	bool LightClusterBuffers::Initialize(ID3D11Device* device)
+	{
+		m_device = device;
+		if (!m_constants.Initialize(device))
+			return false;
+
+		// ĂAUpload ŕKvɉđ傫
+		uint32_t zero = 0;
+		ClusterRange empty = { 0, 0 };
+		ClusterLight none = {};
+		return Upload(nullptr, m_lights, &none, 1, sizeof(ClusterLight)) &&
+			Upload(nullptr, m_ranges, &empty, 1, sizeof(ClusterRange)) &&
+			Upload(nullptr, m_indices, &zero, 1, sizeof(uint32_t));
+	}
+
+	void LightClusterBuffers::Shutdown()
+	{
+		m_lights = DynamicBuffer();
+		m_ranges = DynamicBuffer();
+		m_indices = DynamicBuffer();
+		m_device = nullptr;
+	}
+
+	bool LightClusterBuffers::UploadLights(ID3D11DeviceContext* context, const std::vector<ClusterLight>& lights)
+	{
+		m_lightCount = static_cast<uint32_t>(lights.size());
+		if (lights.empty())
+			return true;
+		return Upload(context, m_lights, lights.data(), m_lightCount, sizeof(ClusterLight));
+	}
+
+	bool LightClusterBuffers::UploadClusters(ID3D11DeviceContext* context, const LightClusterGrid& grid, const D3D11_VIEWPORT& viewport)
+	{
+		const LightClusterSettings& settings = grid.GetSettings();
+
+		ClusterConstantBuffer constants;
+		constants.grid = DirectX::XMUINT4(settings.tilesX, settings.tilesY, settings.slices, m_lightCount);
+		constants.depth = DirectX::XMFLOAT4(grid.GetNearZ(), grid.GetFarZ(), grid.GetSliceScale(), grid.GetSliceBias());
+		constants.viewport = DirectX::XMFLOAT4(viewport.TopLeftX, viewport.TopLeftY,
+			1.0f / std::max(viewport.Width, 1.0f), 1.0f / std::max(viewport.Height, 1.0f));
+		m_constants.Update(context, constants);
+
+		const std::vector<ClusterRange>& ranges = grid.GetRanges();
+		const std::vector<uint32_t>& indices = grid.GetIndices();
+		bool ok = Upload(context, m_ranges, ranges.data(), static_cast<uint32_t>(ranges.size()), sizeof(ClusterRange));
+		if (!indices.empty())
+			ok = Upload(context, m_indices, indices.data(), static_cast<uint32_t>(indices.size()), sizeof(uint32_t)) && ok;
+		return ok;
+	}
+
+	void LightClusterBuffers::Bind(RenderStateTracker& state) const
+	{
+		state.SetPSShaderResource(kLightSlot, m_lights.srv.Get());
+		state.SetPSShaderResource(kRangeSlot, m_ranges.srv.Get());
+		state.SetPSShaderResource(kIndexSlot, m_indices.srv.Get());
+		state.SetPSConstantBuffer(kConstantSlot, m_constants.GetBuffer());
+	}
+
+	bool LightClusterBuffers::Upload(ID3D11DeviceContext* context, DynamicBuffer& target, const void* data, uint32_t count, uint32_t stride)
+	{
+		if (!m_device || count == 0)
+			return false;
+
+		if (count > target.capacity)
+		{
+			uint32_t capacity = 64;
+			while (capacity < count)
+				capacity *= 2;
+
+			D3D11_BUFFER_DESC desc = {};
+			desc.Usage = D3D11_USAGE_DYNAMIC;
+			desc.ByteWidth = capacity * stride;
+			desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+			desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+			desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+			desc.StructureByteStride = stride;
+
+			ComPtr<ID3D11Buffer> buffer;
+			HRESULT hr = m_device->CreateBuffer(&desc, nullptr, &buffer);
+			if (FAILED(hr))
+			{
+				OutputDebugStringA("[LightClusterBuffers] Failed to create structured buffer\n");
+				return false;
+			}
+
+			D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+			srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+			srvDesc.Buffer.FirstElement = 0;
+			srvDesc.Buffer.NumElements = capacity;
+
+			ComPtr<ID3D11ShaderResourceView> srv;
+			hr = m_device->CreateShaderResourceView(buffer.Get(), &srvDesc, &srv);
+			if (FAILED(hr))
+				return false;
+
+			target.buffer = buffer;
+			target.srv = srv;
+			target.capacity = capacity;
+		}
+
+		// Initialize ̓obt@邾
+		if (!context)
+			return true;
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		HRESULT hr = context->Map(target.buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+		if (FAILED(hr))
+			return false;
+		memcpy(mapped.pData, data, static_cast<size_t>(count) * stride);
+		context->Unmap(target.buffer.Get(), 0);
+		return true;
+	}
+}
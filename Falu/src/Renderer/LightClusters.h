@@ -0,0 +1,65 @@
+/*****************************************************************//**
+ * \file   LightClusters.h
+ * \brief  NX^[htH[hCeBO GPU obt@(Cg蓖Ă LightClusterGrid.h)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+#include "Renderer/LightClusterGrid.h"
+#include "Renderer/ConstantBuffer.h"
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	class RenderStateTracker;
+
+	// NX^[ GPU (`Xbh)B
+	// Cg(t13)ANX^[͈̔(t14)ACg̃CfbNXXg(t15)𓮓Iȍ\obt@ŎA
+	// Obh̒萔(b4)
+	class LightClusterBuffers
+	{
+	public:
+		static constexpr UINT kLightSlot = 13;
+		static constexpr UINT kRangeSlot = 14;
+		static constexpr UINT kIndexSlot = 15;
+		static constexpr UINT kConstantSlot = 4;
+
+		LightClusterBuffers();
+
+		bool Initialize(ID3D11Device* device);
+		void Shutdown();
+
+		// t[ 1 : er[̃CfbNXXgwCg
+		bool UploadLights(ID3D11DeviceContext* context, const std::vector<ClusterLight>& lights);
+		// r[Ƃ 1 ALightClusterGrid::Build ̌ŌĂԁBviewport ̓r[̃sNZ͈
+		bool UploadClusters(ID3D11DeviceContext* context, const LightClusterGrid& grid, const D3D11_VIEWPORT& viewport);
+
+		void Bind(RenderStateTracker& state) const;
+
+	private:
+		struct DynamicBuffer
+		{
+			ComPtr<ID3D11Buffer> buffer;
+			ComPtr<ID3D11ShaderResourceView> srv;
+			uint32_t capacity = 0;
+		};
+
+		// ȂΎ 2 ׂ̂܂ő傫ĂAWRITE_DISCARD ŏ
+		bool Upload(ID3D11DeviceContext* context, DynamicBuffer& target, const void* data, uint32_t count, uint32_t stride);
+
+	private:
+		ID3D11Device* m_device;
+		DynamicBuffer m_lights;
+		DynamicBuffer m_ranges;
+		DynamicBuffer m_indices;
+		ConstantBuffer<ClusterConstantBuffer> m_constants;
+		uint32_t m_lightCount;
+	};
+}
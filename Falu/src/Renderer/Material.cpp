@@ -9,9 +9,47 @@
 
 #include "Shader.h"
 #include "Texture.h"
+#include "RenderStateTracker.h"
+
+#include <cstring>
+#include <mutex>
+#include <vector>
 
 namespace Falu
 {
+	namespace
+	{
+		std::atomic<uint64_t> s_versionCounter{ 0 };
+
+		uint64_t NextVersion()
+		{
+			return s_versionCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		// }eAID̊蓖(jꂽID͍ėpăe[ul߂)
+		std::mutex s_idMutex;
+		std::vector<uint32_t> s_freeIds;
+		uint32_t s_nextId = 0;
+
+		uint32_t AllocateMaterialId()
+		{
+			std::lock_guard<std::mutex> lock(s_idMutex);
+			if (!s_freeIds.empty())
+			{
+				uint32_t id = s_freeIds.back();
+				s_freeIds.pop_back();
+				return id;
+			}
+			return s_nextId++;
+		}
+
+		void FreeMaterialId(uint32_t id)
+		{
+			std::lock_guard<std::mutex> lock(s_idMutex);
+			s_freeIds.push_back(id);
+		}
+	}
+
 	Material::Material()
 		:m_shader(nullptr)
 		, m_albedoTexture(nullptr)
@@ -23,13 +61,16 @@ namespace Falu
 		, m_roughness(0.5f)
 		, m_ao(1.0f)
 		, m_emissive(0.0f,0.0f,0.0f,0.0f)
+		, m_version(NextVersion())
+		, m_uploadedVersion(0)
+		, m_materialId(AllocateMaterialId())
 	{
 
 	}
 
 	Material::~Material()
 	{
-
+		FreeMaterialId(m_materialId);
 	}
 
 	bool Material::Initialize(ID3D11Device* device)
@@ -48,6 +89,17 @@ namespace Falu
 	void Material::SetProperties(const MaterialProperties& props)
 	{
 		m_properties = props;
+		MarkDirty();
+	}
+
+	void Material::MarkDirty()
+	{
+		m_version.store(NextVersion(), std::memory_order_release);
+	}
+
+	bool Material::UsesMaterialTable() const
+	{
+		return m_shader && m_shader->GetMaterialTableVariant();
 	}
 
 	void Material::Bind(ID3D11DeviceContext* context)
@@ -77,13 +129,36 @@ namespace Falu
 		// Update Material Constant Buffer
 	}
 
-	void Material::UpdateConstantBuffer(ID3D11DeviceContext* context)
+	bool Material::Bind(RenderStateTracker& state, const MaterialSnapshot& snapshot, uint32_t vertexFormat)
 	{
-		if (!m_constantBuffer)
-			return;
+		if (snapshot.shader)
+		{
+			const Shader* shader = snapshot.shader->GetVertexVariant(vertexFormat);
+			if (!shader)
+				return false;
+			state.SetShader(shader, vertexFormat);
+		}
+		state.SetPSConstantBuffer(2, snapshot.constantBuffer);
 
-		MaterialConstantBuffer cb;
-		cb.albedo = DirectX::XMFLOAT4(
+		// ݒ̃Xbg͑Õ}eÃeNX`c(]BindƓ)
+		for (UINT slot = 0; slot < 4; ++slot)
+		{
+			if (snapshot.textures[slot])
+				state.SetPSShaderResource(slot, snapshot.shaderResources[slot]);
+		}
+		return true;
+	}
+
+	void Material::ExtractSnapshot(MaterialSnapshot& outSnapshot) const
+	{
+		outSnapshot.material = const_cast<Material*>(this);
+		outSnapshot.materialId = m_materialId;
+		outSnapshot.version = GetVersion();
+		outSnapshot.shader = m_shader;
+		outSnapshot.constantBuffer = m_constantBuffer.Get();
+
+		MaterialConstantBuffer& cb = outSnapshot.constants;
+		cb.albedo = Math::Vector4(
 			m_properties.albedo.r,
 			m_properties.albedo.g,
 			m_properties.albedo.b,
@@ -92,29 +167,62 @@ namespace Falu
 
 		float useTexture = (m_albedoTexture != nullptr) ? 1.0f : 0.0f;
 
-		cb.properties = DirectX::XMFLOAT4(
+		cb.properties = Math::Vector4(
 			m_properties.metallic,
 			m_properties.roughness,
 			m_properties.ao,
 			useTexture
 		);
 
-		cb.emissive = DirectX::XMFLOAT4(
+		cb.emissive = Math::Vector4(
 			m_properties.emissive.x,
 			m_properties.emissive.y,
 			m_properties.emissive.z,
 			0.0f
 		);
 
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-		HRESULT hr = context->Map(m_constantBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-		if (SUCCEEDED(hr))
+		const Texture* textures[4] = { m_albedoTexture, m_normalTexture, m_metalicTexture, m_roughnesTexture };
+		for (int i = 0; i < 4; ++i)
 		{
-			memcpy(mappedResource.pData, &cb, sizeof(MaterialConstantBuffer));
-			context->Unmap(m_constantBuffer.Get(), 0);
+			outSnapshot.textures[i] = textures[i];
+			outSnapshot.shaderResources[i] = textures[i] ? textures[i]->GetShaderResourceView() : nullptr;
 		}
+	}
+
+	void Material::UpdateConstantBuffer(ID3D11DeviceContext* context)
+	{
+		if (!m_constantBuffer)
+			return;
+
+		UploadConstantBuffer(context);
 
 		// 萔obt@sNZVF[_[ɃoCh
 		context->PSSetConstantBuffers(2, 1, m_constantBuffer.GetAddressOf());
 	}
+
+	bool Material::UploadConstantBuffer(ID3D11DeviceContext* context)
+	{
+		if (!m_constantBuffer || GetVersion() == m_uploadedVersion)
+			return false;
+
+		MaterialSnapshot snapshot;
+		ExtractSnapshot(snapshot);
+		return UploadConstantBuffer(context, snapshot);
+	}
+
+	bool Material::UploadConstantBuffer(ID3D11DeviceContext* context, const MaterialSnapshot& snapshot)
+	{
+		if (!m_constantBuffer || snapshot.version == m_uploadedVersion)
+			return false;
+
+		D3D11_MAPPED_SUBRESOURCE mappedResource;
+		HRESULT hr = context->Map(m_constantBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+		if (FAILED(hr))
+			return false;// ̃t[ōĒ
+
+		memcpy(mappedResource.pData, &snapshot.constants, sizeof(MaterialConstantBuffer));
+		context->Unmap(m_constantBuffer.Get(), 0);
+		m_uploadedVersion = snapshot.version;
+		return true;
+	}
 }
@@ -9,15 +9,16 @@
 
 #include <d3d11.h>
 #include <wrl/client.h>
-#include <DirectXMath.h>
-#include "Include/Math/MathHelper.h"
+#include "Include/Math/Vector.h"
 #include <memory>
+#include <atomic>
 
 namespace Falu
 {
 	using Microsoft::WRL::ComPtr;
 	class Shader;
 	class Texture;
+	class RenderStateTracker;
 
 	struct MaterialProperties
 	{
@@ -38,9 +39,25 @@ namespace Falu
 
 	struct MaterialConstantBuffer
 	{
-		DirectX::XMFLOAT4 albedo;
-		DirectX::XMFLOAT4 properties; // x: metaric ,y: roughness, z: ao ,w: unused
-		DirectX::XMFLOAT4 emissive;
+		Math::Vector4 albedo;
+		Math::Vector4 properties; // x: metaric ,y: roughness, z: ao ,w: unused
+		Math::Vector4 emissive;
+	};
+
+	class Material;
+
+	// `Xbhɓn}eA̎ʂBQ[XbhoɍA`Xbh͐ Material ǂ܂ɂg
+	struct MaterialSnapshot
+	{
+		Material* material = nullptr;	// `Xbh̏(Abv[hς݃o[W)̎BvpeB͓ǂ܂Ȃ
+		uint32_t materialId = 0;
+		uint64_t version = 0;
+		Shader* shader = nullptr;
+		ID3D11Buffer* constantBuffer = nullptr;
+		MaterialConstantBuffer constants;
+		// albedo / normal / metallic / roughnessB}eAe[u̓eNX`A]̌oH SRV g
+		const Texture* textures[4] = {};
+		ID3D11ShaderResourceView* shaderResources[4] = {};
 	};
 
 	class Material
@@ -52,11 +69,11 @@ namespace Falu
 		bool Initialize(ID3D11Device* device);
 
 		// Material Param Setter
-		void SetAlbedo(const Math::Color& color) { m_albedo = color; }
-		void SetMetallic(float metallic) { m_metallic = metallic; }
-		void SetRoughness(float roughness) { m_roughness = roughness; }
-		void SetAO(float ao) { m_ao = ao; }
-		void SetEmissive(const Math::Color& emissive) { m_emissive = emissive; }
+		void SetAlbedo(const Math::Color& color) { m_albedo = color; MarkDirty(); }
+		void SetMetallic(float metallic) { m_metallic = metallic; MarkDirty(); }
+		void SetRoughness(float roughness) { m_roughness = roughness; MarkDirty(); }
+		void SetAO(float ao) { m_ao = ao; MarkDirty(); }
+		void SetEmissive(const Math::Color& emissive) { m_emissive = emissive; MarkDirty(); }
 
 		// Material Param Getter
 		Math::Color GetAlbedo()const { return m_albedo; }
@@ -66,10 +83,11 @@ namespace Falu
 		Math::Color GetEmissive() const { return m_emissive; }
 
 		// Texture Setter
-		void SetAlbedoTexture(Texture* texture) { m_albedoTexture = texture; }
-		void SetNormalTexture(Texture* texture) { m_normalTexture = texture; }
-		void SetMetallicTexture(Texture* texture) { m_metalicTexture = texture; }
-		void SetRoughnessTexture(Texture* texture) { m_roughnesTexture = texture; }
+		// eNX`̓}eAe[u̍ڂɓ(Axh useTexture tOς)̂ŁAǂo[Wi߂
+		void SetAlbedoTexture(Texture* texture) { m_albedoTexture = texture; MarkDirty(); }
+		void SetNormalTexture(Texture* texture) { m_normalTexture = texture; MarkDirty(); }
+		void SetMetallicTexture(Texture* texture) { m_metalicTexture = texture; MarkDirty(); }
+		void SetRoughnessTexture(Texture* texture) { m_roughnesTexture = texture; MarkDirty(); }
 
 		// Texture Getter
 		Texture* GetAlbedoTexture() const { return m_albedoTexture; }
@@ -80,6 +98,29 @@ namespace Falu
 		void Bind(ID3D11DeviceContext* context);
 		void UpdateConstantBuffer(ID3D11DeviceContext* context);
 
+		// ύXƂ萔obt@Btrue
+		bool UploadConstantBuffer(ID3D11DeviceContext* context);
+		// `Xbhp: ʂ̒lŏ(ʂ̃o[WAbv[hς݂ƈႤƂ)
+		bool UploadConstantBuffer(ID3D11DeviceContext* context, const MaterialSnapshot& snapshot);
+
+		// ̒萔/VF[_[/eNX`ʂBvpeBXbh(Q[Xbh)Ă
+		void ExtractSnapshot(MaterialSnapshot& outSnapshot) const;
+
+		// Xe[ggbJ[oR̃oCh(萔͎OUploadConstantBufferĂ)
+		// VF[_[̒_``Ȃ false
+		static bool Bind(RenderStateTracker& state, const MaterialSnapshot& snapshot, uint32_t vertexFormat = 0);
+
+		// vpeBςĂԁBo[W͑S}eAňӂȂ̂ŁAIDėpႦȂ
+		void MarkDirty();
+		bool IsDirty() const { return GetVersion() != m_uploadedVersion; }
+		uint64_t GetVersion() const { return m_version.load(std::memory_order_acquire); }
+
+		// }eAe[ũCfbNX(̃}eAň)
+		uint32_t GetMaterialId() const { return m_materialId; }
+
+		// VF[_[Ƀ}eAe[uł΁A}eA܂ł܂Ƃ߂ĕ`ł
+		bool UsesMaterialTable() const;
+
 		// Settings Shader
 		Shader* GetShader() const { return m_shader; }
 		void SetShader(Shader* shader) { m_shader = shader; }
@@ -104,5 +145,10 @@ namespace Falu
 		float m_roughness;
 		float m_ao;
 		Math::Color m_emissive;
+
+		// V~[VXbhŐi߂āA`XbhAbv[hς݂̒lo(m_uploadedVersion ͕`XbhG)
+		std::atomic<uint64_t> m_version;
+		uint64_t m_uploadedVersion;
+		uint32_t m_materialId;
 	};
 }
@@ -0,0 +1,171 @@
+/*****************************************************************//**
+ * \file   MaterialTable.cpp
+ * \brief  MaterialTable ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "MaterialTable.h"
+#include "Material.h"
+#include "RenderStateTracker.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Falu
+{
+	namespace
+	{
+		constexpr uint32_t kInitialCapacity = 256;
+	}
+
+	MaterialTable::MaterialTable()
+		: m_device(nullptr)
+		, m_capacity(0)
+		, m_dirtyBegin(UINT32_MAX)
+		, m_dirtyEnd(0)
+	{
+	}
+
+	bool MaterialTable::Initialize(ID3D11Device* device)
+	{
+		m_device = device;
+		m_textureArrays.Initialize(device);
+		return Reserve(kInitialCapacity);
+	}
+
+	void MaterialTable::Shutdown()
+	{
+		m_textureArrays.Shutdown();
+		m_srv.Reset();
+		m_buffer.Reset();
+		m_entries.clear();
+		m_slots.clear();
+		m_capacity = 0;
+		m_device = nullptr;
+	}
+
+	bool MaterialTable::Update(ID3D11DeviceContext* context, const MaterialSnapshot& material)
+	{
+		if (!m_buffer)
+			return false;
+
+		uint32_t id = material.materialId;
+		if (id >= m_slots.size())
+		{
+			if (id >= m_capacity && !Reserve(std::max(m_capacity * 2, id + 1)))
+				return false;
+
+			m_slots.resize(id + 1);
+			m_entries.resize(id + 1);
+		}
+
+		Slot& slot = m_slots[id];
+		uint64_t version = material.version;
+		if (slot.version == version && slot.resident)
+			return true;
+
+		MaterialTableEntry entry;
+		entry.albedo = material.constants.albedo;
+		entry.properties = material.constants.properties;
+		entry.properties.w = 0.0f;
+		entry.emissive = material.constants.emissive;
+
+		const Texture* const* textures = material.textures;
+		uint32_t packed[4];
+		bool resident = true;
+		for (int i = 0; i < 4; ++i)
+		{
+			packed[i] = TextureSlice::kNone;
+			if (!textures[i])
+				continue;
+
+			TextureSlice location;
+			if (m_textureArrays.Acquire(context, textures[i], location))
+				packed[i] = location.Pack();
+			else
+				resident = false;
+		}
+		std::memcpy(entry.textures, packed, sizeof(packed));
+
+		// gݒĂg(ڂȂ܂܂̃eNX`)Ȃ瑗蒼Ȃ
+		bool changed = (slot.version != version) || std::memcmp(&m_entries[id], &entry, sizeof(entry)) != 0;
+		m_entries[id] = entry;
+		slot.version = version;
+		slot.resident = resident;
+
+		if (changed)
+		{
+			m_dirtyBegin = std::min(m_dirtyBegin, id);
+			m_dirtyEnd = std::max(m_dirtyEnd, id + 1);
+		}
+		return resident;
+	}
+
+	void MaterialTable::Flush(ID3D11DeviceContext* context)
+	{
+		if (m_dirtyBegin >= m_dirtyEnd)
+			return;
+
+		// t[Ƃ 1 ̘Á͈B}eA͂߂ɕςȂ̂ŁAʂ͐ōς
+		D3D11_BOX box = {};
+		box.left = m_dirtyBegin * sizeof(MaterialTableEntry);
+		box.right = m_dirtyEnd * sizeof(MaterialTableEntry);
+		box.bottom = 1;
+		box.back = 1;
+		context->UpdateSubresource(m_buffer.Get(), 0, &box, &m_entries[m_dirtyBegin], 0, 0);
+
+		m_dirtyBegin = UINT32_MAX;
+		m_dirtyEnd = 0;
+	}
+
+	void MaterialTable::Bind(RenderStateTracker& state) const
+	{
+		state.SetPSShaderResource(kTableSlot, m_srv.Get());
+		for (uint32_t i = 0; i < TextureArrayPool::kMaxArrays; ++i)
+		{
+			state.SetPSShaderResource(kTextureArraySlot + i, m_textureArrays.GetShaderResourceView(i));
+		}
+	}
+
+	bool MaterialTable::Reserve(uint32_t count)
+	{
+		if (!m_device)
+			return false;
+
+		D3D11_BUFFER_DESC desc = {};
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.ByteWidth = count * sizeof(MaterialTableEntry);
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+		desc.StructureByteStride = sizeof(MaterialTableEntry);
+
+		ComPtr<ID3D11Buffer> buffer;
+		HRESULT hr = m_device->CreateBuffer(&desc, nullptr, &buffer);
+		if (FAILED(hr))
+			return false;
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+		srvDesc.Buffer.FirstElement = 0;
+		srvDesc.Buffer.NumElements = count;
+
+		ComPtr<ID3D11ShaderResourceView> srv;
+		hr = m_device->CreateShaderResourceView(buffer.Get(), &srvDesc, &srv);
+		if (FAILED(hr))
+			return false;
+
+		m_buffer = buffer;
+		m_srv = srv;
+		m_capacity = count;
+
+		// Vobt@͋Ȃ̂ŁA킩Ăׂ̂đ蒼
+		if (!m_entries.empty())
+		{
+			m_dirtyBegin = 0;
+			m_dirtyEnd = static_cast<uint32_t>(m_entries.size());
+		}
+		return true;
+	}
+}
@@ -0,0 +1,83 @@
+/*****************************************************************//**
+ * \file   MaterialTable.h
+ * \brief  ׂẴ}eÃp[^[A}eA ID ň 1 ̍\obt@ɂ܂Ƃ߂
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+#include "Include/Math/Vector.h"
+#include "Renderer/TextureArrayPool.h"
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	struct MaterialSnapshot;
+	class RenderStateTracker;
+
+	// Basic.hlsl  MaterialData(MATERIAL_TABLE)Ɠ
+	struct MaterialTableEntry
+	{
+		Math::Vector4 albedo;
+		Math::Vector4 properties;	// x: metallic, y: roughness, z: ao, w: unused
+		Math::Vector4 emissive;
+		uint32_t textures[4];		// Axh / @ / ^bN / tlXBTextureSlice::Pack()  kNone
+	};
+
+	// `XbhBo^ׂẴ}eA CPU ̎ʂA
+	// ÕAbv[h Material ̃o[Wςڂ𑗂B
+	// zɍڂȂeNX`(ǂݍݒȂ)鍀ڂ́Aڂ܂Ŗt[gݒB
+	// ڂ̓t[ MaterialSnapshot AĂ}eA͍ȂB
+	class MaterialTable
+	{
+	public:
+		// t4: e[uAt5..: eNX`z
+		static constexpr UINT kTableSlot = 4;
+		static constexpr UINT kTextureArraySlot = 5;
+
+		MaterialTable();
+
+		bool Initialize(ID3D11Device* device);
+		void Shutdown();
+
+		// }eAςĂ΍ڂXVBe[uŕ\Ȃ}eA(ǂ̔zɂ܂Ȃ
+		// eNX`Ȃ)Ȃ false Ԃ̂ŁÂƂ͏]̕@ŕ`
+		bool Update(ID3D11DeviceContext* context, const MaterialSnapshot& material);
+
+		// ܂Ă鍀ڂAbv[hBt[ Update() ĂяI 1 Ă
+		void Flush(ID3D11DeviceContext* context);
+
+		// e[uƃeNX`zsNZVF[_[ɃoCh
+		void Bind(RenderStateTracker& state) const;
+
+		uint32_t GetEntryCount() const { return static_cast<uint32_t>(m_entries.size()); }
+
+	private:
+		bool Reserve(uint32_t count);
+
+	private:
+		struct Slot
+		{
+			uint64_t version = 0;	// ڂƂ MaterialSnapshot::version
+			bool resident = false;
+		};
+
+		ID3D11Device* m_device;
+		ComPtr<ID3D11Buffer> m_buffer;
+		ComPtr<ID3D11ShaderResourceView> m_srv;
+		uint32_t m_capacity;
+
+		std::vector<MaterialTableEntry> m_entries;
+		std::vector<Slot> m_slots;
+		uint32_t m_dirtyBegin;
+		uint32_t m_dirtyEnd;
+
+		TextureArrayPool m_textureArrays;
+	};
+}
@@ -6,6 +6,8 @@
  * \date   2026/02/07
  *********************************************************************/
 #include "Mesh.h"
+#include "RenderStateTracker.h"
+#include "MeshOptimizer.h"
 
 
 namespace Falu
@@ -13,6 +15,14 @@ namespace Falu
 	Mesh::Mesh()
 		:m_vertexCount(0)
 		,m_indexCount(0)
+		,m_indexFormat(DXGI_FORMAT_R32_UINT)
+		,m_indexStride(sizeof(uint32_t))
+		,m_cpuAccess(MeshCpuAccess::None)
+		,m_vertexFormat(VertexFormat::Standard)
+		,m_vertexStride(sizeof(Vertex))
+		,m_uploadVertexData(nullptr)
+		,m_uploadIndexData(nullptr)
+		,m_uploadPending(false)
 	{
 
 	}
@@ -22,27 +32,175 @@ namespace Falu
 		Release();
 	}
 
-	bool Mesh::Initialize(ID3D11Device* device, const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+	bool Mesh::Initialize(ID3D11Device* device, ArrayView<Vertex> vertices, ArrayView<unsigned int> indices, uint32_t vertexFormat, uint32_t cpuAccess)
 	{
-		return Create(device,vertices,indices);
+		return Create(device,vertices,indices,vertexFormat,cpuAccess);
 	}
 
-	bool Mesh::Create(ID3D11Device* device, const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+	bool Mesh::Create(ID3D11Device* device, ArrayView<Vertex> vertices, ArrayView<unsigned int> indices, uint32_t vertexFormat, uint32_t cpuAccess)
 	{
-		m_vertices = vertices;
-		m_indices = indices;
+		IndexData indexData;
+		indexData.Assign(indices.data(), indices.size(), vertices.size());
+		if (!CreateBuffers(device, vertices, indexData, vertexFormat))
+			return false;
+
+		// ł GPU ɏグ CPU ɂ͉cȂ
+		if (cpuAccess != MeshCpuAccess::None)
+		{
+			m_vertices.assign(vertices.begin(), vertices.end());
+			m_indices = std::move(indexData);
+		}
+		if (cpuAccess & MeshCpuAccess::Raycast)
+			m_bvh.Build(m_vertices, m_indices);
+		m_cpuAccess = cpuAccess;
+		return true;
+	}
+
+	bool Mesh::Create(ID3D11Device* device, std::vector<Vertex>&& vertices, std::vector<unsigned int>&& indices, uint32_t vertexFormat, uint32_t cpuAccess)
+	{
+		Prepare(std::move(vertices), std::move(indices), vertexFormat, cpuAccess);
+		return Upload(device);
+	}
+
+	void Mesh::Prepare(std::vector<Vertex>&& vertices, std::vector<unsigned int>&& indices, uint32_t vertexFormat, uint32_t cpuAccess)
+	{
+		IndexData indexData;
+		indexData.Assign(std::move(indices), vertices.size());
+		SetLayout(vertices, indexData, vertexFormat);
+
+		if (m_vertexFormat != VertexFormat::Standard)
+		{
+			VertexFormat::Encode(m_vertexFormat, vertices, m_encodedVertices, m_positionTransform);
+			// lߒ Vertex  CPU ɎcƂv
+			if (cpuAccess == MeshCpuAccess::None)
+			{
+				vertices.clear();
+				vertices.shrink_to_fit();
+			}
+		}
+		m_vertices = std::move(vertices);
+		m_indices = std::move(indexData);
+		if (cpuAccess & MeshCpuAccess::Raycast)
+			m_bvh.Build(m_vertices, m_indices);
+		m_cpuAccess = cpuAccess;
+		m_uploadPending = true;
+	}
+
+	void Mesh::Prepare(const MeshUploadData& data, uint32_t cpuAccess)
+	{
+		// CAEgݒ肵ĂA/`/oEfBOۑĂ̂ɒu
+		SetLayout(ArrayView<Vertex>(), IndexData(), data.vertexFormat);
+		m_vertexCount = data.vertexCount;
+		m_indexCount = data.indexCount;
+		m_indexFormat = data.indices16Bit ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+		m_indexStride = data.indices16Bit ? sizeof(uint16_t) : sizeof(uint32_t);
+		m_positionTransform = data.positionTransform;
+		m_bounds = data.bounds;
+		m_uploadVertexData = data.vertexData;
+		m_uploadIndexData = data.indexData;
+
+		if (cpuAccess != MeshCpuAccess::None && data.cpuVertices)
+		{
+			m_vertices.assign(data.cpuVertices, data.cpuVertices + data.vertexCount);
+			if (data.indices16Bit)
+				m_indices.Assign(static_cast<const uint16_t*>(data.indexData), data.indexCount, data.vertexCount);
+			else
+				m_indices.Assign(static_cast<const uint32_t*>(data.indexData), data.indexCount, data.vertexCount);
+			if (cpuAccess & MeshCpuAccess::Raycast)
+				m_bvh.Build(m_vertices, m_indices);
+			m_cpuAccess = cpuAccess;
+		}
+		m_uploadPending = true;
+	}
+
+	const void* Mesh::GetUploadVertexData() const
+	{
+		if (m_uploadVertexData)
+			return m_uploadVertexData;
+		return m_encodedVertices.empty() ? static_cast<const void*>(m_vertices.data()) : m_encodedVertices.data();
+	}
+
+	const void* Mesh::GetUploadIndexData() const
+	{
+		return m_uploadIndexData ? m_uploadIndexData : m_indices.GetData();
+	}
+
+	bool Mesh::Upload(ID3D11Device* device)
+	{
+		if (!m_uploadPending)
+			return m_vertexBuffer != nullptr;
+
+		bool result = CreateGpuBuffers(device, GetUploadVertexData(), GetUploadIndexData());
+
+		m_encodedVertices.clear();
+		m_encodedVertices.shrink_to_fit();
+		m_uploadVertexData = nullptr;
+		m_uploadIndexData = nullptr;
+		m_uploadPending = false;
+		if (m_cpuAccess == MeshCpuAccess::None)
+		{
+			m_vertices.clear();
+			m_vertices.shrink_to_fit();
+			m_indices.Clear();
+		}
+		return result;
+	}
+
+	void Mesh::SetLayout(ArrayView<Vertex> vertices, const IndexData& indices, uint32_t vertexFormat)
+	{
+		if (!VertexFormat::IsValid(vertexFormat))
+			vertexFormat = VertexFormat::Standard;
+
+		// 蒼̂ƂɑO CPU f[^cȂ
+		m_vertices.clear();
+		m_vertices.shrink_to_fit();
+		m_indices.Clear();
+		m_meshlets.clear();
+		m_bvh.Clear();
+		m_encodedVertices.clear();
+		m_encodedVertices.shrink_to_fit();
+		m_uploadVertexData = nullptr;
+		m_uploadIndexData = nullptr;
+		m_uploadPending = false;
+		m_cpuAccess = MeshCpuAccess::None;
+
 		m_vertexCount = static_cast<unsigned int>(vertices.size());
-		m_indexCount = static_cast<unsigned int>(indices.size());
+		m_indexCount = static_cast<unsigned int>(indices.GetCount());
+		m_indexFormat = indices.Is16Bit() ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+		m_indexStride = indices.GetStride();
+		m_vertexFormat = vertexFormat;
+		m_vertexStride = VertexFormat::GetStride(vertexFormat);
+		m_positionTransform = VertexFormat::PositionTransform();
+		m_bounds = CalculateBounds(vertices);
+	}
+
+	bool Mesh::CreateBuffers(ID3D11Device* device, ArrayView<Vertex> vertices, const IndexData& indices, uint32_t vertexFormat)
+	{
+		SetLayout(vertices, indices, vertexFormat);
+		vertexFormat = m_vertexFormat;
 
+		// RpNg`͂GPUpɋlߒ
+		const void* vertexSource = vertices.data();
+		std::vector<uint8_t> encoded;
+		if (vertexFormat != VertexFormat::Standard)
+		{
+			VertexFormat::Encode(vertexFormat, vertices, encoded, m_positionTransform);
+			vertexSource = encoded.data();
+		}
+		return CreateGpuBuffers(device, vertexSource, indices.GetData());
+	}
+
+	bool Mesh::CreateGpuBuffers(ID3D11Device* device, const void* vertexSource, const void* indexSource)
+	{
 		// _obt@̍쐬
 		D3D11_BUFFER_DESC vertexBufferDesc = {};
 		vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-		vertexBufferDesc.ByteWidth = sizeof(Vertex) * m_vertexCount;
+		vertexBufferDesc.ByteWidth = m_vertexStride * m_vertexCount;
 		vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		vertexBufferDesc.CPUAccessFlags = 0;
 
 		D3D11_SUBRESOURCE_DATA vertexData = {};
-		vertexData.pSysMem = vertices.data();
+		vertexData.pSysMem = vertexSource;
 
 		HRESULT hr = device->CreateBuffer(&vertexBufferDesc, &vertexData, &m_vertexBuffer);
 		if (FAILED(hr))
@@ -51,12 +209,12 @@ namespace Falu
 		// CfbNXobt@̍쐬
 		D3D11_BUFFER_DESC indexBufferDesc = {};
 		indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-		indexBufferDesc.ByteWidth = sizeof(unsigned int) * m_indexCount;
+		indexBufferDesc.ByteWidth = static_cast<UINT>(GetIndexBufferSize());
 		indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 		indexBufferDesc.CPUAccessFlags = 0;
 
 		D3D11_SUBRESOURCE_DATA indexData = {};
-		indexData.pSysMem = indices.data();
+		indexData.pSysMem = indexSource;
 
 		hr = device->CreateBuffer(&indexBufferDesc, &indexData, &m_indexBuffer);
 		return SUCCEEDED(hr);
@@ -64,27 +222,62 @@ namespace Falu
 
 	void Mesh::Render(ID3D11DeviceContext* context)
 	{
-		UINT stride = sizeof(Vertex);
+		UINT stride = m_vertexStride;
 		UINT offset = 0;
 
 		context->IASetVertexBuffers(0, 1, m_vertexBuffer.GetAddressOf(), &stride, &offset);
-		context->IASetIndexBuffer(m_indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+		context->IASetIndexBuffer(m_indexBuffer.Get(), m_indexFormat, 0);
 		context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		context->DrawIndexed(m_indexCount, 0, 0);
 	}
 
+	void Mesh::Render(RenderStateTracker& state, UINT instanceCount)
+	{
+		state.SetVertexBuffer(m_vertexBuffer.Get(), m_vertexStride, 0);
+		state.SetIndexBuffer(m_indexBuffer.Get(), m_indexFormat, 0);
+		state.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+		ID3D11DeviceContext* context = state.GetContext();
+		if (instanceCount > 1)
+			context->DrawIndexedInstanced(m_indexCount, instanceCount, 0, 0, 0);
+		else
+			context->DrawIndexed(m_indexCount, 0, 0);
+	}
+
+	void Mesh::Render(RenderStateTracker& state, const IndexRange* ranges, uint32_t rangeCount)
+	{
+		state.SetVertexBuffer(m_vertexBuffer.Get(), m_vertexStride, 0);
+		state.SetIndexBuffer(m_indexBuffer.Get(), m_indexFormat, 0);
+		state.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+		ID3D11DeviceContext* context = state.GetContext();
+		for (uint32_t i = 0; i < rangeCount; ++i)
+		{
+			context->DrawIndexed(ranges[i].indexCount, ranges[i].indexOffset, 0);
+		}
+	}
+
 	void Mesh::Release()
 	{
 		m_vertexBuffer.Reset();
 		m_indexBuffer.Reset();
 		m_vertices.clear();
-		m_indices.clear();
+		m_vertices.shrink_to_fit();
+		m_indices.Clear();
+		m_meshlets.clear();
+		m_meshlets.shrink_to_fit();
+		m_bvh.Clear();
+		m_encodedVertices.clear();
+		m_encodedVertices.shrink_to_fit();
+		m_uploadVertexData = nullptr;
+		m_uploadIndexData = nullptr;
+		m_uploadPending = false;
 	}
 
 	//========= }`쐬 =========
 
-	std::shared_ptr<Mesh> Mesh::CreateTriangle(ID3D11Device* device)
+	std::shared_ptr<Mesh> Mesh::CreateTriangle(ID3D11Device* device, uint32_t cpuAccess)
 	{
 		std::vector<Vertex> vertices =
 		{
@@ -96,7 +289,7 @@ namespace Falu
 		std::vector<unsigned int>indices = { 0,1,2 };
 
 		auto mesh = std::make_shared<Mesh>();
-		if (mesh->Create(device, vertices, indices))
+		if (mesh->Create(device, vertices, indices, VertexFormat::Standard, cpuAccess))
 		{
 			return mesh;
 		}
@@ -104,7 +297,7 @@ namespace Falu
 		return nullptr;
 	}
 
-	std::shared_ptr<Mesh> Mesh::CreateQuad(ID3D11Device* device)
+	std::shared_ptr<Mesh> Mesh::CreateQuad(ID3D11Device* device, uint32_t cpuAccess)
 	{
 		std::vector<Vertex> vertices =
 		{
@@ -117,7 +310,7 @@ namespace Falu
 		std::vector<unsigned int>indices = { 0,1,2,0,2,3 };
 
 		auto mesh = std::make_shared<Mesh>();
-		if (mesh->Create(device, vertices, indices))
+		if (mesh->Create(device, vertices, indices, VertexFormat::Standard, cpuAccess))
 		{
 			return mesh;
 		}
@@ -125,7 +318,7 @@ namespace Falu
 		return nullptr;
 	}
 
-	std::shared_ptr<Mesh> Mesh::CreateCube(ID3D11Device* device)
+	std::shared_ptr<Mesh> Mesh::CreateCube(ID3D11Device* device, uint32_t cpuAccess)
 	{
 		std::vector<Vertex> vertices =
 		{
@@ -177,7 +370,7 @@ namespace Falu
 		};
 
 		auto mesh = std::make_shared<Mesh>();
-		if (mesh->Create(device, vertices, indices))
+		if (mesh->Create(device, vertices, indices, VertexFormat::Standard, cpuAccess))
 		{
 			return mesh;
 		}
@@ -185,7 +378,7 @@ namespace Falu
 		return nullptr;
 	}
 
-	std::shared_ptr<Mesh> Mesh::CreateSphere(ID3D11Device* device, int segments)
+	std::shared_ptr<Mesh> Mesh::CreateSphere(ID3D11Device* device, int segments, uint32_t cpuAccess)
 	{
 		std::vector<Vertex> vertices;
 		std::vector<unsigned int> indices;
@@ -235,8 +428,11 @@ namespace Falu
 			}
 		}
 
+		// ̂܂܂ƒ_LbVɍȂ̂ŕבւ
+		MeshOptimizer::Optimize(vertices, indices, MeshOptimizer::Settings());
+
 		auto mesh = std::make_shared<Mesh>();
-		if (mesh->Create(device, vertices, indices))
+		if (mesh->Create(device, vertices, indices, VertexFormat::Standard, cpuAccess))
 		{
 			return mesh;
 		}
@@ -244,7 +440,7 @@ namespace Falu
 		return nullptr;
 	}
 
-	std::shared_ptr<Mesh> Mesh::CreateCylinder(ID3D11Device* device, int segments)
+	std::shared_ptr<Mesh> Mesh::CreateCylinder(ID3D11Device* device, int segments, uint32_t cpuAccess)
 	{
 		std::vector<Vertex> vertices;
 		std::vector<unsigned int> indices;
@@ -289,8 +485,11 @@ namespace Falu
 			indices.push_back(base + 2);
 		}
 
+		// ̂܂܂ƒ_LbVɍȂ̂ŕבւ
+		MeshOptimizer::Optimize(vertices, indices, MeshOptimizer::Settings());
+
 		auto mesh = std::make_shared<Mesh>();
-		if (mesh->Create(device, vertices, indices))
+		if (mesh->Create(device, vertices, indices, VertexFormat::Standard, cpuAccess))
 		{
 			return mesh;
 		}
@@ -298,7 +497,7 @@ namespace Falu
 		return nullptr;
 	}
 
-	std::shared_ptr<Mesh> Mesh::CreatePlane(ID3D11Device* device, float width, float depth, int division)
+	std::shared_ptr<Mesh> Mesh::CreatePlane(ID3D11Device* device, float width, float depth, int division, uint32_t cpuAccess)
 	{
 		std::vector<Vertex> vertices;
 		std::vector<unsigned int> indices;
@@ -345,25 +544,37 @@ namespace Falu
 			}
 		}
 
+		// ̂܂܂ƒ_LbVɍȂ̂ŕבւ
+		MeshOptimizer::Optimize(vertices, indices, MeshOptimizer::Settings());
+
 		auto mesh = std::make_shared<Mesh>();
-		if (mesh->Create(device, vertices, indices))
+		if (mesh->Create(device, vertices, indices, VertexFormat::Standard, cpuAccess))
 		{
 			return mesh;
 		}
 
 		return nullptr;
 	}
-	Math::AABB Mesh::CalculateBounds() const
+
+	Math::Matrix4 Mesh::GetPositionDequantization() const
 	{
-		if (m_vertices.empty())
+		if (!HasQuantizedPositions())
+			return Math::Matrix4::Identity();
+
+		return Math::Matrix4::Scaling(m_positionTransform.scale) * Math::Matrix4::Translation(m_positionTransform.offset);
+	}
+
+	Math::AABB Mesh::CalculateBounds(ArrayView<Vertex> vertices)
+	{
+		if (vertices.empty())
 		{
 			return Math::AABB(Math::Vector3(0, 0, 0), Math::Vector3(0, 0, 0));
 		}
 
-		Math::Vector3 min = m_vertices[0].position;
-		Math::Vector3 max = m_vertices[0].position;
+		Math::Vector3 min = vertices[0].position;
+		Math::Vector3 max = vertices[0].position;
 
-		for (const auto& vertex : m_vertices)
+		for (const auto& vertex : vertices)
 		{
 			min.x = std::min(min.x, vertex.position.x);
 			min.y = std::min(min.y, vertex.position.y);
@@ -376,4 +587,220 @@ namespace Falu
 
 		return Math::AABB(min,max);
 	}
+
+	void Mesh::AddLod(std::shared_ptr<Mesh> mesh, float screenSize)
+	{
+		if (!mesh)
+			return;
+		m_lods.push_back({ std::move(mesh), screenSize });
+	}
+
+	Mesh* Mesh::GetLod(uint32_t level)
+	{
+		if (level == 0 || level > m_lods.size())
+			return this;
+		return m_lods[level - 1].mesh.get();
+	}
+
+	float Mesh::GetLodScreenSize(uint32_t level) const
+	{
+		if (level == 0 || level > m_lods.size())
+			return 1.0f;
+		return m_lods[level - 1].screenSize;
+	}
+
+	uint32_t Mesh::SelectLod(float screenSize, uint32_t currentLod, float hysteresis) const
+	{
+		// E i (LOD i-1  i ̊)ƂɁA鑤甲Ƃ
+		uint32_t level = 0;
+		for (uint32_t i = 1; i <= m_lods.size(); ++i)
+		{
+			float threshold = m_lods[i - 1].screenSize;
+			bool coarser = (currentLod >= i)
+				? screenSize <= threshold * (1.0f + hysteresis)
+				: screenSize < threshold * (1.0f - hysteresis);
+			if (!coarser)
+				break;
+			level = i;
+		}
+		return level;
+	}
+
+	MeshMemoryUsage Mesh::GetMemoryUsage(bool includeLods) const
+	{
+		MeshMemoryUsage usage;
+		if (m_vertexBuffer)
+			usage.gpuBytes += GetVertexBufferSize();
+		if (m_indexBuffer)
+			usage.gpuBytes += GetIndexBufferSize();
+		usage.cpuBytes += m_vertices.capacity() * sizeof(Vertex);
+		usage.cpuBytes += m_indices.GetSizeInBytes();
+		usage.cpuBytes += m_encodedVertices.capacity();
+		usage.cpuBytes += m_meshlets.capacity() * sizeof(Meshlet);
+		usage.cpuBytes += m_bvh.GetMemoryUsage();
+
+		if (includeLods)
+		{
+			for (const Lod& lod : m_lods)
+				usage.Add(lod.mesh->GetMemoryUsage(false));
+		}
+		return usage;
+	}
+
+	bool Mesh::RayCast(const Math::Ray& localRay, float maxDistance, MeshRayHit& outHit) const
+	{
+		if (!m_bvh.RayCast(localRay, maxDistance, outHit))
+			return false;
+
+		InterpolateHitNormal(outHit);
+		return true;
+	}
+
+	void Mesh::InterpolateHitNormal(MeshRayHit& hit) const
+	{
+		// _@dSWŕԂ(kނĂΖʖ@̂܂)
+		size_t base = (size_t)hit.triangleIndex * 3;
+		if (base + 2 >= m_indices.GetCount())
+			return;
+
+		const Math::Vector3& n0 = m_vertices[m_indices[base + 0]].normal;
+		const Math::Vector3& n1 = m_vertices[m_indices[base + 1]].normal;
+		const Math::Vector3& n2 = m_vertices[m_indices[base + 2]].normal;
+		float u = hit.barycentrics.x;
+		float v = hit.barycentrics.y;
+		float w = 1.0f - u - v;
+		Math::Vector3 n(n0.x * w + n1.x * u + n2.x * v,
+			n0.y * w + n1.y * u + n2.y * v,
+			n0.z * w + n1.z * u + n2.z * v);
+		float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+		if (length > 0.0f)
+			hit.normal = Math::Vector3(n.x / length, n.y / length, n.z / length);
+	}
+
+	void Mesh::HitToWorld(MeshRayHit& hit, const Math::Matrix4& world, const Math::Matrix4& invWorld)
+	{
+		hit.position = Math::TransformPoint(hit.position, world);
+		// @͋t]uŖ߂(lXP[΍)
+		hit.normal = Math::Normalize(Math::TransformVector(hit.normal, Math::Transpose(invWorld)));
+	}
+
+	bool Mesh::RayCast(const Math::Ray& worldRay, const Math::Matrix4& world, float maxDistance, MeshRayHit& outHit) const
+	{
+		if (m_bvh.IsEmpty())
+			return false;
+
+		// ͐KȂ(t [hƓlɂȂ)
+		float determinant;
+		Math::Matrix4 invWorld = Math::Inverse(world, &determinant);
+		if (determinant == 0.0f)
+			return false;
+
+		Math::Ray localRay(Math::TransformPoint(worldRay.origin, invWorld), Math::TransformVector(worldRay.direction, invWorld));
+		if (!RayCast(localRay, maxDistance, outHit))
+			return false;
+
+		HitToWorld(outHit, world, invWorld);
+		return true;
+	}
+
+	uint32_t Mesh::RayCastPacket(const Math::RayPacket& worldPacket, const Math::Matrix4& world,
+		const float maxDistance[Math::RayPacket::kWidth], MeshRayHit outHits[Math::RayPacket::kWidth]) const
+	{
+		if (m_bvh.IsEmpty() || worldPacket.activeMask == 0)
+			return 0;
+
+		float determinant;
+		Math::Matrix4 invWorld = Math::Inverse(world, &determinant);
+		if (determinant == 0.0f)
+			return 0;
+
+		// e[[JԂ(͐KȂ̂ t ̓[hƓ)
+		Math::RayPacket localPacket;
+		for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+		{
+			if (!(worldPacket.activeMask & (1u << lane)))
+				continue;
+
+			Math::Vector3 origin(worldPacket.ox[lane], worldPacket.oy[lane], worldPacket.oz[lane]);
+			Math::Vector3 direction(worldPacket.dx[lane], worldPacket.dy[lane], worldPacket.dz[lane]);
+			localPacket.SetLane(lane, Math::Ray(Math::TransformPoint(origin, invWorld), Math::TransformVector(direction, invWorld)));
+		}
+
+		uint32_t hitMask = m_bvh.RayCastPacket(localPacket, maxDistance, outHits);
+		for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+		{
+			if (!(hitMask & (1u << lane)))
+				continue;
+			InterpolateHitNormal(outHits[lane]);
+			HitToWorld(outHits[lane], world, invWorld);
+		}
+		return hitMask;
+	}
+
+	void Mesh::SetMeshlets(std::vector<Meshlet> meshlets)
+	{
+		// CfbNXobt@̊OŵΎgȂ
+		for (const Meshlet& meshlet : meshlets)
+		{
+			if ((size_t)meshlet.indexOffset + meshlet.triangleCount * 3 > m_indexCount)
+			{
+				OutputDebugStringA("[Mesh] Meshlets do not match the index buffer\n");
+				m_meshlets.clear();
+				return;
+			}
+		}
+		m_meshlets = std::move(meshlets);
+	}
+
+	std::vector<MeshChunk> Mesh::SplitByVertexLimit(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, uint32_t maxVertices)
+	{
+		std::vector<MeshChunk> chunks;
+		if (maxVertices < 3)
+			return chunks;
+
+		// remap[v]  stamp[v] == ̉ԍ̂ƂL(򂲂ƂɃNAȂčς)
+		const uint32_t kUnused = UINT32_MAX;
+		std::vector<uint32_t> remap(vertices.size(), 0);
+		std::vector<uint32_t> stamp(vertices.size(), kUnused);
+		uint32_t chunkId = 0;
+
+		chunks.emplace_back();
+		for (size_t t = 0; t + 2 < indices.size(); t += 3)
+		{
+			// ̎Op`ő钸_
+			uint32_t newVertices = 0;
+			for (int k = 0; k < 3; ++k)
+			{
+				unsigned int v = indices[t + k];
+				bool seen = stamp[v] == chunkId;
+				for (int j = 0; j < k && !seen; ++j)
+					seen = indices[t + j] == v;
+				if (!seen)
+					++newVertices;
+			}
+
+			if (chunks.back().vertices.size() + newVertices > maxVertices)
+			{
+				chunks.emplace_back();
+				++chunkId;
+			}
+
+			MeshChunk& chunk = chunks.back();
+			for (int k = 0; k < 3; ++k)
+			{
+				unsigned int v = indices[t + k];
+				if (stamp[v] != chunkId)
+				{
+					stamp[v] = chunkId;
+					remap[v] = static_cast<uint32_t>(chunk.vertices.size());
+					chunk.vertices.push_back(vertices[v]);
+				}
+				chunk.indices.push_back(remap[v]);
+			}
+		}
+
+		if (chunks.back().indices.empty())
+			chunks.pop_back();
+		return chunks;
+	}
 }
@@ -9,37 +9,69 @@
 
 #include <d3d11.h>
 #include <wrl/client.h>
-#include <DirectXMath.h>
 #include <vector>
 #include <memory>
-#include "Include/Math/MathHelper.h"
+#include "Include/Math/Matrix.h"
 #include "Include/Math/Ray.h"
+#include "Include/Utils/ArrayView.h"
+#include "Renderer/VertexTypes.h"
+#include "Renderer/VertexFormat.h"
+#include "Renderer/IndexData.h"
+#include "Renderer/Meshlet.h"
+#include "Renderer/MeshBvh.h"
 
 namespace Falu
 {
 	using Microsoft::WRL::ComPtr;
+	class RenderStateTracker;
 
-	struct Vertex
+	// SplitByVertexLimit ̌1Ԃ
+	struct MeshChunk
 	{
-		Math::Vector3 position;
-		Math::Vector3 normal;
-		Math::Vector2 texCoord;
-		Math::Color color;
-
-		Vertex()
-			:position(0.0f,0.0f,0.0f)
-			,normal(0.0f,1.0f,0.0f)
-			,texCoord(0.0f,0.0f)
-			,color(1.0f,1.0f,1.0f,1.0f)
-		{}
-
-
-		Vertex(const Math::Vector3& pos,const Math::Vector3& norm,
-			const Math::Vector2& tex,const Math::Color& col)
-			:position(pos),normal(norm),texCoord(tex),color(col)
-		{}
+		std::vector<Vertex> vertices;
+		std::vector<unsigned int> indices;
 	};
 
+	// CPU ɒ_/CfbNXcprBNone Ȃ GPU ɏグŎ̂Ă
+	namespace MeshCpuAccess
+	{
+		enum Flags : uint32_t
+		{
+			None = 0,
+			Raycast = 1u << 0,		// Op`Pʂ̃CLXg(BVH )
+			Collision = 1u << 1,	// RW`̐
+			Occluder = 1u << 2,		// CPU IN[WJO̎Օ(CPU ̒_bV͂ǂłՕɂȂ)
+		};
+	}
+
+	// GPU ̃CAEgɋlߍς݂̃obt@̒g(ĂLbVǂ񂾂̂Ȃ)B
+	// |C^ Mesh::Upload I܂ŗLł邱
+	struct MeshUploadData
+	{
+		uint32_t vertexFormat = VertexFormat::Standard;
+		uint32_t vertexCount = 0;
+		const void* vertexData = nullptr;		// vertexCount * GetStride(vertexFormat) oCg
+		uint32_t indexCount = 0;
+		bool indices16Bit = false;
+		const void* indexData = nullptr;
+		VertexFormat::PositionTransform positionTransform;
+		Math::AABB bounds;
+		// cpuAccess w肵Ƃ̌̒_(Standard Ȃ vertexData Ɠł悢)BvertexCount 
+		const Vertex* cpuVertices = nullptr;
+	};
+
+	// bV풓Ă郁(LOD ܂)
+	struct MeshMemoryUsage
+	{
+		size_t gpuBytes = 0;	// _/CfbNXobt@
+		size_t cpuBytes = 0;	// ێĂ钸_/CfbNXƃbVbg
+
+		void Add(const MeshMemoryUsage& other)
+		{
+			gpuBytes += other.gpuBytes;
+			cpuBytes += other.cpuBytes;
+		}
+	};
 
 	class Mesh
 	{
@@ -47,44 +79,184 @@ namespace Falu
 		Mesh();
 		~Mesh();
 
-		bool Initialize(ID3D11Device* device, const std::vector<Vertex>& vertices,
-			const std::vector<unsigned int>& indices);
-		bool Create(ID3D11Device* device, const std::vector<Vertex>& vertices,
-			const std::vector<unsigned int>& indices);
+		// vertexFormat: GPU ̒_CAEg(VertexFormat::Flags)
+		// cpuAccess: MeshCpuAccess::FlagsBw肵Ƃ CPU  Vertex/CfbNXc
+		bool Initialize(ID3D11Device* device, ArrayView<Vertex> vertices, ArrayView<unsigned int> indices,
+			uint32_t vertexFormat = VertexFormat::Standard, uint32_t cpuAccess = MeshCpuAccess::None);
+		bool Create(ID3D11Device* device, ArrayView<Vertex> vertices, ArrayView<unsigned int> indices,
+			uint32_t vertexFormat = VertexFormat::Standard, uint32_t cpuAccess = MeshCpuAccess::None);
+		// ێꍇ͔ẑ܂܈(Rs[Ȃ)
+		bool Create(ID3D11Device* device, std::vector<Vertex>&& vertices, std::vector<unsigned int>&& indices,
+			uint32_t vertexFormat = VertexFormat::Standard, uint32_t cpuAccess = MeshCpuAccess::None);
+
+		// Create(&&) 2iɕ(񓯊ǂݍݗp)BPrepare  CPU ̏(lߒAoEfBOABVH)
+		// foCXɐGȂ̂Ń[J[XbhĂׂBUpload Ńobt@AcpuAccess  None Ȃ CPU ̂ĂB
+		// Upload ܂ł͐/`/oEfBOg(bVbg LOD ̐ݒł)
+		void Prepare(std::vector<Vertex>&& vertices, std::vector<unsigned int>&& indices,
+			uint32_t vertexFormat = VertexFormat::Standard, uint32_t cpuAccess = MeshCpuAccess::None);
+		bool Upload(ID3D11Device* device);
+		bool IsUploadPending() const { return m_uploadPending; }
+		// lߍς݂̃f[^ Prepare B_̕ϊoEfBǑvZȂ(BVH  Raycast ̂Ƃ)
+		void Prepare(const MeshUploadData& data, uint32_t cpuAccess = MeshCpuAccess::None);
+		// Upload ҂̊ԂL: GPU ɏグ钸_(GetVertexBufferSize oCg)ƃCfbNX(GetIndexBufferSize oCg)
+		const void* GetUploadVertexData() const;
+		const void* GetUploadIndexData() const;
 
 		void Render(ID3D11DeviceContext* context);
+
+		// bVƂ͒_/CfbNXobt@̍ĐݒȂBinstanceCount > 1 ŃCX^X`
+		void Render(RenderStateTracker& state, UINT instanceCount = 1);
+		// CfbNXobt@̈ꕔ`(NX^JǑ)B͈͂Ƃ DrawIndexed 1
+		void Render(RenderStateTracker& state, const IndexRange* ranges, uint32_t rangeCount);
 		void Release();
 
 		//=== Promitive creators ===
-		static std::shared_ptr<Mesh> CreateTriangle(ID3D11Device* device);
-		static std::shared_ptr<Mesh> CreateQuad(ID3D11Device* device);
-		static std::shared_ptr<Mesh> CreateCube(ID3D11Device* device);
+		// cpuAccess ׂ͂ Create Ɠ(MeshCpuAccess::Flags)
+		static std::shared_ptr<Mesh> CreateTriangle(ID3D11Device* device, uint32_t cpuAccess = MeshCpuAccess::None);
+		static std::shared_ptr<Mesh> CreateQuad(ID3D11Device* device, uint32_t cpuAccess = MeshCpuAccess::None);
+		static std::shared_ptr<Mesh> CreateCube(ID3D11Device* device, uint32_t cpuAccess = MeshCpuAccess::None);
 		/// @brief 쐬֐
 		/// @param device foCX
 		/// @param segments 
 		/// @return 
-		static std::shared_ptr<Mesh> CreateSphere(ID3D11Device* device, int segments = 32);
-		static std::shared_ptr<Mesh> CreateCylinder(ID3D11Device* device,int segments = 32);
+		static std::shared_ptr<Mesh> CreateSphere(ID3D11Device* device, int segments = 32,
+			uint32_t cpuAccess = MeshCpuAccess::None);
+		static std::shared_ptr<Mesh> CreateCylinder(ID3D11Device* device,int segments = 32,
+			uint32_t cpuAccess = MeshCpuAccess::None);
 		static std::shared_ptr<Mesh> CreatePlane(ID3D11Device* device,
-			float width = 10.0f,float depth = 10.0f,int division = 10);
+			float width = 10.0f,float depth = 10.0f,int division = 10,
+			uint32_t cpuAccess = MeshCpuAccess::None);
 
 		// Calc Bounding Box
-		Math::AABB CalculateBounds() const;
+		static Math::AABB CalculateBounds(ArrayView<Vertex> vertices);
+		// Create ɌvZ(CPU ̒_̂ĂĂg)
+		const Math::AABB& GetBounds() const { return m_bounds; }
+
+		//=== LOD ===
+		// LOD1 ȍ~𖖔ɒǉBscreenSize ͉ʂ̍ɑ΂铊eTCY(0..1)ŁAƂLODɂȂ
+		void AddLod(std::shared_ptr<Mesh> mesh, float screenSize);
+		uint32_t GetLodCount() const { return 1 + static_cast<uint32_t>(m_lods.size()); }
+		// 0 ͎g
+		Mesh* GetLod(uint32_t level);
+		float GetLodScreenSize(uint32_t level) const;
+		// eTCY LOD IԁBcurrentLod ̋ȆO hysteresis ̊͐؂ւȂ(h~)
+		uint32_t SelectLod(float screenSize, uint32_t currentLod, float hysteresis = 0.15f) const;
+
+		//=== Meshlet ===
+		// Meshlets::Build ŕבւCfbNXōbVɂݒ肷(CfbNX͈͂QƂ邽)
+		void SetMeshlets(std::vector<Meshlet> meshlets);
+		bool HasMeshlets() const { return !m_meshlets.empty(); }
+		const std::vector<Meshlet>& GetMeshlets() const { return m_meshlets; }
+
+		//=== Raycast ===
+		// MeshCpuAccess::Raycast ōƂOp` BVH (CX^XԂŋL)
+		bool HasBvh() const { return !m_bvh.IsEmpty(); }
+		const MeshBvh& GetBvh() const { return m_bvh; }
+		// [JԂ̃Cňԋ߂Op`B@͒_@Ԃ́BBVH Ȃ false
+		bool RayCast(const Math::Ray& localRay, float maxDistance, MeshRayHit& outHit) const;
+		// [hԂ̃CBworld Ń[JɈڂĒׁAʒuƖ@[hɖ߂B
+		// distance ̓[h̃C̃p[^̂܂
+		bool RayCast(const Math::Ray& worldRay, const Math::Matrix4& world, float maxDistance, MeshRayHit& outHit) const;
+		// [hԂ4{̃C܂Ƃ߂Ēׂ(MeshBvh::RayCastPacket)B[̃}XNԂ
+		uint32_t RayCastPacket(const Math::RayPacket& worldPacket, const Math::Matrix4& world,
+			const float maxDistance[Math::RayPacket::kWidth], MeshRayHit outHits[Math::RayPacket::kWidth]) const;
+
+		// Op`XgAꂼ maxVertices _ȉQƂȂɕ(16bit CfbNXp)B
+		// Op`̏Ԃ͕ۂBE̒_͉򂲂Ƃɕ
+		static std::vector<MeshChunk> SplitByVertexLimit(const std::vector<Vertex>& vertices,
+			const std::vector<unsigned int>& indices,
+			uint32_t maxVertices = IndexFormat<uint16_t>::maxVertexCount);
 		
 		//=== Getters ===
 		unsigned int GetVertexCount() const { return m_vertexCount; }
 		unsigned int GetIndexCount() const { return m_indexCount; }
+		// CPU ̃f[^ cpuAccess w肵čƂ(ȊO͋)
+		uint32_t GetCpuAccess() const { return m_cpuAccess; }
+		bool HasCpuData() const { return m_cpuAccess != MeshCpuAccess::None; }
 		const std::vector<Vertex>& GetVertices() const { return m_vertices; }
-		const std::vector<unsigned int>& GetIndices() const { return m_indices; }
+		// _ 65535 ȉȂ 16bit Ŏ
+		const IndexData& GetIndices() const { return m_indices; }
+		DXGI_FORMAT GetIndexFormat() const { return m_indexFormat; }
+		size_t GetIndexBufferSize() const { return (size_t)m_indexStride * m_indexCount; }
+
+		// includeLods: LOD1 ȍ~̃bV
+		MeshMemoryUsage GetMemoryUsage(bool includeLods = true) const;
+
+		uint32_t GetVertexFormat() const { return m_vertexFormat; }
+		UINT GetVertexStride() const { return m_vertexStride; }
+		// _obt@1{Ԃ̃oCg
+		size_t GetVertexBufferSize() const { return (size_t)m_vertexStride * m_vertexCount; }
+
+		// ʎqʒuɖ߂sB[hs̑OɊ|(ʎqĂȂΒPʍs)
+		bool HasQuantizedPositions() const { return (m_vertexFormat & VertexFormat::QuantizedPosition) != 0; }
+		Math::Matrix4 GetPositionDequantization() const;
+		const VertexFormat::PositionTransform& GetPositionTransform() const { return m_positionTransform; }
+
+	private:
+		// obt@A/`/oEfBOݒ肷BCPU ̕ێ͌Ăяo
+		bool CreateBuffers(ID3D11Device* device, ArrayView<Vertex> vertices, const IndexData& indices, uint32_t vertexFormat);
+		// O CPU f[^̂āA/`/oEfBOݒ肷
+		void SetLayout(ArrayView<Vertex> vertices, const IndexData& indices, uint32_t vertexFormat);
+		// vertexData  GPU ̃CAEgɋl߂́Bƌ`͐ݒς݂ł邱
+		bool CreateGpuBuffers(ID3D11Device* device, const void* vertexData, const void* indexData);
+		// BVH ̖ʖ@𒸓_@̕Ԃɒu
+		void InterpolateHitNormal(MeshRayHit& hit) const;
+		// [JԂ̓[hɖ߂B@͋t]uŕϊ
+		static void HitToWorld(MeshRayHit& hit, const Math::Matrix4& world, const Math::Matrix4& invWorld);
 
 	private:
 		ComPtr<ID3D11Buffer> m_vertexBuffer;
 		ComPtr<ID3D11Buffer> m_indexBuffer;
 
 		std::vector<Vertex> m_vertices;
-		std::vector<unsigned int> m_indices;
+		IndexData m_indices;
 
 		unsigned int m_vertexCount;
 		unsigned int m_indexCount;
+		DXGI_FORMAT m_indexFormat;
+		UINT m_indexStride;
+		uint32_t m_cpuAccess;
+
+		uint32_t m_vertexFormat;
+		UINT m_vertexStride;
+		VertexFormat::PositionTransform m_positionTransform;
+
+		// Prepare  Upload ܂: RpNg`ɋl߂_(Standard Ȃ m_vertices g)
+		std::vector<uint8_t> m_encodedVertices;
+		// MeshUploadData  Prepare Ƃ͊Õ̂܂܏グ
+		const void* m_uploadVertexData;
+		const void* m_uploadIndexData;
+		bool m_uploadPending;
+
+		Math::AABB m_bounds;
+
+		struct Lod
+		{
+			std::shared_ptr<Mesh> mesh;
+			float screenSize;
+		};
+		std::vector<Lod> m_lods;
+
+		std::vector<Meshlet> m_meshlets;
+		MeshBvh m_bvh;
+	};
+
+	// bṼ[h AABB ̃LbVBbV(LOD) Transform ̃o[WԂ͌vZȂ
+	struct MeshWorldBounds
+	{
+		const Mesh* mesh = nullptr;
+		uint32_t version = 0;
+		Math::AABB bounds;
+
+		const Math::AABB& Get(const Mesh* target, uint32_t transformVersion, const Math::Matrix4& worldMatrix)
+		{
+			if (mesh != target || version != transformVersion)
+			{
+				bounds = target->GetBounds().Transform(worldMatrix);
+				mesh = target;
+				version = transformVersion;
+			}
+			return bounds;
+		}
 	};
 }
@@ -0,0 +1,565 @@
+/*****************************************************************//**
+ * \file   MeshBvh.cpp
+ * \brief  MeshBvh ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "MeshBvh.h"
+#include "VertexTypes.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FALU_MESHBVH_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace Falu
+{
+	namespace
+	{
+		constexpr uint32_t kBinCount = 12;
+		constexpr uint32_t kNoTriangle = UINT32_MAX;
+
+		struct Bounds
+		{
+			Math::Vector3 min = Math::Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
+			Math::Vector3 max = Math::Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+			void Grow(const Math::Vector3& p)
+			{
+				min = Math::Vector3(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+				max = Math::Vector3(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+			}
+
+			void Grow(const Bounds& b)
+			{
+				Grow(b.min);
+				Grow(b.max);
+			}
+
+			// \ʐς̔B̃oEfBOȂ 0
+			float HalfArea() const
+			{
+				float x = max.x - min.x, y = max.y - min.y, z = max.z - min.z;
+				if (x < 0.0f || y < 0.0f || z < 0.0f)
+					return 0.0f;
+				return x * y + y * z + z * x;
+			}
+		};
+
+		float Axis(const Math::Vector3& v, int axis) { return axis == 0 ? v.x : (axis == 1 ? v.y : v.z); }
+
+		struct Bin
+		{
+			Bounds bounds;
+			uint32_t count = 0;
+		};
+
+		struct BuildTask
+		{
+			uint32_t node;
+			uint32_t first;
+			uint32_t count;
+		};
+
+		// Cƃ{bNX̃XuB鋗ԂAOꂽ FLT_MAX
+		float IntersectBox(const Math::Vector3& boundsMin, const Math::Vector3& boundsMax,
+			const Math::Vector3& origin, const Math::Vector3& invDir, float tBest)
+		{
+			float tx1 = (boundsMin.x - origin.x) * invDir.x, tx2 = (boundsMax.x - origin.x) * invDir.x;
+			float ty1 = (boundsMin.y - origin.y) * invDir.y, ty2 = (boundsMax.y - origin.y) * invDir.y;
+			float tz1 = (boundsMin.z - origin.z) * invDir.z, tz2 = (boundsMax.z - origin.z) * invDir.z;
+
+			float tMin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+			float tMax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+
+			if (tMax >= std::max(tMin, 0.0f) && tMin < tBest)
+				return tMin;
+			return FLT_MAX;
+		}
+	}
+
+	MeshBvh::MeshBvh()
+		: m_triangleCount(0)
+	{
+	}
+
+	void MeshBvh::Clear()
+	{
+		m_nodes.clear();
+		m_nodes.shrink_to_fit();
+		m_packets.clear();
+		m_packets.shrink_to_fit();
+		m_triangleCount = 0;
+	}
+
+	size_t MeshBvh::GetMemoryUsage() const
+	{
+		return m_nodes.capacity() * sizeof(Node) + m_packets.capacity() * sizeof(TrianglePacket);
+	}
+
+	void MeshBvh::Build(ArrayView<Vertex> vertices, const IndexData& indices)
+	{
+		Clear();
+
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.GetCount() / 3);
+		if (triangleCount == 0)
+			return;
+		m_triangleCount = triangleCount;
+
+		std::vector<Bounds> triangleBounds(triangleCount);
+		std::vector<Math::Vector3> centroids(triangleCount);
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			Bounds& b = triangleBounds[t];
+			for (int k = 0; k < 3; ++k)
+				b.Grow(vertices[indices[t * 3 + k]].position);
+			centroids[t] = Math::Vector3((b.min.x + b.max.x) * 0.5f, (b.min.y + b.max.y) * 0.5f, (b.min.z + b.max.z) * 0.5f);
+		}
+
+		std::vector<uint32_t> order(triangleCount);
+		std::iota(order.begin(), order.end(), 0u);
+
+		m_nodes.reserve(2 * (triangleCount / kLeafSize + 1));
+		m_packets.reserve(triangleCount / 2 + 1);
+		m_nodes.push_back(Node());
+
+		std::vector<BuildTask> stack;
+		stack.push_back({ 0, 0, triangleCount });
+
+		while (!stack.empty())
+		{
+			BuildTask task = stack.back();
+			stack.pop_back();
+
+			Bounds bounds;
+			Bounds centroidBounds;
+			for (uint32_t i = task.first; i < task.first + task.count; ++i)
+			{
+				bounds.Grow(triangleBounds[order[i]]);
+				centroidBounds.Grow(centroids[order[i]]);
+			}
+
+			Node& node = m_nodes[task.node];
+			node.boundsMin = bounds.min;
+			node.boundsMax = bounds.max;
+
+			if (task.count <= kLeafSize)
+			{
+				// t: 1 ̃pPbgBgȂ[ 0 ɂāAs񎮂Ŕ肩O悤ɂ
+				TrianglePacket packet = {};
+				for (uint32_t lane = 0; lane < kLeafSize; ++lane)
+				{
+					packet.index[lane] = kNoTriangle;
+					if (lane >= task.count)
+						continue;
+
+					uint32_t t = order[task.first + lane];
+					const Math::Vector3& p0 = vertices[indices[t * 3 + 0]].position;
+					const Math::Vector3& p1 = vertices[indices[t * 3 + 1]].position;
+					const Math::Vector3& p2 = vertices[indices[t * 3 + 2]].position;
+					packet.v0x[lane] = p0.x; packet.v0y[lane] = p0.y; packet.v0z[lane] = p0.z;
+					packet.e1x[lane] = p1.x - p0.x; packet.e1y[lane] = p1.y - p0.y; packet.e1z[lane] = p1.z - p0.z;
+					packet.e2x[lane] = p2.x - p0.x; packet.e2y[lane] = p2.y - p0.y; packet.e2z[lane] = p2.z - p0.z;
+					packet.index[lane] = t;
+				}
+
+				node.leftOrPacket = static_cast<uint32_t>(m_packets.size());
+				node.triangleCount = task.count;
+				m_packets.push_back(packet);
+				continue;
+			}
+
+			// 3 ׂĂŃrg SAH
+			int bestAxis = -1;
+			uint32_t bestSplit = 0;
+			float bestCost = FLT_MAX;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				float axisMin = Axis(centroidBounds.min, axis);
+				float extent = Axis(centroidBounds.max, axis) - axisMin;
+				if (extent <= 0.0f)
+					continue;
+
+				Bin bins[kBinCount];
+				float scale = kBinCount / extent;
+				for (uint32_t i = task.first; i < task.first + task.count; ++i)
+				{
+					uint32_t t = order[i];
+					uint32_t b = std::min(kBinCount - 1, static_cast<uint32_t>((Axis(centroids[t], axis) - axisMin) * scale));
+					bins[b].bounds.Grow(triangleBounds[t]);
+					++bins[b].count;
+				}
+
+				// E|ĂAe]
+				float rightArea[kBinCount - 1];
+				uint32_t rightCount[kBinCount - 1];
+				Bounds right;
+				uint32_t count = 0;
+				for (uint32_t b = kBinCount - 1; b > 0; --b)
+				{
+					right.Grow(bins[b].bounds);
+					count += bins[b].count;
+					rightArea[b - 1] = right.HalfArea();
+					rightCount[b - 1] = count;
+				}
+
+				Bounds left;
+				count = 0;
+				for (uint32_t b = 0; b < kBinCount - 1; ++b)
+				{
+					left.Grow(bins[b].bounds);
+					count += bins[b].count;
+					if (count == 0 || rightCount[b] == 0)
+						continue;
+
+					float cost = count * left.HalfArea() + rightCount[b] * rightArea[b];
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = b;
+					}
+				}
+			}
+
+			uint32_t* begin = order.data() + task.first;
+			uint32_t* end = begin + task.count;
+			uint32_t* middle = begin + task.count / 2;
+			if (bestAxis >= 0)
+			{
+				float axisMin = Axis(centroidBounds.min, bestAxis);
+				float scale = kBinCount / (Axis(centroidBounds.max, bestAxis) - axisMin);
+				middle = std::partition(begin, end, [&](uint32_t t)
+				{
+					uint32_t b = std::min(kBinCount - 1, static_cast<uint32_t>((Axis(centroids[t], bestAxis) - axisMin) * scale));
+					return b <= bestSplit;
+				});
+			}
+			// dSׂēBǂŕĂȂ̂ŁAt kLeafSize 𒴂邱Ƃ͂Ȃ
+			if (middle == begin || middle == end)
+				middle = begin + task.count / 2;
+
+			uint32_t leftCount = static_cast<uint32_t>(middle - begin);
+			uint32_t leftIndex = static_cast<uint32_t>(m_nodes.size());
+			m_nodes[task.node].leftOrPacket = leftIndex;
+			m_nodes[task.node].triangleCount = 0;
+			m_nodes.push_back(Node());
+			m_nodes.push_back(Node());
+
+			stack.push_back({ leftIndex + 1, task.first + leftCount, task.count - leftCount });
+			stack.push_back({ leftIndex, task.first, leftCount });
+		}
+	}
+
+	void MeshBvh::IntersectLeaf(uint32_t packetIndex, const Math::Vector3& origin, const Math::Vector3& dir,
+		float& tBest, LeafHit& hit) const
+	{
+		const TrianglePacket& p = m_packets[packetIndex];
+		alignas(16) float t[4], u[4], v[4];
+		int mask = 0;
+
+#ifdef FALU_MESHBVH_SSE
+		const __m128 ox = _mm_set1_ps(origin.x), oy = _mm_set1_ps(origin.y), oz = _mm_set1_ps(origin.z);
+		const __m128 dx = _mm_set1_ps(dir.x), dy = _mm_set1_ps(dir.y), dz = _mm_set1_ps(dir.z);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 epsilon = _mm_set1_ps(1e-20f);
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+		__m128 e1x = _mm_load_ps(p.e1x), e1y = _mm_load_ps(p.e1y), e1z = _mm_load_ps(p.e1z);
+		__m128 e2x = _mm_load_ps(p.e2x), e2y = _mm_load_ps(p.e2y), e2z = _mm_load_ps(p.e2z);
+
+		// Moller-TrumboreBʂƂ
+		__m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+		__m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+		__m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+		__m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+		__m128 invDet = _mm_div_ps(one, det);
+
+		__m128 sx = _mm_sub_ps(ox, _mm_load_ps(p.v0x));
+		__m128 sy = _mm_sub_ps(oy, _mm_load_ps(p.v0y));
+		__m128 sz = _mm_sub_ps(oz, _mm_load_ps(p.v0z));
+		__m128 uu = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), invDet);
+
+		__m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+		__m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+		__m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+		__m128 vv = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+		__m128 tt = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+
+		__m128 inside = _mm_cmpgt_ps(_mm_and_ps(det, absMask), epsilon);
+		inside = _mm_and_ps(inside, _mm_cmpge_ps(uu, zero));
+		inside = _mm_and_ps(inside, _mm_cmpge_ps(vv, zero));
+		inside = _mm_and_ps(inside, _mm_cmple_ps(_mm_add_ps(uu, vv), one));
+		inside = _mm_and_ps(inside, _mm_cmpge_ps(tt, zero));
+		inside = _mm_and_ps(inside, _mm_cmplt_ps(tt, _mm_set1_ps(tBest)));
+
+		mask = _mm_movemask_ps(inside);
+		if (mask == 0)
+			return;
+		_mm_store_ps(t, tt);
+		_mm_store_ps(u, uu);
+		_mm_store_ps(v, vv);
+#else
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			float px = dir.y * p.e2z[lane] - dir.z * p.e2y[lane];
+			float py = dir.z * p.e2x[lane] - dir.x * p.e2z[lane];
+			float pz = dir.x * p.e2y[lane] - dir.y * p.e2x[lane];
+			float det = p.e1x[lane] * px + p.e1y[lane] * py + p.e1z[lane] * pz;
+			if (std::fabs(det) <= 1e-20f)
+				continue;
+			float invDet = 1.0f / det;
+
+			float sx = origin.x - p.v0x[lane], sy = origin.y - p.v0y[lane], sz = origin.z - p.v0z[lane];
+			u[lane] = (sx * px + sy * py + sz * pz) * invDet;
+			float qx = sy * p.e1z[lane] - sz * p.e1y[lane];
+			float qy = sz * p.e1x[lane] - sx * p.e1z[lane];
+			float qz = sx * p.e1y[lane] - sy * p.e1x[lane];
+			v[lane] = (dir.x * qx + dir.y * qy + dir.z * qz) * invDet;
+			t[lane] = (p.e2x[lane] * qx + p.e2y[lane] * qy + p.e2z[lane] * qz) * invDet;
+
+			if (u[lane] >= 0.0f && v[lane] >= 0.0f && u[lane] + v[lane] <= 1.0f && t[lane] >= 0.0f && t[lane] < tBest)
+				mask |= 1 << lane;
+		}
+#endif
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			if ((mask & (1 << lane)) && t[lane] < tBest)
+			{
+				tBest = t[lane];
+				hit.packet = packetIndex;
+				hit.lane = lane;
+				hit.u = u[lane];
+				hit.v = v[lane];
+			}
+		}
+	}
+
+	void MeshBvh::FillHit(const LeafHit& hit, float distance, const Math::Ray& ray, MeshRayHit& outHit) const
+	{
+		const TrianglePacket& p = m_packets[hit.packet];
+		Math::Vector3 e1(p.e1x[hit.lane], p.e1y[hit.lane], p.e1z[hit.lane]);
+		Math::Vector3 e2(p.e2x[hit.lane], p.e2y[hit.lane], p.e2z[hit.lane]);
+		Math::Vector3 n(e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x);
+		float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+		if (length > 0.0f)
+			n = Math::Vector3(n.x / length, n.y / length, n.z / length);
+
+		outHit.distance = distance;
+		outHit.position = ray.GetPoint(distance);
+		outHit.normal = n;
+		outHit.barycentrics = Math::Vector2(hit.u, hit.v);
+		outHit.triangleIndex = p.index[hit.lane];
+	}
+
+	bool MeshBvh::RayCast(const Math::Ray& ray, float maxDistance, MeshRayHit& outHit) const
+	{
+		if (m_nodes.empty())
+			return false;
+
+		const Math::Vector3& origin = ray.origin;
+		const Math::Vector3& dir = ray.direction;
+		Math::Vector3 invDir(Math::RayPacket::SafeInverse(dir.x), Math::RayPacket::SafeInverse(dir.y),
+			Math::RayPacket::SafeInverse(dir.z));
+
+		float tBest = maxDistance;
+		LeafHit hit;
+
+		// O牜ւǂB̎q͓鋗ƈꏏɃX^bNő҂
+		struct StackEntry
+		{
+			uint32_t node;
+			float t;
+		};
+		// SAH ŕ΁ÃbVŃc[̐[ɓ͂Ƃ͂Ȃ
+		constexpr int kStackSize = 128;
+		StackEntry stack[kStackSize];
+		int stackSize = 0;
+
+		const Node& root = m_nodes[0];
+		if (IntersectBox(root.boundsMin, root.boundsMax, origin, invDir, tBest) == FLT_MAX)
+			return false;
+
+		uint32_t nodeIndex = 0;
+		for (;;)
+		{
+			const Node& node = m_nodes[nodeIndex];
+			if (node.triangleCount > 0)
+			{
+				IntersectLeaf(node.leftOrPacket, origin, dir, tBest, hit);
+			}
+			else
+			{
+				uint32_t nearChild = node.leftOrPacket;
+				uint32_t farChild = nearChild + 1;
+				float tNear = IntersectBox(m_nodes[nearChild].boundsMin, m_nodes[nearChild].boundsMax, origin, invDir, tBest);
+				float tFar = IntersectBox(m_nodes[farChild].boundsMin, m_nodes[farChild].boundsMax, origin, invDir, tBest);
+				if (tFar < tNear)
+				{
+					std::swap(nearChild, farChild);
+					std::swap(tNear, tFar);
+				}
+
+				if (tNear != FLT_MAX)
+				{
+					if (tFar != FLT_MAX && stackSize < kStackSize)
+						stack[stackSize++] = { farChild, tFar };
+					nodeIndex = nearChild;
+					continue;
+				}
+			}
+
+			// oBς񂾌Ɍԋ߂qbg艜n܂m[h͔΂
+			bool found = false;
+			while (stackSize > 0)
+			{
+				StackEntry entry = stack[--stackSize];
+				if (entry.t < tBest)
+				{
+					nodeIndex = entry.node;
+					found = true;
+					break;
+				}
+			}
+			if (!found)
+				break;
+		}
+
+		if (hit.lane < 0)
+			return false;
+
+		FillHit(hit, tBest, ray, outHit);
+		return true;
+	}
+
+	uint32_t MeshBvh::RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+		MeshRayHit outHits[Math::RayPacket::kWidth]) const
+	{
+		constexpr int kWidth = Math::RayPacket::kWidth;
+		if (m_nodes.empty() || packet.activeMask == 0)
+			return 0;
+
+		// Ⴄ~[͋Lm[hȂ̂ŁA1 {ǂ
+		bool coherent = true;
+		int firstLane = -1;
+		for (int lane = 0; lane < kWidth && coherent; ++lane)
+		{
+			if (!(packet.activeMask & (1u << lane)))
+				continue;
+			if (firstLane < 0)
+			{
+				firstLane = lane;
+				continue;
+			}
+			coherent = (packet.dx[lane] < 0.0f) == (packet.dx[firstLane] < 0.0f)
+				&& (packet.dy[lane] < 0.0f) == (packet.dy[firstLane] < 0.0f)
+				&& (packet.dz[lane] < 0.0f) == (packet.dz[firstLane] < 0.0f);
+		}
+		if (!coherent || (packet.activeMask & (packet.activeMask - 1)) == 0)
+		{
+			uint32_t hitMask = 0;
+			for (int lane = 0; lane < kWidth; ++lane)
+			{
+				if ((packet.activeMask & (1u << lane)) && RayCast(packet.GetLane(lane), maxDistance[lane], outHits[lane]))
+					hitMask |= 1u << lane;
+			}
+			return hitMask;
+		}
+
+		float tBest[kWidth];
+		LeafHit hits[kWidth];
+		for (int lane = 0; lane < kWidth; ++lane)
+			tBest[lane] = maxDistance[lane];
+
+		// eڂ͂ǂ̃[ǂŃm[hɓoĂ̂ŁÅԂɂ߂qbg
+		// [͎oƂɔ
+		struct StackEntry
+		{
+			uint32_t node;
+			uint32_t mask;
+			float t[kWidth];
+		};
+		constexpr int kStackSize = 128;
+		StackEntry stack[kStackSize];
+		int stackSize = 0;
+
+		float tNear[kWidth], tFar[kWidth];
+		const Node& root = m_nodes[0];
+		uint32_t rootMask = Math::IntersectAABB(packet, root.boundsMin, root.boundsMax, tBest, tNear, tFar);
+		if (rootMask == 0)
+			return 0;
+		stack[stackSize].node = 0;
+		stack[stackSize].mask = rootMask;
+		std::copy(tNear, tNear + kWidth, stack[stackSize].t);
+		++stackSize;
+
+		while (stackSize > 0)
+		{
+			StackEntry entry = stack[--stackSize];
+			uint32_t mask = 0;
+			for (int lane = 0; lane < kWidth; ++lane)
+			{
+				if ((entry.mask & (1u << lane)) && entry.t[lane] < tBest[lane])
+					mask |= 1u << lane;
+			}
+			if (mask == 0)
+				continue;
+
+			const Node& node = m_nodes[entry.node];
+			if (node.triangleCount > 0)
+			{
+				for (int lane = 0; lane < kWidth; ++lane)
+				{
+					if (!(mask & (1u << lane)))
+						continue;
+					IntersectLeaf(node.leftOrPacket,
+						Math::Vector3(packet.ox[lane], packet.oy[lane], packet.oz[lane]),
+						Math::Vector3(packet.dx[lane], packet.dy[lane], packet.dz[lane]),
+						tBest[lane], hits[lane]);
+				}
+				continue;
+			}
+
+			// Ă郌[ׂĂŗ̎q𒲂ׁApPbgɓ͂K
+			uint32_t children[2] = { node.leftOrPacket, node.leftOrPacket + 1 };
+			StackEntry childEntries[2];
+			float firstEntry[2] = { FLT_MAX, FLT_MAX };
+			for (int c = 0; c < 2; ++c)
+			{
+				const Node& child = m_nodes[children[c]];
+				childEntries[c].node = children[c];
+				childEntries[c].mask = Math::IntersectAABB(packet, child.boundsMin, child.boundsMax, tBest, tNear, tFar) & mask;
+				std::copy(tNear, tNear + kWidth, childEntries[c].t);
+				for (int lane = 0; lane < kWidth; ++lane)
+				{
+					if (childEntries[c].mask & (1u << lane))
+						firstEntry[c] = std::min(firstEntry[c], tNear[lane]);
+				}
+			}
+
+			int nearChild = firstEntry[1] < firstEntry[0] ? 1 : 0;
+			int farChild = 1 - nearChild;
+			if (childEntries[farChild].mask != 0 && stackSize < kStackSize)
+				stack[stackSize++] = childEntries[farChild];
+			if (childEntries[nearChild].mask != 0 && stackSize < kStackSize)
+				stack[stackSize++] = childEntries[nearChild];
+		}
+
+		uint32_t hitMask = 0;
+		for (int lane = 0; lane < kWidth; ++lane)
+		{
+			if (hits[lane].lane < 0)
+				continue;
+			FillHit(hits[lane], tBest[lane], packet.GetLane(lane), outHits[lane]);
+			hitMask |= 1u << lane;
+		}
+		return hitMask;
+	}
+}
@@ -0,0 +1,95 @@
+/*****************************************************************//**
+ * \file   MeshBvh.h
+ * \brief  bVɑ΂鐳mȃCLXgp̎Op` BVH
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Include/Math/Ray.h"
+#include "Include/Math/RayPacket.h"
+#include "Include/Utils/ArrayView.h"
+#include "Renderer/IndexData.h"
+
+namespace Falu
+{
+	struct Vertex;
+
+	// bVɑ΂郌C̈ԋ߂qbgBbṼ[JԂŕ\
+	struct MeshRayHit
+	{
+		float distance = 0.0f;			// C̃p[^[ t(ČPʒȂ烏[hł̋)
+		Math::Vector3 position;
+		Math::Vector3 normal;			// Ԃ_@BKς
+		Math::Vector2 barycentrics;		// Op` 2 Ԗڂ 3 Ԗڂ̒_̏d
+		uint32_t triangleIndex = 0;		// bV̎Op`Xgł̔ԍ(index / 3)
+	};
+
+	// Op`Xgɑ΂r SAH  BVHBet͍ő 4 ̎Op` SoA ŎA
+	// 1  4 {̃CƎOp`̔ŗt𒲂ׂB
+	// Mesh Ƃ 1 ACX^X͋L Mesh ʂĎg
+	class MeshBvh
+	{
+	public:
+		static constexpr uint32_t kLeafSize = 4;
+
+		MeshBvh();
+
+		// ʒu͗tɃRs[̂ŁA̔z͂̌QƂȂ
+		void Build(ArrayView<Vertex> vertices, const IndexData& indices);
+		void Clear();
+
+		bool IsEmpty() const { return m_nodes.empty(); }
+		size_t GetNodeCount() const { return m_nodes.size(); }
+		size_t GetTriangleCount() const { return m_triangleCount; }
+		size_t GetMemoryUsage() const;
+
+		// t  [0, maxDistance] ̈ԋ߂qbgBʂƂBoutHit.normal ͖ʂ̖@
+		// (Mesh::RayCast Ԃ_@ɒu)
+		bool RayCast(const Math::Ray& ray, float maxDistance, MeshRayHit& outHit) const;
+
+		// packet ̗Lȃ[܂Ƃ߂ĂǂBm[hɂ͓郌[ 1 񂾂KA
+		// 4 {̃Xu 1 sB[ i  [0, maxDistance[i]] ɌB[̃}XNԂ
+		uint32_t RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+			MeshRayHit outHits[Math::RayPacket::kWidth]) const;
+
+	private:
+		struct Node
+		{
+			Math::Vector3 boundsMin;
+			uint32_t leftOrPacket;	// m[h: ̎q(E =  + 1)Bt: pPbg̔ԍ
+			Math::Vector3 boundsMax;
+			uint32_t triangleCount;	// m[h 0
+		};
+
+		// 4 ̎Op` v0 ƕӂ SoA ɎBgȂ[ index  UINT32_MAX
+		struct alignas(16) TrianglePacket
+		{
+			float v0x[4], v0y[4], v0z[4];
+			float e1x[4], e1y[4], e1z[4];
+			float e2x[4], e2y[4], e2z[4];
+			uint32_t index[4];
+		};
+
+		struct LeafHit
+		{
+			uint32_t packet = UINT32_MAX;
+			int lane = -1;
+			float u = 0.0f;
+			float v = 0.0f;
+		};
+
+		// 1 {̃Ct 4 ̎Op`Ɣ肷B߂[ tBest ăqbgL^
+		void IntersectLeaf(uint32_t packetIndex, const Math::Vector3& origin, const Math::Vector3& dir,
+			float& tBest, LeafHit& hit) const;
+		void FillHit(const LeafHit& hit, float distance, const Math::Ray& ray, MeshRayHit& outHit) const;
+
+		std::vector<Node> m_nodes;
+		std::vector<TrianglePacket> m_packets;
+		size_t m_triangleCount;
+	};
+}
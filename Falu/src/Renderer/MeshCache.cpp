@@ -0,0 +1,594 @@
+/*****************************************************************//**
+ * \file   MeshCache.cpp
+ * \brief  MeshCache ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "MeshCache.h"
+#include "Mesh.h"
+#include "ModelLoader.h"
+#include "Include/Utils/MappedFile.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <filesystem>
+#include <functional>
+#include <thread>
+
+namespace Falu
+{
+	namespace
+	{
+		constexpr uint32_t kMagic = 0x434D4C46;	// "FLMC"
+		constexpr uint64_t kBlobAlignment = 16;
+
+		constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+		constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+		constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+		constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+		constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+		uint64_t RotateLeft(uint64_t value, int bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		uint64_t Read64(const uint8_t* data)
+		{
+			uint64_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		uint32_t Read32(const uint8_t* data)
+		{
+			uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		uint64_t HashRound(uint64_t accumulator, uint64_t input)
+		{
+			accumulator += input * kPrime2;
+			accumulator = RotateLeft(accumulator, 31);
+			return accumulator * kPrime1;
+		}
+
+		uint64_t HashMerge(uint64_t accumulator, uint64_t value)
+		{
+			accumulator ^= HashRound(0, value);
+			return accumulator * kPrime1 + kPrime4;
+		}
+
+		// ItZbg̓t@C̐擪A͕e[u̐擪琔
+		struct StringRef
+		{
+			uint32_t offset;
+			uint32_t length;
+		};
+
+		struct MaterialRecord
+		{
+			MaterialProperties properties;
+			StringRef albedoPath;
+			StringRef normalPath;
+			uint32_t relativePaths;		// rbg 0: AxhArbg 1: @}bṽpXfBNg̑΃pX
+		};
+
+		struct SubMeshRecord
+		{
+			uint32_t material;
+			uint32_t firstMesh;		// LOD0 Ƃɑ LOD
+			uint32_t lodCount;		// LOD0 ܂
+			StringRef name;
+		};
+
+		struct MeshRecord
+		{
+			uint32_t vertexFormat;
+			uint32_t vertexCount;
+			uint32_t indexCount;
+			uint32_t indices16Bit;
+			uint32_t meshletCount;
+			uint32_t cpuAccess;
+			float screenSize;
+			uint32_t padding;
+			Math::AABB bounds;
+			VertexFormat::PositionTransform positionTransform;
+			uint64_t vertexOffset;
+			uint64_t indexOffset;
+			uint64_t meshletOffset;
+			uint64_t cpuVertexOffset;	// CPU ̒_Ȃ 0
+		};
+
+		struct FileHeader
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint64_t key;
+			uint64_t fileSize;
+			uint64_t contentHash;	// wb_[Ŝ̃nbVBrŐ؂ꂽꂽ肵t@C̓qbgȂ
+			uint32_t layout;		// R[h̃TCYB\̂̕тႤrhł̓qbgȂ
+			uint32_t materialCount;
+			uint32_t subMeshCount;
+			uint32_t meshCount;
+			uint32_t stringBytes;
+			uint32_t padding;
+			ModelLoadReport report;
+		};
+
+		uint32_t GetLayout()
+		{
+			uint64_t sizes[] = { sizeof(FileHeader), sizeof(MaterialRecord), sizeof(SubMeshRecord), sizeof(MeshRecord),
+				sizeof(Vertex), sizeof(Meshlet) };
+			return static_cast<uint32_t>(MeshCache::Hash(sizes, sizeof(sizes)));
+		}
+
+		uint64_t AlignBlob(uint64_t offset)
+		{
+			return (offset + kBlobAlignment - 1) & ~(kBlobAlignment - 1);
+		}
+
+		size_t GetIndexStride(const MeshRecord& record)
+		{
+			return record.indices16Bit ? sizeof(uint16_t) : sizeof(uint32_t);
+		}
+
+		// CPU ̒_bV BVH @̕ԂŃCfbNX璸_̂ŁAׂĔ͈͓ł邱
+		template<typename IndexT>
+		bool IndicesInRange(const uint8_t* data, uint32_t indexCount, uint32_t vertexCount)
+		{
+			for (uint32_t i = 0; i < indexCount; ++i)
+			{
+				IndexT index;
+				std::memcpy(&index, data + (size_t)i * sizeof(IndexT), sizeof(IndexT));
+				if (index >= vertexCount)
+					return false;
+			}
+			return true;
+		}
+
+		// R[h𖄂߂Ȃ镶e[u
+		class StringTable
+		{
+		public:
+			StringRef Add(const std::string& text)
+			{
+				StringRef ref = { static_cast<uint32_t>(m_data.size()), static_cast<uint32_t>(text.size()) };
+				m_data.insert(m_data.end(), text.begin(), text.end());
+				return ref;
+			}
+			const std::vector<char>& GetData() const { return m_data; }
+
+		private:
+			std::vector<char> m_data;
+		};
+
+		// ͈͂m߂Ȃ}bvt@Cǂ
+		class FileView
+		{
+		public:
+			FileView(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+			bool Contains(uint64_t offset, uint64_t size) const
+			{
+				return offset <= m_size && size <= m_size - offset;
+			}
+
+			// Write ĒuB}bv̐擪̓y[WEȂ̂ŁAĂΒ_⃁bVbgƂĂ̂܂ܓǂ߂
+			bool ContainsBlob(uint64_t offset, uint64_t size) const
+			{
+				return offset % kBlobAlignment == 0 && Contains(offset, size);
+			}
+
+			template<typename T>
+			bool ReadRecord(uint64_t offset, T& out) const
+			{
+				if (!Contains(offset, sizeof(T)))
+					return false;
+				std::memcpy(&out, m_data + offset, sizeof(T));
+				return true;
+			}
+
+			const uint8_t* At(uint64_t offset) const { return m_data + offset; }
+
+		private:
+			const uint8_t* m_data;
+			size_t m_size;
+		};
+
+		// Ƃɕʂ̖OɂāAf𓯎ɏĂĂ(XbhłvZXł)t@CLȂ
+		std::filesystem::path GetTemporaryPath(const std::filesystem::path& path)
+		{
+			static std::atomic<uint32_t> s_counter{ 0 };
+			uint64_t unique = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+				static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+
+			char suffix[48];
+			snprintf(suffix, sizeof(suffix), ".%016llx-%u.tmp", static_cast<unsigned long long>(unique),
+				s_counter.fetch_add(1, std::memory_order_relaxed));
+			std::filesystem::path temporaryPath = path;
+			temporaryPath += suffix;
+			return temporaryPath;
+		}
+
+		std::string ToRelativePath(const std::string& path, const std::string& directory, bool& outRelative)
+		{
+			std::string prefix = directory + "/";
+			outRelative = path.compare(0, prefix.size(), prefix) == 0;
+			return outRelative ? path.substr(prefix.size()) : path;
+		}
+	}
+
+	namespace MeshCache
+	{
+		uint64_t Hash(const void* data, size_t size, uint64_t seed)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			const uint8_t* end = bytes + size;
+			uint64_t hash;
+
+			// 32 oCg 4 ̓Ɨ[ŏ
+			if (size >= 32)
+			{
+				uint64_t v1 = seed + kPrime1 + kPrime2;
+				uint64_t v2 = seed + kPrime2;
+				uint64_t v3 = seed;
+				uint64_t v4 = seed - kPrime1;
+				const uint8_t* limit = end - 32;
+				do
+				{
+					v1 = HashRound(v1, Read64(bytes));
+					v2 = HashRound(v2, Read64(bytes + 8));
+					v3 = HashRound(v3, Read64(bytes + 16));
+					v4 = HashRound(v4, Read64(bytes + 24));
+					bytes += 32;
+				} while (bytes <= limit);
+
+				hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+				hash = HashMerge(hash, v1);
+				hash = HashMerge(hash, v2);
+				hash = HashMerge(hash, v3);
+				hash = HashMerge(hash, v4);
+			}
+			else
+			{
+				hash = seed + kPrime5;
+			}
+			hash += static_cast<uint64_t>(size);
+
+			// c
+			for (; bytes + 8 <= end; bytes += 8)
+			{
+				hash ^= HashRound(0, Read64(bytes));
+				hash = RotateLeft(hash, 27) * kPrime1 + kPrime4;
+			}
+			if (bytes + 4 <= end)
+			{
+				hash ^= static_cast<uint64_t>(Read32(bytes)) * kPrime1;
+				hash = RotateLeft(hash, 23) * kPrime2 + kPrime3;
+				bytes += 4;
+			}
+			for (; bytes < end; ++bytes)
+			{
+				hash ^= (*bytes) * kPrime5;
+				hash = RotateLeft(hash, 11) * kPrime1;
+			}
+
+			// Ō̂
+			hash ^= hash >> 33;
+			hash *= kPrime2;
+			hash ^= hash >> 29;
+			hash *= kPrime3;
+			hash ^= hash >> 32;
+			return hash;
+		}
+
+		bool HashFile(const std::string& filepath, uint64_t seed, uint64_t& outHash)
+		{
+			MappedFile file;
+			if (!file.Open(filepath))
+				return false;
+
+			outHash = Hash(file.GetData(), file.GetSize(), seed);
+			return true;
+		}
+
+		std::string GetCookedPath(const std::string& directory, uint64_t key)
+		{
+			char name[32];
+			snprintf(name, sizeof(name), "%016llx.fmc", static_cast<unsigned long long>(key));
+			return directory + "/" + name;
+		}
+
+		bool Write(const std::string& filepath, uint64_t key, const std::string& sourceDirectory,
+			const std::vector<ImportedMaterial>& materials, const std::vector<ImportedSubMesh>& subMeshes,
+			const ModelLoadReport& report)
+		{
+			StringTable strings;
+
+			std::vector<MaterialRecord> materialRecords(materials.size());
+			for (size_t i = 0; i < materials.size(); ++i)
+			{
+				MaterialRecord& record = materialRecords[i];
+				bool relative;
+				record.properties = materials[i].properties;
+				record.relativePaths = 0;
+				record.albedoPath = strings.Add(ToRelativePath(materials[i].albedoPath, sourceDirectory, relative));
+				record.relativePaths |= relative ? 1u : 0u;
+				record.normalPath = strings.Add(ToRelativePath(materials[i].normalPath, sourceDirectory, relative));
+				record.relativePaths |= relative ? 2u : 0u;
+			}
+
+			// ׂĂ SubMesh ׂ̂Ẵx
+			std::vector<SubMeshRecord> subMeshRecords;
+			std::vector<Mesh*> meshes;
+			for (const ImportedSubMesh& subMesh : subMeshes)
+			{
+				if (!subMesh.mesh)
+					continue;
+
+				SubMeshRecord record;
+				record.material = subMesh.material;
+				record.firstMesh = static_cast<uint32_t>(meshes.size());
+				record.lodCount = subMesh.mesh->GetLodCount();
+				record.name = strings.Add(subMesh.name);
+				subMeshRecords.push_back(record);
+
+				for (uint32_t level = 0; level < record.lodCount; ++level)
+				{
+					Mesh* mesh = subMesh.mesh->GetLod(level);
+					if (!mesh->IsUploadPending())
+						return false;
+					meshes.push_back(mesh);
+				}
+			}
+
+			// \ɁǍɃf[^{
+			FileHeader header = {};
+			header.magic = kMagic;
+			header.version = kVersion;
+			header.key = key;
+			header.layout = GetLayout();
+			header.materialCount = static_cast<uint32_t>(materialRecords.size());
+			header.subMeshCount = static_cast<uint32_t>(subMeshRecords.size());
+			header.meshCount = static_cast<uint32_t>(meshes.size());
+			header.stringBytes = static_cast<uint32_t>(strings.GetData().size());
+			header.report = report;
+
+			uint64_t offset = sizeof(FileHeader) + materialRecords.size() * sizeof(MaterialRecord) +
+				subMeshRecords.size() * sizeof(SubMeshRecord) + meshes.size() * sizeof(MeshRecord) + header.stringBytes;
+
+			std::vector<MeshRecord> meshRecords(meshes.size());
+			for (size_t i = 0; i < meshes.size(); ++i)
+			{
+				const Mesh* mesh = meshes[i];
+				MeshRecord& record = meshRecords[i];
+				record = {};
+				record.vertexFormat = mesh->GetVertexFormat();
+				record.vertexCount = mesh->GetVertexCount();
+				record.indexCount = mesh->GetIndexCount();
+				record.indices16Bit = mesh->GetIndexFormat() == DXGI_FORMAT_R16_UINT ? 1 : 0;
+				record.meshletCount = static_cast<uint32_t>(mesh->GetMeshlets().size());
+				record.cpuAccess = mesh->GetCpuAccess();
+				record.bounds = mesh->GetBounds();
+				record.positionTransform = mesh->GetPositionTransform();
+
+				record.vertexOffset = offset = AlignBlob(offset);
+				offset += mesh->GetVertexBufferSize();
+				record.indexOffset = offset = AlignBlob(offset);
+				offset += mesh->GetIndexBufferSize();
+				record.meshletOffset = offset = AlignBlob(offset);
+				offset += record.meshletCount * sizeof(Meshlet);
+
+				// SȒ_ CPU ɎcƂKvBW̒_`Ȃ璸_f[^̂
+				if (record.cpuAccess != MeshCpuAccess::None && !mesh->GetVertices().empty())
+				{
+					if (record.vertexFormat == VertexFormat::Standard)
+					{
+						record.cpuVertexOffset = record.vertexOffset;
+					}
+					else
+					{
+						record.cpuVertexOffset = offset = AlignBlob(offset);
+						offset += mesh->GetVertices().size() * sizeof(Vertex);
+					}
+				}
+			}
+			for (const SubMeshRecord& subMesh : subMeshRecords)
+			{
+				for (uint32_t level = 0; level < subMesh.lodCount; ++level)
+				{
+					uint32_t index = subMesh.firstMesh + level;
+					meshRecords[index].screenSize = meshes[subMesh.firstMesh]->GetLodScreenSize(level);
+				}
+			}
+			header.fileSize = offset;
+
+			// {̂͂܂őgݗĂB̃nbVwb_[ɓ邽
+			std::vector<uint8_t> body;
+			body.reserve(static_cast<size_t>(header.fileSize - sizeof(FileHeader)));
+			auto write = [&](const void* data, uint64_t size)
+			{
+				const uint8_t* bytes = static_cast<const uint8_t*>(data);
+				body.insert(body.end(), bytes, bytes + size);
+			};
+			auto pad = [&](uint64_t target)
+			{
+				body.resize(static_cast<size_t>(target - sizeof(FileHeader)), 0);
+			};
+
+			write(materialRecords.data(), materialRecords.size() * sizeof(MaterialRecord));
+			write(subMeshRecords.data(), subMeshRecords.size() * sizeof(SubMeshRecord));
+			write(meshRecords.data(), meshRecords.size() * sizeof(MeshRecord));
+			write(strings.GetData().data(), strings.GetData().size());
+
+			for (size_t i = 0; i < meshes.size(); ++i)
+			{
+				const Mesh* mesh = meshes[i];
+				const MeshRecord& record = meshRecords[i];
+				pad(record.vertexOffset);
+				write(mesh->GetUploadVertexData(), mesh->GetVertexBufferSize());
+				pad(record.indexOffset);
+				write(mesh->GetUploadIndexData(), mesh->GetIndexBufferSize());
+				pad(record.meshletOffset);
+				write(mesh->GetMeshlets().data(), record.meshletCount * sizeof(Meshlet));
+				if (record.cpuVertexOffset > record.vertexOffset)
+				{
+					pad(record.cpuVertexOffset);
+					write(mesh->GetVertices().data(), mesh->GetVertices().size() * sizeof(Vertex));
+				}
+			}
+
+			if (sizeof(FileHeader) + body.size() != header.fileSize)
+				return false;
+			header.contentHash = Hash(body.data(), body.size());
+
+			std::error_code error;
+			std::filesystem::path path = std::filesystem::u8path(filepath);
+			std::filesystem::create_directories(path.parent_path(), error);
+
+			std::filesystem::path temporaryPath = GetTemporaryPath(path);
+			{
+				std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+				if (!stream)
+					return false;
+
+				stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				stream.write(reinterpret_cast<const char*>(body.data()), static_cast<std::streamsize>(body.size()));
+				if (!stream)
+				{
+					stream.close();
+					std::filesystem::remove(temporaryPath, error);
+					return false;
+				}
+			}
+
+			std::filesystem::rename(temporaryPath, path, error);
+			if (error)
+			{
+				std::filesystem::remove(temporaryPath, error);
+				return false;
+			}
+			return true;
+		}
+
+		std::shared_ptr<MappedFile> Read(const std::string& filepath, uint64_t key, const std::string& sourceDirectory,
+			std::vector<ImportedMaterial>& outMaterials, std::vector<ImportedSubMesh>& outSubMeshes,
+			ModelLoadReport& outReport)
+		{
+			auto file = std::make_shared<MappedFile>();
+			if (!file->Open(filepath))
+				return nullptr;
+
+			FileView view(file->GetData(), file->GetSize());
+			FileHeader header;
+			if (!view.ReadRecord(0, header) || header.magic != kMagic || header.version != kVersion ||
+				header.key != key || header.layout != GetLayout() || header.fileSize != file->GetSize() ||
+				Hash(view.At(sizeof(FileHeader)), file->GetSize() - sizeof(FileHeader)) != header.contentHash)
+				return nullptr;
+
+			uint64_t materialOffset = sizeof(FileHeader);
+			uint64_t subMeshOffset = materialOffset + (uint64_t)header.materialCount * sizeof(MaterialRecord);
+			uint64_t meshOffset = subMeshOffset + (uint64_t)header.subMeshCount * sizeof(SubMeshRecord);
+			uint64_t stringOffset = meshOffset + (uint64_t)header.meshCount * sizeof(MeshRecord);
+			if (!view.Contains(stringOffset, header.stringBytes))
+				return nullptr;
+
+			const char* strings = reinterpret_cast<const char*>(view.At(stringOffset));
+			auto readString = [&](const StringRef& ref, std::string& out)
+			{
+				if ((uint64_t)ref.offset + ref.length > header.stringBytes)
+					return false;
+				out.assign(strings + ref.offset, ref.length);
+				return true;
+			};
+
+			std::vector<ImportedMaterial> materials(header.materialCount);
+			for (uint32_t i = 0; i < header.materialCount; ++i)
+			{
+				MaterialRecord record;
+				view.ReadRecord(materialOffset + i * sizeof(MaterialRecord), record);
+				ImportedMaterial& material = materials[i];
+				material.properties = record.properties;
+				if (!readString(record.albedoPath, material.albedoPath) || !readString(record.normalPath, material.normalPath))
+					return nullptr;
+				if ((record.relativePaths & 1u) != 0)
+					material.albedoPath = sourceDirectory + "/" + material.albedoPath;
+				if ((record.relativePaths & 2u) != 0)
+					material.normalPath = sourceDirectory + "/" + material.normalPath;
+			}
+
+			// bV̓}bvwBCPU ɒ_cȂRs[Ȃ
+			std::vector<std::shared_ptr<Mesh>> meshes(header.meshCount);
+			std::vector<float> screenSizes(header.meshCount);
+			for (uint32_t i = 0; i < header.meshCount; ++i)
+			{
+				MeshRecord record;
+				view.ReadRecord(meshOffset + i * sizeof(MeshRecord), record);
+				if (!VertexFormat::IsValid(record.vertexFormat) ||
+					!view.ContainsBlob(record.vertexOffset, (uint64_t)record.vertexCount * VertexFormat::GetStride(record.vertexFormat)) ||
+					!view.ContainsBlob(record.indexOffset, (uint64_t)record.indexCount * GetIndexStride(record)) ||
+					!view.ContainsBlob(record.meshletOffset, (uint64_t)record.meshletCount * sizeof(Meshlet)) ||
+					(record.cpuVertexOffset && !view.ContainsBlob(record.cpuVertexOffset, (uint64_t)record.vertexCount * sizeof(Vertex))))
+					return nullptr;
+				if (record.cpuVertexOffset && record.cpuAccess != MeshCpuAccess::None &&
+					!(record.indices16Bit ? IndicesInRange<uint16_t>(view.At(record.indexOffset), record.indexCount, record.vertexCount)
+						: IndicesInRange<uint32_t>(view.At(record.indexOffset), record.indexCount, record.vertexCount)))
+					return nullptr;
+
+				MeshUploadData data;
+				data.vertexFormat = record.vertexFormat;
+				data.vertexCount = record.vertexCount;
+				data.vertexData = view.At(record.vertexOffset);
+				data.indexCount = record.indexCount;
+				data.indices16Bit = record.indices16Bit != 0;
+				data.indexData = view.At(record.indexOffset);
+				data.positionTransform = record.positionTransform;
+				data.bounds = record.bounds;
+				if (record.cpuVertexOffset)
+					data.cpuVertices = reinterpret_cast<const Vertex*>(view.At(record.cpuVertexOffset));
+
+				auto mesh = std::make_shared<Mesh>();
+				mesh->Prepare(data, record.cpuAccess);
+
+				const Meshlet* meshlets = reinterpret_cast<const Meshlet*>(view.At(record.meshletOffset));
+				mesh->SetMeshlets(std::vector<Meshlet>(meshlets, meshlets + record.meshletCount));
+
+				meshes[i] = std::move(mesh);
+				screenSizes[i] = record.screenSize;
+			}
+
+			std::vector<ImportedSubMesh> subMeshes(header.subMeshCount);
+			for (uint32_t i = 0; i < header.subMeshCount; ++i)
+			{
+				SubMeshRecord record;
+				view.ReadRecord(subMeshOffset + i * sizeof(SubMeshRecord), record);
+				if (record.material >= header.materialCount || record.lodCount == 0 ||
+					(uint64_t)record.firstMesh + record.lodCount > header.meshCount)
+					return nullptr;
+
+				ImportedSubMesh& subMesh = subMeshes[i];
+				if (!readString(record.name, subMesh.name))
+					return nullptr;
+				subMesh.material = record.material;
+				subMesh.mesh = meshes[record.firstMesh];
+				for (uint32_t level = 1; level < record.lodCount; ++level)
+				{
+					uint32_t index = record.firstMesh + level;
+					subMesh.mesh->AddLod(meshes[index], screenSizes[index]);
+				}
+			}
+
+			outMaterials.insert(outMaterials.end(), materials.begin(), materials.end());
+			for (ImportedSubMesh& subMesh : subMeshes)
+				outSubMeshes.push_back(std::move(subMesh));
+			outReport = header.report;
+			return file;
+		}
+	}
+}
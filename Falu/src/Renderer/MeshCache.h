@@ -0,0 +1,56 @@
+/*****************************************************************//**
+ * \file   MeshCache.h
+ * \brief  ēǂݍ݂ŃC|[^[ʂɍςށAĂݍς݂̃oCift@C
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Falu
+{
+	class MappedFile;
+	struct ImportedMaterial;
+	struct ImportedSubMesh;
+	struct ModelLoadReport;
+
+	// C|[gf 1 ɂ 1 t@CŁAC|[^[ׂ̂ĎB
+	// GPU ̕т̒_ƃCfbNX(CfbNX̓bVbg)AbVbgALODAoEfBOA
+	// SubMesh ̕\A}eÃp[^[ƃeNX`̎QƁBt@C͌t@C̒gƃC|[gݒ
+	// nbVȂ̂ŁAt@CҏWݒς肷ΒPɃqbgȂȂB
+	//
+	// ǂݍ݂̓t@C}bvA}bv璼ڃAbv[h郁bVpӂB͂_Ƃ̏ȂB
+	// `͂̃rh̍\̂̕т̂܂܂ŁAo[WAсATCYAg̃nbVȂƂA
+	// ͈͊ÕItZbgƂ̓qbgȂɂȂ
+	namespace MeshCache
+	{
+		constexpr uint32_t kVersion = 2;
+
+		// oCg 64 rbgnbV(XXH64)
+		uint64_t Hash(const void* data, size_t size, uint64_t seed = 0);
+		// t@C̒g̃nbVB}bvēǂށBǂ߂Ȃ false
+		bool HashFile(const std::string& filepath, uint64_t seed, uint64_t& outHash);
+
+		// <directory>/<16 ĩL[>.fmc
+		std::string GetCookedPath(const std::string& directory, uint64_t key);
+
+		// bV͗pӍς݂ł܂Abv[hĂȂ(Mesh::IsUploadPending)B
+		// sourceDirectory ̒̃eNX`̃pX͂̑΃pXŎB̌Ăяop̈ꎞt@C
+		// oR̂ŁAǂޑ̃t@C邱Ƃ͂ȂAL[𓯎ɏĂĂȂ
+		bool Write(const std::string& filepath, uint64_t key, const std::string& sourceDirectory,
+			const std::vector<ImportedMaterial>& materials, const std::vector<ImportedSubMesh>& subMeshes,
+			const ModelLoadReport& report);
+
+		// Write ۑ̂ǉBbV͖߂l̃}bvŵŁA}bv̓bV Upload 
+		// ĂƁBqbgȂ nullptr ŁAǉȂ
+		std::shared_ptr<MappedFile> Read(const std::string& filepath, uint64_t key, const std::string& sourceDirectory,
+			std::vector<ImportedMaterial>& outMaterials, std::vector<ImportedSubMesh>& outSubMeshes,
+			ModelLoadReport& outReport);
+	}
+}
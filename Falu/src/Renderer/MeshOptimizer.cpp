@@ -0,0 +1,389 @@
+/*****************************************************************//**
+ * \file   MeshOptimizer.cpp
+ * \brief  MeshOptimizer ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "MeshOptimizer.h"
+#include "VertexTypes.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Falu
+{
+	namespace MeshOptimizer
+	{
+		namespace
+		{
+			//=== Forsyth scoring ===
+			// "Linear-Speed Vertex Cache Optimisation"(Tom Forsyth, 2006)̒萔
+			constexpr int kScoreCacheSize = 32;
+			constexpr float kCacheDecayPower = 1.5f;
+			constexpr float kLastTriangleScore = 0.75f;
+			constexpr float kValenceBoostScale = 2.0f;
+			constexpr float kValenceBoostPower = 0.5f;
+			constexpr uint32_t kMaxValence = 64;
+
+			struct ScoreTable
+			{
+				float cache[kScoreCacheSize];
+				float valence[kMaxValence];
+
+				ScoreTable()
+				{
+					for (int i = 0; i < kScoreCacheSize; ++i)
+					{
+						if (i < 3)
+						{
+							// O̎Op`̒_ɂ͌Œ̃XRA^A̎Op`ӂg񂷂ɂȂȂ悤ɂ
+							cache[i] = kLastTriangleScore;
+						}
+						else
+						{
+							float scaler = 1.0f / (kScoreCacheSize - 3);
+							cache[i] = std::pow(1.0f - (i - 3) * scaler, kCacheDecayPower);
+						}
+					}
+					valence[0] = 0.0f;
+					for (uint32_t i = 1; i < kMaxValence; ++i)
+					{
+						valence[i] = kValenceBoostScale * std::pow(float(i), -kValenceBoostPower);
+					}
+				}
+			};
+
+			const ScoreTable& GetScoreTable()
+			{
+				static const ScoreTable table;
+				return table;
+			}
+
+			float VertexScore(int cachePosition, uint32_t remainingTriangles)
+			{
+				if (remainingTriangles == 0)
+					return -1.0f;
+
+				const ScoreTable& table = GetScoreTable();
+				float score = (cachePosition >= 0) ? table.cache[cachePosition] : 0.0f;
+				score += table.valence[std::min(remainingTriangles, kMaxValence - 1)];
+				return score;
+			}
+		}
+
+		VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+		{
+			VertexCacheStats stats;
+			stats.triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+			// FIFO: ǂݍ܂Ẵ~X cacheSize 񖢖̒_̓LbVɎcĂ
+			std::vector<uint32_t> loadedAt(vertexCount, 0);
+			std::vector<bool> used(vertexCount, false);
+			uint32_t time = cacheSize + 1;
+
+			for (size_t i = 0; i + 2 < indices.size(); i += 3)
+			{
+				for (int k = 0; k < 3; ++k)
+				{
+					uint32_t v = indices[i + k];
+					if (v >= vertexCount)
+						continue;
+
+					if (!used[v])
+					{
+						used[v] = true;
+						++stats.vertexCount;
+					}
+
+					if (time - loadedAt[v] > cacheSize)
+					{
+						loadedAt[v] = time++;
+						++stats.transformCount;
+					}
+				}
+			}
+			return stats;
+		}
+
+		void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount)
+		{
+			const size_t triangleCount = indices.size() / 3;
+			if (triangleCount == 0 || vertexCount == 0)
+				return;
+
+			// _ -> Op`̗א(CSR)
+			std::vector<uint32_t> remaining(vertexCount, 0);
+			for (size_t i = 0; i < triangleCount * 3; ++i)
+			{
+				if (indices[i] >= vertexCount)
+					return;
+				++remaining[indices[i]];
+			}
+
+			std::vector<uint32_t> offsets(vertexCount + 1, 0);
+			for (size_t v = 0; v < vertexCount; ++v)
+				offsets[v + 1] = offsets[v] + remaining[v];
+
+			std::vector<uint32_t> adjacency(triangleCount * 3);
+			{
+				std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+				for (size_t t = 0; t < triangleCount; ++t)
+				{
+					for (int k = 0; k < 3; ++k)
+						adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+				}
+			}
+
+			std::vector<float> vertexScore(vertexCount);
+			for (size_t v = 0; v < vertexCount; ++v)
+				vertexScore[v] = VertexScore(-1, remaining[v]);
+
+			std::vector<bool> emitted(triangleCount, false);
+
+			std::vector<uint32_t> output;
+			output.reserve(triangleCount * 3);
+
+			// _ ID  LRU LbV
+			uint32_t cache[kScoreCacheSize];
+			uint32_t cacheCount = 0;
+
+			size_t scanCursor = 0;
+			int64_t bestTriangle = -1;
+
+			for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+			{
+				if (bestTriangle < 0)
+				{
+					// LbVɗאڂ̂cĂȂB܂oĂȂŏ̎Op`蒼B
+					// J[\Ő`ɕۂBԗǂXRA𖈉STƃpX 2 ɂȂ
+					while (scanCursor < triangleCount && emitted[scanCursor])
+						++scanCursor;
+					if (scanCursor == triangleCount)
+						break;
+					bestTriangle = static_cast<int64_t>(scanCursor);
+				}
+
+				size_t triangle = static_cast<size_t>(bestTriangle);
+				emitted[triangle] = true;
+
+				uint32_t tri[3] = { indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2] };
+				output.insert(output.end(), tri, tri + 3);
+
+				// Op`𒸓_̗אڂO
+				for (uint32_t v : tri)
+				{
+					uint32_t* begin = &adjacency[offsets[v]];
+					uint32_t* end = begin + remaining[v];
+					uint32_t* it = std::find(begin, end, static_cast<uint32_t>(triangle));
+					if (it != end)
+					{
+						std::swap(*it, *(end - 1));
+						--remaining[v];
+					}
+				}
+
+				// Op`̒_LbV̐擪ɈڂB] 3 gɂ͉o钸_
+				uint32_t newCache[kScoreCacheSize + 3];
+				uint32_t newCount = 0;
+				for (uint32_t v : tri)
+					newCache[newCount++] = v;
+				for (uint32_t i = 0; i < cacheCount; ++i)
+				{
+					uint32_t v = cache[i];
+					if (v != tri[0] && v != tri[1] && v != tri[2])
+						newCache[newCount++] = v;
+				}
+
+				// XVŐGꂽׂ̂č̓_Boꂽ΂̒_܂
+				for (uint32_t i = 0; i < newCount; ++i)
+				{
+					uint32_t v = newCache[i];
+					vertexScore[v] = VertexScore((i < kScoreCacheSize) ? static_cast<int>(i) : -1, remaining[v]);
+				}
+
+				// ĉ͐擪 kScoreCacheSize ܂
+				cacheCount = std::min<uint32_t>(newCount, kScoreCacheSize);
+				for (uint32_t i = 0; i < cacheCount; ++i)
+					cache[i] = newCache[i];
+
+				// ̎Op`̓LbVɗאڂ钆ňԗǂ
+				bestTriangle = -1;
+				float bestScore = -1.0f;
+				for (uint32_t i = 0; i < newCount; ++i)
+				{
+					uint32_t v = newCache[i];
+					for (uint32_t a = 0; a < remaining[v]; ++a)
+					{
+						uint32_t t = adjacency[offsets[v] + a];
+						float score = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+						if (score > bestScore)
+						{
+							bestScore = score;
+							bestTriangle = t;
+						}
+					}
+				}
+			}
+
+			indices.swap(output);
+		}
+
+		void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, uint32_t cacheSize)
+		{
+			const size_t triangleCount = indices.size() / 3;
+			if (triangleCount < 2 || vertices.empty())
+				return;
+
+			// OptimizeVertexCache ƓA͈͊ÕCfbNXΉȂ
+			for (size_t i = 0; i < triangleCount * 3; ++i)
+			{
+				if (indices[i] >= vertices.size())
+					return;
+			}
+
+			// NX^[̋: ׂĂ̒_ FIFO Ń~XOp`B܂IɃLbV蒼ɂȂ鏊B
+			// NX^[Pʂŕבւ΁AeNX^[̒̃LbV̐U镑͕ۂ
+			std::vector<size_t> clusterStart;
+			{
+				std::vector<uint32_t> loadedAt(vertices.size(), 0);
+				uint32_t time = cacheSize + 1;
+				for (size_t t = 0; t < triangleCount; ++t)
+				{
+					int misses = 0;
+					for (int k = 0; k < 3; ++k)
+					{
+						uint32_t v = indices[t * 3 + k];
+						if (time - loadedAt[v] > cacheSize)
+						{
+							loadedAt[v] = time++;
+							++misses;
+						}
+					}
+					if (t == 0 || misses == 3)
+						clusterStart.push_back(t);
+				}
+			}
+			if (clusterStart.size() < 2)
+				return;
+			clusterStart.push_back(triangleCount);
+
+			// bV̏dS
+			Math::Vector3 meshCenter(0.0f, 0.0f, 0.0f);
+			for (const Vertex& vertex : vertices)
+			{
+				meshCenter.x += vertex.position.x;
+				meshCenter.y += vertex.position.y;
+				meshCenter.z += vertex.position.z;
+			}
+			float inv = 1.0f / vertices.size();
+			meshCenter = Math::Vector3(meshCenter.x * inv, meshCenter.y * inv, meshCenter.z * inv);
+
+			// eNX^[𒆐SǂꂾOĂ邩ŕׂBO̊k
+			struct Cluster
+			{
+				size_t begin;
+				size_t end;
+				float sortKey;
+			};
+			std::vector<Cluster> clusters;
+			clusters.reserve(clusterStart.size() - 1);
+
+			for (size_t c = 0; c + 1 < clusterStart.size(); ++c)
+			{
+				Math::Vector3 centroid(0.0f, 0.0f, 0.0f);
+				Math::Vector3 normal(0.0f, 0.0f, 0.0f);
+				float area = 0.0f;
+
+				for (size_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t)
+				{
+					const Math::Vector3& p0 = vertices[indices[t * 3]].position;
+					const Math::Vector3& p1 = vertices[indices[t * 3 + 1]].position;
+					const Math::Vector3& p2 = vertices[indices[t * 3 + 2]].position;
+
+					// ʐςŏdݕtB|cross| ͎Op`̖ʐς 2 {
+					Math::Vector3 n = Math::Cross(p1 - p0, p2 - p0);
+					float w = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+
+					normal = Math::Vector3(normal.x + n.x, normal.y + n.y, normal.z + n.z);
+					centroid.x += (p0.x + p1.x + p2.x) * w;
+					centroid.y += (p0.y + p1.y + p2.y) * w;
+					centroid.z += (p0.z + p1.z + p2.z) * w;
+					area += w * 3.0f;
+				}
+
+				float key = 0.0f;
+				float normalLength = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+				if (area > 0.0f && normalLength > 0.0f)
+				{
+					Math::Vector3 toCluster = Math::Vector3(centroid.x / area, centroid.y / area, centroid.z / area) - meshCenter;
+					key = (toCluster.x * normal.x + toCluster.y * normal.y + toCluster.z * normal.z) / normalLength;
+				}
+				clusters.push_back({ clusterStart[c], clusterStart[c + 1], key });
+			}
+
+			std::stable_sort(clusters.begin(), clusters.end(),
+				[](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+			std::vector<uint32_t> output;
+			output.reserve(indices.size());
+			for (const Cluster& cluster : clusters)
+			{
+				output.insert(output.end(), indices.begin() + cluster.begin * 3, indices.begin() + cluster.end * 3);
+			}
+			indices.swap(output);
+		}
+
+		void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+		{
+			const uint32_t kUnmapped = UINT32_MAX;
+			std::vector<uint32_t> remap(vertices.size(), kUnmapped);
+
+			std::vector<Vertex> output;
+			output.reserve(vertices.size());
+
+			for (uint32_t& index : indices)
+			{
+				if (index >= vertices.size())
+					continue;
+
+				if (remap[index] == kUnmapped)
+				{
+					remap[index] = static_cast<uint32_t>(output.size());
+					output.push_back(vertices[index]);
+				}
+				index = remap[index];
+			}
+
+			vertices.swap(output);
+		}
+
+		void Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, const Settings& settings, Report* report)
+		{
+			if (report)
+				report->before = AnalyzeVertexCache(indices, vertices.size(), settings.cacheSize);
+
+			if (settings.enabled && indices.size() >= 3)
+			{
+				if (settings.vertexCache)
+					OptimizeVertexCache(indices, vertices.size());
+
+				if (settings.overdraw)
+				{
+					// I[o[h[̏́ALbV̉P܂łȂƂg
+					float acmr = AnalyzeVertexCache(indices, vertices.size(), settings.cacheSize).GetACMR();
+					std::vector<uint32_t> sorted = indices;
+					OptimizeOverdraw(sorted, vertices, settings.cacheSize);
+					if (AnalyzeVertexCache(sorted, vertices.size(), settings.cacheSize).GetACMR() <= acmr * settings.overdrawThreshold)
+						indices.swap(sorted);
+				}
+
+				if (settings.vertexFetch)
+					OptimizeVertexFetch(vertices, indices);
+			}
+
+			if (report)
+				report->after = AnalyzeVertexCache(indices, vertices.size(), settings.cacheSize);
+		}
+	}
+}
@@ -0,0 +1,76 @@
+/*****************************************************************//**
+ * \file   MeshOptimizer.h
+ * \brief  ϊLbVAI[o[h[A_tFb`̂߂̎Op`ƒ_̕בւ
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Falu
+{
+	struct Vertex;
+
+	// CPU ݂̂̃bVœKpXBׂ 32 rbgCfbNX̎Op`Xgɑ΂ēA
+	// bV̌ڂ͕ςȂBς͎̂Op`ƒ_̏ԂB
+	namespace MeshOptimizer
+	{
+		// FIFO ̕ϊLbṼV~[V
+		struct VertexCacheStats
+		{
+			uint32_t triangleCount = 0;
+			uint32_t vertexCount = 0;		// 1 ȏQƂꂽ_
+			uint32_t transformCount = 0;	// LbV~X = _VF[_[̎s
+
+			// σLbV~X: Op`̕ϊ(傫ȃObh̗z 0.5Aň 3)
+			float GetACMR() const { return triangleCount ? float(transformCount) / triangleCount : 0.0f; }
+			// ϊ񐔂ƒ_̔̕: 1.0 Ȃ炷ׂĂ̒_傤 1 񂸂VF[fBO
+			float GetATVR() const { return vertexCount ? float(transformCount) / vertexCount : 0.0f; }
+
+			void Add(const VertexCacheStats& other)
+			{
+				triangleCount += other.triangleCount;
+				vertexCount += other.vertexCount;
+				transformCount += other.transformCount;
+			}
+		};
+
+		struct Settings
+		{
+			bool enabled = true;
+			bool vertexCache = true;
+			bool overdraw = true;
+			bool vertexFetch = true;
+			// ͂ƃI[o[h[̃NX^[̋ڂɎg FIFO ̑傫
+			uint32_t cacheSize = 16;
+			// I[o[h[̕בւ ACMR ̔{オȂgȂ
+			float overdrawThreshold = 1.05f;
+		};
+
+		struct Report
+		{
+			VertexCacheStats before;
+			VertexCacheStats after;
+		};
+
+		VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+		// Forsyth ̐`Ԃ̒_LbVœKBOp`̏ŕבւ
+		void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount);
+
+		// (LbVœKς݂)XgLbV̂蒼ŃNX^[ɕAONX^[ׂB
+		// O̖ʂAɉBʂɕ`₷Ȃ
+		void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, uint32_t cacheSize = 16);
+
+		// _ŏɎg鏇ɐU蒼AQƂȂ_̂ĂB̔z
+		void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+		// LȃpXɎs(LbV -> I[o[h[ -> tFb`)Breport  null ł悢
+		void Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+			const Settings& settings, Report* report = nullptr);
+	}
+}
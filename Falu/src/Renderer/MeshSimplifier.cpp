@@ -0,0 +1,341 @@
+/*****************************************************************//**
+ * \file   MeshSimplifier.cpp
+ * \brief  MeshSimplifier ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "MeshSimplifier.h"
+#include "Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace Falu
+{
+	namespace MeshSimplifier
+	{
+		namespace
+		{
+			struct Vec3
+			{
+				double x, y, z;
+			};
+
+			Vec3 Sub(const Vec3& a, const Vec3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+			Vec3 Cross(const Vec3& a, const Vec3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+			double Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+			// Ώ̂ 4x4 ̕ʂ̓񎟌덷(Op)
+			struct Quadric
+			{
+				double a2 = 0, ab = 0, ac = 0, ad = 0;
+				double b2 = 0, bc = 0, bd = 0;
+				double c2 = 0, cd = 0;
+				double d2 = 0;
+
+				static Quadric FromPlane(double a, double b, double c, double d, double weight)
+				{
+					Quadric q;
+					q.a2 = a * a * weight; q.ab = a * b * weight; q.ac = a * c * weight; q.ad = a * d * weight;
+					q.b2 = b * b * weight; q.bc = b * c * weight; q.bd = b * d * weight;
+					q.c2 = c * c * weight; q.cd = c * d * weight;
+					q.d2 = d * d * weight;
+					return q;
+				}
+
+				void Add(const Quadric& q)
+				{
+					a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+					b2 += q.b2; bc += q.bc; bd += q.bd;
+					c2 += q.c2; cd += q.cd;
+					d2 += q.d2;
+				}
+
+				// ܂ʂ܂ł̋ 2 a
+				double Evaluate(const Vec3& p) const
+				{
+					double x = p.x, y = p.y, z = p.z;
+					double r = a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+						+ b2 * y * y + 2 * bc * y * z + 2 * bd * y
+						+ c2 * z * z + 2 * cd * z
+						+ d2;
+					return std::fabs(r);
+				}
+			};
+
+			struct Collapse
+			{
+				uint32_t from;
+				uint32_t to;
+				double cost;
+			};
+
+			struct PositionKey
+			{
+				float x, y, z;
+				bool operator==(const PositionKey& o) const { return x == o.x && y == o.y && z == o.z; }
+			};
+
+			struct PositionHash
+			{
+				size_t operator()(const PositionKey& k) const
+				{
+					uint32_t h[3];
+					memcpy(h, &k, sizeof(h));
+					return (size_t)(h[0] * 73856093u) ^ (size_t)(h[1] * 19349663u) ^ (size_t)(h[2] * 83492791u);
+				}
+			};
+
+			uint64_t EdgeKey(uint32_t a, uint32_t b)
+			{
+				if (a > b)
+					std::swap(a, b);
+				return (uint64_t(a) << 32) | b;
+			}
+		}
+
+		size_t Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+			size_t targetIndexCount, float maxError, std::vector<uint32_t>& outIndices, float* outError)
+		{
+			outIndices.assign(indices.begin(), indices.end() - indices.size() % 3);
+			if (outError)
+				*outError = 0.0f;
+
+			const size_t vertexCount = vertices.size();
+			if (vertexCount == 0 || outIndices.size() <= targetIndexCount)
+				return outIndices.size();
+
+			for (uint32_t index : outIndices)
+			{
+				if (index >= vertexCount)
+					return outIndices.size();
+			}
+
+			// 傫 1 ̋ԂŌvZAmaxError bVɑ΂鑊Βlɂ
+			Vec3 minP = { vertices[0].position.x, vertices[0].position.y, vertices[0].position.z };
+			Vec3 maxP = minP;
+			for (const Vertex& v : vertices)
+			{
+				minP = { std::min<double>(minP.x, v.position.x), std::min<double>(minP.y, v.position.y), std::min<double>(minP.z, v.position.z) };
+				maxP = { std::max<double>(maxP.x, v.position.x), std::max<double>(maxP.y, v.position.y), std::max<double>(maxP.z, v.position.z) };
+			}
+			double extent = std::max(maxP.x - minP.x, std::max(maxP.y - minP.y, maxP.z - minP.z));
+			double scale = extent > 0.0 ? 1.0 / extent : 1.0;
+
+			std::vector<Vec3> positions(vertexCount);
+			for (size_t i = 0; i < vertexCount; ++i)
+			{
+				const Math::Vector3& p = vertices[i].position;
+				positions[i] = { (p.x - minP.x) * scale, (p.y - minP.y) * scale, (p.z - minP.z) * scale };
+			}
+
+			// ʒuL钸_(̌p)̓g|W[̏ł͂ȂAȂ
+			std::vector<uint32_t> canonical(vertexCount);
+			std::vector<bool> seam(vertexCount, false);
+			{
+				std::unordered_map<PositionKey, uint32_t, PositionHash> first;
+				first.reserve(vertexCount);
+				for (uint32_t i = 0; i < vertexCount; ++i)
+				{
+					const Math::Vector3& p = vertices[i].position;
+					auto result = first.emplace(PositionKey{ p.x, p.y, p.z }, i);
+					canonical[i] = result.first->second;
+					if (!result.second)
+					{
+						seam[i] = true;
+						seam[result.first->second] = true;
+					}
+				}
+			}
+
+			// ʐςŏdݕtʂ̓񎟌덷
+			std::vector<Quadric> quadrics(vertexCount);
+			for (size_t t = 0; t < outIndices.size(); t += 3)
+			{
+				const Vec3& p0 = positions[outIndices[t]];
+				const Vec3& p1 = positions[outIndices[t + 1]];
+				const Vec3& p2 = positions[outIndices[t + 2]];
+				Vec3 n = Cross(Sub(p1, p0), Sub(p2, p0));
+				double length = std::sqrt(Dot(n, n));
+				if (length <= 0.0)
+					continue;
+
+				double a = n.x / length, b = n.y / length, c = n.z / length;
+				double d = -(a * p0.x + b * p0.y + c * p0.z);
+				Quadric q = Quadric::FromPlane(a, b, c, d, length * 0.5);
+				for (int k = 0; k < 3; ++k)
+					quadrics[canonical[outIndices[t + k]]].Add(q);
+			}
+
+			const double maxCost = double(maxError) * double(maxError);
+			double acceptedCost = 0.0;
+
+			std::vector<uint32_t> remap(vertexCount);
+			std::vector<bool> locked(vertexCount);
+			std::vector<bool> border(vertexCount);
+			std::vector<uint32_t> triangleOffsets(vertexCount + 1);
+			std::vector<uint32_t> vertexTriangles;
+			std::vector<Collapse> collapses;
+			std::unordered_map<uint64_t, uint32_t> edgeUse;
+
+			// pX: kW߁AƗȂ̂ɓKpA蒼BȂȂ~߂
+			for (int pass = 0; pass < 64 && outIndices.size() > targetIndexCount; ++pass)
+			{
+				const size_t triangleCount = outIndices.size() / 3;
+
+				// E(1 񂵂gȂ)Ɣ񑽗l̂̕ӂ́A̒_Œ肷
+				edgeUse.clear();
+				edgeUse.reserve(triangleCount * 3);
+				for (size_t t = 0; t < outIndices.size(); t += 3)
+				{
+					for (int k = 0; k < 3; ++k)
+					{
+						uint32_t a = canonical[outIndices[t + k]];
+						uint32_t b = canonical[outIndices[t + (k + 1) % 3]];
+						++edgeUse[EdgeKey(a, b)];
+					}
+				}
+
+				std::fill(border.begin(), border.end(), false);
+				for (const auto& edge : edgeUse)
+				{
+					if (edge.second != 2)
+					{
+						border[edge.first >> 32] = true;
+						border[edge.first & 0xFFFFFFFFu] = true;
+					}
+				}
+
+				// Ԃ̔p̒_ -> Op`̗א
+				std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0);
+				for (uint32_t index : outIndices)
+					++triangleOffsets[index + 1];
+				for (size_t v = 0; v < vertexCount; ++v)
+					triangleOffsets[v + 1] += triangleOffsets[v];
+				vertexTriangles.resize(outIndices.size());
+				{
+					std::vector<uint32_t> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+					for (size_t i = 0; i < outIndices.size(); ++i)
+						vertexTriangles[fill[outIndices[i]]++] = static_cast<uint32_t>(i / 3);
+				}
+
+				// : pڂ̂Ȃ̒_Apڂ̂Ȃׂ̒_
+				collapses.clear();
+				for (size_t t = 0; t < outIndices.size(); t += 3)
+				{
+					for (int k = 0; k < 3; ++k)
+					{
+						uint32_t a = outIndices[t + k];
+						uint32_t b = outIndices[t + (k + 1) % 3];
+						for (int dir = 0; dir < 2; ++dir)
+						{
+							uint32_t from = dir ? b : a;
+							uint32_t to = dir ? a : b;
+							if (seam[from] || seam[to] || border[canonical[from]])
+								continue;
+
+							Quadric q = quadrics[from];
+							q.Add(quadrics[to]);
+							collapses.push_back({ from, to, q.Evaluate(positions[to]) });
+						}
+					}
+				}
+				if (collapses.empty())
+					break;
+
+				std::sort(collapses.begin(), collapses.end(),
+					[](const Collapse& x, const Collapse& y) { return x.cost < y.cost; });
+
+				for (uint32_t v = 0; v < vertexCount; ++v)
+					remap[v] = v;
+				std::fill(locked.begin(), locked.end(), false);
+
+				size_t remainingIndices = outIndices.size();
+				size_t applied = 0;
+				bool errorLimitReached = false;
+
+				for (const Collapse& collapse : collapses)
+				{
+					if (remainingIndices <= targetIndexCount)
+						break;
+					if (collapse.cost > maxCost)
+					{
+						errorLimitReached = true;
+						break;
+					}
+					if (locked[collapse.from] || locked[collapse.to])
+						continue;
+
+					// ̎Op`𗠕Ԃׂ肷k͏
+					bool valid = true;
+					size_t removedTriangles = 0;
+					for (uint32_t i = triangleOffsets[collapse.from]; i < triangleOffsets[collapse.from + 1] && valid; ++i)
+					{
+						const uint32_t* tri = &outIndices[(size_t)vertexTriangles[i] * 3];
+						if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+						{
+							++removedTriangles;
+							continue;
+						}
+
+						Vec3 before[3], after[3];
+						for (int k = 0; k < 3; ++k)
+						{
+							before[k] = positions[tri[k]];
+							after[k] = (tri[k] == collapse.from) ? positions[collapse.to] : before[k];
+						}
+						Vec3 n0 = Cross(Sub(before[1], before[0]), Sub(before[2], before[0]));
+						Vec3 n1 = Cross(Sub(after[1], after[0]), Sub(after[2], after[0]));
+						double l0 = std::sqrt(Dot(n0, n0));
+						double l1 = std::sqrt(Dot(n1, n1));
+						if (l1 <= 1e-12 || Dot(n0, n1) <= 0.2 * l0 * l1)
+							valid = false;
+					}
+					if (!valid)
+						continue;
+
+					remap[collapse.from] = collapse.to;
+					quadrics[collapse.to].Add(quadrics[collapse.from]);
+					acceptedCost = std::max(acceptedCost, collapse.cost);
+					remainingIndices -= removedTriangles * 3;
+					++applied;
+
+					// k̎͂̃pX̎cł͌ÂɂȂ
+					for (uint32_t i = triangleOffsets[collapse.from]; i < triangleOffsets[collapse.from + 1]; ++i)
+					{
+						const uint32_t* tri = &outIndices[(size_t)vertexTriangles[i] * 3];
+						locked[tri[0]] = locked[tri[1]] = locked[tri[2]] = true;
+					}
+				}
+
+				if (applied == 0)
+					break;
+
+				// āAkނOp`̂Ă
+				size_t write = 0;
+				for (size_t t = 0; t < outIndices.size(); t += 3)
+				{
+					uint32_t a = remap[outIndices[t]];
+					uint32_t b = remap[outIndices[t + 1]];
+					uint32_t c = remap[outIndices[t + 2]];
+					if (canonical[a] == canonical[b] || canonical[b] == canonical[c] || canonical[a] == canonical[c])
+						continue;
+					outIndices[write++] = a;
+					outIndices[write++] = b;
+					outIndices[write++] = c;
+				}
+				outIndices.resize(write);
+
+				if (errorLimitReached)
+					break;
+			}
+
+			if (outError)
+				*outError = static_cast<float>(std::sqrt(acceptedCost));
+			return outIndices.size();
+		}
+	}
+}
@@ -0,0 +1,31 @@
+/*****************************************************************//**
+ * \file   MeshSimplifier.h
+ * \brief  bV LOD 邽߂̓񎟌덷gNXɂȗ
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Falu
+{
+	struct Vertex;
+
+	// Garland-Heckbert ̕ӂ̏kB_ׂ̗͊̒_̏ɂȂ̂ŁA
+	// ʂ͓͂̒_zw(V_͍Ȃ)B
+	//
+	// JE UV/@̌p(̒_ 1 ̈ʒuL)͓Ȃ̂ŁA
+	// bV̒fЂ͂ꂸAeNX`􂯂ȂB
+	namespace MeshSimplifier
+	{
+		// CfbNX targetIndexCount ɒB邩Ȁk maxError(bV AABB ̍ő̕ӂɑ΂
+		// ΋)𒴂܂ŕӂk񂷂Bʂ̃CfbNXԂB
+		// outError ɂ͎󂯓ꂽňԑ傫덷
+		size_t Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+			size_t targetIndexCount, float maxError, std::vector<uint32_t>& outIndices, float* outError = nullptr);
+	}
+}
@@ -0,0 +1,312 @@
+/*****************************************************************//**
+ * \file   Meshlet.cpp
+ * \brief  Meshlet ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "Meshlet.h"
+#include "VertexTypes.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Falu
+{
+	namespace Meshlets
+	{
+		namespace
+		{
+			Math::Vector3 TriangleCentroid(const std::vector<Vertex>& vertices, const uint32_t* tri)
+			{
+				const Math::Vector3& a = vertices[tri[0]].position;
+				const Math::Vector3& b = vertices[tri[1]].position;
+				const Math::Vector3& c = vertices[tri[2]].position;
+				return Math::Vector3((a.x + b.x + c.x) / 3.0f, (a.y + b.y + c.y) / 3.0f, (a.z + b.z + c.z) / 3.0f);
+			}
+
+			// AABB ̒S͂ދƁAOp`̕\̖@̖@R[
+			void ComputeBounds(Meshlet& meshlet, const std::vector<Vertex>& vertices, const uint32_t* indices)
+			{
+				const uint32_t indexCount = meshlet.triangleCount * 3;
+
+				Math::Vector3 minP = vertices[indices[0]].position;
+				Math::Vector3 maxP = minP;
+				for (uint32_t i = 1; i < indexCount; ++i)
+				{
+					const Math::Vector3& p = vertices[indices[i]].position;
+					minP = Math::Vector3(std::min(minP.x, p.x), std::min(minP.y, p.y), std::min(minP.z, p.z));
+					maxP = Math::Vector3(std::max(maxP.x, p.x), std::max(maxP.y, p.y), std::max(maxP.z, p.z));
+				}
+
+				meshlet.center = Math::Vector3((minP.x + maxP.x) * 0.5f, (minP.y + maxP.y) * 0.5f, (minP.z + maxP.z) * 0.5f);
+				float radiusSq = 0.0f;
+				for (uint32_t i = 0; i < indexCount; ++i)
+				{
+					Math::Vector3 d = vertices[indices[i]].position - meshlet.center;
+					radiusSq = std::max(radiusSq, Math::Dot(d, d));
+				}
+				meshlet.radius = std::sqrt(radiusSq);
+
+				// \͉ʏŎvȂ̂ŁAcross(b - a, c - a) \̖@ɂȂ
+				std::vector<Math::Vector3> normals;
+				normals.reserve(meshlet.triangleCount);
+				Math::Vector3 axis(0.0f, 0.0f, 0.0f);
+				for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+				{
+					const Math::Vector3& a = vertices[indices[t * 3 + 0]].position;
+					const Math::Vector3& b = vertices[indices[t * 3 + 1]].position;
+					const Math::Vector3& c = vertices[indices[t * 3 + 2]].position;
+					Math::Vector3 n = Math::Cross(b - a, c - a);
+					float length = std::sqrt(Math::Dot(n, n));
+					if (length <= 0.0f)
+						continue;
+
+					n = Math::Vector3(n.x / length, n.y / length, n.z / length);
+					normals.push_back(n);
+					axis = Math::Vector3(axis.x + n.x, axis.y + n.y, axis.z + n.z);
+				}
+
+				meshlet.coneAxis = Math::Vector3(0.0f, 0.0f, 0.0f);
+				meshlet.coneCutoff = 1.0f;
+
+				float axisLength = std::sqrt(Math::Dot(axis, axis));
+				if (normals.empty() || axisLength <= 0.0f)
+					return;
+
+				axis = Math::Vector3(axis.x / axisLength, axis.y / axisLength, axis.z / axisLength);
+				float minDot = 1.0f;
+				for (const Math::Vector3& n : normals)
+				{
+					minDot = std::min(minDot, Math::Dot(n, axis));
+				}
+
+				meshlet.coneAxis = axis;
+				//  84 xLƁAۏシׂĂƂ͂Ȃ
+				if (minDot > 0.1f)
+					meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+			}
+		}
+
+		std::vector<Meshlet> Build(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+			uint32_t maxVertices, uint32_t maxTriangles)
+		{
+			std::vector<Meshlet> meshlets;
+
+			const size_t triangleCount = indices.size() / 3;
+			const size_t vertexCount = vertices.size();
+			if (triangleCount == 0 || maxVertices < 3 || maxTriangles == 0)
+				return meshlets;
+
+			// _ -> Op`̗א
+			std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+			for (size_t i = 0; i < triangleCount * 3; ++i)
+			{
+				++adjacencyOffsets[indices[i] + 1];
+			}
+			for (size_t v = 0; v < vertexCount; ++v)
+			{
+				adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+			}
+			std::vector<uint32_t> adjacency(triangleCount * 3);
+			{
+				std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+				for (size_t i = 0; i < triangleCount * 3; ++i)
+				{
+					adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+				}
+			}
+
+			std::vector<uint8_t> emitted(triangleCount, 0);
+			// _ŌɒǉbVbg̔ԍ
+			std::vector<uint32_t> vertexMeshlet(vertexCount, UINT32_MAX);
+			std::vector<uint32_t> candidates;
+			std::vector<uint32_t> output;
+			output.reserve(triangleCount * 3);
+
+			Meshlet current;
+			Math::Vector3 centroidSum(0.0f, 0.0f, 0.0f);
+			uint32_t meshletIndex = 0;
+			size_t seedCursor = 0;
+
+			auto newVertexCount = [&](uint32_t triangle)
+			{
+				const uint32_t* tri = &indices[triangle * 3];
+				return uint32_t(vertexMeshlet[tri[0]] != meshletIndex) +
+					uint32_t(vertexMeshlet[tri[1]] != meshletIndex) +
+					uint32_t(vertexMeshlet[tri[2]] != meshletIndex);
+			};
+
+			auto addTriangle = [&](uint32_t triangle)
+			{
+				const uint32_t* tri = &indices[triangle * 3];
+				for (int k = 0; k < 3; ++k)
+				{
+					uint32_t v = tri[k];
+					if (vertexMeshlet[v] == meshletIndex)
+						continue;
+
+					vertexMeshlet[v] = meshletIndex;
+					++current.vertexCount;
+					// bVbg̒_LOp`AbVbgL
+					for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a)
+					{
+						if (!emitted[adjacency[a]])
+							candidates.push_back(adjacency[a]);
+					}
+				}
+
+				output.insert(output.end(), tri, tri + 3);
+				emitted[triangle] = 1;
+				++current.triangleCount;
+
+				Math::Vector3 c = TriangleCentroid(vertices, tri);
+				centroidSum = Math::Vector3(centroidSum.x + c.x, centroidSum.y + c.y, centroidSum.z + c.z);
+			};
+
+			auto finishMeshlet = [&]()
+			{
+				current.indexOffset = static_cast<uint32_t>(output.size() - current.triangleCount * 3);
+				ComputeBounds(current, vertices, &output[current.indexOffset]);
+				meshlets.push_back(current);
+
+				current = Meshlet();
+				centroidSum = Math::Vector3(0.0f, 0.0f, 0.0f);
+				candidates.clear();
+				++meshletIndex;
+			};
+
+			for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+			{
+				// V_ȂAɃbVbgɋ߂ɂāAoEfBOۂ
+				uint32_t best = UINT32_MAX;
+				uint32_t bestNew = 4;
+				float bestDistance = 0.0f;
+
+				if (current.triangleCount > 0)
+				{
+					float inv = 1.0f / current.triangleCount;
+					Math::Vector3 centroid(centroidSum.x * inv, centroidSum.y * inv, centroidSum.z * inv);
+
+					size_t keep = 0;
+					for (size_t c = 0; c < candidates.size(); ++c)
+					{
+						uint32_t triangle = candidates[c];
+						if (emitted[triangle])
+							continue;
+						candidates[keep++] = triangle;
+
+						uint32_t newCount = newVertexCount(triangle);
+						if (newCount > bestNew)
+							continue;
+
+						Math::Vector3 d = TriangleCentroid(vertices, &indices[triangle * 3]) - centroid;
+						float distance = Math::Dot(d, d);
+						if (newCount < bestNew || distance < bestDistance)
+						{
+							best = triangle;
+							bestNew = newCount;
+							bestDistance = distance;
+						}
+					}
+					candidates.resize(keep);
+				}
+
+				if (best == UINT32_MAX)
+				{
+					// Ȃ̂cĂȂBbVbgA͂̏Ŏ̎I
+					if (current.triangleCount > 0)
+						finishMeshlet();
+
+					while (emitted[seedCursor])
+						++seedCursor;
+					best = static_cast<uint32_t>(seedCursor);
+				}
+				else if (current.vertexCount + bestNew > maxVertices || current.triangleCount + 1 > maxTriangles)
+				{
+					finishMeshlet();
+				}
+
+				addTriangle(best);
+			}
+
+			if (current.triangleCount > 0)
+				finishMeshlet();
+
+			indices.swap(output);
+			return meshlets;
+		}
+
+		CullView MakeCullView(const Math::Matrix4& world, const Math::Matrix4& viewProjection,
+			const Math::Vector3& cameraPosition)
+		{
+			CullView view;
+
+			// (world * viewProjection) ̕ʂ[JԂ̃NbvʂɂȂ
+			view.frustum = Math::Frustum::FromMatrix(world * viewProjection);
+
+			float determinant = 0.0f;
+			Math::Matrix4 invWorld = Math::Inverse(world, &determinant);
+			view.cameraPosition = Math::TransformPoint(cameraPosition, invWorld);
+			view.coneCulling = determinant > 0.0f;
+
+			return view;
+		}
+
+		size_t Cull(const std::vector<Meshlet>& meshlets, const CullView& view,
+			std::vector<IndexRange>& outRanges, CullStats* stats)
+		{
+			const size_t firstRange = outRanges.size();
+			CullStats local;
+
+			for (const Meshlet& meshlet : meshlets)
+			{
+				++local.meshletCount;
+
+				bool visible = view.frustum.Intersects(meshlet.center, meshlet.radius);
+				if (!visible)
+					++local.frustumCulled;
+
+				// ŜAR[ׂ̂Ă̖@납猩ĂȂ痠
+				if (visible && view.coneCulling && meshlet.coneCutoff < 1.0f)
+				{
+					Math::Vector3 toCenter = meshlet.center - view.cameraPosition;
+					float distance = std::sqrt(Math::Dot(toCenter, toCenter));
+					if (Math::Dot(toCenter, meshlet.coneAxis) >= meshlet.coneCutoff * distance + meshlet.radius)
+					{
+						visible = false;
+						++local.backfaceCulled;
+					}
+				}
+
+				if (!visible)
+					continue;
+
+				uint32_t indexCount = meshlet.triangleCount * 3;
+				if (outRanges.size() > firstRange &&
+					outRanges.back().indexOffset + outRanges.back().indexCount == meshlet.indexOffset)
+				{
+					outRanges.back().indexCount += indexCount;
+				}
+				else
+				{
+					IndexRange range;
+					range.indexOffset = meshlet.indexOffset;
+					range.indexCount = indexCount;
+					outRanges.push_back(range);
+				}
+			}
+
+			size_t added = outRanges.size() - firstRange;
+			if (stats)
+			{
+				local.rangeCount = static_cast<uint32_t>(added);
+				stats->meshletCount += local.meshletCount;
+				stats->frustumCulled += local.frustumCulled;
+				stats->backfaceCulled += local.backfaceCulled;
+				stats->rangeCount += local.rangeCount;
+			}
+			return added;
+		}
+	}
+}
@@ -0,0 +1,82 @@
+/*****************************************************************//**
+ * \file   Meshlet.h
+ * \brief  bVbg(Op`̃NX^[)ւ̕ CPU ł̃NX^[JO
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Include/Math/Frustum.h"
+
+namespace Falu
+{
+	struct Vertex;
+
+	// bṼCfbNXobt@̒ŁAȂ_ɂGOp`̘AȂB
+	// oEfBO̓bṼ[JԂŎ
+	struct Meshlet
+	{
+		uint32_t indexOffset = 0;
+		uint32_t triangleCount = 0;
+		uint32_t vertexCount = 0;
+
+		// E
+		Math::Vector3 center;
+		float radius = 0.0f;
+
+		// @R[: ׂĂ̎Op`̕\̖@ coneAxis  acos(sqrt(1 - coneCutoff^2)) ȓɂB
+		// coneCutoff = 1 ̓R[LėɂȂ邱ƂȂƂӖ
+		Math::Vector3 coneAxis;
+		float coneCutoff = 1.0f;
+	};
+
+	// CfbNXobt@ [indexOffset, indexOffset + indexCount)B1  DrawIndexed ŕ`
+	struct IndexRange
+	{
+		uint32_t indexOffset = 0;
+		uint32_t indexCount = 0;
+	};
+
+	namespace Meshlets
+	{
+		constexpr uint32_t kMaxVertices = 64;
+		constexpr uint32_t kMaxTriangles = 124;
+
+		// bṼ[JԂł̃J
+		struct CullView
+		{
+			Math::Frustum frustum;
+			Math::Vector3 cameraPosition;
+			// f[hsł́AR[Ƃ̉菇tɂȂ̂Ő؂
+			bool coneCulling = true;
+		};
+
+		struct CullStats
+		{
+			uint32_t meshletCount = 0;
+			uint32_t frustumCulled = 0;
+			uint32_t backfaceCulled = 0;
+			uint32_t rangeCount = 0;
+
+			uint32_t GetVisibleCount() const { return meshletCount - frustumCulled - backfaceCulled; }
+		};
+
+		// ̎Op`̏n߁AL钸_ǂăNX^[×~ɍL(ɒ_LbV
+		// œKĂ)BebVbg̎Op`A悤ɃCfbNX
+		std::vector<Meshlet> Build(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+			uint32_t maxVertices = kMaxVertices, uint32_t maxTriangles = kMaxTriangles);
+
+		// J world ̃[JԂɈڂBs͂ǂsxNg`
+		CullView MakeCullView(const Math::Matrix4& world, const Math::Matrix4& viewProjection,
+			const Math::Vector3& cameraPosition);
+
+		// bVbgƂɎƖ@R[Ŕ肷BCfbNXobt@ŗׂ荇郁bVbg
+		// 1 ͈̔͂ɂ܂Ƃ߂BoutRanges ɒǉAǉ͈͂̐Ԃ
+		size_t Cull(const std::vector<Meshlet>& meshlets, const CullView& view,
+			std::vector<IndexRange>& outRanges, CullStats* stats = nullptr);
+	}
+}
@@ -46,6 +46,17 @@ namespace Falu
 		m_subMeshes.push_back(std::move(subMesh));
 	}
 
+	MeshMemoryUsage Model::GetMemoryUsage() const
+	{
+		MeshMemoryUsage usage;
+		for (const auto& subMesh : m_subMeshes)
+		{
+			if (subMesh.mesh)
+				usage.Add(subMesh.mesh->GetMemoryUsage());
+		}
+		return usage;
+	}
+
 	void Model::CalculateBounds()
 	{
 		if (m_subMeshes.empty())
@@ -61,7 +72,7 @@ namespace Falu
 		{
 			if (subMesh.mesh)
 			{
-				Math::AABB meshBounds = subMesh.mesh->CalculateBounds();
+				Math::AABB meshBounds = subMesh.mesh->GetBounds();
 
 				min.x = std::min(min.x, meshBounds.min.x);
 				min.y = std::min(min.y, meshBounds.min.y);
@@ -20,6 +20,7 @@ namespace Falu
 	class Mesh;
 	class Material;
 	class Texture;
+	struct MeshMemoryUsage;
 
 	// SubMesh
 	struct SubMesh
@@ -53,6 +54,9 @@ namespace Falu
 		Math::AABB GetBounds() const { return m_bounds; }
 		void CalculateBounds();
 
+		// ׂĂ SubMesh ̃bVƂ LOD gĂ GPU/CPU ̃oCg
+		MeshMemoryUsage GetMemoryUsage() const;
+
 		// Model Infomation
 		void SetName(const std::string& name) { m_name = name; }
 		const std::string& GetName() const { return m_name; }
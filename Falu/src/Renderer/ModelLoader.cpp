@@ -11,16 +11,379 @@
 #include "Mesh.h"
 #include "Material.h"
 #include "Texture.h"
+#include "Shader.h"
+#include "MeshSimplifier.h"
+#include "MeshCache.h"
+#include "Include/Utils/MappedFile.h"
+#include "Falu/JobSystem.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 #include <filesystem>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <unordered_set>
 
 namespace Falu
 {
+	// 1 ̃fǂݍ݂Ń[J[̃WuQ[Xbh֓nׂ̂
+	struct ModelImport
+	{
+		struct DecodedTexture
+		{
+			std::string path;
+			TextureImage image;		// t@CfR[hłȂ΋
+		};
+
+		ModelImport(const std::string& path, const ModelLoader::ImportSettings& importSettings)
+			: filepath(path)
+			, settings(importSettings)
+		{
+		}
+
+		std::string filepath;
+		ModelLoader::ImportSettings settings;
+		// ǂݍ݂n߂_Ń[_[̃LbVɂeNX`̓fR[hȂ
+		std::unordered_set<std::string> cachedTextures;
+		const std::atomic<bool>* cancelled = nullptr;
+
+		// [J[AgeometryDone Q[XbhǂށB
+		// aiMesh Ƃ 1 ̃}eA(C|[^[̏]ǂ)BAbv[hɎs SubMesh ̃bV nullptr
+		std::string name;
+		std::vector<ImportedMaterial> materials;
+		std::vector<ImportedSubMesh> subMeshes;
+		std::vector<std::string> texturePaths;
+		ModelLoadReport report;
+		// LbV痈ƂAbVAbv[hɂ}bvĂ݃t@C
+		std::shared_ptr<MappedFile> cookedFile;
+		bool failed = false;
+		std::atomic<bool> geometryDone{ false };
+		// [J[ŌɗĂB̌ハ[J[ import ɐG邱Ƃ͂Ȃ
+		std::atomic<bool> workerDone{ false };
+
+		// [J[̐i݋
+		std::atomic<uint32_t> meshCount{ 0 };
+		std::atomic<uint32_t> meshesPrepared{ 0 };
+
+		std::mutex decodedMutex;
+		std::deque<DecodedTexture> decoded;
+
+		// Q[Xbhp
+		std::vector<std::shared_ptr<Material>> createdMaterials;	// materials ̍ڂƁBBuildModel 
+		size_t uploadedMeshes = 0;
+		size_t uploadedTextures = 0;
+	};
+
+	namespace
+	{
+		std::wstring ToWideString(const std::string& text)
+		{
+			return std::filesystem::u8path(text).wstring();
+		}
+
+		bool IsCancelled(const ModelImport& import)
+		{
+			return import.cancelled && import.cancelled->load(std::memory_order_relaxed);
+		}
+	}
+
+	ModelLoadHandle::ModelLoadHandle(const std::string& filepath)
+		: m_filepath(filepath)
+		, m_state(ModelLoadState::Loading)
+		, m_cancelled(false)
+	{
+	}
+
+	ModelLoadHandle::~ModelLoadHandle()
+	{
+	}
+
+	std::unique_ptr<Model> ModelLoadHandle::TakeModel()
+	{
+		return std::move(m_model);
+	}
+
+	float ModelLoadHandle::GetProgress() const
+	{
+		if (IsDone() || !m_import)
+			return 1.0f;
+
+		// C|[g 60%AbV 25%AeNX` 15%
+		const ModelImport& import = *m_import;
+		if (!import.geometryDone.load(std::memory_order_acquire))
+		{
+			uint32_t meshCount = import.meshCount.load(std::memory_order_relaxed);
+			uint32_t prepared = import.meshesPrepared.load(std::memory_order_relaxed);
+			return meshCount ? 0.6f * prepared / meshCount : 0.0f;
+		}
+
+		float progress = 0.6f;
+		progress += import.subMeshes.empty() ? 0.25f : 0.25f * import.uploadedMeshes / import.subMeshes.size();
+		progress += import.texturePaths.empty() ? 0.15f : 0.15f * import.uploadedTextures / import.texturePaths.size();
+		return progress;
+	}
+
+	ModelLoader::ImportSettings ModelLoader::GetImportSettings() const
+	{
+		ImportSettings settings;
+		settings.defaultShader = m_defaultShader;
+		settings.vertexCompression = m_vertexCompression;
+		settings.meshOptimization = m_meshOptimization;
+		settings.lodSettings = m_lodSettings;
+		settings.meshletSettings = m_meshletSettings;
+		settings.cpuAccess = m_cpuAccess;
+		settings.cacheDirectory = m_cacheDirectory;
+		return settings;
+	}
+
+	uint64_t ModelLoader::GetSettingsHash(const ImportSettings& settings)
+	{
+		// Ă݃f[^ςׂ̂āBVF[_[͏Ă݃t@CǂނƂɊm߂
+		uint64_t hash = MeshCache::kVersion;
+		auto add = [&hash](const auto& value) { hash = MeshCache::Hash(&value, sizeof(value), hash); };
+
+		add(settings.vertexCompression.enabled);
+		add(settings.vertexCompression.quantizePositions);
+
+		const MeshOptimizer::Settings& optimization = settings.meshOptimization;
+		add(optimization.enabled);
+		add(optimization.vertexCache);
+		add(optimization.overdraw);
+		add(optimization.vertexFetch);
+		add(optimization.cacheSize);
+		add(optimization.overdrawThreshold);
+
+		const LodSettings& lods = settings.lodSettings;
+		add(lods.enabled);
+		hash = MeshCache::Hash(lods.triangleRatios.data(), lods.triangleRatios.size() * sizeof(float), hash);
+		hash = MeshCache::Hash(lods.screenSizes.data(), lods.screenSizes.size() * sizeof(float), hash);
+		add(lods.maxError);
+		add(lods.minTriangles);
+
+		const MeshletSettings& meshlets = settings.meshletSettings;
+		add(meshlets.enabled);
+		add(meshlets.minTriangles);
+		add(meshlets.maxVertices);
+		add(meshlets.maxTriangles);
+
+		add(settings.cpuAccess);
+		return hash;
+	}
+
 	std::unique_ptr<Model> ModelLoader::LoadModel(ID3D11Device* device, const std::string& filepath)
+	{
+		// LoadModelAsync ƓiKÃXbhōŌ܂Ői߂(WuVXe`)
+		ModelImport import(filepath, GetImportSettings());
+		for (const auto& cached : m_textureCache)
+			import.cachedTextures.insert(cached.first);
+
+		if (!Import(import))
+			return nullptr;
+		DecodeTextures(import);
+
+		size_t meshBudget = SIZE_MAX;
+		UploadMeshes(device, import, meshBudget);
+		auto model = BuildModel(device, import);
+
+		size_t textureBudget = SIZE_MAX;
+		UploadTextures(device, import, textureBudget);
+		return model;
+	}
+
+	std::shared_ptr<ModelLoadHandle> ModelLoader::LoadModelAsync(const std::string& filepath)
+	{
+		auto handle = std::make_shared<ModelLoadHandle>(filepath);
+		handle->m_import = std::make_unique<ModelImport>(filepath, GetImportSettings());
+		ModelImport* import = handle->m_import.get();
+		import->cancelled = &handle->m_cancelled;
+		for (const auto& cached : m_textureCache)
+			import->cachedTextures.insert(cached.first);
+
+		m_pendingLoads.push_back(handle);
+
+		// Wunh(܂ import)̂ŁA̒NĂĂ
+		JobSystem::GetInstance().Schedule([handle, import]()
+		{
+			import->failed = !Import(*import);
+			import->geometryDone.store(true, std::memory_order_release);
+
+			if (!import->failed)
+				DecodeTextures(*import);
+			import->workerDone.store(true, std::memory_order_release);
+		});
+		return handle;
+	}
+
+	void ModelLoader::Update(ID3D11Device* device)
+	{
+		size_t meshBudget = m_uploadBudget.meshBytesPerFrame;
+		size_t textureBudget = m_uploadBudget.textureBytesPerFrame;
+
+		for (size_t i = 0; i < m_pendingLoads.size();)
+		{
+			if (UpdateLoad(device, *m_pendingLoads[i], meshBudget, textureBudget))
+				m_pendingLoads.erase(m_pendingLoads.begin() + i);
+			else
+				++i;
+		}
+	}
+
+	void ModelLoader::CancelLoads()
+	{
+		for (auto& handle : m_pendingLoads)
+			handle->Cancel();
+		m_pendingLoads.clear();
+	}
+
+	bool ModelLoader::UpdateLoad(ID3D11Device* device, ModelLoadHandle& handle, size_t& meshBudget, size_t& textureBudget)
+	{
+		ModelImport& import = *handle.m_import;
+		bool workerDone = import.workerDone.load(std::memory_order_acquire);
+
+		// import ̓[J[gIĂłȂƉłȂ
+		if (handle.IsCancelled())
+		{
+			if (!workerDone)
+				return false;
+
+			handle.m_state = handle.m_state == ModelLoadState::Loading ? ModelLoadState::Failed : ModelLoadState::Complete;
+			handle.m_import.reset();
+			return true;
+		}
+
+		if (!import.geometryDone.load(std::memory_order_acquire))
+			return false;
+		if (import.failed)
+		{
+			if (!workerDone)
+				return false;
+
+			handle.m_state = ModelLoadState::Failed;
+			handle.m_import.reset();
+			return true;
+		}
+
+		// bVBbVڂ΃fg
+		if (handle.m_state == ModelLoadState::Loading)
+		{
+			if (!UploadMeshes(device, import, meshBudget))
+				return false;
+
+			handle.m_model = BuildModel(device, import);
+			handle.m_state = ModelLoadState::GeometryReady;
+			import.cookedFile.reset();
+		}
+
+		// ̌A[J[fR[hɃeNX`
+		UploadTextures(device, import, textureBudget);
+
+		if (!workerDone)
+			return false;
+		{
+			std::lock_guard<std::mutex> lock(import.decodedMutex);
+			if (!import.decoded.empty())
+				return false;
+		}
+
+		handle.m_state = ModelLoadState::Complete;
+		handle.m_import.reset();
+		return true;
+	}
+
+	bool ModelLoader::Import(ModelImport& import)
+	{
+		// Get Directory Path
+		std::filesystem::path path(import.filepath);
+		std::string directory = path.parent_path().string();
+		import.name = path.filename().string();
+
+		auto start = std::chrono::steady_clock::now();
+		auto elapsedMs = [&start]()
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+
+		// gƓݒŏĂt@C΁AC|[gŜŒu
+		std::string cookedPath;
+		uint64_t key = 0;
+		if (!import.settings.cacheDirectory.empty() &&
+			MeshCache::HashFile(import.filepath, GetSettingsHash(import.settings), key))
+		{
+			cookedPath = MeshCache::GetCookedPath(import.settings.cacheDirectory, key);
+			if (ReadCooked(import, cookedPath, key, directory))
+			{
+				char msg[512];
+				snprintf(msg, sizeof(msg), "[ModelLoader] %s: cooked cache hit, %.1f ms\n", import.filepath.c_str(), elapsedMs());
+				OutputDebugStringA(msg);
+
+				CollectTexturePaths(import);
+				return true;
+			}
+		}
+
+		if (!ImportScene(import, directory))
+			return false;
+		double importMs = elapsedMs();
+
+		char msg[512];
+		if (!cookedPath.empty())
+		{
+			if (MeshCache::Write(cookedPath, key, directory, import.materials, import.subMeshes, import.report))
+			{
+				snprintf(msg, sizeof(msg), "[ModelLoader] %s: imported in %.1f ms, cooked in %.1f ms\n",
+					import.filepath.c_str(), importMs, elapsedMs() - importMs);
+			}
+			else
+			{
+				snprintf(msg, sizeof(msg), "[ModelLoader] WARNING: Failed to write cooked cache: %s\n", cookedPath.c_str());
+			}
+		}
+		else
+		{
+			snprintf(msg, sizeof(msg), "[ModelLoader] %s: imported in %.1f ms\n", import.filepath.c_str(), importMs);
+		}
+		OutputDebugStringA(msg);
+
+		CollectTexturePaths(import);
+		return true;
+	}
+
+	bool ModelLoader::ReadCooked(ModelImport& import, const std::string& cookedPath, uint64_t key, const std::string& directory)
+	{
+		auto file = MeshCache::Read(cookedPath, key, directory, import.materials, import.subMeshes, import.report);
+		if (!file)
+			return false;
+
+		// ĂɃVF[_[RpNg`̃oAgȂBC|[g
+		Shader* shader = import.settings.defaultShader;
+		for (const ImportedSubMesh& subMesh : import.subMeshes)
+		{
+			for (uint32_t level = 0; level < subMesh.mesh->GetLodCount(); ++level)
+			{
+				uint32_t vertexFormat = subMesh.mesh->GetLod(level)->GetVertexFormat();
+				if (vertexFormat != VertexFormat::Standard && (!shader || !shader->SupportsVertexFormat(vertexFormat)))
+				{
+					import.materials.clear();
+					import.subMeshes.clear();
+					import.report = ModelLoadReport();
+					return false;
+				}
+			}
+		}
+
+		import.cookedFile = std::move(file);
+		uint32_t meshCount = static_cast<uint32_t>(import.subMeshes.size());
+		import.meshCount.store(meshCount, std::memory_order_relaxed);
+		import.meshesPrepared.store(meshCount, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool ModelLoader::ImportScene(ModelImport& import, const std::string& directory)
 	{
 		Assimp::Importer importer;
 
@@ -34,39 +397,235 @@ namespace Falu
 			aiProcess_SortByPType; // Sort for Primitive type
 
 		// Load Scene
-		const aiScene* scene = importer.ReadFile(filepath, flags);
+		const aiScene* scene = importer.ReadFile(import.filepath, flags);
 
 		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
 		{
 			char msg[512];
-			sprintf_s(msg, "[ModelLoader] ERROR: %s\n", importer.GetErrorString());
+			snprintf(msg, sizeof(msg), "[ModelLoader] ERROR: %s\n", importer.GetErrorString());
 			OutputDebugStringA(msg);
-			return nullptr;
+			return false;
 		}
+		if (IsCancelled(import))
+			return false;
 
-		// Get Directory Path
-		std::filesystem::path path(filepath);
-		std::string directory = path.parent_path().string();
+		// Process Node Recursively
+		std::vector<void*> meshes;
+		ProcessNode(scene->mRootNode, scene, meshes);
+		uint32_t meshCount = static_cast<uint32_t>(meshes.size());
+		import.meshCount.store(meshCount, std::memory_order_relaxed);
+
+		// }eA͌ŷłŃm[hɓǂ
+		for (void* meshPtr : meshes)
+		{
+			aiMesh* mesh = static_cast<aiMesh*>(meshPtr);
+			ProcessMaterial(scene->mMaterials[mesh->mMaterialIndex], directory, import);
+		}
+
+		// bV݂͌ɓƗȂ̂ŁAϊAœKAAȗAבւꂼʂ̃Wuōs
+		std::vector<std::vector<std::shared_ptr<Mesh>>> pieces(meshCount);
+		std::vector<ModelLoadReport> reports(meshCount);
+		JobSystem::GetInstance().ParallelFor(meshCount, [&](uint32_t index)
+		{
+			if (IsCancelled(import))
+				return;
+			pieces[index] = ProcessMesh(meshes[index], import.settings, reports[index]);
+			import.meshesPrepared.fetch_add(1, std::memory_order_relaxed);
+		});
+		if (IsCancelled(import))
+			return false;
+
+		for (uint32_t index = 0; index < meshCount; ++index)
+		{
+			aiMesh* mesh = static_cast<aiMesh*>(meshes[index]);
+			import.report.Add(reports[index]);
+
+			// fЂ̓}eAL
+			for (size_t piece = 0; piece < pieces[index].size(); ++piece)
+			{
+				std::string name = mesh->mName.C_Str();
+				if (pieces[index].size() > 1)
+					name += "_" + std::to_string(piece);
+
+				import.subMeshes.push_back({ std::move(pieces[index][piece]), index, name });
+			}
+		}
+
+		return true;
+	}
+
+	void ModelLoader::CollectTexturePaths(ModelImport& import)
+	{
+		// eeNX` 1 񂸂BLbVɂ͔̂΂
+		std::unordered_set<std::string> seen;
+		for (const ImportedMaterial& material : import.materials)
+		{
+			for (const std::string* texturePath : { &material.albedoPath, &material.normalPath })
+			{
+				if (texturePath->empty() || import.cachedTextures.count(*texturePath) || !seen.insert(*texturePath).second)
+					continue;
+				import.texturePaths.push_back(*texturePath);
+			}
+		}
+	}
+
+	void ModelLoader::DecodeTextures(ModelImport& import)
+	{
+		uint32_t textureCount = static_cast<uint32_t>(import.texturePaths.size());
+		JobSystem::GetInstance().ParallelFor(textureCount, [&](uint32_t index)
+		{
+			if (IsCancelled(import))
+				return;
+
+			ModelImport::DecodedTexture decoded;
+			decoded.path = import.texturePaths[index];
+			Texture::DecodeFile(ToWideString(decoded.path), decoded.image);
+
+			std::lock_guard<std::mutex> lock(import.decodedMutex);
+			import.decoded.push_back(std::move(decoded));
+		});
+	}
+
+	bool ModelLoader::UploadMeshes(ID3D11Device* device, ModelImport& import, size_t& budget)
+	{
+		while (import.uploadedMeshes < import.subMeshes.size())
+		{
+			if (budget == 0)
+				return false;
+
+			ImportedSubMesh& subMesh = import.subMeshes[import.uploadedMeshes++];
+			if (!subMesh.mesh)
+				continue;
+
+			// bV LOD ƈꏏɍڂ̂ŁAobt@̂Ȃx`Ƃ͂Ȃ
+			size_t bytes = 0;
+			bool uploaded = true;
+			for (uint32_t level = 0; level < subMesh.mesh->GetLodCount(); ++level)
+			{
+				Mesh* lod = subMesh.mesh->GetLod(level);
+				bytes += lod->GetVertexBufferSize() + lod->GetIndexBufferSize();
+				uploaded = lod->Upload(device) && uploaded;
+			}
+			budget -= std::min(budget, bytes);
 
+			if (!uploaded)
+			{
+				OutputDebugStringA("[ModelLoader] ERROR: Failed to create mesh\n");
+				subMesh.mesh.reset();
+			}
+		}
+		return true;
+	}
+
+	std::unique_ptr<Model> ModelLoader::BuildModel(ID3D11Device* device, ModelImport& import)
+	{
 		// Create Model
 		auto model = std::make_unique<Model>();
-		model->SetName(path.filename().string());
+		model->SetName(import.name);
 
-		// Process Node Recursively
-		ProcessNode(scene->mRootNode, scene, device, model.get(), directory);
+		for (const ImportedMaterial& imported : import.materials)
+		{
+			auto material = std::make_shared<Material>();
+			material->Initialize(device);
+			material->SetShader(import.settings.defaultShader);
+			// VF[_[ MaterialProperties ǂ(SetAlbedo/SetMetallic ̓GfB^p̒l)
+			material->SetProperties(imported.properties);
+
+			// LbVɂeNX`̓Xg[~OȂ
+			auto albedo = m_textureCache.find(imported.albedoPath);
+			if (albedo != m_textureCache.end())
+				material->SetAlbedoTexture(albedo->second.get());
+			auto normal = m_textureCache.find(imported.normalPath);
+			if (normal != m_textureCache.end())
+				material->SetNormalTexture(normal->second.get());
+
+			import.createdMaterials.push_back(std::move(material));
+		}
+
+		for (ImportedSubMesh& subMesh : import.subMeshes)
+		{
+			if (subMesh.mesh)
+				model->AddSubMesh(std::move(subMesh.mesh), import.createdMaterials[subMesh.material], subMesh.name);
+		}
 
 		// calclate bounding box
 		model->CalculateBounds();
 
-		char msg[256];
-		sprintf_s(msg, "[ModelLoader] Loaded: %s (%zu meshes)\n",
-			filepath.c_str(), model->GetSubMeshCount());
+		const ModelLoadReport& report = import.report;
+		char msg[512];
+		snprintf(msg, sizeof(msg), "[ModelLoader] Loaded: %s (%zu meshes + %zu LODs, %zu meshlets, vertex buffers %zu KB, %zu KB uncompressed, index buffers %zu KB)\n",
+			import.filepath.c_str(), model->GetSubMeshCount(), report.lodMeshCount, report.meshletCount,
+			report.vertexBytes / 1024, report.vertexBytesUncompressed / 1024, report.indexBytes / 1024);
 		OutputDebugStringA(msg);
 
+		MeshMemoryUsage memory = model->GetMemoryUsage();
+		snprintf(msg, sizeof(msg), "[ModelLoader] Resident mesh memory: %s GPU %zu KB, CPU %zu KB\n",
+			import.filepath.c_str(), memory.gpuBytes / 1024, memory.cpuBytes / 1024);
+		OutputDebugStringA(msg);
+
+		if (import.settings.meshOptimization.enabled)
+		{
+			const MeshOptimizer::Report& optimization = report.optimization;
+			snprintf(msg, sizeof(msg), "[ModelLoader] Mesh optimization: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (%u triangles)\n",
+				optimization.before.GetACMR(), optimization.after.GetACMR(),
+				optimization.before.GetATVR(), optimization.after.GetATVR(),
+				optimization.after.triangleCount);
+			OutputDebugStringA(msg);
+		}
+
 		return model;
 	}
 
-	void ModelLoader::ProcessNode(void* nodePtr, const void* scenePtr, ID3D11Device* device, Model* model, const std::string& directory)
+	void ModelLoader::UploadTextures(ID3D11Device* device, ModelImport& import, size_t& budget)
+	{
+		while (budget > 0)
+		{
+			ModelImport::DecodedTexture decoded;
+			{
+				std::lock_guard<std::mutex> lock(import.decodedMutex);
+				if (import.decoded.empty())
+					return;
+				decoded = std::move(import.decoded.front());
+				import.decoded.pop_front();
+			}
+			++import.uploadedTextures;
+
+			std::shared_ptr<Texture> texture;
+			if (!decoded.image.pixels.empty())
+			{
+				texture = std::make_shared<Texture>();
+				if (texture->CreateFromData(device, decoded.image.pixels.data(), decoded.image.width, decoded.image.height, 4))
+				{
+					m_textureCache[decoded.path] = texture;
+				}
+				else
+				{
+					char msg[512];
+					snprintf(msg, sizeof(msg), "[ModelLoader] WARNING: Failed to load texture: %s\n", decoded.path.c_str());
+					OutputDebugStringA(msg);
+					texture = nullptr;
+				}
+				budget -= std::min(budget, decoded.image.pixels.size());
+			}
+			else
+			{
+				// Q[XbhȊOŃfR[hłȂ(WIC ̃rh)ĂBʏ̌oHœǂނG[o
+				texture = LoadTexture(device, decoded.path);
+			}
+
+			if (!texture)
+				continue;
+			for (size_t i = 0; i < import.materials.size(); ++i)
+			{
+				if (import.materials[i].albedoPath == decoded.path)
+					import.createdMaterials[i]->SetAlbedoTexture(texture.get());
+				if (import.materials[i].normalPath == decoded.path)
+					import.createdMaterials[i]->SetNormalTexture(texture.get());
+			}
+		}
+	}
+
+	void ModelLoader::ProcessNode(void* nodePtr, const void* scenePtr, std::vector<void*>& outMeshes)
 	{
 		aiNode* node = static_cast<aiNode*>(nodePtr);
 		const aiScene* scene = static_cast<const aiScene*>(scenePtr);
@@ -74,28 +633,24 @@ namespace Falu
 		// Process all mesh in this node 
 		for (unsigned int i = 0; i < node->mNumMeshes; ++i)
 		{
-			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-
-			auto loadedMesh = ProcessMesh(mesh, scene, device);
-			auto loadedMaterial = ProcessMaterial(scene->mMaterials[mesh->mMaterialIndex],
-				scene, device, directory);
-
-			model->AddSubMesh(std::move(loadedMesh), std::move(loadedMaterial), mesh->mName.C_Str());
+			outMeshes.push_back(scene->mMeshes[node->mMeshes[i]]);
 		}
 		
 		// Process Child node Recursively
 		for (unsigned int i = 0; i < node->mNumChildren; ++i)
 		{
-			ProcessNode(node->mChildren[i], scene, device, model, directory);
+			ProcessNode(node->mChildren[i], scene, outMeshes);
 		}
 	}
 
-	std::shared_ptr<Mesh> ModelLoader::ProcessMesh(void* meshPtr, const void* scenePtr, ID3D11Device* device)
+	std::vector<std::shared_ptr<Mesh>> ModelLoader::ProcessMesh(void* meshPtr, const ImportSettings& settings, ModelLoadReport& report)
 	{
 		aiMesh* mesh = static_cast<aiMesh*>(meshPtr);
 
 		std::vector<Vertex> vertices;
 		std::vector<uint32_t> indices;
+		vertices.reserve(mesh->mNumVertices);
+		indices.reserve((size_t)mesh->mNumFaces * 3);
 
 		// Process Vertex Data
 		for (unsigned int i = 0; i < mesh->mNumVertices; ++i)
@@ -147,50 +702,149 @@ namespace Falu
 			aiFace face = mesh->mFaces[i];
 			for (unsigned int j = 0; j < face.mNumIndices; ++j)
 			{
-				indices.push_back(face.mIndices[i]);
+				indices.push_back(face.mIndices[j]);
 			}
 		}
 
-		// Create Mesh
-		auto loadedMesh = std::make_shared<Mesh>();
-		if (!loadedMesh->Initialize(device, vertices, indices))
+		// obt@ׂOɁAϊLbVAI[o[h[A_tFb`̂߂ɕבւ
+		if (settings.meshOptimization.enabled)
 		{
-			OutputDebugStringA("[ModelLoader] ERROR: Failed to create mesh\n");
-			return nullptr;
+			MeshOptimizer::Optimize(vertices, indices, settings.meshOptimization, &report.optimization);
 		}
 
-		return loadedMesh;
+		// GPU ̒_CAEgIԁBVF[_[RpNg`ǂ߂ȂΊSȌ`̂܂
+		uint32_t vertexFormat = VertexFormat::Choose(vertices, settings.vertexCompression);
+		if (!settings.defaultShader || !settings.defaultShader->SupportsVertexFormat(vertexFormat))
+		{
+			vertexFormat = VertexFormat::Standard;
+		}
+
+		// 65535 _𒴂: ɂȂCfbNX؂ڂɉĕ钸_傫΁A
+		// 16 rbgŎwfЂɕ
+		std::vector<MeshChunk> chunks;
+		if (vertices.size() > IndexFormat<uint16_t>::maxVertexCount)
+		{
+			chunks = Mesh::SplitByVertexLimit(vertices, indices);
+
+			const size_t stride = VertexFormat::GetStride(vertexFormat);
+			size_t wholeBytes = vertices.size() * stride + indices.size() * sizeof(uint32_t);
+			size_t splitBytes = 0;
+			for (const MeshChunk& chunk : chunks)
+				splitBytes += chunk.vertices.size() * stride + chunk.indices.size() * sizeof(uint16_t);
+
+			if (splitBytes >= wholeBytes)
+				chunks.clear();
+		}
+		if (chunks.empty())
+		{
+			MeshChunk whole;
+			whole.vertices = std::move(vertices);
+			whole.indices = std::move(indices);
+			chunks.push_back(std::move(whole));
+		}
+
+		// bVpӂ(obt@͌ŃQ[Xbhō)
+		std::vector<std::shared_ptr<Mesh>> loadedMeshes;
+		for (MeshChunk& chunk : chunks)
+		{
+			// LOD ɒfЂȗĂ΁ALOD0 ̓Rs[ɔz
+			std::vector<LodMesh> lods = BuildLods(chunk.vertices, chunk.indices, vertexFormat, settings, report);
+			size_t uncompressedBytes = chunk.vertices.size() * sizeof(Vertex);
+
+			auto loadedMesh = PrepareMesh(std::move(chunk.vertices), std::move(chunk.indices), vertexFormat,
+				settings.cpuAccess, settings.meshletSettings, report);
+
+			report.vertexBytes += loadedMesh->GetVertexBufferSize();
+			report.vertexBytesUncompressed += uncompressedBytes;
+			report.indexBytes += loadedMesh->GetIndexBufferSize();
+
+			for (LodMesh& lod : lods)
+			{
+				loadedMesh->AddLod(std::move(lod.mesh), lod.screenSize);
+			}
+			loadedMeshes.push_back(std::move(loadedMesh));
+		}
+
+		return loadedMeshes;
+	}
+
+	std::shared_ptr<Mesh> ModelLoader::PrepareMesh(std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices, uint32_t vertexFormat, uint32_t cpuAccess, const MeshletSettings& meshletSettings, ModelLoadReport& report)
+	{
+		// bVbg͎Op`בւ̂ŁACfbNXobt@ׂOɍ
+		std::vector<Meshlet> meshlets;
+		if (meshletSettings.enabled && indices.size() / 3 >= meshletSettings.minTriangles)
+			meshlets = Meshlets::Build(vertices, indices, meshletSettings.maxVertices, meshletSettings.maxTriangles);
+
+		auto mesh = std::make_shared<Mesh>();
+		mesh->Prepare(std::move(vertices), std::move(indices), vertexFormat, cpuAccess);
+
+		report.meshletCount += meshlets.size();
+		mesh->SetMeshlets(std::move(meshlets));
+		return mesh;
+	}
+
+	std::vector<ModelLoader::LodMesh> ModelLoader::BuildLods(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, uint32_t vertexFormat, const ImportSettings& settings, ModelLoadReport& report)
+	{
+		const LodSettings& lodSettings = settings.lodSettings;
+		std::vector<LodMesh> lods;
+		if (!lodSettings.enabled || indices.size() / 3 < lodSettings.minTriangles)
+			return lods;
+
+		size_t levelCount = std::min(lodSettings.triangleRatios.size(), lodSettings.screenSizes.size());
+		size_t previousIndexCount = indices.size();
+
+		for (size_t level = 0; level < levelCount; ++level)
+		{
+			// ǂ̃x LOD0 ȗ̂ŁAx܂Ō덷܂Ȃ
+			size_t target = static_cast<size_t>(indices.size() / 3 * lodSettings.triangleRatios[level]) * 3;
+			std::vector<uint32_t> lodIndices;
+			float error = 0.0f;
+			MeshSimplifier::Simplify(vertices, indices, target, lodSettings.maxError, lodIndices, &error);
+
+			// ȗbV 1 ₷̉l𐶂܂ȂȂ~߂(p/E덷̏)
+			if (lodIndices.empty() || lodIndices.size() > previousIndexCount * 85 / 100)
+				break;
+			previousIndexCount = lodIndices.size();
+
+			std::vector<Vertex> lodVertices = vertices;
+			MeshOptimizer::OptimizeVertexCache(lodIndices, lodVertices.size());
+			MeshOptimizer::OptimizeVertexFetch(lodVertices, lodIndices);
+
+			auto lodMesh = PrepareMesh(std::move(lodVertices), std::move(lodIndices), vertexFormat, MeshCpuAccess::None,
+				settings.meshletSettings, report);
+
+			report.vertexBytes += lodMesh->GetVertexBufferSize();
+			report.indexBytes += lodMesh->GetIndexBufferSize();
+			++report.lodMeshCount;
+
+			lods.push_back({ std::move(lodMesh), lodSettings.screenSizes[level] });
+		}
+		return lods;
 	}
 
-	std::shared_ptr<Material> ModelLoader::ProcessMaterial(void* materialPtr, const void* scenePtr, ID3D11Device* device, const std::string& directory)
+	void ModelLoader::ProcessMaterial(void* materialPtr, const std::string& directory, ModelImport& import)
 	{
 		aiMaterial* material = static_cast<aiMaterial*>(materialPtr);
 
-		auto loadedMaterial = std::make_shared<Material>();
+		ImportedMaterial imported;
+		MaterialProperties& props = imported.properties;
 
 		// albedo (deffuse color)
 		aiColor3D color(1.0f, 1.0f, 1.0f);
 		material->Get(AI_MATKEY_COLOR_DIFFUSE, color);
-		loadedMaterial->SetAlbedo(Math::Color(color.r,color.g,color.b,1.0f));
+		props.albedo = Math::Color(color.r, color.g, color.b, 1.0f);
 
 		// Metallic
 		float shininess = 0.0f;
 		material->Get(AI_MATKEY_SHININESS, shininess);
-		loadedMaterial->SetMetallic(shininess / 128.0f);
+		props.metallic = shininess / 128.0f;
 
 		// Diffuse Texture
 		if (material->GetTextureCount(aiTextureType_DIFFUSE) > 0)
 		{
 			aiString texPath;
 			material->GetTexture(aiTextureType_DIFFUSE, 0, &texPath);
-
-			std::string fullpath = directory + "/" + texPath.C_Str();
-			auto texture = LoadTexture(device, fullpath);
-
-			if (texture)
-			{
-				loadedMaterial->SetAlbedoTexture(texture.get());
-			}
+			imported.albedoPath = directory + "/" + texPath.C_Str();
 		}
 
 		// Normal map
@@ -198,17 +852,10 @@ namespace Falu
 		{
 			aiString texPath;
 			material->GetTexture(aiTextureType_NORMALS, 0, &texPath);
-
-			std::string fullpath = directory + "/" + texPath.C_Str();
-			auto texture = LoadTexture(device, fullpath);
-
-			if (texture)
-			{
-				loadedMaterial->SetNormalTexture(texture.get());
-			}
+			imported.normalPath = directory + "/" + texPath.C_Str();
 		}
 
-		return loadedMaterial;
+		import.materials.push_back(std::move(imported));
 	}
 
 	std::shared_ptr<Texture> ModelLoader::LoadTexture(ID3D11Device* device, const std::string& filepath)
@@ -222,17 +869,10 @@ namespace Falu
 
 		// Load Texture
 		auto texture = std::make_shared<Texture>();
-		auto result = MultiByteToWideChar(CP_UTF8, 0, filepath.c_str(),
-			filepath.length(), nullptr, 0);
-		std::wstring wfilepath;
-		wfilepath.resize(result);
-		result = MultiByteToWideChar(CP_UTF8,
-			0, filepath.c_str(),filepath.length(),
-			wfilepath.data(), wfilepath.size());
-		if (!texture->LoadFromFile(device, wfilepath))
+		if (!texture->LoadFromFile(device, ToWideString(filepath)))
 		{
 			char msg[512];
-			sprintf_s(msg, "[ModelLoader] WARNING: Failed to load texture: %s\n", filepath.c_str());
+			snprintf(msg, sizeof(msg), "[ModelLoader] WARNING: Failed to load texture: %s\n", filepath.c_str());
 			OutputDebugStringA(msg);
 			return nullptr;
 		}
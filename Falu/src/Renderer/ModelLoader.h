@@ -10,7 +10,12 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <atomic>
 #include <unordered_map>
+#include "Renderer/VertexFormat.h"
+#include "Renderer/MeshOptimizer.h"
+#include "Renderer/Meshlet.h"
+#include "Renderer/Material.h"
 
 namespace Falu
 {
@@ -18,6 +23,123 @@ namespace Falu
 	class Mesh;
 	class Material;
 	class Texture;
+	class Shader;
+	struct Vertex;
+	struct ModelImport;
+
+	// C|[gׂẴbVɍ LOD ̘AȂ
+	struct LodSettings
+	{
+		bool enabled = true;
+		// xƂ́ALOD0 ɑ΂Op`̊ƁÃx`ʏ̑傫(r[|[g̍
+		// ΂銄)̏B2 ̃Xgׂ͕Ăǂ
+		std::vector<float> triangleRatios = { 0.5f, 0.25f, 0.12f };
+		std::vector<float> screenSizes = { 0.5f, 0.25f, 0.12f };
+		// ȗ̌덷̏BbV̑傫ɑ΂鑊Βl
+		float maxError = 0.05f;
+		// 菬bV̓x 1 
+		uint32_t minTriangles = 256;
+	};
+
+	// CPU ̃NX^[JOp̃bVbg
+	struct MeshletSettings
+	{
+		bool enabled = true;
+		// bV̓NX^[ƂɃJOۂƕ`
+		uint32_t minTriangles = 8192;
+		uint32_t maxVertices = Meshlets::kMaxVertices;
+		uint32_t maxTriangles = Meshlets::kMaxTriangles;
+	};
+
+	// LoadModelAsync œǂݍރf̃Q[Xbhł̃t[Ƃ̎dʁBǂݍݒׂ̂ĂŋL
+	struct ModelUploadBudget
+	{
+		// t[Ƃɍ钸_ + CfbNXobt@̃oCgB1 t[ɏȂƂ 1 ̃bV(LOD )͍ڂ
+		size_t meshBytesPerFrame = 8 * 1024 * 1024;
+		// t[Ƃɍ RGBA8 eNX`̃oCgB1 t[ɏȂƂ 1 ̃eNX`͍ڂ
+		size_t textureBytesPerFrame = 8 * 1024 * 1024;
+	};
+
+	// 1 ̃C|[gṓBǂݍ݂̃Op
+	struct ModelLoadReport
+	{
+		// _obt@̃oCgBkƂȂ
+		size_t vertexBytes = 0;
+		size_t vertexBytesUncompressed = 0;
+		size_t indexBytes = 0;
+		size_t lodMeshCount = 0;
+		size_t meshletCount = 0;
+		MeshOptimizer::Report optimization;
+
+		void Add(const ModelLoadReport& other)
+		{
+			vertexBytes += other.vertexBytes;
+			vertexBytesUncompressed += other.vertexBytesUncompressed;
+			indexBytes += other.indexBytes;
+			lodMeshCount += other.lodMeshCount;
+			meshletCount += other.meshletCount;
+			optimization.before.Add(other.optimization.before);
+			optimization.after.Add(other.optimization.after);
+		}
+	};
+
+	// C|[gbV́AGPU ̃IuWFNgÕ}eABeNX`̃pX̓tpX
+	struct ImportedMaterial
+	{
+		MaterialProperties properties;
+		std::string albedoPath;
+		std::string normalPath;
+	};
+
+	// C|[g 1  SubMeshBbV( LOD)͗pӍς݂ŁA܂Abv[hĂȂ
+	struct ImportedSubMesh
+	{
+		std::shared_ptr<Mesh> mesh;
+		uint32_t material;
+		std::string name;
+	};
+
+	enum class ModelLoadState
+	{
+		Loading,		// [J[XbhŃC|[gǍチbV 1 t[ɐAbv[hĂ
+		GeometryReady,	// f󂯎ĕ`BeNX`͂܂Xg[~O
+		Complete,		// ׂẴeNX`(ǂݍ݂Ɏs)
+		Failed,
+	};
+
+	// 1  LoadModelAsync ̌ĂяoBCancel ȊO̓Q[Xbhp
+	class ModelLoadHandle
+	{
+	public:
+		explicit ModelLoadHandle(const std::string& filepath);
+		~ModelLoadHandle();
+
+		ModelLoadState GetState() const { return m_state; }
+		bool IsGeometryReady() const { return m_state == ModelLoadState::GeometryReady || m_state == ModelLoadState::Complete; }
+		bool IsDone() const { return m_state == ModelLoadState::Complete || m_state == ModelLoadState::Failed; }
+
+		// WIg烂fB̑OƎ󂯎 nullptrB
+		// 󂯎eNX`͂̃}eAɓ͂
+		std::unique_ptr<Model> TakeModel();
+
+		// C|[gAbṼAbv[hAeNX`̃Abv[hʂ悻 0..1
+		float GetProgress() const;
+		const std::string& GetFilepath() const { return m_filepath; }
+
+		// ̃bVeNX`Ŏ~܂AFailed ŏI(f΂ Complete ŏI)
+		void Cancel() { m_cancelled = true; }
+		bool IsCancelled() const { return m_cancelled; }
+
+	private:
+		friend class ModelLoader;
+
+		std::string m_filepath;
+		ModelLoadState m_state;
+		std::atomic<bool> m_cancelled;
+		std::unique_ptr<Model> m_model;
+		// I܂Ń[J[̃WuƋL
+		std::unique_ptr<ModelImport> m_import;
+	};
 
 	class ModelLoader
 	{
@@ -31,26 +153,134 @@ namespace Falu
 		// Load Model
 		std::unique_ptr<Model> LoadModel(ID3D11Device* device, const std::string& filepath);
 
+		// [J[ŃC|[g: assimp ̉́AׂẴbV̒_ϊAœKALODAbVbgɍsA
+		// ̌eNX`fR[hBUpdate ̓Abv[h̗\Z GPU \[XAbVA
+		// eNX`͌ɂ̂ŁA傫ȃt@Cł炸ɐt[ēǂݍ߂B
+		// ݒ͂ŃRs[̂ŁAŕςĂ̓ǂݍ݂ɂ͉eȂ
+		std::shared_ptr<ModelLoadHandle> LoadModelAsync(const std::string& filepath);
+
+		// ҂Ă LoadModelAsync ̌Ăяoi߂BQ[XbhŃt[ 1 
+		void Update(ID3D11Device* device);
+		// ҂Ăǂݍׂ݂ĎĖY([J[͎̃bVeNX`܂ł͓)
+		void CancelLoads();
+		size_t GetPendingLoadCount() const { return m_pendingLoads.size(); }
+
+		void SetUploadBudget(const ModelUploadBudget& budget) { m_uploadBudget = budget; }
+		const ModelUploadBudget& GetUploadBudget() const { return m_uploadBudget; }
+
 		// Setting Texture Path
 		void SetTextureDirectory(const std::string& directory) { m_textureDirectory = directory; }
 
+		// C|[g}eAɊ蓖ĂVF[_[
+		void SetDefaultShader(Shader* shader) { m_defaultShader = shader; }
+
+		// bVƂ GPU _CAEg̑Iѕ(RpNg`ɂ͊̃VF[_[̒_oAgv)
+		void SetVertexCompression(const VertexFormat::CompressionSettings& settings) { m_vertexCompression = settings; }
+		const VertexFormat::CompressionSettings& GetVertexCompression() const { return m_vertexCompression; }
+
+		// C|[gׂẴbVɂOp`/_̕בւ
+		void SetMeshOptimization(const MeshOptimizer::Settings& settings) { m_meshOptimization = settings; }
+		const MeshOptimizer::Settings& GetMeshOptimization() const { return m_meshOptimization; }
+
+		// C|[gɍ񎟌덷Ŋȗ LOD
+		void SetLodSettings(const LodSettings& settings) { m_lodSettings = settings; }
+		const LodSettings& GetLodSettings() const { return m_lodSettings; }
+
+		void SetMeshletSettings(const MeshletSettings& settings) { m_meshletSettings = settings; }
+		const MeshletSettings& GetMeshletSettings() const { return m_meshletSettings; }
+
+		// ǂݍ񂾃bV LOD0  MeshCpuAccess::FlagsBNone()ȂAbv[h CPU ̎ʂ̂Ă
+		void SetCpuAccess(uint32_t cpuAccess) { m_cpuAccess = cpuAccess; }
+		uint32_t GetCpuAccess() const { return m_cpuAccess; }
+
+		// C|[gĂ(MeshCache)Aassimp 𓮂OɒTꏊBȂLbVgȂ
+		void SetCacheDirectory(const std::string& directory) { m_cacheDirectory = directory; }
+		const std::string& GetCacheDirectory() const { return m_cacheDirectory; }
+
 	private:
+		friend struct ModelImport;
+
+		// ǂݍ݂n߂ƂɃRs[̂ŁAݒ肪ςĂ[J[ŃC|[g𑱂
+		struct ImportSettings
+		{
+			Shader* defaultShader;
+			VertexFormat::CompressionSettings vertexCompression;
+			MeshOptimizer::Settings meshOptimization;
+			LodSettings lodSettings;
+			MeshletSettings meshletSettings;
+			uint32_t cpuAccess;
+			std::string cacheDirectory;
+		};
+
 		ModelLoader() = default;
 		~ModelLoader() = default;
 		ModelLoader(const ModelLoader&) = delete;
 
-		// Process of Assimp Scene
-		void ProcessNode(void* nodePtr, const void* scenePtr, ID3D11Device* device,
-			Model* model, const std::string& directory);
+		ImportSettings GetImportSettings() const;
+		// Ă݃LbṼL[̎: Ă݃f[^ς邷ׂĂ̐ݒ
+		static uint64_t GetSettingsHash(const ImportSettings& settings);
+
+		//=== Worker side (no device, no loader state) ===
+		// ׂẴbVpӂ(Mesh::Prepare)A}eÃvpeBƃeNX`̃pXǂށB
+		// Ă݃LbVɃt@C΂AȂ ImportScene œǂŌʂĂށB
+		// t@Cǂ߂ȂC|[g false
+		static bool Import(ModelImport& import);
+		// assimp ł̃C|[gBbV͕
+		static bool ImportScene(ModelImport& import, const std::string& directory);
+		// qbgȂAVF[_[Ă񂾒_`ǂ߂Ȃ false(ǂ܂Ȃ)
+		static bool ReadCooked(ModelImport& import, const std::string& cookedPath, uint64_t key, const std::string& directory);
+		// fR[heNX`: ꂼ 1 񂸂ALbVɂ̂͏
+		static void CollectTexturePaths(ModelImport& import);
+		// C|[g̃eNX`ɃfR[hBe摜̓fR[hłn
+		static void DecodeTextures(ModelImport& import);
 
-		std::shared_ptr<Mesh> ProcessMesh(void* meshPtr, const void* scenePtr, ID3D11Device* device);
+		// Assimp ̃V[̏: m[h̃bV
+		static void ProcessNode(void* nodePtr, const void* scenePtr, std::vector<void*>& outMeshes);
 
-		std::shared_ptr<Material> ProcessMaterial(void* materialPtr, const void* scenePtr,
-			ID3D11Device* device, const std::string& directory);
+		// 65535 _𒴂郁bV́A16 rbgCfbNX̒̕fЂɂȂĖ߂邱Ƃ
+		static std::vector<std::shared_ptr<Mesh>> ProcessMesh(void* meshPtr, const ImportSettings& settings,
+			ModelLoadReport& report);
+
+		// Mesh::Prepare ɉAbV\傫΃bVbgBz̓bVɃ[u
+		static std::shared_ptr<Mesh> PrepareMesh(std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices,
+			uint32_t vertexFormat, uint32_t cpuAccess, const MeshletSettings& meshletSettings, ModelLoadReport& report);
+
+		struct LodMesh
+		{
+			std::shared_ptr<Mesh> mesh;
+			float screenSize;
+		};
+		// bṼf[^ settings.lodSettings ̃x(LOD1 ȍ~)Ɋȗ
+		static std::vector<LodMesh> BuildLods(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+			uint32_t vertexFormat, const ImportSettings& settings, ModelLoadReport& report);
+
+		// 1  aiMesh ̃}eÃvpeBƃeNX`̃pX
+		static void ProcessMaterial(void* materialPtr, const std::string& directory, ModelImport& import);
+
+		//=== Game thread side ===
+		// \ZȂȂ܂ŗpӂbṼobt@BׂẴbVڂ true
+		bool UploadMeshes(ID3D11Device* device, ModelImport& import, size_t& budget);
+		// Abv[hbV͂ރ}eA ModelBLbVɂeNX`͂Őݒ肷
+		std::unique_ptr<Model> BuildModel(ID3D11Device* device, ModelImport& import);
+		// \ZȂȂ܂ŃfR[heNX`A҂Ă}eAɐݒ肷
+		void UploadTextures(ID3D11Device* device, ModelImport& import, size_t& budget);
+		// ǂݍ݂I(AsA) true
+		bool UpdateLoad(ID3D11Device* device, ModelLoadHandle& handle, size_t& meshBudget, size_t& textureBudget);
 
 		std::shared_ptr<Texture> LoadTexture(ID3D11Device* device, const std::string& filepath);
 	private:
 		std::string m_textureDirectory;
+		Shader* m_defaultShader = nullptr;
+		VertexFormat::CompressionSettings m_vertexCompression;
+		MeshOptimizer::Settings m_meshOptimization;
+		LodSettings m_lodSettings;
+		MeshletSettings m_meshletSettings;
+		uint32_t m_cpuAccess = 0;
+		std::string m_cacheDirectory = "Cache/Models";
+
 		std::unordered_map<std::string, std::shared_ptr<Texture>> m_textureCache;
+
+		ModelUploadBudget m_uploadBudget;
+		std::vector<std::shared_ptr<ModelLoadHandle>> m_pendingLoads;
 	};
 }
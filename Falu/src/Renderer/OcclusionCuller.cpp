@@ -0,0 +1,606 @@
+/*****************************************************************//**
+ * \file   OcclusionCuller.cpp
+ * \brief  \tgEFA[xX^CU[ƊKw Z ɂ锻
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "OcclusionCuller.h"
+#include "Falu/JobSystem.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FALU_OCCLUSION_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define FALU_OCCLUSION_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Falu
+{
+	namespace
+	{
+		// SIMD  1 XebvňsNZB^C͂̔̕{Ȃ̂ŁAXebv̓^C͂ݏoȂ
+#if defined(FALU_OCCLUSION_AVX2)
+		const int32_t kLanes = 8;
+#elif defined(FALU_OCCLUSION_SSE)
+		const int32_t kLanes = 4;
+#else
+		const int32_t kLanes = 1;
+#endif
+
+		// IsVisible ěɍׂׂĂ悢s~bh̃x
+		const uint32_t kMaxRefineTexels = 64;
+
+		// NbvԂ̕ʂ̃AEgR[h̃rbg: -w <= x <= wA-w <= y <= wA0 <= z
+		enum ClipPlane : uint32_t
+		{
+			ClipLeft = 1u << 0,
+			ClipRight = 1u << 1,
+			ClipBottom = 1u << 2,
+			ClipTop = 1u << 3,
+			ClipNear = 1u << 4,
+			ClipPlaneCount = 5,
+		};
+
+		uint32_t GetOutcode(const Math::Vector4& v)
+		{
+			uint32_t code = 0;
+			if (v.x < -v.w) code |= ClipLeft;
+			if (v.x > v.w) code |= ClipRight;
+			if (v.y < -v.w) code |= ClipBottom;
+			if (v.y > v.w) code |= ClipTop;
+			if (v.z < 0.0f) code |= ClipNear;
+			return code;
+		}
+
+		// ʂ܂ł̕tBȂ >= 0
+		float GetPlaneDistance(const Math::Vector4& v, uint32_t plane)
+		{
+			switch (plane)
+			{
+			case ClipLeft: return v.x + v.w;
+			case ClipRight: return v.w - v.x;
+			case ClipBottom: return v.y + v.w;
+			case ClipTop: return v.w - v.y;
+			default: return v.z;
+			}
+		}
+	}
+
+	OcclusionCuller::OcclusionCuller()
+		: m_projectionScale(1.0f)
+		, m_width(0)
+		, m_height(0)
+		, m_tilesX(0)
+		, m_tilesY(0)
+		, m_triangleCount(0)
+		, m_active(false)
+	{
+
+	}
+
+	OcclusionCuller::~OcclusionCuller()
+	{
+
+	}
+
+	const char* OcclusionCuller::GetInstructionSet()
+	{
+#if defined(FALU_OCCLUSION_AVX2)
+		return "AVX2";
+#elif defined(FALU_OCCLUSION_SSE)
+		return "SSE";
+#else
+		return "Scalar";
+#endif
+	}
+
+	void OcclusionCuller::Begin(const Math::Matrix4& viewProjection, const Math::Vector3& eye, float projectionScale)
+	{
+		m_viewProjection = viewProjection;
+		m_eye = eye;
+		m_projectionScale = projectionScale;
+		m_candidates.clear();
+		m_triangleCount = 0;
+		m_active = false;
+
+		uint32_t width = std::max(m_settings.width, kTileWidth);
+		uint32_t height = std::max(m_settings.height, kTileHeight);
+		width = (width + kTileWidth - 1) / kTileWidth * kTileWidth;
+		height = (height + kTileHeight - 1) / kTileHeight * kTileHeight;
+		if (width != m_width || height != m_height)
+		{
+			m_width = width;
+			m_height = height;
+			m_tilesX = width / kTileWidth;
+			m_tilesY = height / kTileHeight;
+			for (uint32_t level = 0; level < kHiZLevels; ++level)
+			{
+				m_levels[level].assign(static_cast<size_t>(width >> level) * (height >> level), 1.0f);
+			}
+			m_bins.resize(static_cast<size_t>(m_tilesX) * m_tilesY);
+		}
+	}
+
+	void OcclusionCuller::AddOccluder(const Math::Vector3* positions, uint32_t positionStride, uint32_t vertexCount,
+		const IndexData& indices, const Math::Matrix4& world, const Math::AABB& worldBounds)
+	{
+		if (!positions || vertexCount < 3 || indices.GetCount() < 3 || m_settings.maxOccluders == 0)
+			return;
+
+		// CameraSnapshot::GetScreenSize Ɠړx[h̃oEfBO狁߂
+		Math::Vector3 center = worldBounds.GetCenter();
+		float radius = 0.5f * Math::Length(worldBounds.GetSize());
+		float distance = Math::Length(center - m_eye);
+		float score = distance <= radius ? FLT_MAX : radius * m_projectionScale / distance;
+		if (score < m_settings.minOccluderSize)
+			return;
+
+		auto greater = [](const Candidate& a, const Candidate& b) { return a.score > b.score; };
+		if (m_candidates.size() >= m_settings.maxOccluders)
+		{
+			if (score <= m_candidates.front().score)
+				return;
+			std::pop_heap(m_candidates.begin(), m_candidates.end(), greater);
+			m_candidates.pop_back();
+		}
+
+		Candidate candidate;
+		candidate.score = score;
+		candidate.positions = positions;
+		candidate.positionStride = positionStride;
+		candidate.vertexCount = vertexCount;
+		candidate.indices = &indices;
+		candidate.worldViewProjection = world * m_viewProjection;
+		m_candidates.push_back(candidate);
+		std::push_heap(m_candidates.begin(), m_candidates.end(), greater);
+	}
+
+	void OcclusionCuller::Rasterize()
+	{
+		m_triangleCount = 0;
+		m_active = false;
+
+		uint32_t occluderCount = static_cast<uint32_t>(m_candidates.size());
+		if (occluderCount == 0 || m_width == 0)
+			return;
+
+		if (m_work.size() < occluderCount)
+			m_work.resize(occluderCount);
+
+		JobSystem& jobSystem = JobSystem::GetInstance();
+		jobSystem.ParallelFor(occluderCount, [this](uint32_t i)
+		{
+			SetupOccluder(m_candidates[i], m_work[i]);
+		});
+
+		// U蕪͎Op`Ƃɐ̐ZBԂ̂͂̌̃^C̃[v
+		for (std::vector<TriangleRef>& bin : m_bins)
+			bin.clear();
+		for (uint32_t i = 0; i < occluderCount; ++i)
+		{
+			const std::vector<Triangle>& triangles = m_work[i].triangles;
+			for (uint32_t t = 0; t < static_cast<uint32_t>(triangles.size()); ++t)
+			{
+				const Triangle& triangle = triangles[t];
+				uint32_t tileX0 = triangle.minX / kTileWidth;
+				uint32_t tileX1 = triangle.maxX / kTileWidth;
+				uint32_t tileY0 = triangle.minY / kTileHeight;
+				uint32_t tileY1 = triangle.maxY / kTileHeight;
+				for (uint32_t ty = tileY0; ty <= tileY1; ++ty)
+				{
+					for (uint32_t tx = tileX0; tx <= tileX1; ++tx)
+					{
+						m_bins[ty * m_tilesX + tx].push_back({ i, t });
+					}
+				}
+			}
+			m_triangleCount += static_cast<uint32_t>(triangles.size());
+		}
+		if (m_triangleCount == 0)
+			return;
+
+		jobSystem.ParallelFor(m_tilesX * m_tilesY, [this](uint32_t tile)
+		{
+			RasterizeTile(tile);
+			BuildHiZ(tile);
+		});
+		m_active = true;
+	}
+
+	void OcclusionCuller::SetupOccluder(const Candidate& candidate, Work& work) const
+	{
+		work.triangles.clear();
+		work.clip.resize(candidate.vertexCount);
+
+		const char* position = reinterpret_cast<const char*>(candidate.positions);
+		for (uint32_t v = 0; v < candidate.vertexCount; ++v)
+		{
+			work.clip[v] = Math::Transform(Math::Vector4(*reinterpret_cast<const Math::Vector3*>(position), 1.0f), candidate.worldViewProjection);
+			position += candidate.positionStride;
+		}
+
+		candidate.indices->Visit([&](const auto& indices)
+		{
+			const uint32_t vertexCount = candidate.vertexCount;
+			const size_t triangleCount = indices.size() / 3;
+			for (size_t t = 0; t < triangleCount; ++t)
+			{
+				uint32_t i0 = indices[t * 3 + 0];
+				uint32_t i1 = indices[t * 3 + 1];
+				uint32_t i2 = indices[t * 3 + 2];
+				if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+					continue;
+
+				const Math::Vector4& v0 = work.clip[i0];
+				const Math::Vector4& v1 = work.clip[i1];
+				const Math::Vector4& v2 = work.clip[i2];
+				uint32_t code0 = GetOutcode(v0);
+				uint32_t code1 = GetOutcode(v1);
+				uint32_t code2 = GetOutcode(v2);
+				if (code0 & code1 & code2)
+					continue;
+
+				uint32_t crossed = code0 | code1 | code2;
+				if (crossed == 0)
+				{
+					EmitTriangle(v0, v1, v2, work);
+					continue;
+				}
+
+				// ܂ʂ Sutherland-HodgmanB1 ʂő钸_͍X 1 
+				Math::Vector4 polygon[2][3 + ClipPlaneCount];
+				uint32_t count = 3;
+				polygon[0][0] = v0;
+				polygon[0][1] = v1;
+				polygon[0][2] = v2;
+				int current = 0;
+				for (uint32_t plane = 1; plane < (1u << ClipPlaneCount) && count >= 3; plane <<= 1)
+				{
+					if (!(crossed & plane))
+						continue;
+
+					const Math::Vector4* in = polygon[current];
+					Math::Vector4* out = polygon[current ^ 1];
+					uint32_t outCount = 0;
+					for (uint32_t i = 0; i < count; ++i)
+					{
+						const Math::Vector4& a = in[i];
+						const Math::Vector4& b = in[(i + 1) % count];
+						float da = GetPlaneDistance(a, plane);
+						float db = GetPlaneDistance(b, plane);
+						if (da >= 0.0f)
+							out[outCount++] = a;
+						if ((da >= 0.0f) != (db >= 0.0f))
+							out[outCount++] = Math::Lerp(a, b, da / (da - db));
+					}
+					count = outCount;
+					current ^= 1;
+				}
+
+				for (uint32_t i = 1; i + 1 < count; ++i)
+				{
+					EmitTriangle(polygon[current][0], polygon[current][i], polygon[current][i + 1], work);
+				}
+			}
+		});
+	}
+
+	void OcclusionCuller::EmitTriangle(const Math::Vector4& v0, const Math::Vector4& v1, const Math::Vector4& v2, Work& work) const
+	{
+		// z >= 0 ŃNbvς݂Ȃ̂ŁAeł w > 0Aseł 1
+		if (v0.w <= 0.0f || v1.w <= 0.0f || v2.w <= 0.0f)
+			return;
+
+		const float width = static_cast<float>(m_width);
+		const float height = static_cast<float>(m_height);
+		const Math::Vector4* v[3] = { &v0, &v1, &v2 };
+		float x[3], y[3], z[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			float invW = 1.0f / v[i]->w;
+			x[i] = (v[i]->x * invW * 0.5f + 0.5f) * width;
+			y[i] = (0.5f - v[i]->y * invW * 0.5f) * height;
+			z[i] = v[i]->z * invW;
+		}
+
+		// _[̗ʃJOƓAʏ(y ͉)Ŏv肪\
+		float dx1 = x[1] - x[0], dy1 = y[1] - y[0], dz1 = z[1] - z[0];
+		float dx2 = x[2] - x[0], dy2 = y[2] - y[0], dz2 = z[2] - z[0];
+		float area = dx1 * dy2 - dx2 * dy1;
+		if (!(area > 0.0f))
+			return;
+
+		// S͈͓ɂsNZBsNZS̊ԂɎ܂Op`͂ŗ
+		Triangle triangle;
+		triangle.minX = std::max(static_cast<int32_t>(std::ceil(std::min(x[0], std::min(x[1], x[2])) - 0.5f)), 0);
+		triangle.minY = std::max(static_cast<int32_t>(std::ceil(std::min(y[0], std::min(y[1], y[2])) - 0.5f)), 0);
+		triangle.maxX = std::min(static_cast<int32_t>(std::floor(std::max(x[0], std::max(x[1], x[2])) - 0.5f)), static_cast<int32_t>(m_width) - 1);
+		triangle.maxY = std::min(static_cast<int32_t>(std::floor(std::max(y[0], std::max(y[1], y[2])) - 0.5f)), static_cast<int32_t>(m_height) - 1);
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+			return;
+
+		//  i ͒_ i  i + 1 ֌AŐB萔ŔsNZSɈڂB
+		// ӂ̂傤Ǐɂ钆S͗̎Op`ɐ̂ŁALӂɌԂ͂łȂ
+		for (int i = 0; i < 3; ++i)
+		{
+			int j = (i + 1) % 3;
+			float a = y[i] - y[j];
+			float b = x[j] - x[i];
+			float c = -(a * x[i] + b * y[i]);
+			triangle.edgeA[i] = a;
+			triangle.edgeB[i] = b;
+			triangle.edgeC[i] = c + 0.5f * (a + b);
+		}
+
+		// [x̓XN[ԂŐ`Ȃ̂ŁAsNZ̍őlAԉ_̐[xŗ}
+		float depthDx = (dz1 * dy2 - dz2 * dy1) / area;
+		float depthDy = (dx1 * dz2 - dx2 * dz1) / area;
+		triangle.depthDx = depthDx;
+		triangle.depthDy = depthDy;
+		triangle.depthC = z[0] - depthDx * x[0] - depthDy * y[0]
+			+ 0.5f * (depthDx + depthDy) + 0.5f * (std::fabs(depthDx) + std::fabs(depthDy));
+		triangle.depthMax = std::max(z[0], std::max(z[1], z[2]));
+
+		work.triangles.push_back(triangle);
+	}
+
+	void OcclusionCuller::RasterizeTile(uint32_t tile)
+	{
+		const int32_t tileX0 = static_cast<int32_t>((tile % m_tilesX) * kTileWidth);
+		const int32_t tileY0 = static_cast<int32_t>((tile / m_tilesX) * kTileHeight);
+		const int32_t tileX1 = tileX0 + static_cast<int32_t>(kTileWidth) - 1;
+		const int32_t tileY1 = tileY0 + static_cast<int32_t>(kTileHeight) - 1;
+		float* depth = m_levels[0].data();
+
+		for (int32_t y = tileY0; y <= tileY1; ++y)
+		{
+			std::fill(depth + static_cast<size_t>(y) * m_width + tileX0, depth + static_cast<size_t>(y) * m_width + tileX1 + 1, 1.0f);
+		}
+
+		for (const TriangleRef& ref : m_bins[tile])
+		{
+			const Triangle& tri = m_work[ref.occluder].triangles[ref.triangle];
+			// SIMD ̃XebvPʂɐ؂艺B]ȃsNZ͕ӂ̔ŊO
+			int32_t minX = std::max(tri.minX, tileX0) & ~(kLanes - 1);
+			int32_t maxX = std::min(tri.maxX, tileX1);
+			int32_t minY = std::max(tri.minY, tileY0);
+			int32_t maxY = std::min(tri.maxY, tileY1);
+
+			for (int32_t y = minY; y <= maxY; ++y)
+			{
+				float* row = depth + static_cast<size_t>(y) * m_width;
+				const float fy = static_cast<float>(y);
+				const float e0Row = tri.edgeB[0] * fy + tri.edgeC[0];
+				const float e1Row = tri.edgeB[1] * fy + tri.edgeC[1];
+				const float e2Row = tri.edgeB[2] * fy + tri.edgeC[2];
+				const float zRow = tri.depthDy * fy + tri.depthC;
+
+#if defined(FALU_OCCLUSION_AVX2)
+				const __m256 laneOffset = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+				const __m256 zero = _mm256_setzero_ps();
+				for (int32_t x = minX; x <= maxX; x += kLanes)
+				{
+					// ܂ɃXebvƂɋ߁A̔肪Ȃ悤ɂ
+					__m256 fx = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), laneOffset);
+					__m256 e0 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.edgeA[0]), fx), _mm256_set1_ps(e0Row));
+					__m256 e1 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.edgeA[1]), fx), _mm256_set1_ps(e1Row));
+					__m256 e2 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.edgeA[2]), fx), _mm256_set1_ps(e2Row));
+					__m256 inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(e0, zero, _CMP_GE_OQ),
+						_mm256_cmp_ps(e1, zero, _CMP_GE_OQ)), _mm256_cmp_ps(e2, zero, _CMP_GE_OQ));
+					if (_mm256_movemask_ps(inside) == 0)
+						continue;
+
+					__m256 z = _mm256_min_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.depthDx), fx), _mm256_set1_ps(zRow)),
+						_mm256_set1_ps(tri.depthMax));
+					__m256 old = _mm256_loadu_ps(row + x);
+					_mm256_storeu_ps(row + x, _mm256_blendv_ps(old, _mm256_min_ps(old, z), inside));
+				}
+#elif defined(FALU_OCCLUSION_SSE)
+				const __m128 laneOffset = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+				const __m128 zero = _mm_setzero_ps();
+				const __m128 a0 = _mm_set1_ps(tri.edgeA[0]), a1 = _mm_set1_ps(tri.edgeA[1]), a2 = _mm_set1_ps(tri.edgeA[2]);
+				const __m128 c0 = _mm_set1_ps(e0Row), c1 = _mm_set1_ps(e1Row), c2 = _mm_set1_ps(e2Row);
+				const __m128 dzdx = _mm_set1_ps(tri.depthDx), zc = _mm_set1_ps(zRow), zMax = _mm_set1_ps(tri.depthMax);
+				for (int32_t x = minX; x <= maxX; x += kLanes)
+				{
+					// ܂ɃXebvƂɋ߁A̔肪Ȃ悤ɂ
+					__m128 fx = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffset);
+					__m128 inside = _mm_and_ps(_mm_and_ps(
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a0, fx), c0), zero),
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a1, fx), c1), zero)),
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a2, fx), c2), zero));
+					if (_mm_movemask_ps(inside) == 0)
+						continue;
+
+					__m128 z = _mm_min_ps(_mm_add_ps(_mm_mul_ps(dzdx, fx), zc), zMax);
+					__m128 old = _mm_loadu_ps(row + x);
+					__m128 updated = _mm_min_ps(old, z);
+					_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, updated), _mm_andnot_ps(inside, old)));
+				}
+#else
+				for (int32_t x = minX; x <= maxX; ++x)
+				{
+					const float fx = static_cast<float>(x);
+					if (tri.edgeA[0] * fx + e0Row >= 0.0f && tri.edgeA[1] * fx + e1Row >= 0.0f && tri.edgeA[2] * fx + e2Row >= 0.0f)
+					{
+						float z = std::min(tri.depthDx * fx + zRow, tri.depthMax);
+						row[x] = std::min(row[x], z);
+					}
+				}
+#endif
+			}
+		}
+	}
+
+	void OcclusionCuller::BuildHiZ(uint32_t tile)
+	{
+		const uint32_t tileX = (tile % m_tilesX) * kTileWidth;
+		const uint32_t tileY = (tile / m_tilesX) * kTileHeight;
+		for (uint32_t level = 1; level < kHiZLevels; ++level)
+		{
+			const float* src = m_levels[level - 1].data();
+			float* dst = m_levels[level].data();
+			const uint32_t srcWidth = m_width >> (level - 1);
+			const uint32_t dstWidth = m_width >> level;
+			const uint32_t x0 = tileX >> level, x1 = (tileX + kTileWidth) >> level;
+			const uint32_t y0 = tileY >> level, y1 = (tileY + kTileHeight) >> level;
+			for (uint32_t y = y0; y < y1; ++y)
+			{
+				const float* srcRow0 = src + static_cast<size_t>(y * 2) * srcWidth;
+				const float* srcRow1 = srcRow0 + srcWidth;
+				float* dstRow = dst + static_cast<size_t>(y) * dstWidth;
+				for (uint32_t x = x0; x < x1; ++x)
+				{
+					dstRow[x] = std::max(std::max(srcRow0[x * 2], srcRow0[x * 2 + 1]), std::max(srcRow1[x * 2], srcRow1[x * 2 + 1]));
+				}
+			}
+		}
+	}
+
+	bool OcclusionCuller::IsRectOccluded(uint32_t level, int32_t x0, int32_t y0, int32_t x1, int32_t y1, float depth) const
+	{
+		const float* texels = m_levels[level].data();
+		const uint32_t width = m_width >> level;
+		for (int32_t y = y0 >> level; y <= (y1 >> level); ++y)
+		{
+			const float* row = texels + static_cast<size_t>(y) * width;
+			for (int32_t x = x0 >> level; x <= (x1 >> level); ++x)
+			{
+				if (row[x] >= depth)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	bool OcclusionCuller::IsVisible(const Math::AABB& bounds) const
+	{
+		if (!m_active)
+			return true;
+
+		// NbvԂ̊p: S +- 傫|s̍s
+		const Math::Matrix4& m = m_viewProjection;
+		Math::Vector3 center = bounds.GetCenter();
+		Math::Vector3 extents = bounds.GetSize() * 0.5f;
+		Math::Vector4 c = Math::Transform(Math::Vector4(center, 1.0f), m);
+		float ax[4] = { m.m[0][0] * extents.x, m.m[0][1] * extents.x, m.m[0][2] * extents.x, m.m[0][3] * extents.x };
+		float ay[4] = { m.m[1][0] * extents.y, m.m[1][1] * extents.y, m.m[1][2] * extents.y, m.m[1][3] * extents.y };
+		float az[4] = { m.m[2][0] * extents.z, m.m[2][1] * extents.z, m.m[2][2] * extents.z, m.m[2][3] * extents.z };
+
+		float minX, maxX, minY, maxY, minZ;
+#if defined(FALU_OCCLUSION_SSE)
+		static const float kSign[3][8] =
+		{
+			{ -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f },
+			{ -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f },
+			{ -1.0f, -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f },
+		};
+		const float center4[4] = { c.x, c.y, c.z, c.w };
+		__m128 clip[4][2];
+		for (int component = 0; component < 4; ++component)
+		{
+			for (int group = 0; group < 2; ++group)
+			{
+				clip[component][group] = _mm_add_ps(_mm_add_ps(_mm_set1_ps(center4[component]),
+					_mm_mul_ps(_mm_loadu_ps(kSign[0] + group * 4), _mm_set1_ps(ax[component]))),
+					_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(kSign[1] + group * 4), _mm_set1_ps(ay[component])),
+						_mm_mul_ps(_mm_loadu_ps(kSign[2] + group * 4), _mm_set1_ps(az[component]))));
+			}
+		}
+
+		// jAv[Oɓ͂{bNX̓J̎E𕢂̂Ŏc
+		int nearMask = 0;
+		__m128 lo = _mm_set1_ps(FLT_MAX), hi = _mm_set1_ps(-FLT_MAX);
+		__m128 loY = lo, hiY = hi, loZ = lo;
+		for (int group = 0; group < 2; ++group)
+		{
+			nearMask |= _mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(clip[2][group], _mm_setzero_ps()),
+				_mm_cmple_ps(clip[3][group], _mm_setzero_ps())));
+			__m128 invW = _mm_div_ps(_mm_set1_ps(1.0f), clip[3][group]);
+			__m128 ndcX = _mm_mul_ps(clip[0][group], invW);
+			__m128 ndcY = _mm_mul_ps(clip[1][group], invW);
+			lo = _mm_min_ps(lo, ndcX);
+			hi = _mm_max_ps(hi, ndcX);
+			loY = _mm_min_ps(loY, ndcY);
+			hiY = _mm_max_ps(hiY, ndcY);
+			loZ = _mm_min_ps(loZ, _mm_mul_ps(clip[2][group], invW));
+		}
+		if (nearMask)
+			return true;
+
+		alignas(16) float reduce[5][4];
+		_mm_store_ps(reduce[0], lo);
+		_mm_store_ps(reduce[1], hi);
+		_mm_store_ps(reduce[2], loY);
+		_mm_store_ps(reduce[3], hiY);
+		_mm_store_ps(reduce[4], loZ);
+		minX = std::min(std::min(reduce[0][0], reduce[0][1]), std::min(reduce[0][2], reduce[0][3]));
+		maxX = std::max(std::max(reduce[1][0], reduce[1][1]), std::max(reduce[1][2], reduce[1][3]));
+		minY = std::min(std::min(reduce[2][0], reduce[2][1]), std::min(reduce[2][2], reduce[2][3]));
+		maxY = std::max(std::max(reduce[3][0], reduce[3][1]), std::max(reduce[3][2], reduce[3][3]));
+		minZ = std::min(std::min(reduce[4][0], reduce[4][1]), std::min(reduce[4][2], reduce[4][3]));
+#else
+		minX = minY = minZ = FLT_MAX;
+		maxX = maxY = -FLT_MAX;
+		for (int i = 0; i < 8; ++i)
+		{
+			float sx = (i & 1) ? 1.0f : -1.0f;
+			float sy = (i & 2) ? 1.0f : -1.0f;
+			float sz = (i & 4) ? 1.0f : -1.0f;
+			float x = c.x + sx * ax[0] + sy * ay[0] + sz * az[0];
+			float y = c.y + sx * ax[1] + sy * ay[1] + sz * az[1];
+			float z = c.z + sx * ax[2] + sy * ay[2] + sz * az[2];
+			float w = c.w + sx * ax[3] + sy * ay[3] + sz * az[3];
+			// jAv[Oɓ͂{bNX̓J̎E𕢂̂Ŏc
+			if (z < 0.0f || w <= 0.0f)
+				return true;
+
+			float invW = 1.0f / w;
+			minX = std::min(minX, x * invW);
+			maxX = std::max(maxX, x * invW);
+			minY = std::min(minY, y * invW);
+			maxY = std::max(maxY, y * invW);
+			minZ = std::min(minZ, z * invW);
+		}
+#endif
+
+		// {bNẌꕔ肤ʏ̋`(sNZP)
+		const float width = static_cast<float>(m_width);
+		const float height = static_cast<float>(m_height);
+		float left = (minX * 0.5f + 0.5f) * width;
+		float right = (maxX * 0.5f + 0.5f) * width;
+		float top = (0.5f - maxY * 0.5f) * height;
+		float bottom = (0.5f - minY * 0.5f) * height;
+		if (!(right >= 0.0f && left < width && bottom >= 0.0f && top < height))
+			return true;
+
+		// 1 sNZLBIN[_[̉̃sNZ͒SΏ̂ŁA
+		// {bNXJOɂ͂ÕsNZɂBĂKv
+		int32_t x0 = static_cast<int32_t>(std::max(left - 1.0f, 0.0f));
+		int32_t x1 = static_cast<int32_t>(std::min(right + 1.0f, width - 1.0f));
+		int32_t y0 = static_cast<int32_t>(std::max(top - 1.0f, 0.0f));
+		int32_t y1 = static_cast<int32_t>(std::min(bottom + 1.0f, height - 1.0f));
+
+		// ` 4x4 eNZȓɎ܂郌xn߁AςފԂׂ͍Ă
+		uint32_t level = 0;
+		while (level + 1 < kHiZLevels && ((x1 >> level) - (x0 >> level) >= 4 || (y1 >> level) - (y0 >> level) >= 4))
+			++level;
+
+		for (int32_t l = static_cast<int32_t>(level); l >= 0; --l)
+		{
+			uint32_t texels = static_cast<uint32_t>(((x1 >> l) - (x0 >> l) + 1) * ((y1 >> l) - (y0 >> l) + 1));
+			if (l != static_cast<int32_t>(level) && texels > kMaxRefineTexels)
+				break;
+			if (IsRectOccluded(static_cast<uint32_t>(l), x0, y0, x1, y1, minZ))
+				return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,146 @@
+/*****************************************************************//**
+ * \file   OcclusionCuller.h
+ * \brief  𑜓x̃\tgEFA[xobt@ɂ CPU ł̃IN[WJO
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Include/Math/Vector.h"
+#include "Include/Math/Matrix.h"
+#include "Include/Math/Ray.h"
+#include "Renderer/IndexData.h"
+
+namespace Falu
+{
+	struct OcclusionSettings
+	{
+		bool enabled = true;
+		// [xobt@̑傫B^CPʂɐ؂グ
+		uint32_t width = 256;
+		uint32_t height = 128;
+		// ʏő傫₾X^CYAc͔肾s
+		uint32_t maxOccluders = 16;
+		// 菬(ea / r[|[g̍)̓IN[_[ɂȂ
+		float minOccluderSize = 0.1f;
+	};
+
+	struct OcclusionStats
+	{
+		uint32_t occluderCount = 0;
+		uint32_t triangleCount = 0;		// NbvAʁA傫ŏɃX^CY
+		uint32_t testedCount = 0;
+		uint32_t culledCount = 0;
+	};
+
+	// ̑傫ȃIN[_[Ȑ[xobt@ɃX^CYAoEfBOő[x̃s~bhŔ肷B
+	// 핢̓sNZSŒׂ邪AesNZɂ͎Op`̒œ͂ԉ[xA{bNX 1 sNZ
+	// L`Ŕ肷̂ŁA덷͕`鑤ɊB[x D3D ɍ킹(O 0A 1)AOp`̌
+	// _[̃JOɍ킹(v肪\)B
+	//
+	// t[Ƃ BeginA₲Ƃ AddOccluderARasterize ̏ɌĂсǍ IsVisible ͂ǂ̃XbhłĂׂ
+	class OcclusionCuller
+	{
+	public:
+		static constexpr uint32_t kTileWidth = 64;
+		static constexpr uint32_t kTileHeight = 32;
+		// x 0 [xobt@ŁAx n  2^n x 2^n sNZ̍őlBk̓^CƂɍs
+		static constexpr uint32_t kHiZLevels = 6;
+
+		OcclusionCuller();
+		~OcclusionCuller();
+
+		void SetSettings(const OcclusionSettings& settings) { m_settings = settings; }
+		const OcclusionSettings& GetSettings() const { return m_settings; }
+
+		// viewProjection: sxNg`̃[hNbvԂւ̕ϊBeye  projectionScale(projection._22)Ōʕt
+		void Begin(const Math::Matrix4& viewProjection, const Math::Vector3& eye, float projectionScale);
+
+		// bVIN[_[̌ɉBʏő傫 settings.maxOccluders cB
+		// positions / indices  Rasterize ߂܂ŐĂ
+		void AddOccluder(const Math::Vector3* positions, uint32_t positionStride, uint32_t vertexCount,
+			const IndexData& indices, const Math::Matrix4& world, const Math::AABB& worldBounds);
+
+		// IN[_[̕ϊƃNbvɍsAOp`^CɐU蕪A^CɃX^CYB
+		// [xs~bhe^C͈̔͂
+		void Rasterize();
+
+		// [hԂ̃{bNXX^CYIN[_[̌ɊmɉBĂ falseB
+		// Rasterize ̑OAX^CYĂȂΏ true
+		bool IsVisible(const Math::AABB& bounds) const;
+
+		bool IsActive() const { return m_active; }
+		uint32_t GetWidth() const { return m_width; }
+		uint32_t GetHeight() const { return m_height; }
+		// sD 1 s GetWidth()  floatB`ĂȂ 1
+		const float* GetDepth() const { return m_levels[0].data(); }
+		uint32_t GetOccluderCount() const { return static_cast<uint32_t>(m_candidates.size()); }
+		uint32_t GetTriangleCount() const { return m_triangleCount; }
+
+		// "AVX2"A"SSE"A"Scalar" ̂ꂩBOx`}[Np
+		static const char* GetInstructionSet();
+
+	private:
+		struct Candidate
+		{
+			float score;
+			const Math::Vector3* positions;
+			uint32_t positionStride;
+			uint32_t vertexCount;
+			const IndexData* indices;
+			Math::Matrix4 worldViewProjection;
+		};
+
+		// ^C̃[vɂ̂܂ܓnXN[Ԃ̎Op`B
+		// ӂƐ[x̎͐̃sNZWAsNẐ܂ł
+		struct Triangle
+		{
+			float edgeA[3], edgeB[3], edgeC[3];	// ׂĂ a*x + b*y + c >= 0 Ȃ
+			float depthC, depthDx, depthDy;		// sNZ (x, y) ̒ňԉ[x
+			float depthMax;
+			int32_t minX, minY, maxX, maxY;		// sNZ͈̔([܂)
+		};
+
+		struct TriangleRef
+		{
+			uint32_t occluder;
+			uint32_t triangle;
+		};
+
+		// IN[_[Ƃ̍Ɨ̈Bt[܂Ŏg
+		struct Work
+		{
+			std::vector<Math::Vector4> clip;
+			std::vector<Triangle> triangles;
+		};
+
+		void SetupOccluder(const Candidate& candidate, Work& work) const;
+		void EmitTriangle(const Math::Vector4& v0, const Math::Vector4& v1, const Math::Vector4& v2, Work& work) const;
+		void RasterizeTile(uint32_t tile);
+		void BuildHiZ(uint32_t tile);
+		// m_levels[level]  [x0, x1] x [y0, y1]([܂ށAx 0 ̃sNZP)̃eNZׂ depth OȂ true
+		bool IsRectOccluded(uint32_t level, int32_t x0, int32_t y0, int32_t x1, int32_t y1, float depth) const;
+
+	private:
+		OcclusionSettings m_settings;
+		Math::Matrix4 m_viewProjection;
+		Math::Vector3 m_eye;
+		float m_projectionScale;
+
+		uint32_t m_width;
+		uint32_t m_height;
+		uint32_t m_tilesX;
+		uint32_t m_tilesY;
+		std::vector<float> m_levels[kHiZLevels];
+
+		// W߂Ԃ̓XRA̍ŏq[vɂāAcĂ钆ňԏ₩ւ
+		std::vector<Candidate> m_candidates;
+		std::vector<Work> m_work;
+		std::vector<std::vector<TriangleRef>> m_bins;
+		uint32_t m_triangleCount;
+		bool m_active;
+	};
+}
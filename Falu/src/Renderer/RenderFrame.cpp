@@ -0,0 +1,210 @@
+/*****************************************************************//**
+ * \file   RenderFrame.cpp
+ * \brief  RenderFrame ̕r[̃JOƃL[̍\z
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "RenderFrame.h"
+#include "Falu/JobSystem.h"
+#include "Renderer/Mesh.h"
+
+#include <atomic>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FALU_VIEW_CULL_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace Falu
+{
+	namespace
+	{
+		const uint32_t kPacketsPerJob = 512;
+
+		// 1 ̃r[ 6 ̕ʂ SoA ŎA8 ɖ߂ă{bNX SSE 2 Ŕł悤ɂB
+		// ߑ͍̕ʂ̌JԂȂ̂ŁAʂ͕ςȂ
+		struct alignas(16) ViewPlanes
+		{
+			float nx[8], ny[8], nz[8], d[8];
+			float ax[8], ay[8], az[8];	// |n|B{bNX𓊉eap
+
+			void Set(const Math::Frustum& frustum)
+			{
+				for (int i = 0; i < 8; ++i)
+				{
+					const Math::Vector4& plane = frustum.planes[i < Math::Frustum::PlaneCount ? i : 0];
+					nx[i] = plane.x;
+					ny[i] = plane.y;
+					nz[i] = plane.z;
+					d[i] = plane.w;
+					ax[i] = std::fabs(plane.x);
+					ay[i] = std::fabs(plane.y);
+					az[i] = std::fabs(plane.z);
+				}
+			}
+
+			// Frustum::Intersects(AABB) Ɠ𒆐S/傫ŏ
+			bool Intersects(const Math::Vector3& center, const Math::Vector3& extents) const
+			{
+#ifdef FALU_VIEW_CULL_SSE
+				__m128 cx = _mm_set1_ps(center.x), cy = _mm_set1_ps(center.y), cz = _mm_set1_ps(center.z);
+				__m128 ex = _mm_set1_ps(extents.x), ey = _mm_set1_ps(extents.y), ez = _mm_set1_ps(extents.z);
+				int outside = 0;
+				for (int i = 0; i < 8; i += 4)
+				{
+					__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(nx + i), cx),
+						_mm_mul_ps(_mm_load_ps(ny + i), cy)), _mm_add_ps(_mm_mul_ps(_mm_load_ps(nz + i), cz), _mm_load_ps(d + i)));
+					__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(ax + i), ex),
+						_mm_mul_ps(_mm_load_ps(ay + i), ey)), _mm_mul_ps(_mm_load_ps(az + i), ez));
+					outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+				}
+				return outside == 0;
+#else
+				for (int i = 0; i < Math::Frustum::PlaneCount; ++i)
+				{
+					float distance = nx[i] * center.x + ny[i] * center.y + nz[i] * center.z + d[i];
+					float radius = ax[i] * extents.x + ay[i] * extents.y + az[i] * extents.z;
+					if (distance + radius < 0.0f)
+						return false;
+				}
+				return true;
+#endif
+			}
+		};
+	}
+
+	void RenderFrame::BuildViewQueues(OcclusionCuller* occlusionCuller)
+	{
+		auto bySortKey = [](const DrawPacket& a, const DrawPacket& b) { return a.sortKey < b.sortKey; };
+
+		if (viewCount == 0 && shadowCascadeCount == 0)
+		{
+			std::sort(drawPackets.begin(), drawPackets.end(), bySortKey);
+			return;
+		}
+
+		// ׂẴr[ƃJXP[h̕ʂ 1 񂾂ׂĂAepPbg̓oEfBOWX^ɍڂ܂
+		// ʂǂBJXP[h̃{bNX̓Cg̕֐Lт̂ŁAǂ̃r[̊OɂLX^[c
+		ViewPlanes planes[kMaxViews];
+		for (uint32_t v = 0; v < viewCount; ++v)
+			planes[v].Set(views[v].camera.frustum);
+		ViewPlanes cascadePlanes[ShadowCascades::kMaxCascades];
+		for (uint32_t c = 0; c < shadowCascadeCount; ++c)
+			cascadePlanes[c].Set(shadowCascades[c].frustum);
+
+		uint32_t packetCount = static_cast<uint32_t>(drawPackets.size());
+		uint32_t jobCount = (packetCount + kPacketsPerJob - 1) / kPacketsPerJob;
+		const uint32_t activeViews = viewCount;
+		const uint32_t activeCascades = shadowCascadeCount;
+		JobSystem::GetInstance().ParallelFor(jobCount, [&](uint32_t job)
+		{
+			uint32_t begin = job * kPacketsPerJob;
+			uint32_t end = std::min(begin + kPacketsPerJob, packetCount);
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				DrawPacket& packet = drawPackets[i];
+				Math::Vector3 center = packet.bounds.GetCenter();
+				Math::Vector3 extents = packet.bounds.GetSize() * 0.5f;
+
+				uint32_t mask = 0;
+				for (uint32_t v = 0; v < activeViews; ++v)
+				{
+					if (planes[v].Intersects(center, extents))
+						mask |= 1u << v;
+				}
+				packet.viewMask = mask;
+
+				uint32_t casterMask = 0;
+				for (uint32_t c = 0; c < activeCascades; ++c)
+				{
+					if (cascadePlanes[c].Intersects(center, extents))
+						casterMask |= 1u << c;
+				}
+				packet.casterMask = casterMask;
+			}
+		});
+
+		// Cr[̃IN[WB̎̃pXŌ̂͑Ił̂ŁAIN[_[͂̒
+		// IсAꂾɍsBVhELX^[⑼̃r[͂̂܂
+		if (occlusionCuller && occlusionCuller->GetSettings().enabled && activeViews > 0 && views[0].camera.valid)
+		{
+			const CameraSnapshot& mainCamera = views[0].camera;
+			Math::Matrix4 viewProjection;
+			memcpy(viewProjection.m, &mainCamera.viewProjection, sizeof(viewProjection.m));
+			occlusionCuller->Begin(viewProjection, mainCamera.position, mainCamera.projection._22);
+			for (const DrawPacket& packet : drawPackets)
+			{
+				if (!(packet.viewMask & 1u) || !packet.mesh || packet.mesh->GetVertices().empty())
+					continue;
+
+				Math::Matrix4 world;
+				memcpy(world.m, &packet.world, sizeof(world.m));
+				const std::vector<Vertex>& vertices = packet.mesh->GetVertices();
+				occlusionCuller->AddOccluder(&vertices.front().position, sizeof(Vertex), static_cast<uint32_t>(vertices.size()),
+					packet.mesh->GetIndices(), world, packet.bounds);
+			}
+			occlusionCuller->Rasterize();
+
+			if (occlusionCuller->IsActive())
+			{
+				std::atomic<uint32_t> tested{ 0 };
+				std::atomic<uint32_t> culled{ 0 };
+				JobSystem::GetInstance().ParallelFor(jobCount, [&](uint32_t job)
+				{
+					uint32_t begin = job * kPacketsPerJob;
+					uint32_t end = std::min(begin + kPacketsPerJob, packetCount);
+					uint32_t jobTested = 0;
+					uint32_t jobCulled = 0;
+					for (uint32_t i = begin; i < end; ++i)
+					{
+						DrawPacket& packet = drawPackets[i];
+						if (!(packet.viewMask & 1u))
+							continue;
+
+						++jobTested;
+						if (!occlusionCuller->IsVisible(packet.bounds))
+						{
+							packet.viewMask &= ~1u;
+							++jobCulled;
+						}
+					}
+					tested.fetch_add(jobTested, std::memory_order_relaxed);
+					culled.fetch_add(jobCulled, std::memory_order_relaxed);
+				});
+				occlusionStats.testedCount = tested.load(std::memory_order_relaxed);
+				occlusionStats.culledCount = culled.load(std::memory_order_relaxed);
+			}
+			occlusionStats.occluderCount = occlusionCuller->GetOccluderCount();
+			occlusionStats.triangleCount = occlusionCuller->GetTriangleCount();
+		}
+
+		// ǂ̃r[ɂAǂ̃JXP[hɂvȂpPbg͂ŗƂ̂ŁA}eA̍XV
+		// IuWFNgƂ̒萔΂
+		drawPackets.erase(std::remove_if(drawPackets.begin(), drawPackets.end(),
+			[](const DrawPacket& packet) { return packet.viewMask == 0 && packet.casterMask == 0; }), drawPackets.end());
+
+		// \[g 1 łׂẴr[ƃJXP[hɎgB\[gς݂̃Xgi荞ł\[gς݂̂܂
+		std::sort(drawPackets.begin(), drawPackets.end(), bySortKey);
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(drawPackets.size()); ++i)
+		{
+			uint32_t mask = drawPackets[i].viewMask;
+			while (mask)
+			{
+				uint32_t v = 0;
+				while (!(mask & (1u << v)))
+					++v;
+				views[v].queue.push_back(i);
+				mask &= mask - 1;
+			}
+
+			for (uint32_t c = 0; c < activeCascades; ++c)
+			{
+				if (drawPackets[i].casterMask & (1u << c))
+					shadowQueues[c].push_back(i);
+			}
+		}
+	}
+}
@@ -0,0 +1,284 @@
+/*****************************************************************//**
+ * \file   RenderFrame.h
+ * \brief  V~[VXbh`Xbh֓nAύXȂt[Ƃ̃XibvVbg
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Include/Math/MathHelper.h"
+#include "Include/Math/Frustum.h"
+#include "Include/Math/Ray.h"
+#include "Include/Utils/Gizmo.h"
+#include "Include/Utils/ImGuiManager.h"
+#include "Renderer/Light.h"
+#include "Renderer/Material.h"
+#include "Renderer/Meshlet.h"
+#include "Renderer/OcclusionCuller.h"
+#include "Renderer/RenderView.h"
+#include "Renderer/ShadowCascades.h"
+#include "Renderer/Shader.h"
+
+namespace Falu
+{
+	class Mesh;
+	class RenderTarget;
+
+	// `R[ 1 񕪂̃f[^B_[R|[lgo
+	struct DrawPacket
+	{
+		static constexpr uint32_t kNoMaterial = UINT32_MAX;
+
+		uint64_t sortKey = 0;
+		Mesh* mesh = nullptr;
+		// RenderFrame::materials ł̔ԍ
+		uint32_t material = kNoMaterial;
+		DirectX::XMFLOAT4X4 world;
+		// [hԂ̃oEfBOBׂẴr[̎Ŕ肷
+		Math::AABB bounds;
+		// RenderFrame::views[v] ɃpPbgȂrbg v (BuildViewQueues ߂)
+		uint32_t viewMask = 0;
+		// pPbg RenderFrame::shadowCascades[c] ɉe𗎂ƂȂrbg c (BuildViewQueues ߂)
+		uint32_t casterMask = 0;
+
+		// NX^[JO`: RenderFrame::indexRanges[rangeOffset, rangeOffset + rangeCount)B
+		// rangeCount == 0 Ȃ烁bVŜ`
+		uint32_t rangeOffset = 0;
+		uint32_t rangeCount = 0;
+	};
+
+	// V~[VXbhŋ߂J̍s
+	struct CameraSnapshot
+	{
+		bool valid = false;
+		DirectX::XMFLOAT4X4 view;
+		DirectX::XMFLOAT4X4 projection;
+		DirectX::XMFLOAT4X4 viewProjection;
+		Math::Vector3 position;
+		// [hԂ̕ʁBJ̃LbVRs[
+		Math::Frustum frustum;
+
+		// oEfBO͂ދ𓊉eáAr[|[g̍ɑ΂銄B
+		// J̒ɂ邩AJȂ 1(LOD 0)
+		float GetScreenSize(const Math::AABB& localBounds, const DirectX::XMMATRIX& world) const
+		{
+			using namespace DirectX;
+			if (!valid)
+				return 1.0f;
+
+			Math::Vector3 localCenter = localBounds.GetCenter();
+			Math::Vector3 size = localBounds.GetSize();
+			XMVECTOR center = XMVector3Transform(XMVectorSet(localCenter.x, localCenter.y, localCenter.z, 1.0f), world);
+
+			// [hs̎̊g̍őlgAsψȊgłێIɂȂ悤ɂ
+			float scale = std::max(XMVectorGetX(XMVector3Length(world.r[0])),
+				std::max(XMVectorGetX(XMVector3Length(world.r[1])), XMVectorGetX(XMVector3Length(world.r[2]))));
+			float radius = 0.5f * std::sqrt(size.x * size.x + size.y * size.y + size.z * size.z) * scale;
+
+			XMVECTOR toCenter = center - XMVectorSet(position.x, position.y, position.z, 1.0f);
+			float distance = XMVectorGetX(XMVector3Length(toCenter));
+			if (distance <= radius)
+				return 1.0f;
+
+			// projection._22 = cot(fovY / 2): a / r[|[g̔PʂƂlɕς
+			return std::min(1.0f, radius * projection._22 / distance);
+		}
+	};
+
+	// L̕`pPbgɑ΂ 1 ̃J̃pX
+	struct RenderView
+	{
+		CameraSnapshot camera;
+		ViewportRect viewport;
+		// nullptr = obNobt@B`撆ɕ`XbhĂ悤ɂŎ
+		std::shared_ptr<RenderTarget> target;
+		bool clear = false;
+		Math::Color clearColor;
+
+		// ̃r[Ō RenderFrame::drawPackets ̔ԍB\[gL[̏ɕł
+		std::vector<uint32_t> queue;
+	};
+
+	// V~[VXbhŋ߂Cg̃p[^[
+	struct LightSnapshot
+	{
+		LightType type = LightType::Directional;
+		Math::Vector3 position;
+		Math::Vector3 direction;
+		Math::Color color;
+		float intensity = 1.0f;
+		float range = 10.0f;
+		float spotAngle = 45.0f;
+	};
+
+	// 1 ̃bV̑IAEgC
+	struct OutlinePacket
+	{
+		bool enabled = false;
+		Mesh* mesh = nullptr;
+		// RenderFrame::materials ł̔ԍ
+		uint32_t material = DrawPacket::kNoMaterial;
+		DirectX::XMFLOAT4X4 world;
+		Math::Color color;
+		float width = 0.0f;
+	};
+
+	// `Xbh 1 t[ɕKvȂׂ̂āB
+	// V~[VXbh߁An͓ǂݎpB
+	struct RenderFrame
+	{
+		uint64_t frameIndex = 0;
+		float time = 0.0f;
+		float deltaTime = 0.0f;
+
+		// views[0](Cr[)̃JBLOD ̑IƃNX^[JOɎg
+		CameraSnapshot camera;
+		// views[0, viewCount)BxN^[͐Lт邾Ȃ̂ŁAer[̃L[͗eʂۂ
+		static constexpr uint32_t kMaxViews = 32;
+		std::vector<RenderView> views;
+		uint32_t viewCount = 0;
+		std::vector<DrawPacket> drawPackets;
+		// pPbggׂẴ}eABt[Ƃ 1 Rs[B`Xbh͐Ă Material ǂ܂Ȃ
+		std::vector<MaterialSnapshot> materials;
+		// }eA ID -> materials ł̔ԍB̃t[Ŏ荞łȂ kNoMaterial
+		std::vector<uint32_t> materialSlots;
+		std::vector<IndexRange> indexRanges;
+		Meshlets::CullStats meshletStats;
+		OcclusionStats occlusionStats;
+		std::vector<LightSnapshot> lights;
+		// Cr[ɍ킹Aŏ̕s̃JXP[hBJXP[h 0  = eȂ
+		ShadowSettings shadowSettings;
+		ShadowCascade shadowCascades[ShadowCascades::kMaxCascades];
+		uint32_t shadowCascadeCount = 0;
+		// eJXP[h̃LX^[: r[̃L[Ɠ\[gL[̏ɕ drawPackets ̔ԍ
+		std::vector<uint32_t> shadowQueues[ShadowCascades::kMaxCascades];
+		OutlinePacket outline;
+		GizmoRenderState gizmo;
+		ImGuiDrawSnapshot ui;
+
+		// xN^[̗eʂcAt[ł͊mۂȂ悤ɂ
+		void Reset()
+		{
+			camera.valid = false;
+			for (uint32_t i = 0; i < viewCount; ++i)
+			{
+				views[i].queue.clear();
+				views[i].target.reset();
+			}
+			viewCount = 0;
+			drawPackets.clear();
+			for (const MaterialSnapshot& material : materials)
+			{
+				materialSlots[material.materialId] = DrawPacket::kNoMaterial;
+			}
+			materials.clear();
+			indexRanges.clear();
+			meshletStats = Meshlets::CullStats();
+			occlusionStats = OcclusionStats();
+			lights.clear();
+			for (uint32_t i = 0; i < shadowCascadeCount; ++i)
+			{
+				shadowQueues[i].clear();
+			}
+			shadowCascadeCount = 0;
+			outline.enabled = false;
+			outline.material = DrawPacket::kNoMaterial;
+			gizmo.visible = false;
+		}
+
+		// kMaxViews ̃r[g؂ nullptr
+		RenderView* AddView()
+		{
+			if (viewCount >= kMaxViews)
+				return nullptr;
+			if (viewCount == views.size())
+				views.emplace_back();
+			RenderView& view = views[viewCount++];
+			view.viewport = ViewportRect();
+			view.clear = false;
+			return &view;
+		}
+
+		// ̃t[ŏ߂ĎgƂɃ}eA̍̏ԂRs[Amaterials ł̔ԍԂB
+		// }eAҏWXbh(V~[VXbh)ĂԁBnullptr Ȃ kNoMaterial
+		uint32_t AddMaterial(const Material* material)
+		{
+			if (!material)
+				return DrawPacket::kNoMaterial;
+
+			uint32_t id = material->GetMaterialId();
+			if (id >= materialSlots.size())
+				materialSlots.resize(id + 1, DrawPacket::kNoMaterial);
+			if (materialSlots[id] == DrawPacket::kNoMaterial)
+			{
+				materialSlots[id] = static_cast<uint32_t>(materials.size());
+				materials.emplace_back();
+				material->ExtractSnapshot(materials.back());
+			}
+			return materialSlots[id];
+		}
+
+		void AddDrawPacket(Mesh* mesh, Material* material, Shader* shader, const DirectX::XMMATRIX& world,
+			const Math::AABB& worldBounds, uint32_t rangeOffset = 0, uint32_t rangeCount = 0)
+		{
+			DrawPacket packet;
+			// e[uΉ̃VF[_[̓}eAƂɃoChȂ̂ŁACX^VÔߓbVׂ荇킹
+			bool batchAcrossMaterials = shader && shader->GetMaterialTableVariant();
+			packet.sortKey = MakeSortKey(shader, material, mesh, batchAcrossMaterials);
+			packet.mesh = mesh;
+			packet.material = AddMaterial(material);
+			DirectX::XMStoreFloat4x4(&packet.world, world);
+			packet.bounds = worldBounds;
+			packet.rangeOffset = rangeOffset;
+			packet.rangeCount = rangeCount;
+			drawPackets.push_back(packet);
+		}
+
+		// bVbgJŃJOACfbNX͈̔͂ǉB
+		// ׂẴNX^[JOꂽ false(`̂Ȃ)B
+		// CfbNXׂ͈̔͂͂Ẵr[ŋL̂ŁAr[ 2 ȏȂ烁bVŜ`
+		bool CullMeshlets(const std::vector<Meshlet>& meshlets, const DirectX::XMMATRIX& world,
+			uint32_t& rangeOffset, uint32_t& rangeCount)
+		{
+			rangeOffset = static_cast<uint32_t>(indexRanges.size());
+			rangeCount = 0;
+			if (!camera.valid || viewCount > 1)
+				return true;
+
+			Meshlets::CullView view = Meshlets::MakeCullView(Math::Matrix4::FromXMMATRIX(world),
+				Math::Matrix4::FromXMMATRIX(DirectX::XMLoadFloat4x4(&camera.viewProjection)), camera.position);
+			rangeCount = static_cast<uint32_t>(Meshlets::Cull(meshlets, view, indexRanges, &meshletStats));
+			return rangeCount > 0;
+		}
+
+		// ׂẴpPbgׂẴr[̎(viewMask)ƃVhEJXP[h(casterMask) 1 ̃pXŔ肵A
+		// ɂgȂ̂𗎂ƂAc 1 \[gĊer[ƊeJXP[h̃L[𖄂߂B
+		// IN[WJO΁ACr[Ɍ钆 CPU ̃WIg傫ȃpPbg
+		// IN[_[ƂăX^CYǍɉBpPbg̓Cr[̃L[OB
+		// ǒɌĂ
+		void BuildViewQueues(OcclusionCuller* occlusionCuller = nullptr);
+
+		// Ԃ̕ύX炷߁ApPbgVF[_[A}eAAbV̏ɂ܂Ƃ߂B
+		// batchAcrossMaterials Ȃ烁bV}eAɂ
+		static uint64_t MakeSortKey(const Shader* shader, const Material* material, const Mesh* mesh,
+			bool batchAcrossMaterials = false)
+		{
+			auto fold = [](const void* ptr, int bits) -> uint64_t
+			{
+				uint64_t v = reinterpret_cast<uintptr_t>(ptr) >> 4;
+				v ^= v >> bits;
+				return v & ((1ull << bits) - 1);
+			};
+			if (batchAcrossMaterials)
+				return (fold(shader, 16) << 48) | (fold(mesh, 24) << 24) | fold(material, 24);
+			return (fold(shader, 16) << 48) | (fold(material, 24) << 24) | fold(mesh, 24);
+		}
+	};
+}
@@ -0,0 +1,251 @@
+/*****************************************************************//**
+ * \file   RenderStateTracker.cpp
+ * \brief  RenderStateTracker ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "RenderStateTracker.h"
+#include "Shader.h"
+
+namespace Falu
+{
+	namespace
+	{
+		// {̃C^[tF[X̃|C^ɂ͂ȂȂ̂ŁA킩ȂXbgւ̍ŏ̃oCh͕Kʂ
+		template<typename T>
+		T* UnknownBinding()
+		{
+			return reinterpret_cast<T*>(~uintptr_t(0));
+		}
+	}
+
+	RenderStateTracker::RenderStateTracker()
+		: m_context(nullptr)
+	{
+		Invalidate();
+	}
+
+	void RenderStateTracker::Reset(ID3D11DeviceContext* context)
+	{
+		if (context != m_context)
+		{
+			m_context = context;
+			m_context1.Reset();
+			if (m_context)
+			{
+				m_context->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(m_context1.GetAddressOf()));
+			}
+		}
+
+		Invalidate();
+		m_stats = BindStats();
+	}
+
+	void RenderStateTracker::Invalidate()
+	{
+		m_vertexShader = UnknownBinding<ID3D11VertexShader>();
+		m_pixelShader = UnknownBinding<ID3D11PixelShader>();
+		m_geometryShader = UnknownBinding<ID3D11GeometryShader>();
+		m_inputLayout = UnknownBinding<ID3D11InputLayout>();
+		m_vertexBuffer = UnknownBinding<ID3D11Buffer>();
+		m_vertexStride = 0;
+		m_vertexOffset = 0;
+		m_indexBuffer = UnknownBinding<ID3D11Buffer>();
+		m_indexFormat = DXGI_FORMAT_UNKNOWN;
+		m_indexOffset = 0;
+		m_topology = static_cast<D3D11_PRIMITIVE_TOPOLOGY>(-1);
+
+		for (auto& view : m_psShaderResources)
+			view = UnknownBinding<ID3D11ShaderResourceView>();
+		for (auto& sampler : m_psSamplers)
+			sampler = UnknownBinding<ID3D11SamplerState>();
+		for (auto& binding : m_vsConstantBuffers)
+			binding = { UnknownBinding<ID3D11Buffer>(), 0, 0 };
+		for (auto& binding : m_psConstantBuffers)
+			binding = { UnknownBinding<ID3D11Buffer>(), 0, 0 };
+
+		m_rasterizerState = UnknownBinding<ID3D11RasterizerState>();
+		m_depthStencilState = UnknownBinding<ID3D11DepthStencilState>();
+		m_stencilRef = 0;
+	}
+
+	//=== Shaders ===
+	void RenderStateTracker::SetShader(const Shader* shader, uint32_t vertexFormat)
+	{
+		if (!shader)
+			return;
+
+		if (shader->GetVertexShader())
+			SetVertexShader(shader->GetVertexShader());
+		if (shader->GetPixelShader())
+			SetPixelShader(shader->GetPixelShader());
+		if (shader->GetGeometryShader())
+			SetGeometryShader(shader->GetGeometryShader());
+		if (ID3D11InputLayout* layout = shader->GetInputLayout(vertexFormat))
+			SetInputLayout(layout);
+	}
+
+	void RenderStateTracker::SetVertexShader(ID3D11VertexShader* shader)
+	{
+		if (Track(m_vertexShader != shader))
+		{
+			m_context->VSSetShader(shader, nullptr, 0);
+			m_vertexShader = shader;
+		}
+	}
+
+	void RenderStateTracker::SetPixelShader(ID3D11PixelShader* shader)
+	{
+		if (Track(m_pixelShader != shader))
+		{
+			m_context->PSSetShader(shader, nullptr, 0);
+			m_pixelShader = shader;
+		}
+	}
+
+	void RenderStateTracker::SetGeometryShader(ID3D11GeometryShader* shader)
+	{
+		if (Track(m_geometryShader != shader))
+		{
+			m_context->GSSetShader(shader, nullptr, 0);
+			m_geometryShader = shader;
+		}
+	}
+
+	void RenderStateTracker::SetInputLayout(ID3D11InputLayout* layout)
+	{
+		if (Track(m_inputLayout != layout))
+		{
+			m_context->IASetInputLayout(layout);
+			m_inputLayout = layout;
+		}
+	}
+
+	//=== Resources ===
+	void RenderStateTracker::SetPSShaderResource(UINT slot, ID3D11ShaderResourceView* view)
+	{
+		if (slot >= kMaxShaderResources)
+		{
+			++m_stats.issued;
+			m_context->PSSetShaderResources(slot, 1, &view);
+			return;
+		}
+
+		if (Track(m_psShaderResources[slot] != view))
+		{
+			m_context->PSSetShaderResources(slot, 1, &view);
+			m_psShaderResources[slot] = view;
+		}
+	}
+
+	void RenderStateTracker::SetPSSampler(UINT slot, ID3D11SamplerState* sampler)
+	{
+		if (slot >= kMaxSamplers)
+		{
+			++m_stats.issued;
+			m_context->PSSetSamplers(slot, 1, &sampler);
+			return;
+		}
+
+		if (Track(m_psSamplers[slot] != sampler))
+		{
+			m_context->PSSetSamplers(slot, 1, &sampler);
+			m_psSamplers[slot] = sampler;
+		}
+	}
+
+	void RenderStateTracker::SetVSConstantBuffer(UINT slot, ID3D11Buffer* buffer, UINT firstConstant, UINT numConstants)
+	{
+		bool cached = slot < kMaxConstantBuffers;
+		if (cached)
+		{
+			const ConstantBufferBinding& current = m_vsConstantBuffers[slot];
+			if (!Track(current.buffer != buffer || current.firstConstant != firstConstant || current.numConstants != numConstants))
+				return;
+			m_vsConstantBuffers[slot] = { buffer, firstConstant, numConstants };
+		}
+		else
+		{
+			++m_stats.issued;
+		}
+
+		if (numConstants > 0 && m_context1)
+			m_context1->VSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants);
+		else
+			m_context->VSSetConstantBuffers(slot, 1, &buffer);
+	}
+
+	void RenderStateTracker::SetPSConstantBuffer(UINT slot, ID3D11Buffer* buffer, UINT firstConstant, UINT numConstants)
+	{
+		bool cached = slot < kMaxConstantBuffers;
+		if (cached)
+		{
+			const ConstantBufferBinding& current = m_psConstantBuffers[slot];
+			if (!Track(current.buffer != buffer || current.firstConstant != firstConstant || current.numConstants != numConstants))
+				return;
+			m_psConstantBuffers[slot] = { buffer, firstConstant, numConstants };
+		}
+		else
+		{
+			++m_stats.issued;
+		}
+
+		if (numConstants > 0 && m_context1)
+			m_context1->PSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants);
+		else
+			m_context->PSSetConstantBuffers(slot, 1, &buffer);
+	}
+
+	//=== Input assembler ===
+	void RenderStateTracker::SetVertexBuffer(ID3D11Buffer* buffer, UINT stride, UINT offset)
+	{
+		if (Track(m_vertexBuffer != buffer || m_vertexStride != stride || m_vertexOffset != offset))
+		{
+			m_context->IASetVertexBuffers(0, 1, &buffer, &stride, &offset);
+			m_vertexBuffer = buffer;
+			m_vertexStride = stride;
+			m_vertexOffset = offset;
+		}
+	}
+
+	void RenderStateTracker::SetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset)
+	{
+		if (Track(m_indexBuffer != buffer || m_indexFormat != format || m_indexOffset != offset))
+		{
+			m_context->IASetIndexBuffer(buffer, format, offset);
+			m_indexBuffer = buffer;
+			m_indexFormat = format;
+			m_indexOffset = offset;
+		}
+	}
+
+	void RenderStateTracker::SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		if (Track(m_topology != topology))
+		{
+			m_context->IASetPrimitiveTopology(topology);
+			m_topology = topology;
+		}
+	}
+
+	//=== Fixed function ===
+	void RenderStateTracker::SetRasterizerState(ID3D11RasterizerState* state)
+	{
+		if (Track(m_rasterizerState != state))
+		{
+			m_context->RSSetState(state);
+			m_rasterizerState = state;
+		}
+	}
+
+	void RenderStateTracker::SetDepthStencilState(ID3D11DepthStencilState* state, UINT stencilRef)
+	{
+		if (Track(m_depthStencilState != state || m_stencilRef != stencilRef))
+		{
+			m_context->OMSetDepthStencilState(state, stencilRef);
+			m_depthStencilState = state;
+			m_stencilRef = stencilRef;
+		}
+	}
+}
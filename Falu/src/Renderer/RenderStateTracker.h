@@ -0,0 +1,123 @@
+/*****************************************************************//**
+ * \file   RenderStateTracker.h
+ * \brief  d D3D11 ̌ĂяoȂ߂̃pCvC̃oCh̍T
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11_1.h>
+#include <wrl/client.h>
+#include <cstdint>
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	class Shader;
+
+	struct BindStats
+	{
+		uint32_t issued = 0;	// ReLXg܂œ͂Ăяo
+		uint32_t skipped = 0;	// Xbgɂl̂ŏȂĂяo
+
+		void Add(const BindStats& other)
+		{
+			issued += other.issued;
+			skipped += other.skipped;
+		}
+	};
+
+	// 1 ̃foCXReLXgɉoChĂ邩oAς̂nB
+	// ReLXgƂ 1 BXbhZ[tł͂ȂB
+	class RenderStateTracker
+	{
+	public:
+		static constexpr UINT kMaxShaderResources = 24;
+		static constexpr UINT kMaxSamplers = 4;
+		static constexpr UINT kMaxConstantBuffers = 8;
+
+		RenderStateTracker();
+
+		// context ̒ǐՂn߂BԂ͂킩Ȃ̂ƂĈAv͏
+		void Reset(ID3D11DeviceContext* context);
+
+		// LbVoChY(ExecuteCommandList ̌AgbJ[ʂɃoChƂȂ)
+		void Invalidate();
+
+		ID3D11DeviceContext* GetContext() const { return m_context; }
+		const BindStats& GetStats() const { return m_stats; }
+
+		//=== Shaders ===
+		// Shader::Bind Ɠ܂: VF[_[ȂXe[Wɂ͐GȂB
+		// ̓CAEg vertexFormat ɑ΂VF[_[̃CAEg(Shader::GetVertexVariant Q)
+		void SetShader(const Shader* shader, uint32_t vertexFormat = 0);
+		void SetVertexShader(ID3D11VertexShader* shader);
+		void SetPixelShader(ID3D11PixelShader* shader);
+		void SetGeometryShader(ID3D11GeometryShader* shader);
+		void SetInputLayout(ID3D11InputLayout* layout);
+
+		//=== Resources ===
+		void SetPSShaderResource(UINT slot, ID3D11ShaderResourceView* view);
+		void SetPSSampler(UINT slot, ID3D11SamplerState* sampler);
+
+		// numConstants == 0 Ȃobt@ŚAłȂ firstConstant n܂鑋oCh(D3D11.1)
+		void SetVSConstantBuffer(UINT slot, ID3D11Buffer* buffer, UINT firstConstant = 0, UINT numConstants = 0);
+		void SetPSConstantBuffer(UINT slot, ID3D11Buffer* buffer, UINT firstConstant = 0, UINT numConstants = 0);
+
+		//=== Input assembler ===
+		void SetVertexBuffer(ID3D11Buffer* buffer, UINT stride, UINT offset);
+		void SetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset);
+		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology);
+
+		//=== Fixed function ===
+		void SetRasterizerState(ID3D11RasterizerState* state);
+		void SetDepthStencilState(ID3D11DepthStencilState* state, UINT stencilRef);
+
+		bool SupportsConstantBufferOffsets() const { return m_context1 != nullptr; }
+
+	private:
+		struct ConstantBufferBinding
+		{
+			ID3D11Buffer* buffer;
+			UINT firstConstant;
+			UINT numConstants;
+		};
+
+		bool Track(bool changed)
+		{
+			if (changed)
+				++m_stats.issued;
+			else
+				++m_stats.skipped;
+			return changed;
+		}
+
+	private:
+		ID3D11DeviceContext* m_context;
+		ComPtr<ID3D11DeviceContext1> m_context1;
+
+		// g킩ȂXbgɂ͔ԕ̃|C^(Invalidate Q)
+		ID3D11VertexShader* m_vertexShader;
+		ID3D11PixelShader* m_pixelShader;
+		ID3D11GeometryShader* m_geometryShader;
+		ID3D11InputLayout* m_inputLayout;
+		ID3D11Buffer* m_vertexBuffer;
+		UINT m_vertexStride;
+		UINT m_vertexOffset;
+		ID3D11Buffer* m_indexBuffer;
+		DXGI_FORMAT m_indexFormat;
+		UINT m_indexOffset;
+		D3D11_PRIMITIVE_TOPOLOGY m_topology;
+		ID3D11ShaderResourceView* m_psShaderResources[kMaxShaderResources];
+		ID3D11SamplerState* m_psSamplers[kMaxSamplers];
+		ConstantBufferBinding m_vsConstantBuffers[kMaxConstantBuffers];
+		ConstantBufferBinding m_psConstantBuffers[kMaxConstantBuffers];
+		ID3D11RasterizerState* m_rasterizerState;
+		ID3D11DepthStencilState* m_depthStencilState;
+		UINT m_stencilRef;
+
+		BindStats m_stats;
+	};
+}
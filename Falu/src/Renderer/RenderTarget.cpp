@@ -0,0 +1,73 @@
+/*****************************************************************//**
+ * \file   RenderTarget.cpp
+ * \brief  RenderTarget ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "RenderTarget.h"
+
+namespace Falu
+{
+	RenderTarget::RenderTarget()
+		: m_width(0)
+		, m_height(0)
+	{
+
+	}
+
+	RenderTarget::~RenderTarget()
+	{
+
+	}
+
+	bool RenderTarget::Initialize(ID3D11Device* device, int width, int height, DXGI_FORMAT format)
+	{
+		if (!device || width <= 0 || height <= 0)
+			return false;
+
+		D3D11_TEXTURE2D_DESC colorDesc = {};
+		colorDesc.Width = width;
+		colorDesc.Height = height;
+		colorDesc.MipLevels = 1;
+		colorDesc.ArraySize = 1;
+		colorDesc.Format = format;
+		colorDesc.SampleDesc.Count = 1;
+		colorDesc.Usage = D3D11_USAGE_DEFAULT;
+		colorDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+		HRESULT hr = device->CreateTexture2D(&colorDesc, nullptr, &m_colorTexture);
+		if (FAILED(hr))
+		{
+			OutputDebugStringA("[RenderTarget] Failed to create color texture\n");
+			return false;
+		}
+
+		hr = device->CreateRenderTargetView(m_colorTexture.Get(), nullptr, &m_renderTargetView);
+		if (FAILED(hr))
+			return false;
+
+		hr = device->CreateShaderResourceView(m_colorTexture.Get(), nullptr, &m_shaderResourceView);
+		if (FAILED(hr))
+			return false;
+
+		D3D11_TEXTURE2D_DESC depthDesc = colorDesc;
+		depthDesc.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+		depthDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+
+		hr = device->CreateTexture2D(&depthDesc, nullptr, &m_depthTexture);
+		if (FAILED(hr))
+		{
+			OutputDebugStringA("[RenderTarget] Failed to create depth texture\n");
+			return false;
+		}
+
+		hr = device->CreateDepthStencilView(m_depthTexture.Get(), nullptr, &m_depthStencilView);
+		if (FAILED(hr))
+			return false;
+
+		m_width = width;
+		m_height = height;
+		return true;
+	}
+}
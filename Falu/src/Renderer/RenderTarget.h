@@ -0,0 +1,44 @@
+/*****************************************************************//**
+ * \file   RenderTarget.h
+ * \brief  _[r[`߂ItXN[̃J[ + [x^[Qbg
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <wrl/client.h>
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	// VF[_[\[XƂēǂ߂(ImGui::Image Ȃ)J[eNX`ƁAp̐[xobt@B
+	// foCXʂĂǂ̃Xbhł邪AoCĥ͕`Xbh
+	class RenderTarget
+	{
+	public:
+		RenderTarget();
+		~RenderTarget();
+
+		bool Initialize(ID3D11Device* device, int width, int height,
+			DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM);
+
+		ID3D11RenderTargetView* GetRenderTargetView() const { return m_renderTargetView.Get(); }
+		ID3D11DepthStencilView* GetDepthStencilView() const { return m_depthStencilView.Get(); }
+		ID3D11ShaderResourceView* GetShaderResourceView() const { return m_shaderResourceView.Get(); }
+		int GetWidth() const { return m_width; }
+		int GetHeight() const { return m_height; }
+
+	private:
+		ComPtr<ID3D11Texture2D> m_colorTexture;
+		ComPtr<ID3D11RenderTargetView> m_renderTargetView;
+		ComPtr<ID3D11ShaderResourceView> m_shaderResourceView;
+		ComPtr<ID3D11Texture2D> m_depthTexture;
+		ComPtr<ID3D11DepthStencilView> m_depthStencilView;
+
+		int m_width;
+		int m_height;
+	};
+}
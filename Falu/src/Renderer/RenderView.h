@@ -0,0 +1,42 @@
+/*****************************************************************//**
+ * \file   RenderView.h
+ * \brief  ǉ̃Jr[̋Lq(ʕAsN`[CsN`[AGfB^̃r[)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <memory>
+#include "Include/Math/MathHelper.h"
+
+namespace Falu
+{
+	class Camera;
+	class RenderTarget;
+
+	// ^[Qbg̑傫ɑ΂銄ŕ\r[|[gBEBhȆ傫̕ύXɒǏ]
+	struct ViewportRect
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+		float width = 1.0f;
+		float height = 1.0f;
+
+		ViewportRect() = default;
+		ViewportRect(float x, float y, float width, float height) :x(x), y(y), width(width), height(height) {}
+	};
+
+	// Scene ɓo^r[BJ̓t[oƂɃV~[VXbhœǂށB
+	// AXyNg̓r[|[gɍ킹Ă
+	struct RenderViewDesc
+	{
+		Camera* camera = nullptr;
+		ViewportRect viewport;
+		// nullptr ȂobNobt@ɕ`(Cr[̏ɏd˂)
+		std::shared_ptr<RenderTarget> target;
+		bool enabled = true;
+		bool clear = true;
+		Math::Color clearColor = Math::Color(0.1f, 0.1f, 0.3f, 1.0f);
+	};
+}
@@ -6,20 +6,51 @@
  * \date   2026/02/06
  *********************************************************************/
 #include "Renderer.h"
-#include "Camera.h"
 #include "Mesh.h"
 #include "Material.h"
 #include "Light.h"
 #include "Shader.h"
-#include "Scene/GameObject.h"
-#include "Scene/MeshRenderer.h"
+#include "RenderFrame.h"
+#include "MaterialTable.h"
+#include "RenderTarget.h"
+#include "ShadowMap.h"
+#include "DeferredCommandRecorder.h"
+#include "Falu/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 namespace Falu
 {
 	Renderer::Renderer()
-		:m_currentCamera(nullptr)
+		:m_bindsIssued(0)
+		,m_bindsSkipped(0)
+		,m_meshletCount(0)
+		,m_meshletsFrustumCulled(0)
+		,m_meshletsBackfaceCulled(0)
+		,m_clusterLightCount(0)
+		,m_clusterIndexCount(0)
+		,m_clusterMaxLights(0)
+		,m_shadowCasterDraws(0)
+		,m_occluderCount(0)
+		,m_occluderTriangles(0)
+		,m_occlusionTested(0)
+		,m_occlusionCulled(0)
+		,m_depthOnlyPass(false)
+		,m_usePerObjectRing(false)
+		,m_perObjectRingOffset(0)
+		,m_viewRenderTargetView(nullptr)
+		,m_viewDepthStencilView(nullptr)
+		,m_viewViewport()
+		,m_viewRasterizerState(nullptr)
+		,m_viewShadowMap(nullptr)
+		,m_outlineShader(nullptr)
 		,m_width(0)
 		,m_height(0)
+		,m_resizePending(false)
+		,m_pendingWidth(0)
+		,m_pendingHeight(0)
 	{
 
 	}
@@ -55,7 +86,10 @@ namespace Falu
 			return false;
 		if (!m_perFrameCB.Initialize(m_device.Get()))
 			return false;
-
+		if (!m_lightCB.Initialize(m_device.Get()))
+			return false;
+		if (!m_shadowCB.Initialize(m_device.Get()))
+			return false;
 
 		D3D11_RASTERIZER_DESC rasterizerDesc = {};
 		rasterizerDesc.FillMode = D3D11_FILL_SOLID;
@@ -75,6 +109,59 @@ namespace Falu
 		m_cullBackState = m_rasterizerState;
 
 		SetupViewport();
+
+		// R}hL^([J[ + `XbhDeferred Context)
+		if (m_settings.enableParallelRecording)
+		{
+			uint32_t maxChunks = JobSystem::GetInstance().GetWorkerCount() + 1;
+			auto recorder = std::make_unique<DeferredCommandRecorder>();
+			if (maxChunks > 1 && recorder->Initialize(m_device.Get(), m_context.Get(), maxChunks))
+			{
+				m_chunkStates.resize(maxChunks);
+				m_chunkPerObjectCBs.resize(maxChunks);
+				for (auto& perObjectCB : m_chunkPerObjectCBs)
+				{
+					if (!perObjectCB.Initialize(m_device.Get()))
+						return false;
+				}
+				m_commandRecorder = std::move(recorder);
+			}
+			else
+			{
+				OutputDebugStringA("[Renderer] WARNING: parallel recording disabled, drawing on the immediate context\n");
+			}
+		}
+
+		// Ή̃foCXł̓h[ƂMap̂܂
+		if (m_settings.enableConstantBufferRing)
+		{
+			if (!m_constantBufferRing.Initialize(m_device.Get(), m_context.Get(), m_settings.constantBufferRingSize))
+			{
+				OutputDebugStringA("[Renderer] WARNING: constant buffer ring unavailable, updating PerObject per draw\n");
+			}
+		}
+
+		// }eAe[u(Ȃ΃}eAƂ̃oCĥ܂)
+		auto materialTable = std::make_unique<MaterialTable>();
+		if (materialTable->Initialize(m_device.Get()))
+		{
+			m_materialTable = std::move(materialTable);
+		}
+		else
+		{
+			OutputDebugStringA("[Renderer] WARNING: material table unavailable\n");
+		}
+
+		// CgNX^[(Ȃ΃|Cg/X|bgCg͕`Ȃ)
+		auto lightClusterBuffers = std::make_unique<LightClusterBuffers>();
+		if (lightClusterBuffers->Initialize(m_device.Get()))
+		{
+			m_lightClusterBuffers = std::move(lightClusterBuffers);
+		}
+		else
+		{
+			OutputDebugStringA("[Renderer] WARNING: light cluster buffers unavailable\n");
+		}
 		return true;
 	}
 
@@ -85,12 +172,24 @@ namespace Falu
 			m_swapChain->SetFullscreenState(FALSE, nullptr);
 		}
 
+		m_commandRecorder.reset();
+		m_chunkPerObjectCBs.clear();
+		m_chunkStates.clear();
+		m_immediateState.Reset(nullptr);
+		m_constantBufferRing.Shutdown();
+		m_materialTable.reset();
+		m_lightClusterBuffers.reset();
+		m_shadowMap.reset();
+		m_viewShadowMap = nullptr;
+		m_outlineBuffer.Reset();
 		m_samplerState.Reset();
 		m_alphaBlendState.Reset();
 		m_wireframeState.Reset();
 		m_rasterizerState.Reset();
 		m_depthDisabledState.Reset();
 		m_depthStencilState.Reset();
+		m_overlayDepthStencilView.Reset();
+		m_overlayDepthBuffer.Reset();
 		m_depthStencilView.Reset();
 		m_depthStencilBuffer.Reset();
 		m_renderTargetView.Reset();
@@ -101,9 +200,28 @@ namespace Falu
 
 	void Renderer::OnResize(int width, int height)
 	{
+		// ŏ̓TCY0̂Ŗ
+		if (width <= 0 || height <= 0)
+			return;
+
+		m_pendingWidth.store(width, std::memory_order_relaxed);
+		m_pendingHeight.store(height, std::memory_order_relaxed);
+		m_resizePending.store(true, std::memory_order_release);
+	}
+
+	void Renderer::ApplyPendingResize()
+	{
+		if (!m_resizePending.exchange(false, std::memory_order_acq_rel))
+			return;
+
 		if (!m_device || !m_swapChain)
 			return;
 
+		int width = m_pendingWidth.load(std::memory_order_relaxed);
+		int height = m_pendingHeight.load(std::memory_order_relaxed);
+		if (width == m_width && height == m_height)
+			return;
+
 		m_width = width;
 		m_height = height;
 
@@ -112,6 +230,8 @@ namespace Falu
 		m_renderTargetView.Reset();
 		m_depthStencilView.Reset();
 		m_depthStencilBuffer.Reset();
+		m_overlayDepthStencilView.Reset();
+		m_overlayDepthBuffer.Reset();
 
 		// Xbv`F[̃TCY
 		HRESULT hr = m_swapChain->ResizeBuffers(0, width, height, DXGI_FORMAT_UNKNOWN, 0);
@@ -131,6 +251,11 @@ namespace Falu
 
 	void Renderer::BeginFrame()
 	{
+		ApplyPendingResize();
+
+		// GPUǂݏIÖ
+		m_constantBufferRing.BeginFrame();
+
 		float clearColor[4] = {
 			m_settings.clearColor.r,
 			m_settings.clearColor.g,
@@ -145,120 +270,771 @@ namespace Falu
 
 	void Renderer::EndFrame()
 	{
+		m_constantBufferRing.EndFrame();
+
 		UINT syncInterval = m_settings.enableVSync ? 1 : 0;
 		m_swapChain->Present(syncInterval, 0);
 	}
 
-	void Renderer::SetCamera(Camera* camera)
+	void Renderer::DrawFrame(const RenderFrame& frame)
 	{
-		m_currentCamera = camera;
+		if (!frame.camera.valid || frame.viewCount == 0)
+			return;
+
+		// CgA}eAAPerObject萔̓r[Ɉ˂Ȃ̂ŁASr[Ԃ1񂾂XV
+		UpdateLightConstants(frame);
+		PrepareMaterials(frame);
+		m_usePerObjectRing = UploadPerObjectConstants(frame);
+
+		// C~fBGCg̏ԂGizmo/ImGuiڐĜŖt[sƂĎn߂
+		m_immediateState.Reset(m_context.Get());
+
+		// e͑Sr[ŋL̂Őɕ`
+		BindStats bindStats;
+		RenderShadows(frame, bindStats);
+
+		for (uint32_t v = 0; v < frame.viewCount; ++v)
+		{
+			const RenderView& view = frame.views[v];
+			if (!BeginView(view, v == 0))
+				continue;
+
+			UpdateFrameConstants(frame, view.camera);
+			UpdateLightClusters(view, v == 0);
+			DrawViewQueue(frame, view.queue, bindStats);
+
+			// AEgC̓Cr[̐[xƃJŕ`
+			if (v == 0 && frame.outline.enabled)
+			{
+				RenderOutline(frame.outline, frame);
+			}
+		}
+
+		m_usePerObjectRing = false;
+
+		// Gizmo/ImGui ̓obNobt@Ŝɕ`̂ŁAo͐ƃr[|[g߂
+		m_context->OMSetRenderTargets(1, m_renderTargetView.GetAddressOf(), m_depthStencilView.Get());
+		SetupViewport();
+
+		bindStats.Add(m_immediateState.GetStats());
+		m_bindsIssued.store(bindStats.issued, std::memory_order_relaxed);
+		m_bindsSkipped.store(bindStats.skipped, std::memory_order_relaxed);
+		m_meshletCount.store(frame.meshletStats.meshletCount, std::memory_order_relaxed);
+		m_meshletsFrustumCulled.store(frame.meshletStats.frustumCulled, std::memory_order_relaxed);
+		m_meshletsBackfaceCulled.store(frame.meshletStats.backfaceCulled, std::memory_order_relaxed);
+		m_occluderCount.store(frame.occlusionStats.occluderCount, std::memory_order_relaxed);
+		m_occluderTriangles.store(frame.occlusionStats.triangleCount, std::memory_order_relaxed);
+		m_occlusionTested.store(frame.occlusionStats.testedCount, std::memory_order_relaxed);
+		m_occlusionCulled.store(frame.occlusionStats.culledCount, std::memory_order_relaxed);
 	}
 
-	void Renderer::RenderMesh(Mesh* mesh, Material* material, const DirectX::XMMATRIX& worldMatrix)
+	bool Renderer::BeginView(const RenderView& view, bool isMainView)
+	{
+		float targetWidth = static_cast<float>(m_width);
+		float targetHeight = static_cast<float>(m_height);
+
+		if (view.target)
+		{
+			if (!view.target->GetRenderTargetView())
+				return false;
+			m_viewRenderTargetView = view.target->GetRenderTargetView();
+			m_viewDepthStencilView = view.target->GetDepthStencilView();
+			targetWidth = static_cast<float>(view.target->GetWidth());
+			targetHeight = static_cast<float>(view.target->GetHeight());
+		}
+		else
+		{
+			m_viewRenderTargetView = m_renderTargetView.Get();
+			// obNobt@ɏd˂r[͕ʂ̐[xgACr[̐[x(AEgC/Gizmop)c
+			if (isMainView)
+			{
+				m_viewDepthStencilView = m_depthStencilView.Get();
+			}
+			else
+			{
+				if (!m_overlayDepthStencilView && !CreateOverlayDepthBuffer())
+					return false;
+				m_viewDepthStencilView = m_overlayDepthStencilView.Get();
+			}
+		}
+
+		m_viewRasterizerState = m_rasterizerState.Get();
+		m_viewViewport = {};
+		m_viewViewport.TopLeftX = view.viewport.x * targetWidth;
+		m_viewViewport.TopLeftY = view.viewport.y * targetHeight;
+		m_viewViewport.Width = view.viewport.width * targetWidth;
+		m_viewViewport.Height = view.viewport.height * targetHeight;
+		m_viewViewport.MinDepth = 0.0f;
+		m_viewViewport.MaxDepth = 1.0f;
+		if (m_viewViewport.Width < 1.0f || m_viewViewport.Height < 1.0f)
+			return false;
+
+		// Cr[̐[xBeginFrameŃNAς
+		if (!isMainView || view.target)
+		{
+			m_context->ClearDepthStencilView(m_viewDepthStencilView, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+		}
+
+		if (view.clear)
+		{
+			float clearColor[4] = { view.clearColor.r, view.clearColor.g, view.clearColor.b, view.clearColor.a };
+
+			// r[|[g̋`h(D3D11.1)BgȂ΃ItXN[̃^[QbgŜh
+			D3D11_RECT rect;
+			rect.left = static_cast<LONG>(m_viewViewport.TopLeftX);
+			rect.top = static_cast<LONG>(m_viewViewport.TopLeftY);
+			rect.right = static_cast<LONG>(m_viewViewport.TopLeftX + m_viewViewport.Width);
+			rect.bottom = static_cast<LONG>(m_viewViewport.TopLeftY + m_viewViewport.Height);
+
+			ComPtr<ID3D11DeviceContext1> context1;
+			if (SUCCEEDED(m_context->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(context1.GetAddressOf()))))
+				context1->ClearView(m_viewRenderTargetView, clearColor, &rect, 1);
+			else if (view.target)
+				m_context->ClearRenderTargetView(m_viewRenderTargetView, clearColor);
+		}
+		return true;
+	}
+
+	void Renderer::RenderShadows(const RenderFrame& frame, BindStats& bindStats)
 	{
-		if (!mesh || !material || !m_currentCamera)
-			return;
 		using namespace DirectX;
 
-		// PerFrame萔obt@̍XV
+		ShadowConstantBuffer constants = {};
+		uint32_t casterDraws = 0;
+		m_viewShadowMap = nullptr;
+
+		const ShadowSettings& settings = frame.shadowSettings;
+		uint32_t cascadeCount = frame.shadowCascadeCount;
+		if (cascadeCount > 0 && (!m_shadowMap || !m_shadowMap->Matches(settings.resolution, cascadeCount)))
+		{
+			// ȂΉeȂŕ`
+			auto shadowMap = std::make_unique<ShadowMap>();
+			if (shadowMap->Initialize(m_device.Get(), settings.resolution, cascadeCount))
+			{
+				m_shadowMap = std::move(shadowMap);
+			}
+			else
+			{
+				m_shadowMap.reset();
+				OutputDebugStringA("[Renderer] WARNING: shadow map unavailable\n");
+			}
+		}
+
+		if (cascadeCount > 0 && m_shadowMap)
+		{
+			// Õt[ŃVF[_[\[XƂĎh܂܂Ȃ̂ŁAOĂ[xƂď
+			m_immediateState.SetPSShaderResource(kShadowMapSlot, nullptr);
+
+			float resolution = static_cast<float>(settings.resolution);
+			m_viewRenderTargetView = nullptr;
+			m_viewRasterizerState = m_shadowMap->GetRasterizerState();
+			m_viewViewport = {};
+			m_viewViewport.Width = resolution;
+			m_viewViewport.Height = resolution;
+			m_viewViewport.MinDepth = 0.0f;
+			m_viewViewport.MaxDepth = 1.0f;
+
+			m_depthOnlyPass = true;
+			for (uint32_t c = 0; c < cascadeCount; ++c)
+			{
+				const ShadowCascade& cascade = frame.shadowCascades[c];
+				m_viewDepthStencilView = m_shadowMap->GetCascadeView(c);
+				m_context->ClearDepthStencilView(m_viewDepthStencilView, D3D11_CLEAR_DEPTH, 1.0f, 0);
+
+				// JXP[h̃CgԂJƂēn(Math::Matrix4  XMFLOAT4X4 ̓zu)
+				CameraSnapshot camera;
+				camera.valid = true;
+				memcpy(&camera.view, cascade.view.m, sizeof(camera.view));
+				memcpy(&camera.projection, cascade.projection.m, sizeof(camera.projection));
+				memcpy(&camera.viewProjection, cascade.viewProjection.m, sizeof(camera.viewProjection));
+				camera.frustum = cascade.frustum;
+				UpdateFrameConstants(frame, camera);
+
+				// LX^[BuildViewQueuesŃJXP[hƂɍi荞ݍς
+				DrawViewQueue(frame, frame.shadowQueues[c], bindStats);
+				casterDraws += static_cast<uint32_t>(frame.shadowQueues[c].size());
+
+				constants.cascadeViewProjection[c] = XMMatrixTranspose(XMLoadFloat4x4(&camera.viewProjection));
+				constants.cascadeParams[c] = XMFLOAT4(cascade.texelSize, cascade.splitNear, cascade.splitFar, 0.0f);
+			}
+			m_depthOnlyPass = false;
+
+			constants.params = XMFLOAT4(static_cast<float>(cascadeCount), 1.0f / resolution,
+				settings.depthBias, settings.normalOffset);
+			m_viewShadowMap = m_shadowMap->GetShaderResourceView();
+		}
+
+		m_shadowCB.Update(m_context.Get(), constants);
+		m_shadowCasterDraws.store(casterDraws, std::memory_order_relaxed);
+	}
+
+	void Renderer::DrawViewQueue(const RenderFrame& frame, const std::vector<uint32_t>& queue, BindStats& bindStats)
+	{
+		size_t drawCount = queue.size();
+		uint32_t chunkCount = GetChunkCount(drawCount);
+
+		if (chunkCount > 1)
+		{
+			// \[gς݃L[AԂɕĕɋL^ȀŎs
+			m_commandRecorder->Record(chunkCount, [&](uint32_t chunk, ID3D11DeviceContext* context)
+			{
+				size_t begin, end;
+				GetChunkRange(drawCount, chunk, chunkCount, begin, end);
+
+				// Deferred Context ͋̏ԂL^n܂
+				RenderStateTracker& state = m_chunkStates[chunk];
+				state.Reset(context);
+				RecordDrawChunk(state, m_chunkPerObjectCBs[chunk], frame, queue, begin, end);
+			});
+			m_commandRecorder->Execute();
+
+			for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+			{
+				bindStats.Add(m_chunkStates[chunk].GetStats());
+			}
+
+			// ExecuteCommandList(FALSE) ̓C~fBGCg̏ԂNÂŁALbV̂ĂĂ߂
+			m_immediateState.Invalidate();
+			BindFrameState(m_immediateState);
+		}
+		else
+		{
+			BindFrameState(m_immediateState);
+			RecordDrawChunk(m_immediateState, m_perObjectCB, frame, queue, 0, drawCount);
+		}
+	}
+
+	BindStats Renderer::GetLastFrameBindStats() const
+	{
+		BindStats stats;
+		stats.issued = m_bindsIssued.load(std::memory_order_relaxed);
+		stats.skipped = m_bindsSkipped.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	Meshlets::CullStats Renderer::GetLastFrameMeshletStats() const
+	{
+		Meshlets::CullStats stats;
+		stats.meshletCount = m_meshletCount.load(std::memory_order_relaxed);
+		stats.frustumCulled = m_meshletsFrustumCulled.load(std::memory_order_relaxed);
+		stats.backfaceCulled = m_meshletsBackfaceCulled.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	LightClusterStats Renderer::GetLastFrameLightClusterStats() const
+	{
+		LightClusterStats stats;
+		stats.lightCount = m_clusterLightCount.load(std::memory_order_relaxed);
+		stats.indexCount = m_clusterIndexCount.load(std::memory_order_relaxed);
+		stats.maxClusterLights = m_clusterMaxLights.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	uint32_t Renderer::GetLastFrameShadowCasterCount() const
+	{
+		return m_shadowCasterDraws.load(std::memory_order_relaxed);
+	}
+
+	OcclusionStats Renderer::GetLastFrameOcclusionStats() const
+	{
+		OcclusionStats stats;
+		stats.occluderCount = m_occluderCount.load(std::memory_order_relaxed);
+		stats.triangleCount = m_occluderTriangles.load(std::memory_order_relaxed);
+		stats.testedCount = m_occlusionTested.load(std::memory_order_relaxed);
+		stats.culledCount = m_occlusionCulled.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void Renderer::PrepareMaterials(const RenderFrame& frame)
+	{
+		// }eAe[uoR̕`̓ÕItZbgw(CX^XƂPerObject)O
+		bool useMaterialTable = m_materialTable && m_constantBufferRing.IsAvailable();
+
+		// ύX̂}eAAL^OɃC~fBGCgŏ
+		// (Deferred Context MapƁA`N̎sɂČÂlĂ܂)B
+		// l̓t[̎ʂAQ[Xbh̃}eA͓ǂ܂Ȃ
+		m_materialInTable.assign(frame.materials.size(), false);
+		for (size_t i = 0; i < frame.materials.size(); ++i)
+		{
+			const MaterialSnapshot& material = frame.materials[i];
+			if (useMaterialTable && material.shader && material.shader->GetMaterialTableVariant())
+			{
+				m_materialInTable[i] = m_materialTable->Update(m_context.Get(), material);
+			}
+
+			// OɍڂȂt[͏]̌oHŕ`̂ŁA萔obt@ŐVɂĂ
+			if (material.material)
+			{
+				material.material->UploadConstantBuffer(m_context.Get(), material);
+			}
+		}
+
+		if (useMaterialTable)
+		{
+			m_materialTable->Flush(m_context.Get());
+		}
+
+		m_drawMaterialIds.assign(frame.drawPackets.size(), kNoMaterialTable);
+		for (size_t i = 0; i < frame.drawPackets.size(); ++i)
+		{
+			const DrawPacket& packet = frame.drawPackets[i];
+			if (packet.material == DrawPacket::kNoMaterial || !packet.mesh || !m_materialInTable[packet.material])
+				continue;
+
+			// e[uŃVF[_[bV̒_``ȂƂ]̌oH
+			const MaterialSnapshot& material = frame.materials[packet.material];
+			if (material.shader->GetMaterialTableVariant()->GetVertexVariant(packet.mesh->GetVertexFormat()))
+			{
+				m_drawMaterialIds[i] = material.materialId;
+			}
+		}
+	}
+
+	bool Renderer::UploadPerObjectConstants(const RenderFrame& frame)
+	{
+		using namespace DirectX;
+
+		size_t drawCount = frame.drawPackets.size();
+		if (!m_constantBufferRing.IsAvailable() || drawCount == 0)
+			return false;
+
+		const uint32_t stride = ConstantBufferRing::kAlignment;
+		uint64_t size = (uint64_t)drawCount * stride;
+		if (size > m_constantBufferRing.GetCapacity())
+			return false;
+
+		uint8_t* data = static_cast<uint8_t*>(m_constantBufferRing.Map((uint32_t)size, m_perObjectRingOffset));
+		if (!data)
+			return false;
+
+		// tšvZd̂ŁAubNPʂŃ[J[ɕ
+		const uint32_t kDrawsPerBlock = 256;
+		uint32_t blockCount = (uint32_t)((drawCount + kDrawsPerBlock - 1) / kDrawsPerBlock);
+
+		JobSystem::GetInstance().ParallelFor(blockCount, [&](uint32_t block)
+		{
+			size_t begin = (size_t)block * kDrawsPerBlock;
+			size_t end = std::min(begin + kDrawsPerBlock, drawCount);
+			for (size_t i = begin; i < end; ++i)
+			{
+				const DrawPacket& packet = frame.drawPackets[i];
+				XMMATRIX world = XMLoadFloat4x4(&packet.world);
+
+				// ʎqʒu̓̕[hsɏݍ(@͗ʎqĂȂ̂ŋt]u͌̍s񂩂)
+				XMMATRIX positionWorld = world;
+				if (packet.mesh && packet.mesh->HasQuantizedPositions())
+					positionWorld = packet.mesh->GetPositionDequantization().ToXMMATRIX() * world;
+
+				PerObjectConstantBuffer perObject;
+				perObject.world = XMMatrixTranspose(positionWorld);
+				perObject.worldInvTranspose = XMMatrixTranspose(XMMatrixInverse(nullptr, world));
+				perObject.params = XMUINT4(m_drawMaterialIds[i] != kNoMaterialTable ? m_drawMaterialIds[i] : 0, 0, 0, 0);
+
+				// }bv͏݌Ȃ̂ŁA܂Ƃ߂1ŏ
+				memcpy(data + i * stride, &perObject, sizeof(PerObjectConstantBuffer));
+			}
+		});
+
+		m_constantBufferRing.Unmap();
+		return true;
+	}
+
+	void Renderer::UpdateFrameConstants(const RenderFrame& frame, const CameraSnapshot& camera)
+	{
+		using namespace DirectX;
+
+		// PerFrame萔obt@̍XV(r[EJXP[h)
 		PerFrameConstantBuffer perFrame;
-		perFrame.view = XMMatrixTranspose(m_currentCamera->GetViewMatrix());
-		perFrame.projection = XMMatrixTranspose(m_currentCamera->GetProjectionMatrix());
-		perFrame.viewProjection = XMMatrixTranspose(m_currentCamera->GetViewProjectionMatrix());
+		perFrame.view = XMMatrixTranspose(XMLoadFloat4x4(&camera.view));
+		perFrame.projection = XMMatrixTranspose(XMLoadFloat4x4(&camera.projection));
+		perFrame.viewProjection = XMMatrixTranspose(XMLoadFloat4x4(&camera.viewProjection));
 
-		Math::Vector3 camPos = m_currentCamera->GetTransform().GetPosition();
+		const Math::Vector3& camPos = camera.position;
 		perFrame.cameraPosition = XMFLOAT4(camPos.x, camPos.y, camPos.z, 1.0f);
 		perFrame.ambientLight = XMFLOAT4(0.2f, 0.2f, 0.2f, 1.0f);
-		perFrame.time = 0.0f;
-		perFrame.deltaTime = 0.0f;
+		perFrame.time = frame.time;
+		perFrame.deltaTime = frame.deltaTime;
 
 		m_perFrameCB.Update(m_context.Get(), perFrame);
-		m_perFrameCB.BindVS(m_context.Get(), 1);// register(b1)
-		m_perFrameCB.BindPS(m_context.Get(), 1);
-
-		// PerObject 萔̃obt@̍XV
-		PerObjectConstantBuffer perObject;
-		perObject.world = XMMatrixTranspose(worldMatrix);
-		XMMATRIX invWorld = XMMatrixInverse(nullptr, worldMatrix);
-		perObject.worldInvTranspose = XMMatrixTranspose(invWorld);
+	}
 
-		m_perObjectCB.Update(m_context.Get(), perObject);
-		m_perObjectCB.BindVS(m_context.Get(), 0);
+	void Renderer::UpdateLightConstants(const RenderFrame& frame)
+	{
+		using namespace DirectX;
 
-		// Light萔obt@̍XV
-		auto& lights = LightManager::GetInstance().GetLights();
-		if (!lights.empty() && lights[0]->IsEnabled())
+		// Light萔obt@̓fBNViCg(ŏ1)BȂ΋x0
+		const LightSnapshot* directional = nullptr;
+		for (const LightSnapshot& light : frame.lights)
 		{
-			Light* light = lights[0].get();
+			if (light.type == LightType::Directional)
+			{
+				directional = &light;
+				break;
+			}
+		}
 
-			LightConstantBuffer lightCB;
+		LightConstantBuffer lightCB = {};
+		if (directional)
+		{
+			const LightSnapshot& light = *directional;
 
 			// Cg̈ʒu
-			Math::Vector3 lightPos = light->GetTransform().GetPosition();
-			lightCB.lightPosition = XMFLOAT4(lightPos.x, lightPos.y, lightPos.z, 1.0f);
+			lightCB.lightPosition = XMFLOAT4(light.position.x, light.position.y, light.position.z, 1.0f);
 
 			// Cg̕
-			Math::Vector3 lightDir = light->GetTransform().GetForward();
-			lightCB.lightDirection = XMFLOAT4(lightDir.x, lightDir.y, lightDir.z, 0.0f);
+			lightCB.lightDirection = XMFLOAT4(light.direction.x, light.direction.y, light.direction.z, 0.0f);
 
 			// Cg̐F
-			Math::Color lightColor = light->GetColor();
 			lightCB.lightColor = XMFLOAT4(
-				lightColor.r,
-				lightColor.g,
-				lightColor.b,
-				lightColor.a
+				light.color.r,
+				light.color.g,
+				light.color.b,
+				light.color.a
 			);
 
 			// Cg̃p[^
 			lightCB.lightParam = XMFLOAT4(
-				light->GetIntensity(), // intensity
-				light->GetRange(), // range
-				(float)light->GetType(), // type
+				light.intensity, // intensity
+				light.range, // range
+				(float)light.type, // type
 				0.0f
 			);
+		}
+		m_lightCB.Update(m_context.Get(), lightCB);
+
+		if (!m_lightClusterBuffers)
+			return;
 
-			// 萔obt@XVăoCh
-			if (!m_lightCB.GetBuffer())
+		// |Cg/X|bgCg̓NX^[p̔z(Sr[)
+		m_clusterLights.clear();
+		for (const LightSnapshot& light : frame.lights)
+		{
+			if (light.type == LightType::Directional || light.range <= 0.0f || light.intensity <= 0.0f)
+				continue;
+
+			ClusterLight clusterLight;
+			clusterLight.position = light.position;
+			clusterLight.range = light.range;
+			clusterLight.direction = Math::Normalize(light.direction);
+			clusterLight.color = Math::Vector3(light.color.r, light.color.g, light.color.b) * light.intensity;
+			if (light.type == LightType::Spot)
 			{
-				m_lightCB.Initialize(m_device.Get());
+				// spotAngle ̓R[Ŝ̊px(x)B͊O8
+				float outer = XMConvertToRadians(std::min(light.spotAngle, 179.0f) * 0.5f);
+				clusterLight.cosOuter = std::cos(outer);
+				clusterLight.cosInner = std::cos(outer * 0.8f);
 			}
+			else
+			{
+				clusterLight.cosOuter = ClusterLight::kNoCone;
+				clusterLight.cosInner = ClusterLight::kNoCone;
+			}
+			m_clusterLights.push_back(clusterLight);
+		}
+		m_lightClusterBuffers->UploadLights(m_context.Get(), m_clusterLights);
+	}
+
+	void Renderer::UpdateLightClusters(const RenderView& view, bool isMainView)
+	{
+		if (!m_lightClusterBuffers)
+			return;
 
-			m_lightCB.Update(m_context.Get(), lightCB);
-			m_lightCB.BindVS(m_context.Get(), 3);
-			m_lightCB.BindPS(m_context.Get(), 3);
+		// CgȂΒ萔(Cg0)AVF[_[Ń[v΂
+		if (!m_clusterLights.empty())
+		{
+			// XMFLOAT4X4  Math::Matrix4 ̓zu
+			Math::Matrix4 viewMatrix;
+			Math::Matrix4 projectionMatrix;
+			memcpy(viewMatrix.m, &view.camera.view, sizeof(viewMatrix.m));
+			memcpy(projectionMatrix.m, &view.camera.projection, sizeof(projectionMatrix.m));
+			m_lightClusterGrid.Build(m_clusterLights.data(), static_cast<uint32_t>(m_clusterLights.size()),
+				viewMatrix, projectionMatrix);
 		}
+		m_lightClusterBuffers->UploadClusters(m_context.Get(), m_lightClusterGrid, m_viewViewport);
 
-		// }eÃoCh
-		material->Bind(m_context.Get());
+		if (isMainView)
+		{
+			LightClusterStats stats = m_clusterLights.empty() ? LightClusterStats() : m_lightClusterGrid.GetStats();
+			m_clusterLightCount.store(stats.lightCount, std::memory_order_relaxed);
+			m_clusterIndexCount.store(stats.indexCount, std::memory_order_relaxed);
+			m_clusterMaxLights.store(stats.maxClusterLights, std::memory_order_relaxed);
+		}
+	}
 
-		// bV̕`
-		mesh->Render(m_context.Get());
+	void Renderer::BindFrameState(RenderStateTracker& state)
+	{
+		ID3D11DeviceContext* context = state.GetContext();
+
+		// `撆̃r[̏o͐(BeginView / RenderShadowsŌ܂BVhEpX͐[x)
+		UINT renderTargetCount = m_viewRenderTargetView ? 1 : 0;
+		context->OMSetRenderTargets(renderTargetCount, renderTargetCount ? &m_viewRenderTargetView : nullptr, m_viewDepthStencilView);
+		context->RSSetViewports(1, &m_viewViewport);
+		state.SetRasterizerState(m_viewRasterizerState);
+		state.SetDepthStencilState(m_depthStencilState.Get(), 1);
+		state.SetPSSampler(0, m_samplerState.Get());
+
+		state.SetVSConstantBuffer(1, m_perFrameCB.GetBuffer());// register(b1)
+		state.SetPSConstantBuffer(1, m_perFrameCB.GetBuffer());
+		state.SetVSConstantBuffer(3, m_lightCB.GetBuffer());
+		state.SetPSConstantBuffer(3, m_lightCB.GetBuffer());
+		if (m_lightClusterBuffers)
+		{
+			m_lightClusterBuffers->Bind(state);
+		}
+
+		state.SetPSConstantBuffer(kShadowConstantSlot, m_shadowCB.GetBuffer());
+		state.SetPSShaderResource(kShadowMapSlot, m_viewShadowMap);
+		if (m_shadowMap)
+		{
+			state.SetPSSampler(kShadowSamplerSlot, m_shadowMap->GetComparisonSampler());
+		}
 	}
 
-	void Renderer::RenderOutline(GameObject* object, const Math::Color& color, float width)
+	void Renderer::RecordDrawChunk(RenderStateTracker& state, ConstantBuffer<PerObjectConstantBuffer>& perObjectCB,
+		const RenderFrame& frame, const std::vector<uint32_t>& queue, size_t begin, size_t end)
 	{
-		if (!object || !m_outlineShader)
+		ID3D11DeviceContext* context = state.GetContext();
+
+		// Null obNGh̓ReLXgȂ
+		if (!context)
+			return;
+
+		if (context != m_context.Get())
+		{
+			BindFrameState(state);
+		}
+
+		if (m_depthOnlyPass)
+		{
+			RecordDepthChunk(state, perObjectCB, frame, queue, begin, end);
 			return;
+		}
+
+		if (m_usePerObjectRing && state.SupportsConstantBufferOffsets())
+		{
+			ID3D11Buffer* ringBuffer = m_constantBufferRing.GetBuffer();
+			const UINT constantsPerDraw = ConstantBufferRing::kAlignment / ConstantBufferRing::kConstantSize;
+
+			size_t i = begin;
+			while (i < end)
+			{
+				uint32_t index = queue[i];
+				const DrawPacket& packet = frame.drawPackets[index];
+				if (!packet.mesh || packet.material == DrawPacket::kNoMaterial)
+				{
+					++i;
+					continue;
+				}
+				const MaterialSnapshot& material = frame.materials[packet.material];
+
+				// 萔̓Abv[hς(h[̔ԍ)Bh[ƂɃItZbgςăoCh邾
+				uint32_t offset = m_perObjectRingOffset + index * ConstantBufferRing::kAlignment;
+				UINT firstConstant = offset / ConstantBufferRing::kConstantSize;
+
+				if (m_drawMaterialIds[index] != kNoMaterialTable)
+				{
+					// VF[_[EbVԂ́A}eAĂ1̃CX^X`ɂ܂Ƃ߂
+					// (PerObject̓OŘAĂ̂ŁAԂԂ̑oChSV_InstanceIDň)
+					Shader* shader = material.shader;
+					size_t runEnd = i + 1;
+					// NX^JOh[̓CX^XƂɔ͈͂Ⴄ̂ł܂Ƃ߂ȂB
+					// ق̃r[Ɍh[Ԃɋ܂ƒ萔AȂ̂ŁAŐ؂
+					while (packet.rangeCount == 0 && runEnd < end && runEnd - i < kMaxInstancesPerBatch)
+					{
+						uint32_t nextIndex = queue[runEnd];
+						const DrawPacket& next = frame.drawPackets[nextIndex];
+						if (nextIndex != index + (runEnd - i) ||
+							next.mesh != packet.mesh || m_drawMaterialIds[nextIndex] == kNoMaterialTable ||
+							frame.materials[next.material].shader != shader || next.rangeCount != 0)
+							break;
+						++runEnd;
+					}
+
+					UINT instanceCount = (UINT)(runEnd - i);
+					uint32_t vertexFormat = packet.mesh->GetVertexFormat();
+					state.SetShader(shader->GetMaterialTableVariant()->GetVertexVariant(vertexFormat), vertexFormat);
+					m_materialTable->Bind(state);
+					state.SetVSConstantBuffer(0, ringBuffer, firstConstant, constantsPerDraw * instanceCount);
+					DrawPacketMesh(state, frame, packet, instanceCount);
+
+					i = runEnd;
+					continue;
+				}
+
+				state.SetVSConstantBuffer(0, ringBuffer, firstConstant, constantsPerDraw);
+				if (Material::Bind(state, material, packet.mesh->GetVertexFormat()))
+					DrawPacketMesh(state, frame, packet);
+				++i;
+			}
+			return;
+		}
 
+		// OgȂƂ(D3D11.1 ̒萔obt@̃ItZbgw肪ȂAOA܂͂̃t[
+		// h[OɎ܂Ȃ)́Ah[Ƃ PerObject  Map ]̌oHŕ`B
+		// ItZbgȂł͒萔̑点Ȃ̂ŁACX^Xł܂Ƃ߂`Ȃ(m̐B[xpX)
+		for (size_t i = begin; i < end; ++i)
+		{
+			const DrawPacket& packet = frame.drawPackets[queue[i]];
+			if (packet.material == DrawPacket::kNoMaterial)
+				continue;
+			const IndexRange* ranges = packet.rangeCount ? &frame.indexRanges[packet.rangeOffset] : nullptr;
+			RenderMesh(state, perObjectCB, packet.mesh, frame.materials[packet.material], DirectX::XMLoadFloat4x4(&packet.world),
+				ranges, packet.rangeCount);
+		}
+	}
+
+	void Renderer::RecordDepthChunk(RenderStateTracker& state, ConstantBuffer<PerObjectConstantBuffer>& perObjectCB,
+		const RenderFrame& frame, const std::vector<uint32_t>& queue, size_t begin, size_t end)
+	{
+		using namespace DirectX;
+
+		bool useRing = m_usePerObjectRing && state.SupportsConstantBufferOffsets();
+		ID3D11Buffer* ringBuffer = m_constantBufferRing.GetBuffer();
+		const UINT constantsPerDraw = ConstantBufferRing::kAlignment / ConstantBufferRing::kConstantSize;
+
+		size_t i = begin;
+		while (i < end)
+		{
+			uint32_t index = queue[i];
+			const DrawPacket& packet = frame.drawPackets[index];
+			Shader* shader = packet.material != DrawPacket::kNoMaterial ? frame.materials[packet.material].shader : nullptr;
+			if (!packet.mesh || !shader)
+			{
+				++i;
+				continue;
+			}
+			uint32_t vertexFormat = packet.mesh->GetVertexFormat();
+
+			size_t runEnd = i + 1;
+			const Shader* vertexShader = nullptr;
+			if (useRing)
+			{
+				uint32_t offset = m_perObjectRingOffset + index * ConstantBufferRing::kAlignment;
+				UINT firstConstant = offset / ConstantBufferRing::kConstantSize;
+
+				// e[uł̒_VF[_[͒萔̑SV_InstanceIDň̂ŁA
+				// bV΃}eAĂ܂Ƃ߂ĕ`
+				Shader* tableVariant = shader->GetMaterialTableVariant();
+				if (tableVariant)
+				{
+					while (runEnd < end && runEnd - i < kMaxInstancesPerBatch)
+					{
+						uint32_t nextIndex = queue[runEnd];
+						const DrawPacket& next = frame.drawPackets[nextIndex];
+						if (nextIndex != index + (runEnd - i) || next.mesh != packet.mesh ||
+							next.material == DrawPacket::kNoMaterial || frame.materials[next.material].shader != shader)
+							break;
+						++runEnd;
+					}
+					vertexShader = tableVariant->GetVertexVariant(vertexFormat);
+				}
+				else
+				{
+					vertexShader = shader->GetVertexVariant(vertexFormat);
+				}
+				state.SetVSConstantBuffer(0, ringBuffer, firstConstant, constantsPerDraw * (UINT)(runEnd - i));
+			}
+			else
+			{
+				// @͎gȂ̂World
+				PerObjectConstantBuffer perObject;
+				perObject.world = XMMatrixTranspose(packet.mesh->GetPositionDequantization().ToXMMATRIX() * XMLoadFloat4x4(&packet.world));
+				perObject.worldInvTranspose = XMMatrixIdentity();
+				perObject.params = XMUINT4(0, 0, 0, 0);
+				perObjectCB.Update(state.GetContext(), perObject);
+				state.SetVSConstantBuffer(0, perObjectCB.GetBuffer());
+				vertexShader = shader->GetVertexVariant(vertexFormat);
+			}
+
+			// bVbg͈̔͂̓J猩NX^Ȃ̂ŁAe̓bVŜ`
+			if (vertexShader)
+			{
+				state.SetShader(vertexShader, vertexFormat);
+				state.SetPixelShader(nullptr);
+				packet.mesh->Render(state, (UINT)(runEnd - i));
+			}
+			i = runEnd;
+		}
+	}
+
+	uint32_t Renderer::GetChunkCount(size_t drawCount) const
+	{
+		if (!m_commandRecorder)
+			return 1;
+		return CalculateChunkCount(drawCount, m_settings.minDrawsPerChunk, m_commandRecorder->GetMaxChunkCount());
+	}
+
+	void Renderer::RenderMesh(Mesh* mesh, const MaterialSnapshot& material, const DirectX::XMMATRIX& worldMatrix)
+	{
+		RenderMesh(m_immediateState, m_perObjectCB, mesh, material, worldMatrix);
+	}
+
+	void Renderer::DrawPacketMesh(RenderStateTracker& state, const RenderFrame& frame, const DrawPacket& packet, UINT instanceCount)
+	{
+		if (packet.rangeCount > 0)
+			packet.mesh->Render(state, &frame.indexRanges[packet.rangeOffset], packet.rangeCount);
+		else
+			packet.mesh->Render(state, instanceCount);
+	}
+
+	void Renderer::RenderMesh(RenderStateTracker& state, ConstantBuffer<PerObjectConstantBuffer>& perObjectCB,
+		Mesh* mesh, const MaterialSnapshot& material, const DirectX::XMMATRIX& worldMatrix,
+		const IndexRange* ranges, uint32_t rangeCount)
+	{
+		if (!mesh)
+			return;
 		using namespace DirectX;
 
-		auto meshRenderer = object->GetComponent<MeshRenderer>();
-		if (!meshRenderer)
+		ID3D11DeviceContext* context = state.GetContext();
+
+		// PerObject 萔̃obt@̍XV
+		PerObjectConstantBuffer perObject;
+		perObject.world = XMMatrixTranspose(mesh->GetPositionDequantization().ToXMMATRIX() * worldMatrix);
+		XMMATRIX invWorld = XMMatrixInverse(nullptr, worldMatrix);
+		perObject.worldInvTranspose = XMMatrixTranspose(invWorld);
+		perObject.params = XMUINT4(0, 0, 0, 0);
+
+		perObjectCB.Update(context, perObject);
+		state.SetVSConstantBuffer(0, perObjectCB.GetBuffer());
+
+		// }eÃoCh(萔UploadMaterialConstantsōXVς)
+		// VF[_[̒_``ȂΕ`Ȃ
+		if (!Material::Bind(state, material, mesh->GetVertexFormat()))
 			return;
 
-		auto mesh = meshRenderer->GetMesh();
-		auto material = meshRenderer->GetMaterial();
-		if (!mesh || !material)
+		// bV̕`
+		if (rangeCount > 0)
+			mesh->Render(state, ranges, rangeCount);
+		else
+			mesh->Render(state);
+	}
+
+	void Renderer::RenderOutline(const OutlinePacket& outline, const RenderFrame& frame)
+	{
+		if (!outline.mesh || outline.material == DrawPacket::kNoMaterial || !m_outlineShader)
 			return;
 
-		XMMATRIX worldMatrix = object->GetTransform().GetWorldMatrix();
-		RenderMesh(mesh.get(), material.get(), worldMatrix);
+		using namespace DirectX;
+
+		Mesh* mesh = outline.mesh;
+		const Math::Color& color = outline.color;
+		float width = outline.width;
+
+		XMMATRIX worldMatrix = XMLoadFloat4x4(&outline.world);
+		RenderMesh(mesh, frame.materials[outline.material], worldMatrix);
 
 		SetCullMode(D3D11_CULL_FRONT);
 
 		XMMATRIX scaleMatrix = XMMatrixScaling(1.0f + width, 1.0f + width, 1.0f + width);
-		XMMATRIX outlineWorld = scaleMatrix * worldMatrix;
+		XMMATRIX outlineWorld = mesh->GetPositionDequantization().ToXMMATRIX() * scaleMatrix * worldMatrix;
+
+		// AEgC͈ʒuǂ܂Ȃ̂ŁA_`Ƃ̃CAEgĂ΂̂܂ܕ`
+		ID3D11InputLayout* outlineLayout = m_outlineShader->GetInputLayout(mesh->GetVertexFormat());
+		if (!outlineLayout)
+		{
+			SetCullMode(D3D11_CULL_BACK);
+			return;
+		}
 
 		struct OutlineConstantBuffer
 		{
@@ -270,35 +1046,38 @@ namespace Falu
 		OutlineConstantBuffer cb;
 		XMStoreFloat4x4(&cb.world, XMMatrixTranspose(outlineWorld));
 		XMStoreFloat4x4(&cb.viewProjection,
-			XMMatrixTranspose(m_currentCamera->GetViewProjectionMatrix()));
+			XMMatrixTranspose(XMLoadFloat4x4(&frame.camera.viewProjection)));
 		cb.color = XMFLOAT4(color.r, color.g, color.b, color.a);
 
-		static ComPtr<ID3D11Buffer> outlineBuffer;
-		if (!outlineBuffer)
+		if (!m_outlineBuffer)
 		{
 			D3D11_BUFFER_DESC bufferDesc = {};
 			bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
 			bufferDesc.ByteWidth = sizeof(OutlineConstantBuffer);
 			bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 			bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-			m_device->CreateBuffer(&bufferDesc, nullptr, &outlineBuffer);
+			m_device->CreateBuffer(&bufferDesc, nullptr, &m_outlineBuffer);
 		}
 
 		D3D11_MAPPED_SUBRESOURCE mappedResource;
-		HRESULT hr = m_context->Map(outlineBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+		HRESULT hr = m_context->Map(m_outlineBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
 		if (SUCCEEDED(hr))
 		{
 			memcpy(mappedResource.pData, &cb, sizeof(OutlineConstantBuffer));
-			m_context->Unmap(outlineBuffer.Get(), 0);
+			m_context->Unmap(m_outlineBuffer.Get(), 0);
 		}
 		
 		m_outlineShader->Bind(m_context.Get());
-		m_context->VSSetConstantBuffers(0, 1, outlineBuffer.GetAddressOf());
-		m_context->PSSetConstantBuffers(0, 1, outlineBuffer.GetAddressOf());
+		m_context->IASetInputLayout(outlineLayout);
+		m_context->VSSetConstantBuffers(0, 1, m_outlineBuffer.GetAddressOf());
+		m_context->PSSetConstantBuffers(0, 1, m_outlineBuffer.GetAddressOf());
 
 		mesh->Render(m_context.Get());
 
 		SetCullMode(D3D11_CULL_BACK);
+
+		// gbJ[ʂɃVF[_[ƒ萔ς̂ŁALbV̂Ă
+		m_immediateState.Invalidate();
 	}
 
 	void Renderer::SetDepthTestEnabled(bool enabled)
@@ -404,6 +1183,28 @@ namespace Falu
 		return true;
 	}
 
+	bool Renderer::CreateOverlayDepthBuffer()
+	{
+		// obNobt@Ɠ`ETvŁAC̐[xƂ͕ʂɎ
+		D3D11_TEXTURE2D_DESC depthStencilDesc = {};
+		depthStencilDesc.Width = m_width;
+		depthStencilDesc.Height = m_height;
+		depthStencilDesc.MipLevels = 1;
+		depthStencilDesc.ArraySize = 1;
+		depthStencilDesc.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+		depthStencilDesc.SampleDesc.Count = m_settings.enableMSAA ? m_settings.msaaSampleCount : 1;
+		depthStencilDesc.SampleDesc.Quality = 0;
+		depthStencilDesc.Usage = D3D11_USAGE_DEFAULT;
+		depthStencilDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+
+		HRESULT hr = m_device->CreateTexture2D(&depthStencilDesc, nullptr, &m_overlayDepthBuffer);
+		if (FAILED(hr))
+			return false;
+
+		hr = m_device->CreateDepthStencilView(m_overlayDepthBuffer.Get(), nullptr, &m_overlayDepthStencilView);
+		return SUCCEEDED(hr);
+	}
+
 	bool Renderer::CreateDepthStencilStates()
 	{
 		// [xeXgL
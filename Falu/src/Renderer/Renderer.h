@@ -11,19 +11,32 @@
 #include <dxgi.h>
 #include <wrl/client.h>
 #include <memory>
+#include <atomic>
+#include <vector>
 #include "Include/Math/MathHelper.h"
 #include "Renderer/ConstantBuffer.h"
+#include "Renderer/CommandRecorder.h"
+#include "Renderer/ConstantBufferRing.h"
+#include "Renderer/RenderStateTracker.h"
+#include "Renderer/Meshlet.h"
+#include "Renderer/LightClusters.h"
+#include "Renderer/OcclusionCuller.h"
 
 namespace Falu
 {
 	using Microsoft::WRL::ComPtr;
 
 
-	class Camera;
 	class Mesh;
-	class Material;
+	struct MaterialSnapshot;
 	class Shader;
-	class GameObject;
+	class MaterialTable;
+	class ShadowMap;
+	struct RenderFrame;
+	struct RenderView;
+	struct CameraSnapshot;
+	struct OutlinePacket;
+	struct DrawPacket;
 
 	struct RenderSettings
 	{
@@ -31,6 +44,14 @@ namespace Falu
 		bool enableMSAA = false;
 		int msaaSampleCount = 4;
 		Math::Color clearColor = Math::Color(0.1f, 0.1f, 0.3f, 1.0f);
+
+		// `L[`Nɕă[J[XbhŋL^
+		bool enableParallelRecording = true;
+		int minDrawsPerChunk = 128;
+
+		// PerObject萔1{̑傫ȃobt@ɂ܂Ƃ߁At[Ƃ1񂾂Map(D3D11.1)
+		bool enableConstantBufferRing = true;
+		uint32_t constantBufferRingSize = 4 * 1024 * 1024;
 	};
 
 	class Renderer
@@ -41,18 +62,21 @@ namespace Falu
 
 		bool Initialize(HWND hWnd, int width, int height, const RenderSettings& settings);
 		void Shutdown();
+
+		// EBhEXbhĂ΂Bۂ̃TCY͎BeginFrameŕ`Xbhs
 		void OnResize(int width, int height);
 
+		//=== `Xbhp ===
 		void BeginFrame();
 		void EndFrame();
 
-		void SetCamera(Camera* camera);
-		void RenderMesh(Mesh* mesh, Material* material, const DirectX::XMMATRIX& worldMatrix);
+		// XibvVbgV[`(CuGameObjectɂ͐GȂ)
+		void DrawFrame(const RenderFrame& frame);
+		void RenderMesh(Mesh* mesh, const MaterialSnapshot& material, const DirectX::XMMATRIX& worldMatrix);
 
 		//=== Getters === 
 		ID3D11Device* GetDevice() const { return m_device.Get(); }
 		ID3D11DeviceContext* GetContext() const { return m_context.Get(); }
-		Camera* GetCamera() const { return m_currentCamera; }
 
 		int GetWidth() const { return m_width;}
 		int GetHeight() const { return m_height; }
@@ -62,7 +86,18 @@ namespace Falu
 		void SetOutlineShader(Shader* shader) { m_outlineShader = shader; }
 		Shader* GetOutlineShader()const { return m_outlineShader; }
 
-		void RenderOutline(GameObject* object, const Math::Color& color, float width);
+		void RenderOutline(const OutlinePacket& outline, const RenderFrame& frame);
+		// Oɕ`悵t[̃oCh(s/XLbv)Bǂ̃Xbhłǂ߂
+		BindStats GetLastFrameBindStats() const;
+		// Oɕ`悵t[̃bVbgJO
+		Meshlets::CullStats GetLastFrameMeshletStats() const;
+		// Oɕ`悵t[̃CgNX^[(ŏ̃r[)
+		LightClusterStats GetLastFrameLightClusterStats() const;
+		// Oɕ`悵t[̃VhELX^[̃h[(SJXP[h̍v)
+		uint32_t GetLastFrameShadowCasterCount() const;
+		// Oɕ`悵t[̃IN[WJO(Cr[)
+		OcclusionStats GetLastFrameOcclusionStats() const;
+
 		void SetDepthTestEnabled(bool enabled);
 		void SetCullMode(D3D11_CULL_MODE cullMode);
 
@@ -74,7 +109,41 @@ namespace Falu
 		bool CreateRasterizerStates();
 		bool CreateBlendStates();
 		bool CreateSamplerStates();
+		bool CreateOverlayDepthBuffer();
 		void SetupViewport();
+		void ApplyPendingResize();
+		// PerFrame萔(J)̓r[EJXP[hƁACg̓t[1
+		void UpdateFrameConstants(const RenderFrame& frame, const CameraSnapshot& camera);
+		void UpdateLightConstants(const RenderFrame& frame);
+		// r[̃NX^[Ƀ|Cg/X|bgCg蓖Ăđ(BeginView̌)
+		void UpdateLightClusters(const RenderView& view, bool isMainView);
+
+		// JXP[hƂɐ[x`AVhE萔XV(r[)
+		void RenderShadows(const RenderFrame& frame, BindStats& bindStats);
+
+		// r[̏o͐ƃr[|[g߂ăNAB`Ȃr[Ȃfalse
+		bool BeginView(const RenderView& view, bool isMainView);
+		// r[̃L[(drawPackets̔ԍ)L^Ďs
+		void DrawViewQueue(const RenderFrame& frame, const std::vector<uint32_t>& queue, BindStats& bindStats);
+
+		// Sh[PerObject萔OɏށBsh[ƂMapɖ߂
+		bool UploadPerObjectConstants(const RenderFrame& frame);
+		// }eA萔̍XVƃ}eAe[uւ̓o^(`悲ƂID߂)
+		void PrepareMaterials(const RenderFrame& frame);
+
+		// Deferred Context ł͏ԂpȂ̂ŁA`NƂɐݒ肵
+		void BindFrameState(RenderStateTracker& state);
+		void RecordDrawChunk(RenderStateTracker& state, ConstantBuffer<PerObjectConstantBuffer>& perObjectCB,
+			const RenderFrame& frame, const std::vector<uint32_t>& queue, size_t begin, size_t end);
+		// [x̃pXBsNZVF[_[ȂŁA}eAĂbV͂܂Ƃ߂ĕ`
+		void RecordDepthChunk(RenderStateTracker& state, ConstantBuffer<PerObjectConstantBuffer>& perObjectCB,
+			const RenderFrame& frame, const std::vector<uint32_t>& queue, size_t begin, size_t end);
+		void RenderMesh(RenderStateTracker& state, ConstantBuffer<PerObjectConstantBuffer>& perObjectCB,
+			Mesh* mesh, const MaterialSnapshot& material, const DirectX::XMMATRIX& worldMatrix,
+			const IndexRange* ranges = nullptr, uint32_t rangeCount = 0);
+		// rangeCount > 0 ȂJOŎcCfbNX͈͂`
+		void DrawPacketMesh(RenderStateTracker& state, const RenderFrame& frame, const DrawPacket& packet, UINT instanceCount = 1);
+		uint32_t GetChunkCount(size_t drawCount) const;
 
 	private:
 		ComPtr<ID3D11Device> m_device;
@@ -98,12 +167,76 @@ namespace Falu
 		ConstantBuffer<PerFrameConstantBuffer> m_perFrameCB;
 
 		ConstantBuffer<LightConstantBuffer> m_lightCB;
+		ConstantBuffer<ShadowConstantBuffer> m_shadowCB;
+
+		// L^
+		std::unique_ptr<ICommandRecorder> m_commandRecorder;
+		std::vector<ConstantBuffer<PerObjectConstantBuffer>> m_chunkPerObjectCBs;// `NƂPerObject
+
+		// doCh̏(ReLXgƂ1)
+		RenderStateTracker m_immediateState;
+		std::vector<RenderStateTracker> m_chunkStates;
+		std::atomic<uint32_t> m_bindsIssued;
+		std::atomic<uint32_t> m_bindsSkipped;
+		std::atomic<uint32_t> m_meshletCount;
+		std::atomic<uint32_t> m_meshletsFrustumCulled;
+		std::atomic<uint32_t> m_meshletsBackfaceCulled;
+		std::atomic<uint32_t> m_clusterLightCount;
+		std::atomic<uint32_t> m_clusterIndexCount;
+		std::atomic<uint32_t> m_clusterMaxLights;
+		std::atomic<uint32_t> m_shadowCasterDraws;
+		std::atomic<uint32_t> m_occluderCount;
+		std::atomic<uint32_t> m_occluderTriangles;
+		std::atomic<uint32_t> m_occlusionTested;
+		std::atomic<uint32_t> m_occlusionCulled;
+
+		// }eAe[uBm_drawMaterialIds[i] ̓h[iID(kNoMaterialTableȂ]̃oCh)
+		static constexpr uint32_t kNoMaterialTable = UINT32_MAX;
+		static constexpr size_t kMaxInstancesPerBatch = 256;// 64KB̒萔obt@ / 256B
+		// Basic.hlsl  ShadowMap(t16) / ShadowSampler(s1) / ShadowBuffer(b5)
+		static constexpr UINT kShadowMapSlot = 16;
+		static constexpr UINT kShadowSamplerSlot = 1;
+		static constexpr UINT kShadowConstantSlot = 5;
+		std::unique_ptr<MaterialTable> m_materialTable;
+		std::vector<uint32_t> m_drawMaterialIds;
+		// RenderFrame::materials[i] e[uɍڂ(PrepareMaterials Ō߂)
+		std::vector<bool> m_materialInTable;
+
+		// NX^[hCeBO(Ȃ΃fBNViCg)
+		std::unique_ptr<LightClusterBuffers> m_lightClusterBuffers;
+		LightClusterGrid m_lightClusterGrid;
+		std::vector<ClusterLight> m_clusterLights;
+
+		// VhE}bv(JXP[hE𑜓xς蒼)
+		std::unique_ptr<ShadowMap> m_shadowMap;
+		bool m_depthOnlyPass;
+
+		// PerObject萔̃O(h[i m_perObjectRingOffset + i * kAlignment)
+		ConstantBufferRing m_constantBufferRing;
+		bool m_usePerObjectRing;
+		uint32_t m_perObjectRingOffset;
 
-		Camera* m_currentCamera;
 		RenderSettings m_settings;
+		// `撆̃r[̏o͐BBindFrameState ReLXgƂɐݒ肷
+		ID3D11RenderTargetView* m_viewRenderTargetView;
+		ID3D11DepthStencilView* m_viewDepthStencilView;
+		D3D11_VIEWPORT m_viewViewport;
+		ID3D11RasterizerState* m_viewRasterizerState;
+		// VhEpX͏ݐȂ̂nullptr
+		ID3D11ShaderResourceView* m_viewShadowMap;
+		// obNobt@ɏd˂2ڈȍ~̃r[p̐[x(KvɂȂƂɍ)
+		ComPtr<ID3D11Texture2D> m_overlayDepthBuffer;
+		ComPtr<ID3D11DepthStencilView> m_overlayDepthStencilView;
+
 		Shader* m_outlineShader;
+		ComPtr<ID3D11Buffer> m_outlineBuffer;
 
 		int m_width;
 		int m_height;
+
+		// OnResize̗v(`XbhœKp)
+		std::atomic<bool> m_resizePending;
+		std::atomic<int> m_pendingWidth;
+		std::atomic<int> m_pendingHeight;
 	};
 }
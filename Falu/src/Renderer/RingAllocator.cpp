@@ -0,0 +1,108 @@
+/*****************************************************************//**
+ * \file   RingAllocator.cpp
+ * \brief  RingAllocator ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "RingAllocator.h"
+
+namespace Falu
+{
+	namespace
+	{
+		uint64_t AlignUp(uint64_t value, uint64_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+	}
+
+	RingAllocator::RingAllocator()
+		: RingAllocator(0, 1)
+	{
+	}
+
+	RingAllocator::RingAllocator(uint64_t capacity, uint64_t alignment)
+	{
+		Reset(capacity, alignment);
+	}
+
+	void RingAllocator::Reset(uint64_t capacity, uint64_t alignment)
+	{
+		m_alignment = (alignment > 0) ? alignment : 1;
+		m_capacity = capacity / m_alignment * m_alignment;
+		m_head = 0;
+		m_tail = 0;
+		m_usedSize = 0;
+		m_currentFrameSize = 0;
+		m_frames.clear();
+	}
+
+	uint64_t RingAllocator::Allocate(uint64_t size)
+	{
+		size = AlignUp(size, m_alignment);
+		if (size == 0 || m_usedSize + size > m_capacity)
+			return kInvalidOffset;
+
+		if (m_head >= m_tail)
+		{
+			// gp: [tail, head)  : [head, capacity) + [0, tail)
+			if (m_head + size <= m_capacity)
+			{
+				uint64_t offset = m_head;
+				m_head += size;
+				m_usedSize += size;
+				m_currentFrameSize += size;
+				return offset;
+			}
+
+			// 擪ɖ߂BO̎ĉ͎Ă
+			if (size <= m_tail)
+			{
+				uint64_t padding = m_capacity - m_head;
+				m_head = size;
+				m_usedSize += padding + size;
+				m_currentFrameSize += padding + size;
+				return 0;
+			}
+		}
+		else if (m_head + size <= m_tail)
+		{
+			// gp: [tail, capacity) + [0, head)  : [head, tail)
+			uint64_t offset = m_head;
+			m_head += size;
+			m_usedSize += size;
+			m_currentFrameSize += size;
+			return offset;
+		}
+
+		return kInvalidOffset;
+	}
+
+	void RingAllocator::FinishFrame(uint64_t fenceValue)
+	{
+		if (m_currentFrameSize == 0)
+			return;
+
+		m_frames.push_back({ fenceValue, m_head, m_currentFrameSize });
+		m_currentFrameSize = 0;
+	}
+
+	void RingAllocator::Retire(uint64_t completedFenceValue)
+	{
+		while (!m_frames.empty() && m_frames.front().fenceValue <= completedFenceValue)
+		{
+			const FrameMarker& frame = m_frames.front();
+			m_tail = frame.head;
+			m_usedSize -= frame.size;
+			m_frames.pop_front();
+		}
+
+		// ̂̂Ȃ̂ŁA͈͂A悤ɐ擪蒼
+		if (m_usedSize == 0 && m_currentFrameSize == 0)
+		{
+			m_head = 0;
+			m_tail = 0;
+		}
+	}
+}
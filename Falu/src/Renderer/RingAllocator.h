@@ -0,0 +1,63 @@
+/*****************************************************************//**
+ * \file   RingAllocator.h
+ * \brief  tFXt̃OAP[^[(foCXɈˑȂItZbg̊Ǘ)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <deque>
+
+namespace Falu
+{
+	// ŒTCỸOAACA͈͂𕥂oB
+	// mۂ̓t[Ƃɂ܂Ƃ߁At[̗̈͂̃tFX̒l
+	// Retire() ŊƓ`ꂽB
+	class RingAllocator
+	{
+	public:
+		static constexpr uint64_t kInvalidOffset = ~0ull;
+
+		RingAllocator();
+		RingAllocator(uint64_t capacity, uint64_t alignment);
+
+		void Reset(uint64_t capacity, uint64_t alignment);
+
+		// OɘA󂫂Ȃ kInvalidOffset ԂB
+		// ͈͂ȌI܂Ƃ͂ȂB΂͍̃t[̕ɐB
+		uint64_t Allocate(uint64_t size);
+
+		// ̃t[̊mۂ fenceValue(P)Œ߂
+		void FinishFrame(uint64_t fenceValue);
+
+		// tFX̒l completedFenceValue ȉ̃t[ׂĉ
+		void Retire(uint64_t completedFenceValue);
+
+		// ܂̈ĂԌÂt[̃tFX(Ȃ 0)
+		uint64_t GetOldestPendingFence() const { return m_frames.empty() ? 0 : m_frames.front().fenceValue; }
+
+		uint64_t GetCapacity() const { return m_capacity; }
+		uint64_t GetAlignment() const { return m_alignment; }
+		uint64_t GetUsedSize() const { return m_usedSize; }
+		bool IsEmpty() const { return m_usedSize == 0; }
+		bool IsFull() const { return m_usedSize == m_capacity; }
+
+	private:
+		struct FrameMarker
+		{
+			uint64_t fenceValue;
+			uint64_t head;		// t[߂Ƃ̃O head
+			uint64_t size;		// t[̕ɐoCg(܂Ԃ̋lߕ܂)
+		};
+
+		uint64_t m_capacity;
+		uint64_t m_alignment;
+		uint64_t m_head;				// ̊mۈʒu
+		uint64_t m_tail;				// ԌÂgp̃oCg
+		uint64_t m_usedSize;
+		uint64_t m_currentFrameSize;
+		std::deque<FrameMarker> m_frames;
+	};
+}
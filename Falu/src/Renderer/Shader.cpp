@@ -12,8 +12,9 @@
 namespace Falu
 {
 	Shader::Shader()
+		:m_materialTableVariant(nullptr)
 	{
-
+		m_vertexVariants.fill(nullptr);
 	}
 
 	Shader::~Shader()
@@ -84,6 +85,57 @@ namespace Falu
 		return SUCCEEDED(hr);
 	}
 
+	bool Shader::CreateInputLayout(ID3D11Device* device, uint32_t vertexFormat)
+	{
+		if (!m_vertexShaderBlob || !VertexFormat::IsValid(vertexFormat))
+			return false;
+
+		D3D11_INPUT_ELEMENT_DESC elements[VertexFormat::kMaxElements];
+		UINT count = VertexFormat::GetInputElements(vertexFormat, elements);
+
+		ComPtr<ID3D11InputLayout> layout;
+		HRESULT hr = device->CreateInputLayout(
+			elements,
+			count,
+			m_vertexShaderBlob->GetBufferPointer(),
+			m_vertexShaderBlob->GetBufferSize(),
+			&layout
+		);
+		if (FAILED(hr))
+			return false;
+
+		m_formatLayouts[vertexFormat] = layout;
+		if (vertexFormat == VertexFormat::Standard && !m_inputLayout)
+			m_inputLayout = layout;
+		return true;
+	}
+
+	ID3D11InputLayout* Shader::GetInputLayout(uint32_t vertexFormat) const
+	{
+		if (vertexFormat == VertexFormat::Standard)
+			return m_inputLayout.Get();
+		return (vertexFormat < VertexFormat::kCount) ? m_formatLayouts[vertexFormat].Get() : nullptr;
+	}
+
+	const Shader* Shader::GetVertexVariant(uint32_t vertexFormat) const
+	{
+		// ͂ʒũVF[_[(AEgCȂ)́AŃCAEgĂ΂̂܂ܕ`
+		if (vertexFormat == VertexFormat::Standard || GetInputLayout(vertexFormat))
+			return this;
+
+		const Shader* variant = m_vertexVariants[VertexFormat::GetShaderVariant(vertexFormat)];
+		if (variant && variant->GetInputLayout(vertexFormat))
+			return variant;
+		return nullptr;
+	}
+
+	bool Shader::SupportsVertexFormat(uint32_t vertexFormat) const
+	{
+		if (!GetVertexVariant(vertexFormat))
+			return false;
+		return !m_materialTableVariant || m_materialTableVariant->SupportsVertexFormat(vertexFormat);
+	}
+
 	void Shader::Bind(ID3D11DeviceContext* context)
 	{
 		if (m_vertexShader)
@@ -170,7 +222,7 @@ namespace Falu
 		static ShaderManager Instance;
 		return Instance;
 	}
-	Shader* ShaderManager::LoadShader(ID3D11Device* device, const std::string& name, const std::wstring& vsFile, const std::wstring& psFile, const D3D11_INPUT_ELEMENT_DESC* layout, UINT numElements)
+	Shader* ShaderManager::LoadShader(ID3D11Device* device, const std::string& name, const std::wstring& vsFile, const std::wstring& psFile, const D3D11_INPUT_ELEMENT_DESC* layout, UINT numElements, const std::vector<ShaderDefine>& defines)
 	{
 		// łɓǂݍ܂Ă邩mF
 		auto it = m_shaders.find(name);
@@ -183,10 +235,10 @@ namespace Falu
 		// ȂVVF[_[쐬
 		auto shader = std::make_unique<Shader>();
 		// VertexShader
-		if (!shader->LoadVertexShader(device, vsFile))
+		if (!shader->LoadVertexShader(device, vsFile, defines))
 			return nullptr;
 		// PixelShader
-		if (!shader->LoadPixelShader(device, psFile))
+		if (!shader->LoadPixelShader(device, psFile, defines))
 			return nullptr;
 		
 		if (layout && numElements > 0)
@@ -199,6 +251,49 @@ namespace Falu
 		m_shaders[name] = std::move(shader);
 		return ptr;
 	}
+
+	bool ShaderManager::LoadVertexVariants(ID3D11Device* device, Shader* base, const std::string& name, const std::wstring& vsFile, const std::wstring& psFile, const std::vector<ShaderDefine>& defines)
+	{
+		if (!base)
+			return false;
+
+		struct VariantInfo
+		{
+			VertexFormat::ShaderVariant variant;
+			const char* suffix;
+			bool color;
+		};
+		const VariantInfo variants[] =
+		{
+			{ VertexFormat::CompactVariant, "_Compact", false },
+			{ VertexFormat::CompactColorVariant, "_CompactColor", true },
+		};
+
+		for (const VariantInfo& info : variants)
+		{
+			std::vector<ShaderDefine> variantDefines = defines;
+			variantDefines.push_back({ "COMPACT_VERTEX", "1" });
+			if (info.color)
+				variantDefines.push_back({ "VERTEX_COLOR", "1" });
+
+			// CAEg͒_`ƂɌォ
+			Shader* shader = LoadShader(device, name + info.suffix, vsFile, psFile, nullptr, 0, variantDefines);
+			if (!shader)
+				return false;
+
+			for (uint32_t format = 0; format < VertexFormat::kCount; ++format)
+			{
+				if (!VertexFormat::IsValid(format) || VertexFormat::GetShaderVariant(format) != info.variant)
+					continue;
+				if (!shader->CreateInputLayout(device, format))
+					return false;
+			}
+
+			base->SetVertexVariant(info.variant, shader);
+		}
+
+		return true;
+	}
 	Shader* ShaderManager::GetShader(const std::string& name)
 	{
 		auto it = m_shaders.find(name);
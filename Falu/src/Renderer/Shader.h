@@ -15,6 +15,8 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <array>
+#include "Renderer/VertexFormat.h"
 
 namespace Falu
 {
@@ -42,6 +44,8 @@ namespace Falu
 
 		bool CreateInputLayout(ID3D11Device* device, 
 			const D3D11_INPUT_ELEMENT_DESC* layout, UINT numElements);
+		// VertexFormat p̃CAEg(_VF[_[̓͂Ă邱)
+		bool CreateInputLayout(ID3D11Device* device, uint32_t vertexFormat);
 
 		void Bind(ID3D11DeviceContext* context);
 		void Unbind(ID3D11DeviceContext* context);
@@ -50,6 +54,19 @@ namespace Falu
 		ID3D11PixelShader* GetPixelShader() const { return m_pixelShader.Get(); }
 		ID3D11GeometryShader* GetGeometryShader() const { return m_geometryShader.Get(); }
 		ID3D11InputLayout* GetInputLayput() const { return m_inputLayout.Get(); }
+		// Standard ͒ʏ̃CAEgAȊO CreateInputLayout(device, format) ō
+		ID3D11InputLayout* GetInputLayout(uint32_t vertexFormat) const;
+
+		// COMPACT_VERTEX tŃRpCVF[_[
+		void SetVertexVariant(VertexFormat::ShaderVariant variant, Shader* shader) { m_vertexVariants[variant] = shader; }
+		// ̒_``VF[_[(g_oAg)B`Ȃ nullptr
+		const Shader* GetVertexVariant(uint32_t vertexFormat) const;
+		// }eAe[uł܂߂āA̒_``邩
+		bool SupportsVertexFormat(uint32_t vertexFormat) const;
+
+		// MATERIAL_TABLE tŃRpCVF[_[(}eAe[uoR̕`Ŏg)
+		void SetMaterialTableVariant(Shader* variant) { m_materialTableVariant = variant; }
+		Shader* GetMaterialTableVariant() const { return m_materialTableVariant; }
 
 	private:
 		bool CompileFromFile(const std::wstring& filename, const char* entryPoint,
@@ -62,6 +79,9 @@ namespace Falu
 		ComPtr<ID3D11GeometryShader> m_geometryShader;
 		ComPtr<ID3D11InputLayout> m_inputLayout;
 		ComPtr<ID3DBlob> m_vertexShaderBlob;
+		Shader* m_materialTableVariant;
+		std::array<ComPtr<ID3D11InputLayout>, VertexFormat::kCount> m_formatLayouts;
+		std::array<Shader*, VertexFormat::ShaderVariantCount> m_vertexVariants;
 	};
 
 	class ShaderManager
@@ -71,7 +91,13 @@ namespace Falu
 
 		Shader* LoadShader(ID3D11Device* device, const std::string& name,
 			const std::wstring& vsFile, const std::wstring& psFile,
-			const D3D11_INPUT_ELEMENT_DESC* layout, UINT numElements);
+			const D3D11_INPUT_ELEMENT_DESC* layout, UINT numElements,
+			const std::vector<ShaderDefine>& defines = {});
+
+		// base Ɠt@C COMPACT_VERTEX tŃRpCARpNg_p̃oAgƂēo^
+		bool LoadVertexVariants(ID3D11Device* device, Shader* base, const std::string& name,
+			const std::wstring& vsFile, const std::wstring& psFile,
+			const std::vector<ShaderDefine>& defines = {});
 
 		Shader* GetShader(const std::string& name);
 		void Clear();
@@ -0,0 +1,158 @@
+/*****************************************************************//**
+ * \file   ShadowCascades.cpp
+ * \brief  JXP[h̕AȂCgԂ̔zuƃLX^[̔
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "ShadowCascades.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Falu
+{
+	namespace ShadowCascades
+	{
+		namespace
+		{
+			// sxNg` OrthographicOffCenterLH(zNear Ő[x 0AzFar  1)
+			Math::Matrix4 OrthographicOffCenter(float left, float right, float bottom, float top, float zNear, float zFar)
+			{
+				return Math::Matrix4(
+					2.0f / (right - left), 0.0f, 0.0f, 0.0f,
+					0.0f, 2.0f / (top - bottom), 0.0f, 0.0f,
+					0.0f, 0.0f, 1.0f / (zFar - zNear), 0.0f,
+					(left + right) / (left - right), (top + bottom) / (bottom - top), zNear / (zNear - zFar), 1.0f);
+			}
+
+			// [h烉CgԂւ̉]݂̂̕ϊBCg +z 
+			Math::Matrix4 LightRotation(const Math::Vector3& forward)
+			{
+				Math::Vector3 up = std::fabs(forward.y) > 0.99f ? Math::Vector3(0.0f, 0.0f, 1.0f) : Math::Vector3(0.0f, 1.0f, 0.0f);
+				Math::Vector3 right = Math::Normalize(Math::Cross(up, forward));
+				up = Math::Cross(forward, right);
+				return Math::Matrix4(
+					right.x, up.x, forward.x, 0.0f,
+					right.y, up.y, forward.y, 0.0f,
+					right.z, up.z, forward.z, 0.0f,
+					0.0f, 0.0f, 0.0f, 1.0f);
+			}
+		}
+
+		void ComputeSplits(float nearZ, float farZ, uint32_t count, float lambda, float outSplits[kMaxCascades])
+		{
+			count = std::min(std::max(count, 1u), kMaxCascades);
+			lambda = Math::Clamp(lambda, 0.0f, 1.0f);
+			for (uint32_t c = 0; c < count; ++c)
+			{
+				// p@: ϓƑΐ
+				float t = static_cast<float>(c + 1) / count;
+				float uniformSplit = nearZ + (farZ - nearZ) * t;
+				float logSplit = nearZ > 0.0f ? nearZ * std::pow(farZ / nearZ, t) : uniformSplit;
+				outSplits[c] = c + 1 == count ? farZ : Math::Lerp(uniformSplit, logSplit, lambda);
+			}
+		}
+
+		uint32_t Fit(const Math::Matrix4& cameraView, const Math::Matrix4& cameraProjection,
+			const Math::Vector3& lightDirection, const ShadowSettings& settings, ShadowCascade outCascades[kMaxCascades])
+		{
+			float directionLength = Math::Length(lightDirection);
+			if (directionLength < 1e-6f || settings.resolution == 0)
+				return 0;
+
+			// D3D ̎ˉes񂩂jA/t@[o(_34 ͓e 1Ase 0)
+			const float(&p)[4][4] = cameraProjection.m;
+			bool perspective = p[2][3] != 0.0f;
+			float nearZ = -p[3][2] / p[2][2];
+			float farZ = perspective ? p[3][2] / (1.0f - p[2][2]) : (1.0f - p[3][2]) / p[2][2];
+			if (perspective)
+				nearZ = std::max(nearZ, 1e-3f);
+
+			float shadowFar = std::min(farZ, settings.maxDistance);
+			if (!(shadowFar > nearZ))
+				return 0;
+
+			// r[̔̑傫BeȂ[x 1 ł̒lAseȂ
+			float halfWidth = 1.0f / p[0][0];
+			float halfHeight = 1.0f / p[1][1];
+			float diagonalSq = halfWidth * halfWidth + halfHeight * halfHeight;
+			float offsetX = perspective ? 0.0f : -p[3][0] / p[0][0];
+			float offsetY = perspective ? 0.0f : -p[3][1] / p[1][1];
+
+			Math::Matrix4 cameraToWorld = Math::Inverse(cameraView);
+			Math::Matrix4 lightRotation = LightRotation(lightDirection / directionLength);
+
+			uint32_t count = std::min(std::max(settings.cascadeCount, 1u), kMaxCascades);
+			float resolution = static_cast<float>(settings.resolution);
+
+			float splits[kMaxCascades];
+			ComputeSplits(nearZ, shadowFar, count, settings.splitLambda, splits);
+
+			float splitNear = nearZ;
+			for (uint32_t c = 0; c < count; ++c)
+			{
+				float splitFar = splits[c];
+
+				// ɒuԂ͂ދBJςĂςȂ
+				float centerZ;
+				float radius;
+				if (perspective)
+				{
+					// jAƃt@[̊p瓙BLԂł̓t@[ʂ̒Sɒu
+					centerZ = 0.5f * (splitNear + splitFar) * (1.0f + diagonalSq);
+					if (centerZ > splitFar)
+					{
+						centerZ = splitFar;
+						radius = splitFar * std::sqrt(diagonalSq);
+					}
+					else
+					{
+						radius = std::sqrt((splitFar - centerZ) * (splitFar - centerZ) + splitFar * splitFar * diagonalSq);
+					}
+				}
+				else
+				{
+					centerZ = 0.5f * (splitNear + splitFar);
+					float halfDepth = 0.5f * (splitFar - splitNear);
+					radius = std::sqrt(halfDepth * halfDepth + diagonalSq);
+				}
+				// t[Ԃ̕_̌덷ŃeNZ̑傫ςȂ悤ɐ؂グ
+				radius = std::ceil(radius * 16.0f) / 16.0f;
+				float texelSize = 2.0f * radius / resolution;
+
+				// SCgԂ̃eNZPʂɑAVhE}bveNZPʂłȂ悤ɂ
+				Math::Vector3 center = Math::TransformPoint(Math::Vector3(offsetX, offsetY, centerZ), cameraToWorld);
+				Math::Vector3 lightCenter = Math::TransformPoint(center, lightRotation);
+				lightCenter.x = std::floor(lightCenter.x / texelSize) * texelSize;
+				lightCenter.y = std::floor(lightCenter.y / texelSize) * texelSize;
+
+				ShadowCascade& cascade = outCascades[c];
+				cascade.view = lightRotation;
+				cascade.projection = OrthographicOffCenter(
+					lightCenter.x - radius, lightCenter.x + radius,
+					lightCenter.y - radius, lightCenter.y + radius,
+					lightCenter.z - radius - settings.casterDistance, lightCenter.z + radius);
+				cascade.viewProjection = cascade.view * cascade.projection;
+				cascade.frustum = Math::Frustum::FromMatrix(cascade.viewProjection);
+				cascade.splitNear = splitNear;
+				cascade.splitFar = splitFar;
+				cascade.texelSize = texelSize;
+
+				splitNear = splitFar;
+			}
+			return count;
+		}
+
+		uint32_t GetCasterMask(const ShadowCascade* cascades, uint32_t cascadeCount, const Math::AABB& bounds)
+		{
+			uint32_t mask = 0;
+			for (uint32_t c = 0; c < cascadeCount; ++c)
+			{
+				if (cascades[c].frustum.Intersects(bounds))
+					mask |= 1u << c;
+			}
+			return mask;
+		}
+	}
+}
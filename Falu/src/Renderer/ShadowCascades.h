@@ -0,0 +1,63 @@
+/*****************************************************************//**
+ * \file   ShadowCascades.h
+ * \brief  s̃JXP[hVhE}bv̔zu(CPU ̂݁AfoCXsv)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include "Include/Math/Vector.h"
+#include "Include/Math/Matrix.h"
+#include "Include/Math/Frustum.h"
+
+namespace Falu
+{
+	struct ShadowSettings
+	{
+		bool enabled = true;
+		uint32_t cascadeCount = 4;		// 1 .. ShadowCascades::kMaxCascades
+		uint32_t resolution = 2048;		// JXP[hƁA`
+		float maxDistance = 80.0f;		// e͂܂(܂̓J̃t@[v[܂)
+		// 0 = ϓA1 = ΐ
+		float splitLambda = 0.75f;
+		// JXP[ȟ(Cg)̂ǂ܂ŃLX^[c
+		float casterDistance = 100.0f;
+		float depthBias = 0.0005f;		// VhE}bv̐[x̒P
+		float normalOffset = 1.5f;		// JXP[h̃eNZP
+	};
+
+	// 1 ̃JXP[hBJ̎ 1 Ԃ͂ރCg̕se
+	struct ShadowCascade
+	{
+		Math::Matrix4 view;
+		Math::Matrix4 projection;
+		Math::Matrix4 viewProjection;
+		// CgԂ̃{bNX̃[hԂ̕ʁBÕLX^[͕`Ȃ
+		Math::Frustum frustum;
+		float splitNear = 0.0f;		// JXP[h󂯎J̃r[[x
+		float splitFar = 0.0f;
+		float texelSize = 0.0f;		// VhE}bv 1 eNZ̃[hł̑傫
+	};
+
+	namespace ShadowCascades
+	{
+		static constexpr uint32_t kMaxCascades = 4;
+
+		// nearZ  farZ ܂ł̃r[[x count (1 .. kMaxCascades)ɕBoutSplits[c] ̓JXP[h c 
+		// t@[̐[xŁAŌ͕K farZBlambda  0 ŋϓA1 őΐ(p@)
+		void ComputeSplits(float nearZ, float farZ, uint32_t count, float lambda, float outSplits[kMaxCascades]);
+
+		// settings.cascadeCount ̃JXP[hJɍ킹(sxNg` view / projectionAełseł悢)B
+		// eJXP[h͕ő傫܂鋅Ŏ̋Ԃ͂݁ACgԂ̌_eNZPʂɑ̂ŁA
+		// Jς肵ĂeȂBlightDirection ̓Cg痣B
+		// 񂾃JXP[h̐Ԃ(CǧsȂ 0)
+		uint32_t Fit(const Math::Matrix4& cameraView, const Math::Matrix4& cameraProjection,
+			const Math::Vector3& lightDirection, const ShadowSettings& settings, ShadowCascade outCascades[kMaxCascades]);
+
+		// bounds  cascades[c] ɉe𗎂ƂȂrbg c B
+		// BuildViewQueues ͓}XN 4 [߂B̓eXgP̖₢킹p
+		uint32_t GetCasterMask(const ShadowCascade* cascades, uint32_t cascadeCount, const Math::AABB& bounds);
+	}
+}
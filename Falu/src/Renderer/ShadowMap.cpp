@@ -0,0 +1,118 @@
+/*****************************************************************//**
+ * \file   ShadowMap.cpp
+ * \brief  ShadowMap ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "ShadowMap.h"
+
+namespace Falu
+{
+	ShadowMap::ShadowMap()
+		: m_resolution(0)
+		, m_cascadeCount(0)
+	{
+
+	}
+
+	ShadowMap::~ShadowMap()
+	{
+
+	}
+
+	bool ShadowMap::Initialize(ID3D11Device* device, uint32_t resolution, uint32_t cascadeCount)
+	{
+		if (!device || resolution == 0 || cascadeCount == 0)
+			return false;
+
+		// Typeless ɂāAeNX`ɏݗp̐[xr[Ɠǂݍݗp float r[
+		D3D11_TEXTURE2D_DESC desc = {};
+		desc.Width = resolution;
+		desc.Height = resolution;
+		desc.MipLevels = 1;
+		desc.ArraySize = cascadeCount;
+		desc.Format = DXGI_FORMAT_R32_TYPELESS;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE;
+
+		ComPtr<ID3D11Texture2D> texture;
+		HRESULT hr = device->CreateTexture2D(&desc, nullptr, &texture);
+		if (FAILED(hr))
+		{
+			OutputDebugStringA("[ShadowMap] Failed to create depth texture array\n");
+			return false;
+		}
+
+		std::vector<ComPtr<ID3D11DepthStencilView>> cascadeViews(cascadeCount);
+		for (uint32_t i = 0; i < cascadeCount; ++i)
+		{
+			D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+			dsvDesc.Format = DXGI_FORMAT_D32_FLOAT;
+			dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
+			dsvDesc.Texture2DArray.MipSlice = 0;
+			dsvDesc.Texture2DArray.FirstArraySlice = i;
+			dsvDesc.Texture2DArray.ArraySize = 1;
+
+			hr = device->CreateDepthStencilView(texture.Get(), &dsvDesc, &cascadeViews[i]);
+			if (FAILED(hr))
+				return false;
+		}
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = DXGI_FORMAT_R32_FLOAT;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+		srvDesc.Texture2DArray.MostDetailedMip = 0;
+		srvDesc.Texture2DArray.MipLevels = 1;
+		srvDesc.Texture2DArray.FirstArraySlice = 0;
+		srvDesc.Texture2DArray.ArraySize = cascadeCount;
+
+		ComPtr<ID3D11ShaderResourceView> shaderResourceView;
+		hr = device->CreateShaderResourceView(texture.Get(), &srvDesc, &shaderResourceView);
+		if (FAILED(hr))
+			return false;
+
+		D3D11_RASTERIZER_DESC rasterizerDesc = {};
+		rasterizerDesc.FillMode = D3D11_FILL_SOLID;
+		rasterizerDesc.CullMode = D3D11_CULL_BACK;
+		rasterizerDesc.FrontCounterClockwise = FALSE;
+		rasterizerDesc.DepthBias = 0;
+		rasterizerDesc.SlopeScaledDepthBias = 1.5f;
+		rasterizerDesc.DepthClipEnable = FALSE;
+
+		ComPtr<ID3D11RasterizerState> rasterizerState;
+		hr = device->CreateRasterizerState(&rasterizerDesc, &rasterizerState);
+		if (FAILED(hr))
+			return false;
+
+		// }bv̊O͏Ƃ炳ĂƂ݂Ȃ(E̐[x 1)
+		D3D11_SAMPLER_DESC samplerDesc = {};
+		samplerDesc.Filter = D3D11_FILTER_COMPARISON_MIN_MAG_LINEAR_MIP_POINT;
+		samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_BORDER;
+		samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_BORDER;
+		samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+		samplerDesc.BorderColor[0] = 1.0f;
+		samplerDesc.BorderColor[1] = 1.0f;
+		samplerDesc.BorderColor[2] = 1.0f;
+		samplerDesc.BorderColor[3] = 1.0f;
+		samplerDesc.MaxAnisotropy = 1;
+		samplerDesc.ComparisonFunc = D3D11_COMPARISON_LESS_EQUAL;
+		samplerDesc.MinLOD = 0;
+		samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+
+		ComPtr<ID3D11SamplerState> comparisonSampler;
+		hr = device->CreateSamplerState(&samplerDesc, &comparisonSampler);
+		if (FAILED(hr))
+			return false;
+
+		m_texture = texture;
+		m_cascadeViews = std::move(cascadeViews);
+		m_shaderResourceView = shaderResourceView;
+		m_rasterizerState = rasterizerState;
+		m_comparisonSampler = comparisonSampler;
+		m_resolution = resolution;
+		m_cascadeCount = cascadeCount;
+		return true;
+	}
+}
@@ -0,0 +1,52 @@
+/*****************************************************************//**
+ * \file   ShadowMap.h
+ * \brief  VhEJXP[h`ސ[xeNX`z
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	// JXP[hƂ 1 ̐[xXCXArTv[ Texture2DArray<float> Ƃēǂ߂B
+	// [x݂̂̃pX̃Xe[g(XɉoCAXB[xNbvȂɂāAjAv[O
+	// LX^[ɃjAv[ɒt悤ɂ)
+	class ShadowMap
+	{
+	public:
+		ShadowMap();
+		~ShadowMap();
+
+		bool Initialize(ID3D11Device* device, uint32_t resolution, uint32_t cascadeCount);
+
+		bool Matches(uint32_t resolution, uint32_t cascadeCount) const
+		{
+			return m_resolution == resolution && m_cascadeCount == cascadeCount;
+		}
+
+		ID3D11DepthStencilView* GetCascadeView(uint32_t cascade) const { return m_cascadeViews[cascade].Get(); }
+		ID3D11ShaderResourceView* GetShaderResourceView() const { return m_shaderResourceView.Get(); }
+		ID3D11RasterizerState* GetRasterizerState() const { return m_rasterizerState.Get(); }
+		ID3D11SamplerState* GetComparisonSampler() const { return m_comparisonSampler.Get(); }
+		uint32_t GetResolution() const { return m_resolution; }
+		uint32_t GetCascadeCount() const { return m_cascadeCount; }
+
+	private:
+		ComPtr<ID3D11Texture2D> m_texture;
+		std::vector<ComPtr<ID3D11DepthStencilView>> m_cascadeViews;
+		ComPtr<ID3D11ShaderResourceView> m_shaderResourceView;
+		ComPtr<ID3D11RasterizerState> m_rasterizerState;
+		ComPtr<ID3D11SamplerState> m_comparisonSampler;
+
+		uint32_t m_resolution;
+		uint32_t m_cascadeCount;
+	};
+}
@@ -14,6 +14,8 @@
  *********************************************************************/
 #include "Texture.h"
 
+#include <cstdlib>
+
 #define USE_STB_IMAGE
 
 #ifdef USE_STB_IMAGE
@@ -50,10 +52,20 @@ namespace Falu
 
 	bool Texture::LoadFromFile_STB(ID3D11Device* device, const std::wstring& filename)
 	{
+		TextureImage image;
+		if (!DecodeFile(filename, image))
+			return false;
+
+		return CreateFromData(device, image.pixels.data(), image.width, image.height, 4);
+	}
+
+	bool Texture::DecodeFile(const std::wstring& filename, TextureImage& outImage)
+	{
+#ifdef USE_STB_IMAGE
 		// Ch}`oCgɕϊ
 		char filenameStr[512];
-		size_t convertedChars = 0;
-		wcstombs_s(&convertedChars, filenameStr, filename.c_str(), sizeof(filenameStr));
+		size_t convertedChars = std::wcstombs(filenameStr, filename.c_str(), sizeof(filenameStr) - 1);
+		filenameStr[convertedChars == static_cast<size_t>(-1) ? 0 : convertedChars] = '\0';
 
 		// stb_imageŉ摜ǂݍ
 		int width, height, channels;
@@ -67,13 +79,14 @@ namespace Falu
 			return false;
 		}
 
-		m_width = width;
-		m_height = height;
-
-		bool result = CreateFromData(device, data, width, height, 4);
+		outImage.width = width;
+		outImage.height = height;
+		outImage.pixels.assign(data, data + (size_t)width * height * 4);
 		stbi_image_free(data);
-
-		return result;
+		return true;
+#else
+		return false;
+#endif
 	}
 
 	bool Texture::LoadFromFile_WIC(ID3D11Device* device, const std::wstring& filename)
@@ -12,11 +12,20 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace Falu
 {
 	using Microsoft::WRL::ComPtr;
 
+	// fR[h̉摜(RGBA8)BCreateFromData ŃeNX`ɂ
+	struct TextureImage
+	{
+		std::vector<unsigned char> pixels;
+		int width = 0;
+		int height = 0;
+	};
+
 	class Texture
 	{
 	public:
@@ -29,10 +38,15 @@ namespace Falu
 		bool CreateFromData(ID3D11Device* device,
 			const void* data, int width, int height, int channels);
 
+		// t@C RGBA8 ɃfR[h邾BfoCXgȂ̂Ń[J[XbhĂׂB
+		// stb_image ̂ƂΉ(WIC ̂Ƃ͏ false)
+		static bool DecodeFile(const std::wstring& filename, TextureImage& outImage);
+
 		void Bind(ID3D11DeviceContext* context, unsigned int slot = 0);
 		void Unbind(ID3D11DeviceContext* context, unsigned int slot = 0);
 
 		ID3D11ShaderResourceView* GetShaderResourceView() const { return m_shaderResourceView.Get(); }
+		ID3D11Texture2D* GetTexture() const { return m_texture.Get(); }
 		int GetWidth() const { return m_width; }
 		int GetHeight() const { return m_height; }
 
@@ -0,0 +1,145 @@
+/*****************************************************************//**
+ * \file   TextureArrayPool.cpp
+ * \brief  TextureArrayPool ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "TextureArrayPool.h"
+#include "Texture.h"
+
+#include <Windows.h>
+#include <algorithm>
+#include <cstdio>
+
+namespace Falu
+{
+	namespace
+	{
+		constexpr uint32_t kInitialSlices = 4;
+	}
+
+	TextureArrayPool::TextureArrayPool()
+		: m_device(nullptr)
+	{
+	}
+
+	void TextureArrayPool::Initialize(ID3D11Device* device)
+	{
+		m_device = device;
+	}
+
+	void TextureArrayPool::Shutdown()
+	{
+		m_slices.clear();
+		m_arrays.clear();
+		m_device = nullptr;
+	}
+
+	bool TextureArrayPool::Acquire(ID3D11DeviceContext* context, const Texture* texture, TextureSlice& outSlice)
+	{
+		if (!m_device || !texture || !texture->GetTexture())
+			return false;
+
+		auto it = m_slices.find(texture);
+		if (it != m_slices.end())
+		{
+			outSlice = it->second;
+			return true;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		texture->GetTexture()->GetDesc(&desc);
+		if (desc.Format != DXGI_FORMAT_R8G8B8A8_UNORM || desc.ArraySize != 1 || desc.MipLevels != 1)
+			return false;
+
+		// ̑傫̔zTAȂΐVJ
+		uint32_t arrayIndex = 0;
+		for (; arrayIndex < m_arrays.size(); ++arrayIndex)
+		{
+			if (m_arrays[arrayIndex].width == desc.Width && m_arrays[arrayIndex].height == desc.Height)
+				break;
+		}
+
+		if (arrayIndex == m_arrays.size())
+		{
+			if (m_arrays.size() >= kMaxArrays)
+			{
+				char msg[128];
+				sprintf_s(msg, "[TextureArrayPool] WARNING: no array left for %ux%u textures\n", desc.Width, desc.Height);
+				OutputDebugStringA(msg);
+				return false;
+			}
+
+			TextureArray array;
+			array.width = desc.Width;
+			array.height = desc.Height;
+			m_arrays.push_back(std::move(array));
+		}
+
+		TextureArray& array = m_arrays[arrayIndex];
+		if (array.count == array.capacity)
+		{
+			uint32_t capacity = std::max(kInitialSlices, array.capacity * 2);
+			capacity = std::min<uint32_t>(capacity, D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION);
+			if (capacity == array.count || !Grow(context, array, capacity))
+				return false;
+		}
+
+		uint32_t slice = array.count++;
+		context->CopySubresourceRegion(array.texture.Get(), slice, 0, 0, 0, texture->GetTexture(), 0, nullptr);
+
+		TextureSlice location;
+		location.arrayIndex = static_cast<uint16_t>(arrayIndex);
+		location.slice = static_cast<uint16_t>(slice);
+		m_slices[texture] = location;
+
+		outSlice = location;
+		return true;
+	}
+
+	ID3D11ShaderResourceView* TextureArrayPool::GetShaderResourceView(uint32_t arrayIndex) const
+	{
+		return (arrayIndex < m_arrays.size()) ? m_arrays[arrayIndex].srv.Get() : nullptr;
+	}
+
+	bool TextureArrayPool::Grow(ID3D11DeviceContext* context, TextureArray& array, uint32_t capacity)
+	{
+		D3D11_TEXTURE2D_DESC desc = {};
+		desc.Width = array.width;
+		desc.Height = array.height;
+		desc.MipLevels = 1;
+		desc.ArraySize = capacity;
+		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+		ComPtr<ID3D11Texture2D> texture;
+		HRESULT hr = m_device->CreateTexture2D(&desc, nullptr, &texture);
+		if (FAILED(hr))
+			return false;
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = desc.Format;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+		srvDesc.Texture2DArray.MipLevels = 1;
+		srvDesc.Texture2DArray.ArraySize = capacity;
+
+		ComPtr<ID3D11ShaderResourceView> srv;
+		hr = m_device->CreateShaderResourceView(texture.Get(), &srvDesc, &srv);
+		if (FAILED(hr))
+			return false;
+
+		// ̃XCXڂ(GPU ŃRs[)
+		for (uint32_t slice = 0; slice < array.count; ++slice)
+		{
+			context->CopySubresourceRegion(texture.Get(), slice, 0, 0, 0, array.texture.Get(), slice, nullptr);
+		}
+
+		array.texture = texture;
+		array.srv = srv;
+		array.capacity = capacity;
+		return true;
+	}
+}
@@ -0,0 +1,70 @@
+/*****************************************************************//**
+ * \file   TextureArrayPool.h
+ * \brief  傫̃eNX`AXCXŎw Texture2DArray ɂ܂Ƃ߂
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Falu
+{
+	using Microsoft::WRL::ComPtr;
+
+	class Texture;
+
+	// v[ł̃eNX`̈ʒuBVF[_[p (arrayIndex << 16) | slice ɋl߂
+	struct TextureSlice
+	{
+		static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+		uint16_t arrayIndex = 0;
+		uint16_t slice = 0;
+
+		uint32_t Pack() const { return (uint32_t(arrayIndex) << 16) | slice; }
+	};
+
+	// RGBA8 ̃eNX`A傫Ƃ 1  Texture2DArray ɃRs[B
+	// z͔{XɐLсAXCX͉Ȃ(eNX`̓Av̊ԂƃLbV)B
+	class TextureArrayPool
+	{
+	public:
+		// VF[_[͔ԍƂ 1  Texture2DArray oCh(Basic.hlsl  MATERIAL_TABLE Q)
+		static constexpr uint32_t kMaxArrays = 8;
+
+		TextureArrayPool();
+
+		void Initialize(ID3D11Device* device);
+		void Shutdown();
+
+		// eNX`̃tH[}bgɑΉĂȂAz̔ԍg؂ false
+		bool Acquire(ID3D11DeviceContext* context, const Texture* texture, TextureSlice& outSlice);
+
+		uint32_t GetArrayCount() const { return static_cast<uint32_t>(m_arrays.size()); }
+		ID3D11ShaderResourceView* GetShaderResourceView(uint32_t arrayIndex) const;
+
+	private:
+		struct TextureArray
+		{
+			uint32_t width = 0;
+			uint32_t height = 0;
+			uint32_t capacity = 0;
+			uint32_t count = 0;
+			ComPtr<ID3D11Texture2D> texture;
+			ComPtr<ID3D11ShaderResourceView> srv;
+		};
+
+		bool Grow(ID3D11DeviceContext* context, TextureArray& array, uint32_t capacity);
+
+	private:
+		ID3D11Device* m_device;
+		std::vector<TextureArray> m_arrays;
+		std::unordered_map<const Texture*, TextureSlice> m_slices;
+	};
+}
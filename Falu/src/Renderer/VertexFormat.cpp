@@ -0,0 +1,286 @@
+/*****************************************************************//**
+ * \file   VertexFormat.cpp
+ * \brief  VertexFormat ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "VertexFormat.h"
+#include "VertexTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Falu
+{
+	namespace VertexFormat
+	{
+		namespace
+		{
+			uint16_t ToUNorm16(float value)
+			{
+				value = std::min(std::max(value, 0.0f), 1.0f);
+				return static_cast<uint16_t>(value * 65535.0f + 0.5f);
+			}
+
+			int16_t ToSNorm16(float value)
+			{
+				value = std::min(std::max(value, -1.0f), 1.0f);
+				return static_cast<int16_t>(std::lround(value * 32767.0f));
+			}
+
+			uint8_t ToUNorm8(float value)
+			{
+				value = std::min(std::max(value, 0.0f), 1.0f);
+				return static_cast<uint8_t>(value * 255.0f + 0.5f);
+			}
+
+			// float -> halfBXMConvertFloatToHalf Ɠ(ŋߐڋւ̊ۂ߁A͈͊O͖)
+			uint16_t ToHalf(float value)
+			{
+				uint32_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+				uint32_t sign = (bits & 0x80000000u) >> 16;
+				bits &= 0x7FFFFFFFu;
+
+				uint32_t result;
+				if (bits >= 0x47800000u)
+				{
+					// 傫: 傩 NaN
+					result = 0x7C00u | ((bits > 0x7F800000u) ? (0x200u | ((bits >> 13) & 0x3FFu)) : 0u);
+				}
+				else if (bits <= 0x33000000u)
+				{
+					result = 0;
+				}
+				else if (bits < 0x38800000u)
+				{
+					// Kŕ\Ȃ̂Ŕ񐳋Kɂ
+					uint32_t shift = 125u - (bits >> 23);
+					bits = 0x800000u | (bits & 0x7FFFFFu);
+					result = bits >> (shift + 1);
+					uint32_t sticky = (bits & ((1u << shift) - 1)) != 0;
+					result += (result | sticky) & ((bits >> shift) & 1u);
+				}
+				else
+				{
+					// w̃oCAX half ɍ킹
+					bits += 0xC8000000u;
+					result = ((bits + 0x0FFFu + ((bits >> 13) & 1u)) >> 13) & 0x7FFFu;
+				}
+				return static_cast<uint16_t>(result | sign);
+			}
+
+			// PʃxNg -> [-1,1]^2B͑ΊpŐ܂Ԃ
+			void EncodeOctahedral(const Math::Vector3& normal, float& outX, float& outY)
+			{
+				float sum = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+				if (sum <= 0.0f)
+				{
+					outX = 0.0f;
+					outY = 0.0f;
+					return;
+				}
+
+				float x = normal.x / sum;
+				float y = normal.y / sum;
+				if (normal.z < 0.0f)
+				{
+					float foldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+					float foldedY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+					x = foldedX;
+					y = foldedY;
+				}
+				outX = x;
+				outY = y;
+			}
+
+			UINT GetPositionSize(uint32_t format)
+			{
+				return (format & QuantizedPosition) ? 8 : 12;
+			}
+		}
+
+		bool IsValid(uint32_t format)
+		{
+			if (format >= kCount)
+				return false;
+			return format == Standard || (format & Compact) != 0;
+		}
+
+		UINT GetStride(uint32_t format)
+		{
+			if (!(format & Compact))
+				return sizeof(Vertex);
+
+			UINT stride = GetPositionSize(format) + 4 + 4;
+			if (format & Color)
+				stride += 4;
+			return stride;
+		}
+
+		ShaderVariant GetShaderVariant(uint32_t format)
+		{
+			if (!(format & Compact))
+				return StandardVariant;
+			return (format & Color) ? CompactColorVariant : CompactVariant;
+		}
+
+		UINT GetInputElements(uint32_t format, D3D11_INPUT_ELEMENT_DESC* outElements)
+		{
+			if (!(format & Compact))
+			{
+				outElements[0] = { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+				outElements[1] = { "NORMAL",   0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+				outElements[2] = { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+				outElements[3] = { "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+				return 4;
+			}
+
+			UINT offset = 0;
+			UINT count = 0;
+
+			DXGI_FORMAT positionFormat = (format & QuantizedPosition) ? DXGI_FORMAT_R16G16B16A16_UNORM : DXGI_FORMAT_R32G32B32_FLOAT;
+			outElements[count++] = { "POSITION", 0, positionFormat, 0, offset, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+			offset += GetPositionSize(format);
+
+			DXGI_FORMAT texCoordFormat = (format & UNormTexCoord) ? DXGI_FORMAT_R16G16_UNORM : DXGI_FORMAT_R16G16_FLOAT;
+			outElements[count++] = { "TEXCOORD", 0, texCoordFormat, 0, offset, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+			offset += 4;
+
+			outElements[count++] = { "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, offset, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+			offset += 4;
+
+			if (format & Color)
+			{
+				outElements[count++] = { "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, offset, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+			}
+			return count;
+		}
+
+		uint32_t Choose(const std::vector<Vertex>& vertices, const CompressionSettings& settings)
+		{
+			if (!settings.enabled || vertices.empty())
+				return Standard;
+
+			bool hasColor = false;
+			bool texCoordsInUnitRange = true;
+			for (const Vertex& vertex : vertices)
+			{
+				const Math::Color& color = vertex.color;
+				if (color.r < 1.0f || color.g < 1.0f || color.b < 1.0f || color.a < 1.0f)
+					hasColor = true;
+
+				const Math::Vector2& uv = vertex.texCoord;
+				if (uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f)
+					texCoordsInUnitRange = false;
+			}
+
+			uint32_t format = Compact;
+			if (hasColor)
+				format |= Color;
+			if (texCoordsInUnitRange)
+				format |= UNormTexCoord;
+			if (settings.quantizePositions)
+				format |= QuantizedPosition;
+			return format;
+		}
+
+		void Encode(uint32_t format, ArrayView<Vertex> vertices,
+			std::vector<uint8_t>& outData, PositionTransform& outPositionTransform)
+		{
+			const UINT stride = GetStride(format);
+			outData.resize((size_t)stride * vertices.size());
+			outPositionTransform = PositionTransform();
+
+			if (!(format & Compact))
+			{
+				if (!vertices.empty())
+					memcpy(outData.data(), vertices.data(), outData.size());
+				return;
+			}
+
+			Math::Vector3 scaleInv(0.0f, 0.0f, 0.0f);
+			if ((format & QuantizedPosition) && !vertices.empty())
+			{
+				Math::Vector3 min = vertices[0].position;
+				Math::Vector3 max = vertices[0].position;
+				for (const Vertex& vertex : vertices)
+				{
+					min.x = std::min(min.x, vertex.position.x);
+					min.y = std::min(min.y, vertex.position.y);
+					min.z = std::min(min.z, vertex.position.z);
+					max.x = std::max(max.x, vertex.position.x);
+					max.y = std::max(max.y, vertex.position.y);
+					max.z = std::max(max.z, vertex.position.z);
+				}
+
+				outPositionTransform.offset = min;
+				outPositionTransform.scale = Math::Vector3(max.x - min.x, max.y - min.y, max.z - min.z);
+
+				// Ȏ 0 ̂܂(s̊gł 0)
+				const Math::Vector3& scale = outPositionTransform.scale;
+				scaleInv = Math::Vector3(
+					scale.x > 0.0f ? 1.0f / scale.x : 0.0f,
+					scale.y > 0.0f ? 1.0f / scale.y : 0.0f,
+					scale.z > 0.0f ? 1.0f / scale.z : 0.0f);
+			}
+
+			uint8_t* dst = outData.data();
+			for (const Vertex& vertex : vertices)
+			{
+				uint8_t* p = dst;
+
+				if (format & QuantizedPosition)
+				{
+					const Math::Vector3& offset = outPositionTransform.offset;
+					uint16_t position[4] = {
+						ToUNorm16((vertex.position.x - offset.x) * scaleInv.x),
+						ToUNorm16((vertex.position.y - offset.y) * scaleInv.y),
+						ToUNorm16((vertex.position.z - offset.z) * scaleInv.z),
+						0,
+					};
+					memcpy(p, position, sizeof(position));
+				}
+				else
+				{
+					float position[3] = { vertex.position.x, vertex.position.y, vertex.position.z };
+					memcpy(p, position, sizeof(position));
+				}
+				p += GetPositionSize(format);
+
+				if (format & UNormTexCoord)
+				{
+					uint16_t texCoord[2] = { ToUNorm16(vertex.texCoord.x), ToUNorm16(vertex.texCoord.y) };
+					memcpy(p, texCoord, sizeof(texCoord));
+				}
+				else
+				{
+					uint16_t texCoord[2] = { ToHalf(vertex.texCoord.x), ToHalf(vertex.texCoord.y) };
+					memcpy(p, texCoord, sizeof(texCoord));
+				}
+				p += 4;
+
+				float octX, octY;
+				EncodeOctahedral(vertex.normal, octX, octY);
+				int16_t normal[2] = { ToSNorm16(octX), ToSNorm16(octY) };
+				memcpy(p, normal, sizeof(normal));
+				p += 4;
+
+				if (format & Color)
+				{
+					uint8_t color[4] = {
+						ToUNorm8(vertex.color.r),
+						ToUNorm8(vertex.color.g),
+						ToUNorm8(vertex.color.b),
+						ToUNorm8(vertex.color.a),
+					};
+					memcpy(p, color, sizeof(color));
+				}
+
+				dst += stride;
+			}
+		}
+	}
+}
@@ -0,0 +1,81 @@
+/*****************************************************************//**
+ * \file   VertexFormat.h
+ * \brief  RpNg GPU _CAEgƂ̃GR[_[
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+#include <cstdint>
+#include <vector>
+#include "Include/Math/Vector.h"
+#include "Include/Utils/ArrayView.h"
+
+namespace Falu
+{
+	struct Vertex;
+
+	// bV GPU ̒_CAEgBrbgtOŁA0  48 oCg̊S VertexB
+	// ̃tOׂ͂ Compact KvB
+	//
+	// Compact ̗vf̏: position | texCoord | ʑ̂ normal | color
+	//   position  R32G32B32_FLOATA܂̓bV AABB ɑ΂ R16G16B16A16_UNORM(QuantizedPosition)
+	//   texCoord  R16G16_FLOATA܂ׂ͂Ă UV  [0,1] ɓ R16G16_UNORM(UNormTexCoord)
+	//   normal    R16G16_SNORM ̔ʑ(vf 4 oCgEȂ̂ 2x16 ł 2x8 ł傫)
+	//   color     R8G8B8A8_UNORM(Color)BȂΏȂAVF[_[͔g
+	namespace VertexFormat
+	{
+		enum Flags : uint32_t
+		{
+			Standard = 0,
+			Compact = 1u << 0,
+			Color = 1u << 1,
+			QuantizedPosition = 1u << 2,
+			UNormTexCoord = 1u << 3,
+		};
+
+		constexpr uint32_t kCount = 16;
+		constexpr uint32_t kMaxElements = 4;
+
+		// RpNg_ǂ߂VF[_[̓oAgƂɃRpC(Basic.hlsl  COMPACT_VERTEX Q)
+		enum ShaderVariant : uint32_t
+		{
+			StandardVariant = 0,
+			CompactVariant,			// COMPACT_VERTEX
+			CompactColorVariant,	// COMPACT_VERTEX + VERTEX_COLOR
+			ShaderVariantCount,
+		};
+
+		// ModelLoader bVƂɌ`IԂ߂̃IvV
+		struct CompressionSettings
+		{
+			bool enabled = true;
+			// ł̓ItBႤ AABB ŗʎqׂ荇bVɔ̖тقǂ̌Ԃ邱Ƃ
+			bool quantizePositions = false;
+		};
+
+		bool IsValid(uint32_t format);
+		UINT GetStride(uint32_t format);
+		ShaderVariant GetShaderVariant(uint32_t format);
+
+		// ő kMaxElements ̋Lqq𖄂߁AԂ
+		UINT GetInputElements(uint32_t format, D3D11_INPUT_ELEMENT_DESC* outElements);
+
+		// bṼf[^Ȃԏ`BׂĂ̒_ȂF𗎂ƂA
+		// UV ׂ [0,1] ɓ UNORM  UV g
+		uint32_t Choose(const std::vector<Vertex>& vertices, const CompressionSettings& settings);
+
+		// QuantizedPosition ̋tʎq: position = offset + unorm * scale
+		struct PositionTransform
+		{
+			Math::Vector3 offset = Math::Vector3(0.0f, 0.0f, 0.0f);
+			Math::Vector3 scale = Math::Vector3(1.0f, 1.0f, 1.0f);
+		};
+
+		// _ GetStride(format) ̑傫̃R[hɋl߂
+		void Encode(uint32_t format, ArrayView<Vertex> vertices,
+			std::vector<uint8_t>& outData, PositionTransform& outPositionTransform);
+	}
+}
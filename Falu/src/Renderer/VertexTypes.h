@@ -0,0 +1,35 @@
+/*****************************************************************//**
+ * \file   VertexTypes.h
+ * \brief  _̌^(foCXɈˑȂ)
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include "Include/Math/Vector.h"
+
+namespace Falu
+{
+	// CPU ̒_BGPU ɏグƂ VertexFormat ŋl߂
+	struct Vertex
+	{
+		Math::Vector3 position;
+		Math::Vector3 normal;
+		Math::Vector2 texCoord;
+		Math::Color color;
+
+		Vertex()
+			:position(0.0f,0.0f,0.0f)
+			,normal(0.0f,1.0f,0.0f)
+			,texCoord(0.0f,0.0f)
+			,color(1.0f,1.0f,1.0f,1.0f)
+		{}
+
+
+		Vertex(const Math::Vector3& pos,const Math::Vector3& norm,
+			const Math::Vector2& tex,const Math::Color& col)
+			:position(pos),normal(norm),texCoord(tex),color(col)
+		{}
+	};
+}
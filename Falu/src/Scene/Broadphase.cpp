@@ -0,0 +1,288 @@
+/*****************************************************************//**
+ * \file   Broadphase.cpp
+ * \brief  Broadphase ̎
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#include "Broadphase.h"
+#include <algorithm>
+#include "GameObject.h"
+#include "Falu/JobSystem.h"
+
+namespace Falu
+{
+	namespace
+	{
+		// 1 ̃Wuň{fB̐(oEfBO̍XVƖ₢킹)
+		constexpr uint32_t kBodiesPerJob = 64;
+
+		constexpr uint32_t kNullBody = UINT32_MAX;
+	}
+
+	Broadphase::Broadphase(float margin)
+		: m_tree(margin)
+	{
+
+	}
+
+	Broadphase::~Broadphase()
+	{
+
+	}
+
+	void Broadphase::MarkRequery(uint32_t body)
+	{
+		if (!m_bodies[body].requery)
+		{
+			m_bodies[body].requery = true;
+			m_requery.push_back(body);
+		}
+	}
+
+	void Broadphase::Add(GameObject* object)
+	{
+		if (!object || object->m_broadphaseBody != kNullBody)
+			return;
+
+		uint32_t index;
+		if (!m_freeBodies.empty())
+		{
+			index = m_freeBodies.back();
+			m_freeBodies.pop_back();
+		}
+		else
+		{
+			index = static_cast<uint32_t>(m_bodies.size());
+			m_bodies.emplace_back();
+			m_bounds.emplace_back();
+			m_objects.push_back(nullptr);
+		}
+
+		// vLV͎ Update ōBIuWFNgANeBuǂŌ߂
+		Body& body = m_bodies[index];
+		body.object = object;
+		body.proxy = Math::DynamicAabbTree::kNullProxy;
+		body.version = 0;
+		body.requery = false;
+		body.removed = false;
+		object->m_broadphaseBody = index;
+	}
+
+	void Broadphase::Remove(GameObject* object)
+	{
+		if (!object || object->m_broadphaseBody == kNullBody)
+			return;
+
+		uint32_t index = object->m_broadphaseBody;
+		object->m_broadphaseBody = kNullBody;
+
+		// Xbg Update ŏIyA񍐂Ăg
+		Body& body = m_bodies[index];
+		if (body.proxy != Math::DynamicAabbTree::kNullProxy)
+		{
+			m_tree.DestroyProxy(body.proxy);
+			body.proxy = Math::DynamicAabbTree::kNullProxy;
+		}
+		body.removed = true;
+		m_objects[index] = nullptr;
+		MarkRequery(index);
+	}
+
+	void Broadphase::Clear()
+	{
+		for (Body& body : m_bodies)
+		{
+			if (body.object && !body.removed)
+				body.object->m_broadphaseBody = kNullBody;
+		}
+		m_tree.Clear();
+		m_bodies.clear();
+		m_bounds.clear();
+		m_objects.clear();
+		m_freeBodies.clear();
+		m_moved.clear();
+		m_requery.clear();
+		m_candidateKeys.clear();
+		m_pairKeys.clear();
+		m_pairs.clear();
+		m_beginOverlaps.clear();
+		m_endOverlaps.clear();
+	}
+
+	void Broadphase::UpdateBounds()
+	{
+		m_moved.clear();
+
+		// O Update ς̂T
+		uint32_t bodyCount = static_cast<uint32_t>(m_bodies.size());
+		for (uint32_t i = 0; i < bodyCount; ++i)
+		{
+			Body& body = m_bodies[i];
+			if (!body.object || body.removed)
+				continue;
+
+			if (!body.object->IsActive())
+			{
+				if (body.proxy != Math::DynamicAabbTree::kNullProxy)
+				{
+					m_tree.DestroyProxy(body.proxy);
+					body.proxy = Math::DynamicAabbTree::kNullProxy;
+					m_objects[i] = nullptr;
+					MarkRequery(i);
+				}
+				continue;
+			}
+
+			uint32_t version = body.object->GetBoundsVersion();
+			if (body.proxy == Math::DynamicAabbTree::kNullProxy || version != body.version)
+			{
+				body.version = version;
+				m_moved.push_back(i);
+			}
+		}
+
+		JobSystem& jobSystem = JobSystem::GetInstance();
+		uint32_t movedCount = static_cast<uint32_t>(m_moved.size());
+		uint32_t jobCount = (movedCount + kBodiesPerJob - 1) / kBodiesPerJob;
+
+		// IuWFNg̃[hoEfBOB
+		// eIuWFNgɐGWu 1 Ȃ̂ŁAGetWorldBounds ̒̒xXVS
+		jobSystem.ParallelFor(jobCount, [&](uint32_t job)
+		{
+			uint32_t begin = job * kBodiesPerJob;
+			uint32_t end = std::min(begin + kBodiesPerJob, movedCount);
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				uint32_t index = m_moved[i];
+				m_bounds[index] = m_bodies[index].object->GetWorldBounds();
+			}
+		});
+
+		// قƂǂ̈ړ͍LoEfBOɎ܂A͂̂܂܎gB
+		// c[ɏނ̂͂Ȃ̂ŁAUpdate ̖₢킹͕ɍs
+		for (uint32_t index : m_moved)
+		{
+			Body& body = m_bodies[index];
+			if (body.proxy == Math::DynamicAabbTree::kNullProxy)
+			{
+				body.proxy = m_tree.CreateProxy(m_bounds[index], reinterpret_cast<void*>(static_cast<uintptr_t>(index)));
+				m_objects[index] = body.object;
+				MarkRequery(index);
+			}
+			else if (m_tree.MoveProxy(body.proxy, m_bounds[index]))
+			{
+				MarkRequery(index);
+			}
+		}
+	}
+
+	void Broadphase::Update()
+	{
+		m_beginOverlaps.clear();
+		m_endOverlaps.clear();
+
+		UpdateBounds();
+
+		// LoEfBOςȂ{fBm̌͂̂܂ܗL
+		m_newKeys.clear();
+		for (uint64_t key : m_candidateKeys)
+		{
+			if (!m_bodies[static_cast<uint32_t>(key >> 32)].requery && !m_bodies[static_cast<uint32_t>(key)].requery)
+				m_newKeys.push_back(key);
+		}
+		size_t keptCount = m_newKeys.size();
+
+		// ꒼{fB₢킹B
+		// ꒼{fBm̃yA͗猩̂ŁAID ̕c
+		JobSystem& jobSystem = JobSystem::GetInstance();
+		uint32_t requeryCount = static_cast<uint32_t>(m_requery.size());
+		uint32_t queryJobCount = (requeryCount + kBodiesPerJob - 1) / kBodiesPerJob;
+		if (m_jobKeys.size() < queryJobCount)
+			m_jobKeys.resize(queryJobCount);
+		jobSystem.ParallelFor(queryJobCount, [&](uint32_t job)
+		{
+			std::vector<uint64_t>& keys = m_jobKeys[job];
+			keys.clear();
+			uint32_t begin = job * kBodiesPerJob;
+			uint32_t end = std::min(begin + kBodiesPerJob, requeryCount);
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				uint32_t index = m_requery[i];
+				uint32_t proxy = m_bodies[index].proxy;
+				if (proxy == Math::DynamicAabbTree::kNullProxy)
+					continue;
+
+				m_tree.Query(m_tree.GetFatBounds(proxy), [&](uint32_t otherProxy)
+				{
+					uint32_t other = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(m_tree.GetUserData(otherProxy)));
+					if (other == index || (m_bodies[other].requery && other < index))
+						return;
+					keys.push_back(MakeKey(index, other));
+				});
+			}
+		});
+		for (uint32_t job = 0; job < queryJobCount; ++job)
+			m_newKeys.insert(m_newKeys.end(), m_jobKeys[job].begin(), m_jobKeys[job].end());
+		std::sort(m_newKeys.begin() + keptCount, m_newKeys.end());
+		std::inplace_merge(m_newKeys.begin(), m_newKeys.begin() + keptCount, m_newKeys.end());
+		m_candidateKeys.swap(m_newKeys);
+
+		// ׂĂ̌𐳊mɔ肷Bʂ͐񂵂܂
+		m_newKeys.clear();
+		for (uint64_t key : m_candidateKeys)
+		{
+			if (m_bounds[static_cast<uint32_t>(key >> 32)].Intersects(m_bounds[static_cast<uint32_t>(key)]))
+				m_newKeys.push_back(key);
+		}
+
+		// ̃Xg͐ς݂Ȃ̂ŁAׂĂǂăCxg
+		size_t oldIndex = 0;
+		size_t newIndex = 0;
+		while (oldIndex < m_pairKeys.size() || newIndex < m_newKeys.size())
+		{
+			if (newIndex == m_newKeys.size() || (oldIndex < m_pairKeys.size() && m_pairKeys[oldIndex] < m_newKeys[newIndex]))
+			{
+				m_endOverlaps.push_back(MakePair(m_pairKeys[oldIndex++]));
+			}
+			else if (oldIndex == m_pairKeys.size() || m_newKeys[newIndex] < m_pairKeys[oldIndex])
+			{
+				m_beginOverlaps.push_back(MakePair(m_newKeys[newIndex++]));
+			}
+			else
+			{
+				++oldIndex;
+				++newIndex;
+			}
+		}
+		m_pairKeys.swap(m_newKeys);
+
+		m_pairs.resize(m_pairKeys.size());
+		for (size_t i = 0; i < m_pairKeys.size(); ++i)
+			m_pairs[i] = MakePair(m_pairKeys[i]);
+
+		// 폜Xbg͏ICxgoɎg񂹂
+		for (uint32_t index : m_requery)
+		{
+			Body& body = m_bodies[index];
+			body.requery = false;
+			if (body.removed)
+			{
+				body.object = nullptr;
+				body.removed = false;
+				m_freeBodies.push_back(index);
+			}
+		}
+		m_requery.clear();
+	}
+
+	void Broadphase::OverlapBox(const Math::AABB& bounds, std::vector<GameObject*>& outObjects) const
+	{
+		m_tree.Query(bounds, [&](uint32_t proxy)
+		{
+			uint32_t index = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(m_tree.GetUserData(proxy)));
+			if (bounds.Intersects(m_bounds[index]))
+				outObjects.push_back(m_objects[index]);
+		});
+	}
+}
@@ -0,0 +1,111 @@
+/*****************************************************************//**
+ * \file   Broadphase.h
+ * \brief  Q[IuWFNg̃[hoEfBOm̏dȂyAێu[htF[Y
+ *
+ * \author tsunn
+ * \date   2026/10/18
+ *********************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Include/Math/DynamicAabbTree.h"
+
+namespace Falu
+{
+	class GameObject;
+
+	// a  b Ƀu[htF[Yɒǉꂽ({fB ID )ByA͏ɓŗ
+	struct OverlapPair
+	{
+		GameObject* a;
+		GameObject* b;
+	};
+
+	// [hoEfBOdȂĂANeBuȃIuWFNg̃yAׂĕێB
+	// {fB͍LoEfBOœI AABB c[ɓALoEfBOdȂyAƂăt[܂ŎcB
+	// Update ̓gXtH[[JoEfBOςIuWFNg̃oEfBOvZA
+	// LoEfBO͂ݏo{fB()₢킹ĂAmȃoEfBOŌiB
+	// ̂ߕׂ̓{fB̑ł͂Ȃ{fB̐Ō܂B
+	//
+	// ANeBuȃIuWFNg̓{fB܂܃c[OBׂăQ[Xbhp
+	class Broadphase
+	{
+	public:
+		explicit Broadphase(float margin = 0.2f);
+		~Broadphase();
+
+		void Add(GameObject* object);
+		// IuWFNg܂ރyA͎ Update ŏIB̏ICxg͂܂IuWFNgw
+		void Remove(GameObject* object);
+		void Clear();
+
+		// AANeBuԂςAǉE폜ꂽIuWFNgEAyAƃCxgXV
+		void Update();
+		// Update ̑O: GetBounds ƃc[IuWFNgɍ킹B
+		// yAƃCxg͎ Update ܂ŕςȂ
+		void UpdateBounds();
+
+		// O Update ̎_ŏdȂĂyAB{fB ID 
+		const std::vector<OverlapPair>& GetPairs() const { return m_pairs; }
+		// O Update ŏdȂn߂ / dȂȂȂyA
+		const std::vector<OverlapPair>& GetBeginOverlaps() const { return m_beginOverlaps; }
+		const std::vector<OverlapPair>& GetEndOverlaps() const { return m_endOverlaps; }
+
+		// (O Update ̎_)oEfBO bounds ɏdȂANeBuȃIuWFNgǉ
+		void OverlapBox(const Math::AABB& bounds, std::vector<GameObject*>& outObjects) const;
+
+		// S{fB̃[hoEfBO 1 ̘AzŕԂBV[Ŝ񂷃[vpB
+		// 2 ̔z i Ԗڂ͓{fBBANeBuA폜ς݁Agp̃{fB objects[i]  nullptr ŁA
+		// ̃oEfBO͌Â
+		const std::vector<Math::AABB>& GetBounds() const { return m_bounds; }
+		const std::vector<GameObject*>& GetObjects() const { return m_objects; }
+
+		uint32_t GetBodyCount() const { return static_cast<uint32_t>(m_bodies.size() - m_freeBodies.size()); }
+		// O UpdateBounds ŃoEfBOvZ{fB
+		uint32_t GetMovedCount() const { return static_cast<uint32_t>(m_moved.size()); }
+		// LoEfBOdȂyABUpdate ̂тɐmȃoEfBOŊm߂
+		uint32_t GetCandidateCount() const { return static_cast<uint32_t>(m_candidateKeys.size()); }
+		const Math::DynamicAabbTree& GetTree() const { return m_tree; }
+
+	private:
+		struct Body
+		{
+			GameObject* object;		// 󂫃XgɂԂ nullptrB폜ICxĝ߂Ɏc
+			uint32_t proxy;			// ANeBůԂ kNullProxy
+			uint32_t version;		// oEfBOvZƂ GameObject::GetBoundsVersion
+			bool requery;			// LoEfBOςB Update Ō蒼
+			bool removed;
+		};
+
+		// {fB ID ʂɓꂽyÃL[BL[̏̂܂܃yȀɂȂ
+		static uint64_t MakeKey(uint32_t a, uint32_t b)
+		{
+			return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+		}
+		OverlapPair MakePair(uint64_t key) const
+		{
+			return { m_bodies[static_cast<uint32_t>(key >> 32)].object, m_bodies[static_cast<uint32_t>(key)].object };
+		}
+		void MarkRequery(uint32_t body);
+
+	private:
+		Math::DynamicAabbTree m_tree;
+		std::vector<Body> m_bodies;
+		std::vector<Math::AABB> m_bounds;		// {fBƂ̐mȃ[hoEfBO
+		std::vector<GameObject*> m_objects;		// {fBƁBc[ɂȂ nullptr
+		std::vector<uint32_t> m_freeBodies;
+		std::vector<uint32_t> m_moved;		// oEfBOvZ{fB
+		std::vector<uint32_t> m_requery;	// requery Ă{fB
+
+		// ǂς݁ByA͐mȃoEfBOdȂ
+		std::vector<uint64_t> m_candidateKeys;
+		std::vector<uint64_t> m_pairKeys;
+		std::vector<uint64_t> m_newKeys;
+		std::vector<std::vector<uint64_t>> m_jobKeys;
+
+		std::vector<OverlapPair> m_pairs;
+		std::vector<OverlapPair> m_beginOverlaps;
+		std::vector<OverlapPair> m_endOverlaps;
+	};
+}
@@ -18,6 +18,9 @@ namespace Falu
 		, m_isActive(true)
 		, m_parent(nullptr)
 		, m_localBounds(Math::Vector3(-0.5f,-0.5f,-0.5f),Math::Vector3(0.5f,0.5f,0.5f))// Default 1 * 1 * 1 Cube
+		, m_boundsVersion(0)
+		, m_worldBoundsVersion(UINT32_MAX)
+		, m_broadphaseBody(UINT32_MAX)
 	{
 
 	}
@@ -62,40 +65,46 @@ namespace Falu
 		}
 	}
 
-	void GameObject::Render()
+	void GameObject::ExtractRenderData(RenderFrame& frame)
 	{
 		if (!IsActive())
 			return;
 
-		// R|[lg̕`
+		// R|[lg̕`f[^
 		for (auto& component : m_components)
 		{
 			if (component && component->IsEnabled())
 			{
-				component->Render();
+				component->ExtractRenderData(frame);
 			}
 		}
 
-		// qIuWFNg̕`
+		// qIuWFNg̕`f[^
 		for (auto child : m_children)
 		{
 			if (child && child->IsActive())
 			{
-				child->Render();
+				child->ExtractRenderData(frame);
 			}
 		}
 	}
 
-	Math::AABB GameObject::GetWorldBounds() const
+	const Math::AABB& GameObject::GetWorldBounds() const
 	{
-		return m_localBounds.Transform(m_transform.GetWorldMatrix());
+		uint32_t version = GetBoundsVersion();
+		if (m_worldBoundsVersion != version)
+		{
+			m_worldBounds = m_localBounds.Transform(m_transform.GetWorldMatrix());
+			m_worldBoundsVersion = version;
+		}
+		return m_worldBounds;
 	}
 
 	bool GameObject::RayCastHit(const Math::Ray& ray, float& distance) const
 	{
 		if (!m_isActive) return false;
 
-		Math::AABB worldBounds = GetWorldBounds();
+		const Math::AABB& worldBounds = GetWorldBounds();
 
 		float tMin, tMax;
 		if (worldBounds.IntersectsRay(ray, tMin, tMax))
@@ -107,6 +116,96 @@ namespace Falu
 		return false;
 	}
 
+	bool GameObject::RayCastPrecise(const Math::Ray& ray, float maxDistance, RayHit& outHit) const
+	{
+		if (!m_isActive) return false;
+
+		bool hasPrecise = false;
+		bool hit = false;
+		float closest = maxDistance;
+
+		for (const auto& component : m_components)
+		{
+			if (!component->IsEnabled() || !component->CanRayCast())
+				continue;
+
+			hasPrecise = true;
+			RayHit componentHit;
+			if (component->RayCast(ray, closest, componentHit))
+			{
+				closest = componentHit.distance;
+				outHit = componentHit;
+				hit = true;
+			}
+		}
+
+		if (hasPrecise)
+			return hit;
+
+		// Op`ȂIuWFNg͏]ǂ AABB
+		float distance;
+		if (!RayCastHit(ray, distance) || distance > maxDistance)
+			return false;
+
+		outHit = RayHit();
+		outHit.distance = distance;
+		outHit.position = ray.GetPoint(distance);
+		return true;
+	}
+
+	uint32_t GameObject::RayCastPacketPrecise(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+		RayHit outHits[Math::RayPacket::kWidth]) const
+	{
+		constexpr int kWidth = Math::RayPacket::kWidth;
+		if (!m_isActive || packet.activeMask == 0) return 0;
+
+		bool hasPrecise = false;
+		uint32_t hitMask = 0;
+		float closest[kWidth];
+		for (int lane = 0; lane < kWidth; ++lane)
+			closest[lane] = maxDistance[lane];
+
+		for (const auto& component : m_components)
+		{
+			if (!component->IsEnabled() || !component->CanRayCast())
+				continue;
+
+			hasPrecise = true;
+			RayHit componentHits[kWidth];
+			uint32_t componentMask = component->RayCastPacket(packet, closest, componentHits);
+			for (int lane = 0; lane < kWidth; ++lane)
+			{
+				if (!(componentMask & (1u << lane)))
+					continue;
+				closest[lane] = componentHits[lane].distance;
+				outHits[lane] = componentHits[lane];
+				hitMask |= 1u << lane;
+			}
+		}
+
+		if (hasPrecise)
+			return hitMask;
+
+		// Op`ŒׂȂ AABB œĂ(RayCastHit Ɠ̎)
+		const Math::AABB& worldBounds = GetWorldBounds();
+		float tNear[kWidth], tFar[kWidth];
+		uint32_t boxMask = Math::IntersectAABB(packet, worldBounds.min, worldBounds.max, maxDistance, tNear, tFar);
+		for (int lane = 0; lane < kWidth; ++lane)
+		{
+			if (!(boxMask & (1u << lane)))
+				continue;
+			float distance = (tNear[lane] > 0.0f) ? tNear[lane] : tFar[lane];
+			if (distance <= 0.0f || distance > maxDistance[lane])
+				continue;
+
+			outHits[lane] = RayHit();
+			outHits[lane].distance = distance;
+			outHits[lane].position = packet.GetLane(lane).GetPoint(distance);
+			hitMask |= 1u << lane;
+		}
+		return hitMask;
+	}
+
 	void GameObject::SetParent(GameObject* parent)
 	{
 		// ̐e폜
@@ -12,11 +12,35 @@
 #include <memory>
 #include "Transform.h"
 #include "Include/Math/Ray.h"
+#include "Include/Math/RayPacket.h"
 
 namespace Falu
 {
 	class Component;
 	class MeshRenderer;
+	class Mesh;
+	class GameObject;
+	struct RenderFrame;
+
+	// Scene::RayCast ̔@
+	enum class RayCastMode
+	{
+		Bounds,		// [h AABB ̂
+		Precise,	// Op` BVH bV͎Op`܂(ȂIuWFNg AABB)
+	};
+
+	// CLXǧ(ʒuƖ@̓[h)
+	struct RayHit
+	{
+		GameObject* object = nullptr;
+		float distance = 0.0f;
+		Math::Vector3 position;
+		Math::Vector3 normal;			// AABB œĂƂ 0
+		Math::Vector2 barycentrics;		// Op`2Ԗ/3Ԗڂ̒_̏d
+		uint32_t triangleIndex = 0;
+		int subMeshIndex = -1;			// ModelRenderer  SubMesh ԍ(ȊO -1)
+		Mesh* mesh = nullptr;			// Op`œbV
+	};
 
 	class GameObject
 	{
@@ -25,19 +49,30 @@ namespace Falu
 		virtual ~GameObject();
 
 		virtual void Update(float deltaTime);
-		virtual void Render();
+
+		// `f[^t[XibvVbg֏o(V~[VXbh)
+		virtual void ExtractRenderData(RenderFrame& frame);
 
 		//=== Transform ===
 		Transform& GetTransform() { return m_transform; }
 		const Transform& GetTransform() const { return m_transform; }
 
 		//=== Bounding Box ===
-		void SetBounds(const Math::AABB& bounds) { m_localBounds = bounds; }
+		void SetBounds(const Math::AABB& bounds) { m_localBounds = bounds; ++m_boundsVersion; }
 		Math::AABB GetLocalBounds() const { return m_localBounds; }
-		Math::AABB GetWorldBounds() const;
+		// [h AABBBTransform [J AABB ςƂvZ(ʃXbh瓯ɌĂԑOɈxĂł)
+		const Math::AABB& GetWorldBounds() const;
+		// Transform [J AABB ς邽тɕς([h AABB ̃LbV̖p)
+		uint32_t GetBoundsVersion() const { return m_transform.GetVersion() + m_boundsVersion; }
 
 		//=== Judge Ray Cast ===
 		bool RayCastHit(const Math::Ray& ray, float& distance) const;
+		// CLXgłR|[lg(BVH t̃bV)ΎOp`ŁAȂ AABB Ŕ肷B
+		// outHit.object ͌ĂяoŐݒ肷
+		bool RayCastPrecise(const Math::Ray& ray, float maxDistance, RayHit& outHit) const;
+		// 4{܂Ƃ߂ŁB[ i  maxDistance[i] OB[̃}XNԂ
+		uint32_t RayCastPacketPrecise(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+			RayHit outHits[Math::RayPacket::kWidth]) const;
 
 		//=== Component management ===
 		template<typename T>
@@ -83,6 +118,14 @@ namespace Falu
 
 		static int s_nextID;
 		Math::AABB m_localBounds;// Local Bounding Box
+		uint32_t m_boundsVersion;
+		mutable Math::AABB m_worldBounds;// World Bounding Box(LbV)
+		mutable uint32_t m_worldBoundsVersion;// m_worldBounds vZƂ GetBoundsVersion
+
+	private:
+		friend class Broadphase;
+		// Broadphase ̃{fBԍ(o^ĂȂ UINT32_MAX)
+		uint32_t m_broadphaseBody;
 	};
 
 	//====== Component ======
@@ -93,7 +136,23 @@ namespace Falu
 		virtual ~Component() = default;
 
 		virtual void Update(float deltaTime) {}
-		virtual void Render(){}
+		virtual void ExtractRenderData(RenderFrame& frame) {}
+
+		// Op`Pʂ̃CLXg(GameObject::RayCastPrecise Ă΂)
+		virtual bool CanRayCast() const { return false; }
+		virtual bool RayCast(const Math::Ray& ray, float maxDistance, RayHit& outHit) const { return false; }
+		// Scene::RayCastBatch pBł1{ RayCast B[̃}XNԂ
+		virtual uint32_t RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+			RayHit outHits[Math::RayPacket::kWidth]) const
+		{
+			uint32_t hitMask = 0;
+			for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+			{
+				if ((packet.activeMask & (1u << lane)) && RayCast(packet.GetLane(lane), maxDistance[lane], outHits[lane]))
+					hitMask |= 1u << lane;
+			}
+			return hitMask;
+		}
 
 		GameObject* GetOwner() const { return m_owner; }
 		void SetEnabled(bool enabled) { m_isEnabled = enabled; }
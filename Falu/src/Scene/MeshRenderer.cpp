@@ -5,11 +5,12 @@
  * \author tsunn
  * \date   2026/02/08
  *********************************************************************/
+// RenderFrame ƍs XMMATRIX ϊ̂߁AMath  DirectXMath ǂ
+#include "Include/Math/MathHelper.h"
 #include "MeshRenderer.h"
 #include "Renderer/Mesh.h"
 #include "Renderer/Material.h"
-#include "Falu/Engine.h"
-#include "Renderer/Renderer.h"
+#include "Renderer/RenderFrame.h"
 
 namespace Falu
 {
@@ -17,6 +18,7 @@ namespace Falu
 		: Component(owner)
 		, m_mesh(nullptr)
 		, m_material(nullptr)
+		, m_currentLod(0)
 	{
 
 	}
@@ -26,19 +28,80 @@ namespace Falu
 
 	}
 
-	void MeshRenderer::Render()
+	bool MeshRenderer::CanRayCast() const
 	{
-		if (!m_mesh || !m_material || !m_owner)
-			return;
+		return m_mesh && m_mesh->HasBvh();
+	}
+
+	bool MeshRenderer::RayCast(const Math::Ray& ray, float maxDistance, RayHit& outHit) const
+	{
+		if (!CanRayCast() || !m_owner)
+			return false;
 
-		auto renderer = Engine::GetInstance().GetRenderer();
-		if (!renderer)
+		MeshRayHit meshHit;
+		if (!m_mesh->RayCast(ray, m_owner->GetTransform().GetWorldMatrix(), maxDistance, meshHit))
+			return false;
+
+		outHit = RayHit();
+		outHit.distance = meshHit.distance;
+		outHit.position = meshHit.position;
+		outHit.normal = meshHit.normal;
+		outHit.barycentrics = meshHit.barycentrics;
+		outHit.triangleIndex = meshHit.triangleIndex;
+		outHit.mesh = m_mesh.get();
+		return true;
+	}
+
+	uint32_t MeshRenderer::RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+		RayHit outHits[Math::RayPacket::kWidth]) const
+	{
+		if (!CanRayCast() || !m_owner)
+			return 0;
+
+		MeshRayHit meshHits[Math::RayPacket::kWidth];
+		uint32_t hitMask = m_mesh->RayCastPacket(packet, m_owner->GetTransform().GetWorldMatrix(), maxDistance, meshHits);
+		for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+		{
+			if (!(hitMask & (1u << lane)))
+				continue;
+			RayHit& hit = outHits[lane];
+			hit = RayHit();
+			hit.distance = meshHits[lane].distance;
+			hit.position = meshHits[lane].position;
+			hit.normal = meshHits[lane].normal;
+			hit.barycentrics = meshHits[lane].barycentrics;
+			hit.triangleIndex = meshHits[lane].triangleIndex;
+			hit.mesh = m_mesh.get();
+		}
+		return hitMask;
+	}
+
+	void MeshRenderer::ExtractRenderData(RenderFrame& frame)
+	{
+		if (!m_mesh || !m_material || !m_owner)
 			return;
 
 		// [hs̎擾
-		DirectX::XMMATRIX worldMatrix = m_owner->GetTransform().GetWorldMatrix();
+		const Math::Matrix4& world = m_owner->GetTransform().GetWorldMatrix();
+		DirectX::XMMATRIX worldMatrix = world.ToXMMATRIX();
+
+		// LOD ̑IBJ̓eTCYŌ߁AEt߂ł͑Õt[ LOD ۂ
+		Mesh* mesh = m_mesh.get();
+		if (mesh->GetLodCount() > 1)
+		{
+			float screenSize = frame.camera.GetScreenSize(mesh->GetBounds(), worldMatrix);
+			m_currentLod = mesh->SelectLod(screenSize, m_currentLod);
+			mesh = mesh->GetLod(m_currentLod);
+		}
+
+		// NX^JOBcbVbgȂΕ`Ȃ
+		uint32_t rangeOffset = 0;
+		uint32_t rangeCount = 0;
+		if (mesh->HasMeshlets() && !frame.CullMeshlets(mesh->GetMeshlets(), worldMatrix, rangeOffset, rangeCount))
+			return;
 
-		// bV̕`
-		renderer->RenderMesh(m_mesh.get(), m_material.get(), worldMatrix);
+		// `pPbg̒ǉ
+		frame.AddDrawPacket(mesh, m_material.get(), m_material->GetShader(), worldMatrix,
+			m_worldBounds.Get(mesh, m_owner->GetTransform().GetVersion(), world), rangeOffset, rangeCount);
 	}
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "GameObject.h"
+#include "Renderer/Mesh.h"
 
 namespace Falu
 {
@@ -20,7 +21,13 @@ namespace Falu
 		MeshRenderer(GameObject* owner);
 		~MeshRenderer() override;
 
-		void Render() override;
+		void ExtractRenderData(RenderFrame& frame) override;
+
+		// bV BVH ĂΎOp`Ŕ肷(LOD0)
+		bool CanRayCast() const override;
+		bool RayCast(const Math::Ray& ray, float maxDistance, RayHit& outHit) const override;
+		uint32_t RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+			RayHit outHits[Math::RayPacket::kWidth]) const override;
 
 		void SetMesh(std::shared_ptr<Mesh> mesh) { m_mesh = mesh; }
 		void SetMaterial(std::shared_ptr<Material> material) { m_material = material; }
@@ -28,8 +35,13 @@ namespace Falu
 		std::shared_ptr<Mesh> GetMesh() const { return m_mesh; }
 		std::shared_ptr<Material> GetMaterial() const { return m_material; }
 
+		// Õt[őI LOD(0 = ̃bV)
+		uint32_t GetCurrentLod() const { return m_currentLod; }
+
 	private:
 		std::shared_ptr<Mesh> m_mesh;
 		std::shared_ptr<Material> m_material;
+		uint32_t m_currentLod;
+		MeshWorldBounds m_worldBounds;
 	};
 }
\ No newline at end of file
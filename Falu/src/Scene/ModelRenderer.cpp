@@ -5,12 +5,18 @@
  * \author tsunn
  * \date   2026/03/10
  *********************************************************************/
+// RenderFrame ƍs XMMATRIX ϊ̂߁AMath  DirectXMath ǂ
+#include "Include/Math/MathHelper.h"
 #include "ModelRenderer.h"
 #include "GameObject.h"
 #include "Renderer/Model.h"
+#include "Renderer/Mesh.h"
 #include "Renderer/ModelLoader.h"
+#include "Renderer/Material.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/RenderFrame.h"
 #include "Falu/Engine.h"
+#include <algorithm>
 
 
 namespace Falu
@@ -23,33 +29,190 @@ namespace Falu
 
 	ModelRenderer::~ModelRenderer()
 	{
-
+		CancelPendingLoad();
 	}
 
 	void ModelRenderer::Update(float deltaTime)
 	{
+		// P\̉߂fj
+		for (auto& retired : m_retiredModels)
+		{
+			--retired.framesLeft;
+		}
+		m_retiredModels.erase(
+			std::remove_if(m_retiredModels.begin(), m_retiredModels.end(),
+				[](const RetiredModel& retired) {
+					return retired.framesLeft <= 0;
+				}),
+			m_retiredModels.end()
+		);
 
+		// obNOEh̓ǂݍ݂̓WIg󂯎
+		if (m_pendingLoad)
+		{
+			if (m_pendingLoad->IsGeometryReady())
+			{
+				ApplyModel(m_pendingLoad->TakeModel(), m_pendingLoad->GetFilepath());
+				m_pendingLoad.reset();
+			}
+			else if (m_pendingLoad->GetState() == ModelLoadState::Failed)
+			{
+				m_pendingLoad.reset();
+			}
+		}
 	}
 
-	void ModelRenderer::Render()
+	void ModelRenderer::ExtractRenderData(RenderFrame& frame)
 	{
 		if (!m_model) return;
 
-		auto renderer = Engine::GetInstance().GetRenderer();
-		if (!renderer) return;
+		const Math::Matrix4& world = GetOwner()->GetTransform().GetWorldMatrix();
+		DirectX::XMMATRIX worldMatrix = world.ToXMMATRIX();
 
-		DirectX::XMMATRIX worldMatrix = GetOwner()->GetTransform().GetWorldMatrix();
+		const auto& subMeshes = m_model->GetSubMeshes();
+		m_subMeshLods.resize(subMeshes.size(), 0);
+		m_subMeshBounds.resize(subMeshes.size());
+		uint32_t transformVersion = GetOwner()->GetTransform().GetVersion();
 
-		for (const auto& subMesh : m_model->GetSubMeshes())
+		for (size_t i = 0; i < subMeshes.size(); ++i)
 		{
+			const SubMesh& subMesh = subMeshes[i];
 			if (subMesh.mesh && subMesh.material) {
-				renderer->RenderMesh(subMesh.mesh.get(),
+				// SubMesh Ƃɓe傫 LOD IԁBl̑Oɂ̓qXeVX
+				Mesh* mesh = subMesh.mesh.get();
+				if (mesh->GetLodCount() > 1)
+				{
+					float screenSize = frame.camera.GetScreenSize(mesh->GetBounds(), worldMatrix);
+					m_subMeshLods[i] = mesh->SelectLod(screenSize, m_subMeshLods[i]);
+					mesh = mesh->GetLod(m_subMeshLods[i]);
+				}
+
+				// NX^[JOBc郁bVbgȂ SubMesh Ɣ΂AΌ͈͂`
+				uint32_t rangeOffset = 0;
+				uint32_t rangeCount = 0;
+				if (mesh->HasMeshlets() && !frame.CullMeshlets(mesh->GetMeshlets(), worldMatrix, rangeOffset, rangeCount))
+					continue;
+
+				frame.AddDrawPacket(mesh,
 					subMesh.material.get(),
-					worldMatrix);
+					subMesh.material->GetShader(),
+					worldMatrix,
+					m_subMeshBounds[i].Get(mesh, transformVersion, world),
+					rangeOffset, rangeCount);
 			}
 		}
 	}
 
+	bool ModelRenderer::CanRayCast() const
+	{
+		if (!m_model)
+			return false;
+		for (const SubMesh& subMesh : m_model->GetSubMeshes())
+		{
+			if (subMesh.mesh && subMesh.mesh->HasBvh())
+				return true;
+		}
+		return false;
+	}
+
+	bool ModelRenderer::RayCast(const Math::Ray& ray, float maxDistance, RayHit& outHit) const
+	{
+		if (!m_model || !m_owner)
+			return false;
+
+		const Math::Matrix4& worldMatrix = m_owner->GetTransform().GetWorldMatrix();
+		const auto& subMeshes = m_model->GetSubMeshes();
+
+		bool hit = false;
+		float closest = maxDistance;
+		for (size_t i = 0; i < subMeshes.size(); ++i)
+		{
+			Mesh* mesh = subMeshes[i].mesh.get();
+			if (!mesh || !mesh->HasBvh())
+				continue;
+
+			// BVH ǂO SubMesh ̃oEfBOňe
+			float tMin, tMax;
+			Math::AABB worldBounds = mesh->GetBounds().Transform(worldMatrix);
+			if (!worldBounds.IntersectsRay(ray, tMin, tMax) || tMin > closest)
+				continue;
+
+			MeshRayHit meshHit;
+			if (!mesh->RayCast(ray, worldMatrix, closest, meshHit))
+				continue;
+
+			closest = meshHit.distance;
+			outHit = RayHit();
+			outHit.distance = meshHit.distance;
+			outHit.position = meshHit.position;
+			outHit.normal = meshHit.normal;
+			outHit.barycentrics = meshHit.barycentrics;
+			outHit.triangleIndex = meshHit.triangleIndex;
+			outHit.subMeshIndex = static_cast<int>(i);
+			outHit.mesh = mesh;
+			hit = true;
+		}
+		return hit;
+	}
+
+	uint32_t ModelRenderer::RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+		RayHit outHits[Math::RayPacket::kWidth]) const
+	{
+		constexpr int kWidth = Math::RayPacket::kWidth;
+		if (!m_model || !m_owner)
+			return 0;
+
+		const Math::Matrix4& worldMatrix = m_owner->GetTransform().GetWorldMatrix();
+		const auto& subMeshes = m_model->GetSubMeshes();
+
+		float closest[kWidth];
+		for (int lane = 0; lane < kWidth; ++lane)
+			closest[lane] = maxDistance[lane];
+
+		uint32_t hitMask = 0;
+		for (size_t i = 0; i < subMeshes.size(); ++i)
+		{
+			Mesh* mesh = subMeshes[i].mesh.get();
+			if (!mesh || !mesh->HasBvh())
+				continue;
+
+			// ̍ł߂qbgO SubMesh ̃oEfBOɓ͂[
+			Math::RayPacket subPacket = packet;
+			float tNear[kWidth], tFar[kWidth];
+			Math::AABB worldBounds = mesh->GetBounds().Transform(worldMatrix);
+			subPacket.activeMask = Math::IntersectAABB(packet, worldBounds.min, worldBounds.max, closest, tNear, tFar);
+			if (subPacket.activeMask == 0)
+				continue;
+
+			MeshRayHit meshHits[kWidth];
+			uint32_t meshMask = mesh->RayCastPacket(subPacket, worldMatrix, closest, meshHits);
+			for (int lane = 0; lane < kWidth; ++lane)
+			{
+				if (!(meshMask & (1u << lane)))
+					continue;
+				closest[lane] = meshHits[lane].distance;
+				RayHit& hit = outHits[lane];
+				hit = RayHit();
+				hit.distance = meshHits[lane].distance;
+				hit.position = meshHits[lane].position;
+				hit.normal = meshHits[lane].normal;
+				hit.barycentrics = meshHits[lane].barycentrics;
+				hit.triangleIndex = meshHits[lane].triangleIndex;
+				hit.subMeshIndex = static_cast<int>(i);
+				hit.mesh = mesh;
+				hitMask |= 1u << lane;
+			}
+		}
+		return hitMask;
+	}
+
+	void ModelRenderer::SetModel(std::unique_ptr<Model> model)
+	{
+		RetireModel();
+		m_model = std::move(model);
+		m_subMeshLods.clear();
+	}
+
 	bool ModelRenderer::LoadModel(const std::string& filepath)
 	{
 		// Get Device
@@ -59,17 +222,50 @@ namespace Falu
 
 		if (loadedModel)
 		{
-			m_model = std::move(loadedModel);
-			m_modelPath = filepath;
-
-			// setting bounding box
-			GetOwner()->SetBounds(m_model->GetBounds());
-
+			CancelPendingLoad();
+			ApplyModel(std::move(loadedModel), filepath);
 			return true;
 		}
 
 		return false;
 	}
 
+	void ModelRenderer::LoadModelAsync(const std::string& filepath)
+	{
+		CancelPendingLoad();
+		m_pendingLoad = ModelLoader::GetInstance().LoadModelAsync(filepath);
+	}
+
+	void ModelRenderer::ApplyModel(std::unique_ptr<Model> model, const std::string& filepath)
+	{
+		if (!model)
+			return;
+
+		RetireModel();
+		m_model = std::move(model);
+		m_modelPath = filepath;
+		m_subMeshLods.clear();
+
+		// setting bounding box
+		GetOwner()->SetBounds(m_model->GetBounds());
+	}
+
+	void ModelRenderer::RetireModel()
+	{
+		if (m_model)
+		{
+			m_retiredModels.push_back({ std::move(m_model), kRetireDelayFrames });
+		}
+	}
+
+	void ModelRenderer::CancelPendingLoad()
+	{
+		if (m_pendingLoad)
+		{
+			m_pendingLoad->Cancel();
+			m_pendingLoad.reset();
+		}
+	}
+
 }
 
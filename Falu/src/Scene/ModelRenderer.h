@@ -8,12 +8,15 @@
 #pragma once
 
 #include "GameObject.h"
+#include "Renderer/Mesh.h"
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Falu
 {
 	class Model;
+	class ModelLoadHandle;
 	
 	class ModelRenderer : public Component
 	{
@@ -22,17 +25,46 @@ namespace Falu
 		~ModelRenderer() override;
 
 		void Update(float deltaTime) override;
-		void Render() override;
+		void ExtractRenderData(RenderFrame& frame) override;
+
+		// BVH ׂĂ SubMesh(LOD0)ɑ΂Op`Pʂ̃CLXg
+		bool CanRayCast() const override;
+		bool RayCast(const Math::Ray& ray, float maxDistance, RayHit& outHit) const override;
+		uint32_t RayCastPacket(const Math::RayPacket& packet, const float maxDistance[Math::RayPacket::kWidth],
+			RayHit outHits[Math::RayPacket::kWidth]) const override;
 
 		// Setting Model
-		void SetModel(std::unique_ptr<Model> model) { m_model = std::move(model); }
+		void SetModel(std::unique_ptr<Model> model);
 		Model* GetModel()const { return m_model.get(); }
 
 		// Load Model
 		bool LoadModel(const std::string& filepath);
+		// obNOEhŃfǂݍ(ModelLoader::LoadModelAsync)B
+		// VWIg GPU ɍڂ܂ł͍̃f̂܂܁BeNX`͂̌ɓ͂
+		void LoadModelAsync(const std::string& filepath);
+		bool IsLoading() const { return m_pendingLoad != nullptr; }
+
+	private:
+		void ApplyModel(std::unique_ptr<Model> model, const std::string& filepath);
+		void CancelPendingLoad();
+		// ̃fOB`撆̃t[bV/}eAQƂĂ̂Ŕj͗P\t[
+		void RetireModel();
 
 	private:
+		static constexpr int kRetireDelayFrames = 3;
+		struct RetiredModel
+		{
+			std::unique_ptr<Model> model;
+			int framesLeft;
+		};
+
 		std::unique_ptr<Model> m_model;
+		std::vector<RetiredModel> m_retiredModels;
+		std::shared_ptr<ModelLoadHandle> m_pendingLoad;
 		std::string m_modelPath;
+
+		// SubMesh Ƃ̑Ot[őI LOD
+		std::vector<uint32_t> m_subMeshLods;
+		std::vector<MeshWorldBounds> m_subMeshBounds;
 	};
 }
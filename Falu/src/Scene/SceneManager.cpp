@@ -6,8 +6,11 @@
  * \date   2026/02/08
  *********************************************************************/
 #include "SceneManager.h"
+#include <algorithm>
+#include <cfloat>
 #include "GameObject.h"
 #include "Renderer/Camera.h"
+#include "Falu/JobSystem.h"
 
 namespace Falu
 {
@@ -18,6 +21,145 @@ namespace Falu
 	//*****************************************************************
 
 
+	namespace
+	{
+		// V[Ŝ̃[h AABB ̔z(Broadphase )Bobjects[i]  nullptr ̗vf͔΂
+		struct RayCastTargets
+		{
+			const Math::AABB* bounds;
+			GameObject* const* objects;
+			size_t count;
+		};
+
+		// GameObject::RayCastHit Ɠ̎(猂Ƃ͏o鑤)
+		bool RayCastBounds(const Math::AABB& bounds, const Math::Ray& ray, float& distance)
+		{
+			float tMin, tMax;
+			if (!bounds.IntersectsRay(ray, tMin, tMax))
+				return false;
+			distance = (tMin > 0.0f) ? tMin : tMax;
+			return distance > 0.0f;
+		}
+
+		// Precise  AABB ɓIuWFNgBentry ̓[Ƃ̓鋗
+		struct RayCastCandidate
+		{
+			GameObject* object;
+			uint32_t mask;
+			float entry[Math::RayPacket::kWidth];
+			float firstEntry;
+		};
+
+		// 1Wu󂯎pPbg(64{)
+		constexpr uint32_t kPacketsPerJob = 16;
+
+		void TracePacketBounds(const RayCastTargets& targets, const Math::RayPacket& packet,
+			float maxDistance, RayHit* outHits)
+		{
+			constexpr int kWidth = Math::RayPacket::kWidth;
+			float tBest[kWidth];
+			for (int lane = 0; lane < kWidth; ++lane)
+				tBest[lane] = maxDistance;
+
+			float tNear[kWidth], tFar[kWidth];
+			for (size_t i = 0; i < targets.count; ++i)
+			{
+				GameObject* object = targets.objects[i];
+				if (!object)
+					continue;
+
+				uint32_t mask = Math::IntersectAABB(packet, targets.bounds[i].min, targets.bounds[i].max, tBest, tNear, tFar);
+				for (int lane = 0; mask != 0 && lane < kWidth; ++lane)
+				{
+					if (!(mask & (1u << lane)))
+						continue;
+
+					// 猂Ƃ͏o鑤(GameObject::RayCastHit Ɠ)
+					float distance = (tNear[lane] > 0.0f) ? tNear[lane] : tFar[lane];
+					if (distance <= 0.0f || distance >= tBest[lane])
+						continue;
+
+					tBest[lane] = distance;
+					outHits[lane].object = object;
+					outHits[lane].distance = distance;
+				}
+			}
+
+			for (int lane = 0; lane < kWidth; ++lane)
+			{
+				if (outHits[lane].object)
+					outHits[lane].position = packet.GetLane(lane).GetPoint(outHits[lane].distance);
+			}
+		}
+
+		void TracePacketPrecise(const RayCastTargets& targets, const Math::RayPacket& packet,
+			float maxDistance, RayHit* outHits, std::vector<RayCastCandidate>& candidates)
+		{
+			constexpr int kWidth = Math::RayPacket::kWidth;
+			float tBest[kWidth];
+			for (int lane = 0; lane < kWidth; ++lane)
+				tBest[lane] = maxDistance;
+
+			// AABB ɓ鋗̋߂ɕׂ
+			candidates.clear();
+			float tNear[kWidth], tFar[kWidth];
+			for (size_t i = 0; i < targets.count; ++i)
+			{
+				GameObject* object = targets.objects[i];
+				if (!object)
+					continue;
+
+				uint32_t mask = Math::IntersectAABB(packet, targets.bounds[i].min, targets.bounds[i].max, tBest, tNear, tFar);
+				if (mask == 0)
+					continue;
+
+				RayCastCandidate candidate;
+				candidate.object = object;
+				candidate.mask = mask;
+				candidate.firstEntry = FLT_MAX;
+				for (int lane = 0; lane < kWidth; ++lane)
+				{
+					candidate.entry[lane] = std::max(tNear[lane], 0.0f);
+					if (mask & (1u << lane))
+						candidate.firstEntry = std::min(candidate.firstEntry, candidate.entry[lane]);
+				}
+				candidates.push_back(candidate);
+			}
+			std::sort(candidates.begin(), candidates.end(),
+				[](const RayCastCandidate& a, const RayCastCandidate& b) { return a.firstEntry < b.firstEntry; });
+
+			for (const RayCastCandidate& candidate : candidates)
+			{
+				// 艜n܂郌[͊OBS[O΂ȍ~Kv͂Ȃ
+				Math::RayPacket subPacket = packet;
+				subPacket.activeMask = 0;
+				float farthestBest = 0.0f;
+				for (int lane = 0; lane < kWidth; ++lane)
+				{
+					if (packet.activeMask & (1u << lane))
+						farthestBest = std::max(farthestBest, tBest[lane]);
+					if ((candidate.mask & (1u << lane)) && candidate.entry[lane] <= tBest[lane])
+						subPacket.activeMask |= 1u << lane;
+				}
+				if (candidate.firstEntry > farthestBest)
+					break;
+				if (subPacket.activeMask == 0)
+					continue;
+
+				RayHit hits[kWidth];
+				uint32_t hitMask = candidate.object->RayCastPacketPrecise(subPacket, tBest, hits);
+				for (int lane = 0; lane < kWidth; ++lane)
+				{
+					if (!(hitMask & (1u << lane)))
+						continue;
+					tBest[lane] = hits[lane].distance;
+					outHits[lane] = hits[lane];
+					outHits[lane].object = candidate.object;
+				}
+			}
+		}
+	}
+
 	Scene::Scene(const std::string& name)
 		: m_name(name)
 		, m_mainCamera(nullptr)
@@ -27,11 +169,25 @@ namespace Falu
 
 	Scene::~Scene()
 	{
+		m_pendingDestroy.clear();
 		m_gameObjects.clear();
 	}
 
 	void Scene::Update(float deltaTime)
 	{
+		// P\̉߂IuWFNgj
+		for (auto& pending : m_pendingDestroy)
+		{
+			--pending.framesLeft;
+		}
+		m_pendingDestroy.erase(
+			std::remove_if(m_pendingDestroy.begin(), m_pendingDestroy.end(),
+				[](const PendingDestroy& pending) {
+					return pending.framesLeft <= 0;
+				}),
+			m_pendingDestroy.end()
+		);
+
 		for (auto& gameObject : m_gameObjects)
 		{
 			if (gameObject && gameObject->IsActive())
@@ -41,13 +197,13 @@ namespace Falu
 		}
 	}
 
-	void Scene::Render()
+	void Scene::ExtractRenderData(RenderFrame& frame)
 	{
 		for (auto& gameObject : m_gameObjects)
 		{
 			if (gameObject && gameObject->IsActive())
 			{
-				gameObject->Render();
+				gameObject->ExtractRenderData(frame);
 			}
 		}
 	}
@@ -58,6 +214,7 @@ namespace Falu
 		GameObject* ptr = gameObject.get();
 
 		m_gameObjects.push_back(std::move(gameObject));
+		m_broadphase.Add(ptr);
 		return ptr;
 	}
 
@@ -66,13 +223,18 @@ namespace Falu
 		if (!gameObject)
 			return;
 
-		m_gameObjects.erase(
-			std::remove_if(m_gameObjects.begin(), m_gameObjects.end(),
-				[gameObject](const std::unique_ptr<GameObject>& obj) {
-					return obj.get() == gameObject;
-				}),
-			m_gameObjects.end()
-		);
+		auto it = std::find_if(m_gameObjects.begin(), m_gameObjects.end(),
+			[gameObject](const std::unique_ptr<GameObject>& obj) {
+				return obj.get() == gameObject;
+			});
+		if (it == m_gameObjects.end())
+			return;
+
+		// V[͑ɊOAbV͕̉`Xbhǂ܂Œx点
+		gameObject->SetActive(false);
+		m_broadphase.Remove(gameObject);
+		m_pendingDestroy.push_back({ std::move(*it), kDestroyDelayFrames });
+		m_gameObjects.erase(it);
 	}
 
 	GameObject* Scene::FindGameObjectByName(const std::string& name)
@@ -114,43 +276,159 @@ namespace Falu
 		return results;
 	}
 
-	GameObject* Scene::RayCast(const Math::Ray& ray, float maxDistance)
+	GameObject* Scene::RayCast(const Math::Ray& ray, float maxDistance, RayCastMode mode, RayHit* outHit)
 	{
+		if (mode == RayCastMode::Precise)
+			return RayCastPrecise(ray, maxDistance, outHit);
+
 		GameObject* hitObject = nullptr;
 		float closestDistancce = maxDistance;
 
-		for (const auto& obj : m_gameObjects)
+		// IuWFNg AABB vZAƂ̓V[Ŝ̔zɌ
+		m_broadphase.UpdateBounds();
+		const std::vector<Math::AABB>& bounds = m_broadphase.GetBounds();
+		const std::vector<GameObject*>& objects = m_broadphase.GetObjects();
+		for (size_t i = 0; i < objects.size(); ++i)
 		{
-			if (!obj->IsActive()) continue;
+			if (!objects[i]) continue;
 
 			float distance;
-			if (obj->RayCastHit(ray, distance))
+			if (RayCastBounds(bounds[i], ray, distance))
 			{
 				if (distance < closestDistancce)
 				{
 					closestDistancce = distance;
-					hitObject = obj.get();
+					hitObject = objects[i];
 				}
 			}
 		}
 
+		if (hitObject && outHit)
+		{
+			*outHit = RayHit();
+			outHit->object = hitObject;
+			outHit->distance = closestDistancce;
+			outHit->position = ray.GetPoint(closestDistancce);
+		}
 		return hitObject;
 	}
 
+	GameObject* Scene::RayCastPrecise(const Math::Ray& ray, float maxDistance, RayHit* outHit)
+	{
+		// AABB ɓ鋗̋߂ɒׁAOœĂΑł؂
+		std::vector<std::pair<float, GameObject*>> candidates;
+		m_broadphase.UpdateBounds();
+		const std::vector<Math::AABB>& bounds = m_broadphase.GetBounds();
+		const std::vector<GameObject*>& objects = m_broadphase.GetObjects();
+		for (size_t i = 0; i < objects.size(); ++i)
+		{
+			if (!objects[i]) continue;
+
+			float tMin, tMax;
+			if (bounds[i].IntersectsRay(ray, tMin, tMax) && tMin <= maxDistance)
+				candidates.emplace_back(tMin, objects[i]);
+		}
+		std::sort(candidates.begin(), candidates.end(),
+			[](const std::pair<float, GameObject*>& a, const std::pair<float, GameObject*>& b) {
+				return a.first < b.first;
+			});
+
+		RayHit closest;
+		float closestDistance = maxDistance;
+		for (const auto& candidate : candidates)
+		{
+			if (candidate.first > closestDistance)
+				break;
+
+			RayHit hit;
+			if (candidate.second->RayCastPrecise(ray, closestDistance, hit))
+			{
+				closestDistance = hit.distance;
+				closest = hit;
+				closest.object = candidate.second;
+			}
+		}
+
+		if (closest.object && outHit)
+			*outHit = closest;
+		return closest.object;
+	}
+
+	size_t Scene::RayCastBatch(ArrayView<Math::Ray> rays, RayHit* outHits, float maxDistance, RayCastMode mode)
+	{
+		constexpr uint32_t kWidth = Math::RayPacket::kWidth;
+		if (rays.empty() || !outHits)
+			return 0;
+
+		// [hs AABB ̒xvZ̓XbhZ[tłȂ̂ŁAőSς܂Ă烏[J[ɓn
+		m_broadphase.UpdateBounds();
+		RayCastTargets targets = { m_broadphase.GetBounds().data(), m_broadphase.GetObjects().data(),
+			m_broadphase.GetObjects().size() };
+
+		const uint32_t rayCount = static_cast<uint32_t>(rays.size());
+		const uint32_t packetCount = (rayCount + kWidth - 1) / kWidth;
+		const uint32_t jobCount = (packetCount + kPacketsPerJob - 1) / kPacketsPerJob;
+
+		auto traceJob = [&](uint32_t job)
+		{
+			std::vector<RayCastCandidate> candidates;
+			uint32_t firstPacket = job * kPacketsPerJob;
+			uint32_t lastPacket = std::min(packetCount, firstPacket + kPacketsPerJob);
+			for (uint32_t p = firstPacket; p < lastPacket; ++p)
+			{
+				uint32_t firstRay = p * kWidth;
+				uint32_t laneCount = std::min(kWidth, rayCount - firstRay);
+
+				Math::RayPacket packet;
+				RayHit hits[kWidth];
+				for (uint32_t lane = 0; lane < laneCount; ++lane)
+					packet.SetLane(lane, rays[firstRay + lane]);
+
+				if (mode == RayCastMode::Precise)
+					TracePacketPrecise(targets, packet, maxDistance, hits, candidates);
+				else
+					TracePacketBounds(targets, packet, maxDistance, hits);
+
+				for (uint32_t lane = 0; lane < laneCount; ++lane)
+					outHits[firstRay + lane] = hits[lane];
+			}
+		};
+
+		if (jobCount > 1 && JobSystem::GetInstance().GetWorkerCount() > 0)
+		{
+			JobSystem::GetInstance().ParallelFor(jobCount, traceJob);
+		}
+		else
+		{
+			for (uint32_t job = 0; job < jobCount; ++job)
+				traceJob(job);
+		}
+
+		size_t hitCount = 0;
+		for (uint32_t i = 0; i < rayCount; ++i)
+		{
+			if (outHits[i].object)
+				++hitCount;
+		}
+		return hitCount;
+	}
+
 	std::vector<GameObject*> Scene::RaycastAll(const Math::Ray& ray, float maxDistance)
 	{
 		// ڐGIuWFNg̍ČvZh߃LbVɕۑ
 		std::vector<std::pair<GameObject*, float>> hits; 
 
-
-		for (const auto& obj : m_gameObjects)
+		m_broadphase.UpdateBounds();
+		const std::vector<Math::AABB>& bounds = m_broadphase.GetBounds();
+		const std::vector<GameObject*>& objects = m_broadphase.GetObjects();
+		for (size_t i = 0; i < objects.size(); ++i)
 		{
-			if (!obj->IsActive()) continue;
+			if (!objects[i]) continue;
 
 			float distance;
-			if (obj->RayCastHit(ray, distance) && distance <= maxDistance)
+			if (RayCastBounds(bounds[i], ray, distance) && distance <= maxDistance)
 			{
-				hits.emplace_back(obj.get(),distance);
+				hits.emplace_back(objects[i], distance);
 			}
 		}
 
@@ -193,14 +471,15 @@ namespace Falu
 		if (m_currentScene)
 		{
 			m_currentScene->Update(deltaTime);
+			m_currentScene->UpdateBroadphase();
 		}
 	}
 
-	void SceneManager::Render()
+	void SceneManager::ExtractRenderData(RenderFrame& frame)
 	{
 		if (m_currentScene)
 		{
-			m_currentScene->Render();
+			m_currentScene->ExtractRenderData(frame);
 		}
 	}
 
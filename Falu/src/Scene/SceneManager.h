@@ -11,11 +11,16 @@
 #include <memory>
 #include <string>
 #include "Scene/GameObject.h"
+#include "Scene/Broadphase.h"
 #include "Include/Math/Ray.h"
+#include "Include/Math/RayPacket.h"
+#include "Include/Utils/ArrayView.h"
+#include "Renderer/RenderView.h"
 
 namespace Falu
 {
 	class Camera;
+	struct RenderFrame;
 
 	/// @brief V[NX
 	class Scene
@@ -27,7 +32,7 @@ namespace Falu
 		virtual void OnLoad() {}
 		virtual void OnUnload() {}
 		virtual void Update(float deltaTime);
-		virtual void Render();
+		virtual void ExtractRenderData(RenderFrame& frame);
 
 		//=== Management GameObject ===
 		GameObject* CreateGameObject(const std::string& name = "GameObject");
@@ -44,10 +49,42 @@ namespace Falu
 		//=== Management Camera ===
 		void SetMainCamera(Camera* camera) { m_mainCamera = camera; }
 		Camera* GetMainCamera() const { return m_mainCamera; }
+		// CJ̕`͈(͉ʑS)Bʂł͂߂Ďc AddView Ŗ߂
+		void SetMainViewport(const ViewportRect& viewport) { m_mainViewport = viewport; }
+		const ViewportRect& GetMainViewport() const { return m_mainViewport; }
+
+		//=== Render Views ===
+		// CJȊÕr[BČɓo^ŕ`AJO͑Sr[܂Ƃ߂1ōs
+		size_t AddView(const RenderViewDesc& view) { m_views.push_back(view); return m_views.size() - 1; }
+		RenderViewDesc& GetView(size_t index) { return m_views[index]; }
+		const std::vector<RenderViewDesc>& GetViews() const { return m_views; }
+		void ClearViews() { m_views.clear(); }
 
 		//=== Ray Cast ===
-		GameObject* RayCast(const Math::Ray& ray, float maxDistance = 1000.0f);
+		// Precise  BVH bVOp`Ŕ肷BoutHit Γʒu/@Ȃǂ
+		GameObject* RayCast(const Math::Ray& ray, float maxDistance = 1000.0f,
+			RayCastMode mode = RayCastMode::Bounds, RayHit* outHit = nullptr);
 		std::vector<GameObject*> RaycastAll(const Math::Ray& ray, float maxDistance = 1000.0f);
+		// ʂ̃C܂Ƃ߂Ĕ肷B4{pPbgɂ SIMD ŃoEfBO{bNX/BVH HA
+		// { JobSystem ̃[J[ɕBoutHits  rays ƓKvŁA
+		// OꂽC object == nullptr ɂȂB{ԂB
+		// V[ύXĂXbh(Q[Xbh)ĂԂ
+		size_t RayCastBatch(ArrayView<Math::Ray> rays, RayHit* outHits, float maxDistance = 1000.0f,
+			RayCastMode mode = RayCastMode::Bounds);
+
+		//=== Overlap ===
+		// ړIuWFNg𔽉fďdȂyAƊJn/ICxgXVB
+		// SceneManager  Update ̌ɖt[Ă
+		void UpdateBroadphase() { m_broadphase.Update(); }
+		// [h AABB  bounds ƏdȂLȃIuWFNg outObjects ɒǉ(Ō UpdateBroadphase _̈ʒu)
+		void OverlapBox(const Math::AABB& bounds, std::vector<GameObject*>& outObjects) const
+		{
+			m_broadphase.OverlapBox(bounds, outObjects);
+		}
+		const std::vector<OverlapPair>& GetOverlapPairs() const { return m_broadphase.GetPairs(); }
+		const std::vector<OverlapPair>& GetBeginOverlaps() const { return m_broadphase.GetBeginOverlaps(); }
+		const std::vector<OverlapPair>& GetEndOverlaps() const { return m_broadphase.GetEndOverlaps(); }
+		const Broadphase& GetBroadphase() const { return m_broadphase; }
 
 		//=== Getter ===
 		const std::string& GetName() const { return m_name; }
@@ -58,6 +95,23 @@ namespace Falu
 		std::string m_name;
 		std::vector<std::unique_ptr<GameObject>> m_gameObjects;
 		Camera* m_mainCamera;
+		ViewportRect m_mainViewport;
+		std::vector<RenderViewDesc> m_views;
+
+	private:
+		GameObject* RayCastPrecise(const Math::Ray& ray, float maxDistance, RayHit* outHit);
+
+		// `Xbht[xĎQƂ邽߁Aj͗P\t[ɍs
+		static constexpr int kDestroyDelayFrames = 3;
+		struct PendingDestroy
+		{
+			std::unique_ptr<GameObject> object;
+			int framesLeft;
+		};
+		std::vector<PendingDestroy> m_pendingDestroy;
+
+		// CreateGameObject IuWFNg̏dȂ蔻
+		Broadphase m_broadphase;
 	};
 	//=== Implimentation Template ===
 	template<typename T>
@@ -84,7 +138,7 @@ namespace Falu
 		~SceneManager();
 
 		void Update(float deltaTime);
-		void Render();
+		void ExtractRenderData(RenderFrame& frame);
 
 		void LoadScene(std::unique_ptr<Scene> scene);
 		void UnloadCurrentScene();
@@ -11,11 +11,14 @@ namespace Falu
 {
 	Transform::Transform()
 		: m_position(0.0f,0.0f,0.0f)
-		, m_rotation(0.0f,0.0f,0.0f)
+		, m_orientation()
+		, m_euler(0.0f,0.0f,0.0f)
 		, m_scale(1.0f,1.0f,1.0f)
+		, m_worldMatrix(Math::Matrix4::Identity())
 		, m_isDirty(true)
+		, m_version(0)
 	{
-		m_worldMatrix = DirectX::XMMatrixIdentity();
+
 	}
 
 	Transform::~Transform()
@@ -26,43 +29,50 @@ namespace Falu
 	void Transform::SetPosition(const Math::Vector3& position)
 	{
 		m_position = position;
-		m_isDirty = true;
+		MarkDirty();
 	}
 
 	void Transform::SetPosition(float x, float y, float z)
 	{
 		m_position = Math::Vector3(x, y, z);
-		m_isDirty = true;
+		MarkDirty();
 	}
 
 	void Transform::SetRotation(const Math::Vector3& rotation)
 	{
-		m_rotation = rotation;
-		m_isDirty = true;
+		m_euler = rotation;
+		m_orientation = Math::Quaternion::FromEuler(rotation);
+		MarkDirty();
 	}
 
 	void Transform::SetRotation(float x, float y, float z)
 	{
-		m_rotation = Math::Vector3(x, y, z);
-		m_isDirty = true;
+		SetRotation(Math::Vector3(x, y, z));
+	}
+
+	void Transform::SetOrientation(const Math::Quaternion& orientation)
+	{
+		m_orientation = Math::Normalize(orientation);
+		m_euler = m_orientation.ToEuler();
+		MarkDirty();
 	}
 
 	void Transform::SetScale(const Math::Vector3& scale)
 	{
 		m_scale = scale;
-		m_isDirty = true;
+		MarkDirty();
 	}
 
 	void Transform::SetScale(float x, float y, float z)
 	{
 		m_scale = Math::Vector3(x, y, z);
-		m_isDirty = true;
+		MarkDirty();
 	}
 
 	void Transform::SetScale(float uniformScale)
 	{
 		m_scale = Math::Vector3(uniformScale, uniformScale, uniformScale);
-		m_isDirty = true;
+		MarkDirty();
 	}
 
 	void Transform::Translate(const Math::Vector3& translation)
@@ -70,79 +80,58 @@ namespace Falu
 		m_position.x += translation.x;
 		m_position.y += translation.y;
 		m_position.z += translation.z;
-		m_isDirty = true;
+		MarkDirty();
 	}
 
 	void Transform::Rotate(const Math::Vector3& rotation)
 	{
-		m_rotation.x += rotation.x;
-		m_rotation.y += rotation.y;
-		m_rotation.z += rotation.z;
-		m_isDirty = true;
+		// IC[pɑ(]ǂ)
+		SetRotation(m_euler + rotation);
 	}
 
-	DirectX::XMMATRIX Transform::GetWorldMatrix() const
+	void Transform::Rotate(const Math::Quaternion& delta)
 	{
-		if (m_isDirty)
-		{
-			const_cast<Transform*>(this)->UpdateMatrix();
-		}
-		return m_worldMatrix;
+		SetOrientation(m_orientation * delta);
 	}
 
-	DirectX::XMMATRIX Transform::GetWorldMatrixTranspose() const
-	{
-		return DirectX::XMMatrixTranspose(GetWorldMatrix());
-	}
-	Math::Vector3 Transform::GetForward() const
+	void Transform::MarkDirty()
 	{
-		return GetDirections().forward;
+		m_isDirty = true;
+		++m_version;
 	}
 
-	Math::Vector3 Transform::GetRight() const
+	const Math::Matrix4& Transform::GetWorldMatrix() const
 	{
-		return GetDirections().right;
+		if (m_isDirty)
+		{
+			const_cast<Transform*>(this)->UpdateMatrix();
+		}
+		return m_worldMatrix;
 	}
 
-	Math::Vector3 Transform::GetUp() const
+	Math::Matrix4 Transform::GetWorldMatrixTranspose() const
 	{
-		return GetDirections().up;
+		return Math::Transpose(GetWorldMatrix());
 	}
 
-	Transform::Directions Transform::GetDirections() const
+	const Transform::Directions& Transform::GetDirections() const
 	{
-		DirectX::XMMATRIX rotationMatrix = DirectX::XMMatrixRotationRollPitchYaw(
-			m_rotation.x,m_rotation.y,m_rotation.z
-		);
-
-		DirectX::XMFLOAT3 f, r, u;
-
-		DirectX::XMVECTOR forward = DirectX::XMVector3TransformNormal(
-			DirectX::XMVectorSet(0, 0, 1, 0), rotationMatrix);
-		DirectX::XMVECTOR right = DirectX::XMVector3TransformNormal(
-			DirectX::XMVectorSet(1, 0, 0, 0), rotationMatrix);
-		DirectX::XMVECTOR up = DirectX::XMVector3TransformNormal(
-			DirectX::XMVectorSet(0, 1, 0, 0), rotationMatrix);
-
-		DirectX::XMStoreFloat3(&f, forward);
-		DirectX::XMStoreFloat3(&r, right);
-		DirectX::XMStoreFloat3(&u, up);
-		return {
-			Math::Vector3(f.x, f.y, f.z),
-			Math::Vector3(r.x, r.y, r.z),
-			Math::Vector3(u.x, u.y, u.z)
-		};
+		if (m_isDirty)
+		{
+			const_cast<Transform*>(this)->UpdateMatrix();
+		}
+		return m_directions;
 	}
 
 	void Transform::UpdateMatrix()
 	{
-		using namespace DirectX;
-
-		XMMATRIX scaleMatrix = XMMatrixScaling(m_scale.x, m_scale.y, m_scale.z);
-		XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(m_rotation.x, m_rotation.y, m_rotation.z);
-		XMMATRIX translationMatrix = XMMatrixTranslation(m_position.x, m_position.y, m_position.z);
+		// ]s̊eŝ܂ right / up / forward ɂȂ
+		Math::Matrix4 rotation = Math::Matrix4::Rotation(m_orientation);
+		m_directions.right = rotation.GetRow(0);
+		m_directions.up = rotation.GetRow(1);
+		m_directions.forward = rotation.GetRow(2);
 
-		m_worldMatrix = scaleMatrix * rotationMatrix * translationMatrix;
+		m_worldMatrix = Math::Matrix4::TRS(m_position, m_orientation, m_scale);
 		m_isDirty = false;
 	}
 }
@@ -8,7 +8,9 @@
 
 #pragma once
 
-#include "Include/Math/MathHelper.h"
+#include <cstdint>
+#include "Include/Math/Matrix.h"
+#include "Include/Math/Quaternion.h"
 
 namespace Falu
 {
@@ -24,9 +26,14 @@ namespace Falu
 		Math::Vector3 GetPosition()const { return m_position; }
 
 		//=== Rotation === 
+		// ]̓NH[^jIŎBIC[p(WA: x=sb`, y=[, z=[)͕֋Xp̑
 		void SetRotation(const Math::Vector3& rotation);
 		void SetRotation(float x, float y, float z);
-		Math::Vector3 GetRotation() const { return m_rotation;}
+		// Ōɐݒ肵IC[p(SetOrientation ̓NH[^jItZl)
+		Math::Vector3 GetRotation() const { return m_euler;}
+
+		void SetOrientation(const Math::Quaternion& orientation);
+		const Math::Quaternion& GetOrientation() const { return m_orientation; }
 
 		//=== Scale ===
 		void SetScale(const Math::Vector3& scale);
@@ -37,15 +44,19 @@ namespace Falu
 		//=== Transform operations === 
 		void Translate(const Math::Vector3& translation);
 		void Rotate(const Math::Vector3& rotation);
+		// ݂̉]̌Ƀ[h delta |
+		void Rotate(const Math::Quaternion& delta);
 
 		//=== Matrix === 
-		DirectX::XMMATRIX GetWorldMatrix() const;
-		DirectX::XMMATRIX GetWorldMatrixTranspose() const;
+		// sxNg`(XMMATRIX Ɠ)BD3D ɓnƂ ToXMMATRIX() ŕϊ
+		const Math::Matrix4& GetWorldMatrix() const;
+		Math::Matrix4 GetWorldMatrixTranspose() const;
 
 		//=== Directions vectors ===
-		Math::Vector3 GetForward() const;
-		Math::Vector3 GetRight() const;
-		Math::Vector3 GetUp() const;
+		// [hsƈꏏɌvẐԂ(ĂԂтɎOp֐vZȂ)
+		Math::Vector3 GetForward() const { return GetDirections().forward; }
+		Math::Vector3 GetRight() const { return GetDirections().right; }
+		Math::Vector3 GetUp() const { return GetDirections().up; }
 
 		struct Directions
 		{
@@ -53,17 +64,24 @@ namespace Falu
 			Math::Vector3 right;
 			Math::Vector3 up;
 		};
-		Directions GetDirections() const;
+		const Directions& GetDirections() const;
+
+		// ʒu/]/XP[ς邽тɑBCamera ȂǂÕLbV̖Ɏg
+		uint32_t GetVersion() const { return m_version; }
 
 	private:
+		void MarkDirty();
 		void UpdateMatrix();
 
 	private:
 		Math::Vector3 m_position;
-		Math::Vector3 m_rotation; //IC[
+		Math::Quaternion m_orientation;
+		Math::Vector3 m_euler; //IC[(GetRotation p)
 		Math::Vector3 m_scale;
 
-		mutable DirectX::XMMATRIX m_worldMatrix;
+		mutable Math::Matrix4 m_worldMatrix;
+		mutable Directions m_directions;
 		mutable bool m_isDirty;
+		uint32_t m_version;
 	};
 }
@@ -0,0 +1,162 @@
+/*****************************************************************//**
+ * \file   AabbTransformTest.cpp
+ * \brief  AABB::Transform ƃ[h AABB ̃LbV 8 _̕ϊƔׂeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Include/Math/Ray.h"
+#include "Scene/GameObject.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Falu;
+
+namespace
+{
+	// 8 _ double ŕϊĕށAƂ GetWorldBounds Ɠ
+	void CornerBounds(const Math::AABB& box, const Math::Matrix4& matrix, double outMin[3], double outMax[3])
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			outMin[j] = INFINITY;
+			outMax[j] = -INFINITY;
+		}
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			double p[3] = {
+				(corner & 1) ? box.max.x : box.min.x,
+				(corner & 2) ? box.max.y : box.min.y,
+				(corner & 4) ? box.max.z : box.min.z,
+			};
+			for (int j = 0; j < 3; ++j)
+			{
+				double v = p[0] * matrix.m[0][j] + p[1] * matrix.m[1][j] + p[2] * matrix.m[2][j] + matrix.m[3][j];
+				outMin[j] = std::min(outMin[j], v);
+				outMax[j] = std::max(outMax[j], v);
+			}
+		}
+	}
+
+	// float ̊ۂߌ덷͑킹鍀̑傫ɔႷ̂ŁA1e-6 ̑傫ŐL΂ĔׂB
+	// ʂ̑傫gƁAsړƉ]ł 0 t߂ŌȂ肷
+	bool MatchesCorners(const Math::AABB& result, const Math::AABB& box, const Math::Matrix4& matrix)
+	{
+		double cornerMin[3], cornerMax[3];
+		CornerBounds(box, matrix, cornerMin, cornerMax);
+
+		const double extent[3] = {
+			std::max(std::fabs(box.min.x), std::fabs(box.max.x)),
+			std::max(std::fabs(box.min.y), std::fabs(box.max.y)),
+			std::max(std::fabs(box.min.z), std::fabs(box.max.z)),
+		};
+		const float resultMin[3] = { result.min.x, result.min.y, result.min.z };
+		const float resultMax[3] = { result.max.x, result.max.y, result.max.z };
+		for (int j = 0; j < 3; ++j)
+		{
+			double magnitude = std::fabs(matrix.m[3][j]);
+			for (int i = 0; i < 3; ++i)
+				magnitude += std::fabs(matrix.m[i][j]) * extent[i];
+			magnitude = std::max(1.0, magnitude);
+			double tolerance = 1e-6 * magnitude;
+			if (std::fabs(resultMin[j] - cornerMin[j]) > tolerance || std::fabs(resultMax[j] - cornerMax[j]) > tolerance)
+				return false;
+		}
+		return true;
+	}
+
+	Math::AABB RandomBox(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> size(0.01f, 20.0f);
+		Math::Vector3 center(unit(rng) * 10.0f, unit(rng) * 10.0f, unit(rng) * 10.0f);
+		Math::Vector3 half(size(rng) * 0.5f, size(rng) * 0.5f, size(rng) * 0.5f);
+		return Math::AABB(center - half, center + half);
+	}
+
+	Math::Vector3 RandomScale(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> logScale(std::log(0.1f), std::log(10.0f));
+		Math::Vector3 scale(std::exp(logScale(rng)), std::exp(logScale(rng)), std::exp(logScale(rng)));
+		// (̃XP[)
+		if (rng() % 8 == 0)
+			scale.x = -scale.x;
+		return scale;
+	}
+
+	void TestAgainstCorners()
+	{
+		std::mt19937 rng(48);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		int failures = 0;
+		for (int trial = 0; trial < 100000; ++trial)
+		{
+			Math::Vector3 position(unit(rng) * 100.0f, unit(rng) * 100.0f, unit(rng) * 100.0f);
+			Math::Quaternion rotation = Math::Quaternion::FromEuler(unit(rng) * 3.2f, unit(rng) * 3.2f, unit(rng) * 3.2f);
+			Math::Matrix4 matrix = Math::Matrix4::TRS(position, rotation, RandomScale(rng));
+
+			Math::AABB box = RandomBox(rng);
+			if (!MatchesCorners(box.Transform(matrix), box, matrix))
+				++failures;
+		}
+		FALU_CHECK(failures == 0);
+
+		// PʍsƕsړȂ猳̔̂܂ܓ
+		Math::AABB box(Math::Vector3(-1.0f, -2.0f, -3.0f), Math::Vector3(4.0f, 5.0f, 6.0f));
+		Math::AABB same = box.Transform(Math::Matrix4::Identity());
+		FALU_CHECK(same.min == box.min && same.max == box.max);
+		Math::AABB moved = box.Transform(Math::Matrix4::TRS(Math::Vector3(10.0f, 0.0f, -10.0f), Math::Quaternion::Identity(), Math::Vector3(1.0f, 1.0f, 1.0f)));
+		FALU_CHECK(moved.min == Math::Vector3(9.0f, -2.0f, -13.0f) && moved.max == Math::Vector3(14.0f, 5.0f, -4.0f));
+	}
+
+	// GetWorldBounds ̃LbV́AgXtH[[J AABB ςƂ蒼A
+	// ɍ̍sł 8 _̌ʂƈv
+	void TestCachedWorldBounds()
+	{
+		std::mt19937 rng(480);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		GameObject object;
+		object.SetBounds(RandomBox(rng));
+		for (int step = 0; step < 5000; ++step)
+		{
+			uint32_t before = object.GetBoundsVersion();
+			Math::AABB cached = object.GetWorldBounds();
+
+			Transform& transform = object.GetTransform();
+			switch (rng() % 7)
+			{
+			case 0: transform.SetPosition(unit(rng) * 100.0f, unit(rng) * 100.0f, unit(rng) * 100.0f); break;
+			case 1: transform.Translate(Math::Vector3(unit(rng), unit(rng), unit(rng))); break;
+			case 2: transform.SetRotation(unit(rng) * 3.2f, unit(rng) * 3.2f, unit(rng) * 3.2f); break;
+			case 3: transform.Rotate(Math::Vector3(unit(rng), unit(rng), unit(rng))); break;
+			case 4: transform.SetScale(RandomScale(rng)); break;
+			case 5: object.SetBounds(RandomBox(rng)); break;
+			default: break;
+			}
+
+			const Math::AABB& world = object.GetWorldBounds();
+			if (object.GetBoundsVersion() == before)
+			{
+				// ςĂȂ΃LbV̂܂ܕԂ
+				FALU_CHECK(world.min == cached.min && world.max == cached.max);
+			}
+			FALU_CHECK(MatchesCorners(world, object.GetLocalBounds(), transform.GetWorldMatrix()));
+
+			// 2 ڂ̌Ăяo͓LbVԂ
+			FALU_CHECK(&object.GetWorldBounds() == &world);
+		}
+	}
+}
+
+int main()
+{
+	TestAgainstCorners();
+	TestCachedWorldBounds();
+
+	return Test::Result();
+}
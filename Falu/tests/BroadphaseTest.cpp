@@ -0,0 +1,240 @@
+/*****************************************************************//**
+ * \file   BroadphaseTest.cpp
+ * \brief  Broadphase ̃yAƃCxg𑍓ƔׂeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Scene/Broadphase.h"
+#include "Scene/GameObject.h"
+#include "Falu/JobSystem.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+
+using namespace Falu;
+
+namespace
+{
+	using PairSet = std::set<std::pair<const GameObject*, const GameObject*>>;
+
+	std::pair<const GameObject*, const GameObject*> Unordered(const GameObject* a, const GameObject* b)
+	{
+		return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+	}
+
+	PairSet ToSet(const std::vector<OverlapPair>& pairs)
+	{
+		PairSet set;
+		for (const OverlapPair& pair : pairs)
+			set.insert(Unordered(pair.a, pair.b));
+		return set;
+	}
+
+	void Randomize(GameObject& object, std::mt19937& rng, float worldSize)
+	{
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		object.GetTransform().SetPosition(unit(rng) * worldSize, unit(rng) * worldSize * 0.2f, unit(rng) * worldSize);
+		object.GetTransform().SetRotation(unit(rng) * 3.0f, unit(rng) * 3.0f, unit(rng) * 3.0f);
+		object.GetTransform().SetScale(1.0f + unit(rng) * 0.5f);
+	}
+
+	// V[ɎcĂIuWFNgƁAu[htF[Yւ̏o𑍓Œǂ
+	struct World
+	{
+		std::vector<std::unique_ptr<GameObject>> objects;
+		// 폜 Update ̏ICxgŵŁA Update ̌܂ŐĂ
+		std::vector<std::unique_ptr<GameObject>> removed;
+	};
+
+	// O Update ̎_ŏdȂĂAANeBuȃIuWFNg̃yȂ
+	PairSet BruteForcePairs(const World& world)
+	{
+		PairSet pairs;
+		for (size_t i = 0; i < world.objects.size(); ++i)
+		{
+			const GameObject* a = world.objects[i].get();
+			if (!a->IsActive())
+				continue;
+			for (size_t j = i + 1; j < world.objects.size(); ++j)
+			{
+				const GameObject* b = world.objects[j].get();
+				if (b->IsActive() && a->GetWorldBounds().Intersects(b->GetWorldBounds()))
+					pairs.insert(Unordered(a, b));
+			}
+		}
+		return pairs;
+	}
+
+	// yAAJn/ICxgAGetBounds / GetObjectsAOverlapBox 𑍓Ɣׂ
+	void CheckBroadphase(const Broadphase& broadphase, const World& world, const PairSet& previous, std::mt19937& rng)
+	{
+		PairSet expected = BruteForcePairs(world);
+		PairSet pairs = ToSet(broadphase.GetPairs());
+		FALU_CHECK(pairs == expected);
+		FALU_CHECK(pairs.size() == broadphase.GetPairs().size());
+
+		PairSet begin, end;
+		std::set_difference(expected.begin(), expected.end(), previous.begin(), previous.end(), std::inserter(begin, begin.end()));
+		std::set_difference(previous.begin(), previous.end(), expected.begin(), expected.end(), std::inserter(end, end.end()));
+		FALU_CHECK(ToSet(broadphase.GetBeginOverlaps()) == begin);
+		FALU_CHECK(ToSet(broadphase.GetEndOverlaps()) == end);
+		FALU_CHECK(broadphase.GetBeginOverlaps().size() == begin.size());
+		FALU_CHECK(broadphase.GetEndOverlaps().size() == end.size());
+
+		// GetObjects ̓Y{fB IDBANeBuȃIuWFNg͂傤 1 ÃoEfBOƕŏo
+		const std::vector<GameObject*>& bodies = broadphase.GetObjects();
+		const std::vector<Math::AABB>& bounds = broadphase.GetBounds();
+		FALU_CHECK(bodies.size() == bounds.size());
+		std::vector<std::pair<const GameObject*, size_t>> bodyOf;
+		for (size_t i = 0; i < bodies.size(); ++i)
+		{
+			if (!bodies[i])
+				continue;
+			bodyOf.emplace_back(bodies[i], i);
+			const Math::AABB& box = bodies[i]->GetWorldBounds();
+			FALU_CHECK(bounds[i].min == box.min && bounds[i].max == box.max);
+		}
+		std::sort(bodyOf.begin(), bodyOf.end());
+		size_t activeCount = 0;
+		for (const auto& object : world.objects)
+		{
+			if (!object->IsActive())
+				continue;
+			++activeCount;
+			auto it = std::lower_bound(bodyOf.begin(), bodyOf.end(), std::make_pair(static_cast<const GameObject*>(object.get()), size_t(0)));
+			FALU_CHECK(it != bodyOf.end() && it->first == object.get());
+		}
+		FALU_CHECK(bodyOf.size() == activeCount);
+
+		// yA a ̃{fB ID  b 菬A{fB ID ɕ
+		auto bodyId = [&bodyOf](const GameObject* object)
+		{
+			auto it = std::lower_bound(bodyOf.begin(), bodyOf.end(), std::make_pair(object, size_t(0)));
+			return it != bodyOf.end() && it->first == object ? it->second : SIZE_MAX;
+		};
+		std::pair<size_t, size_t> last(0, 0);
+		for (size_t p = 0; p < broadphase.GetPairs().size(); ++p)
+		{
+			const OverlapPair& pair = broadphase.GetPairs()[p];
+			std::pair<size_t, size_t> ids(bodyId(pair.a), bodyId(pair.b));
+			FALU_CHECK(ids.first < ids.second);
+			if (p > 0)
+				FALU_CHECK(last < ids);
+			last = ids;
+		}
+
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		for (int q = 0; q < 10; ++q)
+		{
+			Math::Vector3 center(unit(rng) * 100.0f, unit(rng) * 20.0f, unit(rng) * 100.0f);
+			Math::Vector3 half(5.0f + unit(rng) * 4.0f, 5.0f + unit(rng) * 4.0f, 5.0f + unit(rng) * 4.0f);
+			Math::AABB query(center - half, center + half);
+
+			std::vector<GameObject*> found;
+			broadphase.OverlapBox(query, found);
+			std::sort(found.begin(), found.end());
+			std::vector<GameObject*> expectedObjects;
+			for (const auto& object : world.objects)
+			{
+				if (object->IsActive() && object->GetWorldBounds().Intersects(query))
+					expectedObjects.push_back(object.get());
+			}
+			std::sort(expectedObjects.begin(), expectedObjects.end());
+			FALU_CHECK(found == expectedObjects);
+		}
+	}
+
+	// t[ꕔ̃IuWFNg/傫A񂵁AoEfBOςAANeBu؂ւA
+	// ǉƍ폜āAe Update ̌ʂ𑍓Ɣׂ
+	void TestRandomFrames()
+	{
+		const float worldSize = 100.0f;
+		std::mt19937 rng(47);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		Broadphase broadphase(0.5f);
+		World world;
+		for (int i = 0; i < 1500; ++i)
+		{
+			world.objects.push_back(std::make_unique<GameObject>());
+			Randomize(*world.objects.back(), rng, worldSize);
+			broadphase.Add(world.objects.back().get());
+		}
+
+		PairSet previous;
+		size_t beginEvents = 0, endEvents = 0;
+		for (int frame = 0; frame < 60; ++frame)
+		{
+			for (auto& object : world.objects)
+			{
+				uint32_t roll = rng() % 100;
+				Transform& transform = object->GetTransform();
+				if (roll < 20)
+					transform.Translate(Math::Vector3(unit(rng) * 0.2f, unit(rng) * 0.2f, unit(rng) * 0.2f));
+				else if (roll < 23)
+					Randomize(*object, rng, worldSize);
+				else if (roll < 25)
+					transform.Rotate(Math::Vector3(unit(rng), unit(rng), unit(rng)));
+				else if (roll < 26)
+					object->SetBounds(Math::AABB(Math::Vector3(-1.0f, -0.5f, -2.0f) * (1.5f + unit(rng)), Math::Vector3(1.0f, 0.5f, 2.0f) * (1.5f + unit(rng))));
+				else if (roll < 28)
+					object->SetActive(!object->IsActive());
+			}
+
+			// 폜({fB͏ICxǧŎg񂳂)ƒǉ
+			for (int r = 0; r < 10 && !world.objects.empty(); ++r)
+			{
+				size_t index = rng() % world.objects.size();
+				broadphase.Remove(world.objects[index].get());
+				world.removed.push_back(std::move(world.objects[index]));
+				world.objects.erase(world.objects.begin() + index);
+			}
+			for (int a = 0; a < 10; ++a)
+			{
+				world.objects.push_back(std::make_unique<GameObject>());
+				Randomize(*world.objects.back(), rng, worldSize);
+				broadphase.Add(world.objects.back().get());
+			}
+
+			// UpdateBounds ł̓yAƃCxg͕ςȂ
+			if (frame % 10 == 5)
+			{
+				std::vector<OverlapPair> before = broadphase.GetPairs();
+				broadphase.UpdateBounds();
+				FALU_CHECK(ToSet(broadphase.GetPairs()) == ToSet(before));
+			}
+
+			broadphase.Update();
+			CheckBroadphase(broadphase, world, previous, rng);
+			FALU_CHECK(broadphase.GetBodyCount() == world.objects.size());
+
+			beginEvents += broadphase.GetBeginOverlaps().size();
+			endEvents += broadphase.GetEndOverlaps().size();
+			previous = ToSet(broadphase.GetPairs());
+			world.removed.clear();
+		}
+		// JnIۂɋNĂ
+		FALU_CHECK(beginEvents > 100 && endEvents > 100);
+		FALU_CHECK(!previous.empty());
+
+		// Clear ͉̌ԂȂ
+		broadphase.Clear();
+		broadphase.Update();
+		FALU_CHECK(broadphase.GetPairs().empty() && broadphase.GetBodyCount() == 0);
+	}
+}
+
+int main()
+{
+	JobSystem::GetInstance().Initialize(3);
+
+	TestRandomFrames();
+
+	JobSystem::GetInstance().Shutdown();
+	return Test::Result();
+}
@@ -0,0 +1,107 @@
+/*****************************************************************//**
+ * \file   CommandRecorderTest.cpp
+ * \brief  R}hL^̕Ǝs̃eXg(NullCommandRecorder)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/CommandRecorder.h"
+#include "Falu/JobSystem.h"
+
+#include <vector>
+
+using namespace Falu;
+
+namespace
+{
+	void TestChunkCount()
+	{
+		FALU_CHECK(CalculateChunkCount(1000, 0, 4) == 1);
+		FALU_CHECK(CalculateChunkCount(1000, 64, 1) == 1);
+		FALU_CHECK(CalculateChunkCount(0, 64, 4) == 1);
+		FALU_CHECK(CalculateChunkCount(63, 64, 4) == 1);
+		FALU_CHECK(CalculateChunkCount(128, 64, 4) == 2);
+		FALU_CHECK(CalculateChunkCount(191, 64, 4) == 2);
+		FALU_CHECK(CalculateChunkCount(100000, 64, 4) == 4);
+	}
+
+	// Ԃ͏dȂ炸ԂȂA`Nɕ
+	void TestChunkRanges()
+	{
+		const size_t counts[] = { 0, 1, 7, 64, 1000, 1001 };
+		for (size_t count : counts)
+		{
+			for (uint32_t chunkCount = 1; chunkCount <= 9; ++chunkCount)
+			{
+				size_t expectedBegin = 0;
+				for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+				{
+					size_t begin, end;
+					GetChunkRange(count, chunk, chunkCount, begin, end);
+					FALU_CHECK(begin == expectedBegin);
+					FALU_CHECK(begin <= end);
+					// 傫̍ 1 ȓ
+					FALU_CHECK(end - begin <= count / chunkCount + 1);
+					expectedBegin = end;
+				}
+				FALU_CHECK(expectedBegin == count);
+			}
+		}
+	}
+
+	// ɋL^e`N̒gsɂȂƌ̃L[̏ɖ߂
+	void TestRecordOrder()
+	{
+		const uint32_t kMaxChunks = 4;
+		const size_t kDrawCount = 1000;
+		NullCommandRecorder recorder(kMaxChunks);
+		FALU_CHECK(recorder.GetMaxChunkCount() == kMaxChunks);
+
+		// ő吔𒴂v͐؂l߂
+		uint32_t chunkCount = 6;
+		std::vector<std::vector<size_t>> recorded(chunkCount);
+		std::vector<int> nullContexts(chunkCount, 0);
+		recorder.Record(chunkCount, [&](uint32_t chunk, ID3D11DeviceContext* context)
+		{
+			size_t begin, end;
+			GetChunkRange(kDrawCount, chunk, kMaxChunks, begin, end);
+			for (size_t i = begin; i < end; ++i)
+				recorded[chunk].push_back(i);
+			nullContexts[chunk] = context == nullptr ? 1 : 0;
+		});
+		recorder.Execute();
+
+		const std::vector<uint32_t>& executed = recorder.GetExecutedChunks();
+		FALU_CHECK(executed.size() == kMaxChunks);
+		for (uint32_t chunk = kMaxChunks; chunk < chunkCount; ++chunk)
+			FALU_CHECK(recorded[chunk].empty());
+
+		std::vector<size_t> replay;
+		for (size_t i = 0; i < executed.size(); ++i)
+		{
+			FALU_CHECK(executed[i] == i);
+			FALU_CHECK(nullContexts[executed[i]] == 1);
+			replay.insert(replay.end(), recorded[executed[i]].begin(), recorded[executed[i]].end());
+		}
+		FALU_CHECK(replay.size() == kDrawCount);
+		for (size_t i = 0; i < replay.size(); ++i)
+			FALU_CHECK(replay[i] == i);
+
+		// Execute ͑O Record ̕x
+		recorder.Execute();
+		FALU_CHECK(recorder.GetExecutedChunks().empty());
+	}
+}
+
+int main()
+{
+	JobSystem::GetInstance().Initialize(3);
+
+	TestChunkCount();
+	TestChunkRanges();
+	TestRecordOrder();
+
+	JobSystem::GetInstance().Shutdown();
+	return Test::Result();
+}
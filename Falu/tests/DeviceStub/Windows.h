@@ -0,0 +1,86 @@
+/*****************************************************************//**
+ * \file   Windows.h
+ * \brief  Windows ȊOŃGW̃\[Xrh邽߂̍ŏ Win32 `(eXg ModelLoadBench p)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+typedef long HRESULT;
+typedef int BOOL;
+typedef int INT;
+typedef unsigned int UINT;
+typedef uint8_t UINT8;
+typedef uint8_t BYTE;
+typedef long LONG;
+typedef unsigned long ULONG;
+typedef unsigned long DWORD;
+typedef float FLOAT;
+typedef size_t SIZE_T;
+typedef uintptr_t UINT_PTR;
+
+#define TRUE 1
+#define FALSE 0
+
+#define S_OK ((HRESULT)0L)
+#define S_FALSE ((HRESULT)1L)
+#define E_NOTIMPL ((HRESULT)0x80004001L)
+#define E_NOINTERFACE ((HRESULT)0x80004002L)
+#define E_FAIL ((HRESULT)0x80004005L)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+
+// C^[tF[X̎ʂ͌^ōs
+struct IID
+{
+	const void* type;
+	bool operator==(const IID& other) const { return type == other.type; }
+};
+template<typename T>
+inline IID GetStubIID()
+{
+	static const char tag = 0;
+	return IID{ &tag };
+}
+#define __uuidof(T) GetStubIID<T>()
+
+// QƃJEg COM ̊B0 ɂȂ delete 
+struct IUnknown
+{
+	virtual ~IUnknown() = default;
+
+	virtual ULONG AddRef() { return ++m_refCount; }
+	virtual ULONG Release()
+	{
+		ULONG count = --m_refCount;
+		if (count == 0)
+			delete this;
+		return count;
+	}
+	virtual HRESULT QueryInterface(const IID&, void** object)
+	{
+		*object = nullptr;
+		return E_NOINTERFACE;
+	}
+
+private:
+	std::atomic<ULONG> m_refCount{ 1 };
+};
+
+inline void OutputDebugStringA(const char* text)
+{
+	std::fputs(text, stderr);
+}
+
+// CRT  sprintf_s(zn)
+template<size_t N, typename... Args>
+inline int sprintf_s(char (&buffer)[N], const char* format, Args... args)
+{
+	return std::snprintf(buffer, N, format, args...);
+}
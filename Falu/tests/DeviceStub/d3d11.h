@@ -0,0 +1,244 @@
+/*****************************************************************//**
+ * \file   d3d11.h
+ * \brief  GW̃\[Xg D3D11 ̌^ƁAȂC^[tF[X(eXg ModelLoadBench p)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *
+ * \bhׂ͂ĉzŁAł͉Ȃ E_NOTIMPL ԂB
+ * eXgƃx`}[N͕KvȂ̂hNXŎ
+ *********************************************************************/
+#pragma once
+
+#include <Windows.h>
+#include <dxgi.h>
+
+//=== d3dcommon ===
+struct D3D_SHADER_MACRO
+{
+	const char* Name;
+	const char* Definition;
+};
+
+struct ID3DInclude;
+#define D3D_COMPILE_STANDARD_FILE_INCLUDE ((ID3DInclude*)(UINT_PTR)1)
+
+struct ID3DBlob : IUnknown
+{
+	virtual void* GetBufferPointer() { return nullptr; }
+	virtual SIZE_T GetBufferSize() { return 0; }
+};
+typedef ID3DBlob ID3D10Blob;
+
+//===  ===
+enum D3D11_USAGE
+{
+	D3D11_USAGE_DEFAULT = 0,
+	D3D11_USAGE_IMMUTABLE = 1,
+	D3D11_USAGE_DYNAMIC = 2,
+	D3D11_USAGE_STAGING = 3,
+};
+
+enum D3D11_BIND_FLAG
+{
+	D3D11_BIND_VERTEX_BUFFER = 0x1,
+	D3D11_BIND_INDEX_BUFFER = 0x2,
+	D3D11_BIND_CONSTANT_BUFFER = 0x4,
+	D3D11_BIND_SHADER_RESOURCE = 0x8,
+};
+
+enum D3D11_CPU_ACCESS_FLAG
+{
+	D3D11_CPU_ACCESS_WRITE = 0x10000,
+	D3D11_CPU_ACCESS_READ = 0x20000,
+};
+
+enum D3D11_RESOURCE_MISC_FLAG
+{
+	D3D11_RESOURCE_MISC_BUFFER_STRUCTURED = 0x40,
+};
+
+enum D3D11_MAP
+{
+	D3D11_MAP_READ = 1,
+	D3D11_MAP_WRITE = 2,
+	D3D11_MAP_READ_WRITE = 3,
+	D3D11_MAP_WRITE_DISCARD = 4,
+	D3D11_MAP_WRITE_NO_OVERWRITE = 5,
+};
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+};
+
+enum D3D11_SRV_DIMENSION
+{
+	D3D11_SRV_DIMENSION_BUFFER = 1,
+	D3D11_SRV_DIMENSION_TEXTURE2D = 4,
+	D3D11_SRV_DIMENSION_TEXTURE2DARRAY = 5,
+};
+
+enum D3D11_INPUT_CLASSIFICATION
+{
+	D3D11_INPUT_PER_VERTEX_DATA = 0,
+	D3D11_INPUT_PER_INSTANCE_DATA = 1,
+};
+
+#define D3D11_APPEND_ALIGNED_ELEMENT 0xffffffff
+#define D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION 2048
+
+//=== \ ===
+struct D3D11_BUFFER_DESC
+{
+	UINT ByteWidth;
+	D3D11_USAGE Usage;
+	UINT BindFlags;
+	UINT CPUAccessFlags;
+	UINT MiscFlags;
+	UINT StructureByteStride;
+};
+
+struct D3D11_SUBRESOURCE_DATA
+{
+	const void* pSysMem;
+	UINT SysMemPitch;
+	UINT SysMemSlicePitch;
+};
+
+struct D3D11_MAPPED_SUBRESOURCE
+{
+	void* pData;
+	UINT RowPitch;
+	UINT DepthPitch;
+};
+
+struct D3D11_BOX
+{
+	UINT left, top, front;
+	UINT right, bottom, back;
+};
+
+struct D3D11_TEXTURE2D_DESC
+{
+	UINT Width;
+	UINT Height;
+	UINT MipLevels;
+	UINT ArraySize;
+	DXGI_FORMAT Format;
+	DXGI_SAMPLE_DESC SampleDesc;
+	D3D11_USAGE Usage;
+	UINT BindFlags;
+	UINT CPUAccessFlags;
+	UINT MiscFlags;
+};
+
+struct D3D11_BUFFER_SRV
+{
+	UINT FirstElement;
+	UINT NumElements;
+};
+
+struct D3D11_TEX2D_SRV
+{
+	UINT MostDetailedMip;
+	UINT MipLevels;
+};
+
+struct D3D11_TEX2D_ARRAY_SRV
+{
+	UINT MostDetailedMip;
+	UINT MipLevels;
+	UINT FirstArraySlice;
+	UINT ArraySize;
+};
+
+struct D3D11_SHADER_RESOURCE_VIEW_DESC
+{
+	DXGI_FORMAT Format;
+	D3D11_SRV_DIMENSION ViewDimension;
+	union
+	{
+		D3D11_BUFFER_SRV Buffer;
+		D3D11_TEX2D_SRV Texture2D;
+		D3D11_TEX2D_ARRAY_SRV Texture2DArray;
+	};
+};
+
+struct D3D11_INPUT_ELEMENT_DESC
+{
+	const char* SemanticName;
+	UINT SemanticIndex;
+	DXGI_FORMAT Format;
+	UINT InputSlot;
+	UINT AlignedByteOffset;
+	D3D11_INPUT_CLASSIFICATION InputSlotClass;
+	UINT InstanceDataStepRate;
+};
+
+//=== C^[tF[X ===
+struct ID3D11DeviceChild : IUnknown {};
+struct ID3D11Resource : ID3D11DeviceChild {};
+
+struct ID3D11Buffer : ID3D11Resource
+{
+	virtual void GetDesc(D3D11_BUFFER_DESC* desc) { *desc = {}; }
+};
+
+struct ID3D11Texture2D : ID3D11Resource
+{
+	virtual void GetDesc(D3D11_TEXTURE2D_DESC* desc) { *desc = {}; }
+};
+
+struct ID3D11View : ID3D11DeviceChild {};
+struct ID3D11ShaderResourceView : ID3D11View {};
+struct ID3D11VertexShader : ID3D11DeviceChild {};
+struct ID3D11PixelShader : ID3D11DeviceChild {};
+struct ID3D11GeometryShader : ID3D11DeviceChild {};
+struct ID3D11InputLayout : ID3D11DeviceChild {};
+struct ID3D11SamplerState : ID3D11DeviceChild {};
+struct ID3D11RasterizerState : ID3D11DeviceChild {};
+struct ID3D11DepthStencilState : ID3D11DeviceChild {};
+struct ID3D11ClassLinkage : ID3D11DeviceChild {};
+struct ID3D11ClassInstance : ID3D11DeviceChild {};
+
+struct ID3D11DeviceContext : ID3D11DeviceChild
+{
+	virtual HRESULT Map(ID3D11Resource*, UINT, D3D11_MAP, UINT, D3D11_MAPPED_SUBRESOURCE*) { return E_NOTIMPL; }
+	virtual void Unmap(ID3D11Resource*, UINT) {}
+	virtual void UpdateSubresource(ID3D11Resource*, UINT, const D3D11_BOX*, const void*, UINT, UINT) {}
+	virtual void CopySubresourceRegion(ID3D11Resource*, UINT, UINT, UINT, UINT, ID3D11Resource*, UINT, const D3D11_BOX*) {}
+
+	virtual void VSSetShader(ID3D11VertexShader*, ID3D11ClassInstance* const*, UINT) {}
+	virtual void PSSetShader(ID3D11PixelShader*, ID3D11ClassInstance* const*, UINT) {}
+	virtual void GSSetShader(ID3D11GeometryShader*, ID3D11ClassInstance* const*, UINT) {}
+	virtual void VSSetConstantBuffers(UINT, UINT, ID3D11Buffer* const*) {}
+	virtual void PSSetConstantBuffers(UINT, UINT, ID3D11Buffer* const*) {}
+	virtual void VSSetShaderResources(UINT, UINT, ID3D11ShaderResourceView* const*) {}
+	virtual void PSSetShaderResources(UINT, UINT, ID3D11ShaderResourceView* const*) {}
+	virtual void VSSetSamplers(UINT, UINT, ID3D11SamplerState* const*) {}
+	virtual void PSSetSamplers(UINT, UINT, ID3D11SamplerState* const*) {}
+
+	virtual void IASetInputLayout(ID3D11InputLayout*) {}
+	virtual void IASetVertexBuffers(UINT, UINT, ID3D11Buffer* const*, const UINT*, const UINT*) {}
+	virtual void IASetIndexBuffer(ID3D11Buffer*, DXGI_FORMAT, UINT) {}
+	virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY) {}
+	virtual void RSSetState(ID3D11RasterizerState*) {}
+	virtual void OMSetDepthStencilState(ID3D11DepthStencilState*, UINT) {}
+
+	virtual void Draw(UINT, UINT) {}
+	virtual void DrawIndexed(UINT, UINT, INT) {}
+	virtual void DrawIndexedInstanced(UINT, UINT, UINT, INT, UINT) {}
+};
+
+struct ID3D11Device : IUnknown
+{
+	virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC*, const D3D11_SUBRESOURCE_DATA*, ID3D11Buffer**) { return E_NOTIMPL; }
+	virtual HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC*, const D3D11_SUBRESOURCE_DATA*, ID3D11Texture2D**) { return E_NOTIMPL; }
+	virtual HRESULT CreateShaderResourceView(ID3D11Resource*, const D3D11_SHADER_RESOURCE_VIEW_DESC*, ID3D11ShaderResourceView**) { return E_NOTIMPL; }
+	virtual HRESULT CreateVertexShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11VertexShader**) { return E_NOTIMPL; }
+	virtual HRESULT CreatePixelShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11PixelShader**) { return E_NOTIMPL; }
+	virtual HRESULT CreateGeometryShader(const void*, SIZE_T, ID3D11ClassLinkage*, ID3D11GeometryShader**) { return E_NOTIMPL; }
+	virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC*, UINT, const void*, SIZE_T, ID3D11InputLayout**) { return E_NOTIMPL; }
+};
@@ -0,0 +1,16 @@
+/*****************************************************************//**
+ * \file   d3d11_1.h
+ * \brief  D3D11.1 ̒萔obt@͈͎w(eXg ModelLoadBench p)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+
+struct ID3D11DeviceContext1 : ID3D11DeviceContext
+{
+	virtual void VSSetConstantBuffers1(UINT, UINT, ID3D11Buffer* const*, const UINT*, const UINT*) {}
+	virtual void PSSetConstantBuffers1(UINT, UINT, ID3D11Buffer* const*, const UINT*, const UINT*) {}
+};
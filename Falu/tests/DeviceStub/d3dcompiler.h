@@ -0,0 +1,23 @@
+/*****************************************************************//**
+ * \file   d3dcompiler.h
+ * \brief  VF[_[RpC̑BɎs(eXg ModelLoadBench p)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <d3d11.h>
+
+#define D3DCOMPILE_DEBUG (1 << 0)
+#define D3DCOMPILE_SKIP_OPTIMIZATION (1 << 2)
+#define D3DCOMPILE_ENABLE_STRICTNESS (1 << 11)
+
+inline HRESULT D3DCompileFromFile(const wchar_t*, const D3D_SHADER_MACRO*, ID3DInclude*, const char*, const char*,
+	UINT, UINT, ID3DBlob** code, ID3DBlob** errors)
+{
+	*code = nullptr;
+	if (errors)
+		*errors = nullptr;
+	return E_NOTIMPL;
+}
@@ -0,0 +1,104 @@
+/*****************************************************************//**
+ * \file   client.h
+ * \brief  Microsoft::WRL::ComPtr ̑(eXg ModelLoadBench p)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <Windows.h>
+#include <utility>
+
+namespace Microsoft
+{
+	namespace WRL
+	{
+		template<typename T>
+		class ComPtr
+		{
+		public:
+			ComPtr() : m_ptr(nullptr) {}
+			ComPtr(std::nullptr_t) : m_ptr(nullptr) {}
+			ComPtr(T* ptr) : m_ptr(ptr) { AddRef(); }
+			ComPtr(const ComPtr& other) : m_ptr(other.m_ptr) { AddRef(); }
+			ComPtr(ComPtr&& other) noexcept : m_ptr(other.m_ptr) { other.m_ptr = nullptr; }
+			~ComPtr() { Release(); }
+
+			ComPtr& operator=(const ComPtr& other)
+			{
+				ComPtr(other).Swap(*this);
+				return *this;
+			}
+			ComPtr& operator=(ComPtr&& other) noexcept
+			{
+				ComPtr(std::move(other)).Swap(*this);
+				return *this;
+			}
+			ComPtr& operator=(T* ptr)
+			{
+				ComPtr(ptr).Swap(*this);
+				return *this;
+			}
+			ComPtr& operator=(std::nullptr_t)
+			{
+				Reset();
+				return *this;
+			}
+
+			T* Get() const { return m_ptr; }
+			T* operator->() const { return m_ptr; }
+			explicit operator bool() const { return m_ptr != nullptr; }
+
+			T* const* GetAddressOf() const { return &m_ptr; }
+			T** GetAddressOf() { return &m_ptr; }
+			T** ReleaseAndGetAddressOf()
+			{
+				Release();
+				return &m_ptr;
+			}
+			// {ƓA擾pɓnOɍ̎QƂ
+			T** operator&() { return ReleaseAndGetAddressOf(); }
+
+			void Reset() { Release(); }
+			void Attach(T* ptr)
+			{
+				Release();
+				m_ptr = ptr;
+			}
+			T* Detach()
+			{
+				T* ptr = m_ptr;
+				m_ptr = nullptr;
+				return ptr;
+			}
+			void Swap(ComPtr& other) { std::swap(m_ptr, other.m_ptr); }
+
+			bool operator==(std::nullptr_t) const { return m_ptr == nullptr; }
+			bool operator!=(std::nullptr_t) const { return m_ptr != nullptr; }
+
+			template<typename U>
+			HRESULT As(ComPtr<U>* other) const
+			{
+				return m_ptr->QueryInterface(__uuidof(U), reinterpret_cast<void**>(other->ReleaseAndGetAddressOf()));
+			}
+
+		private:
+			void AddRef()
+			{
+				if (m_ptr)
+					m_ptr->AddRef();
+			}
+			void Release()
+			{
+				T* ptr = m_ptr;
+				m_ptr = nullptr;
+				if (ptr)
+					ptr->Release();
+			}
+
+		private:
+			T* m_ptr;
+		};
+	}
+}
@@ -0,0 +1,211 @@
+/*****************************************************************//**
+ * \file   DynamicAabbTreeTest.cpp
+ * \brief  DynamicAabbTree _ȒǉAړA폜őƔׂeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Include/Math/DynamicAabbTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Falu;
+
+namespace
+{
+	bool ContainsBox(const Math::AABB& outer, const Math::AABB& inner)
+	{
+		return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+			outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+	}
+
+	// ̑BvLV ID Ƃ̎ۂ̃oEfBOƁAĂ邩
+	struct Reference
+	{
+		std::vector<Math::AABB> bounds;
+		std::vector<void*> userData;
+		std::vector<uint8_t> alive;
+		std::vector<uint32_t> live;
+
+		void Set(uint32_t proxy, const Math::AABB& box)
+		{
+			if (proxy >= bounds.size())
+			{
+				bounds.resize(proxy + 1);
+				userData.resize(proxy + 1, nullptr);
+				alive.resize(proxy + 1, 0);
+			}
+			bounds[proxy] = box;
+			if (!alive[proxy])
+				live.push_back(proxy);
+			alive[proxy] = 1;
+		}
+
+		void Remove(uint32_t proxy)
+		{
+			alive[proxy] = 0;
+			live.erase(std::find(live.begin(), live.end(), proxy));
+		}
+	};
+
+	Math::AABB RandomBox(std::mt19937& rng, float worldSize)
+	{
+		std::uniform_real_distribution<float> position(-worldSize, worldSize);
+		std::uniform_real_distribution<float> extent(0.05f, 2.0f);
+		Math::Vector3 center(position(rng), position(rng), position(rng));
+		Math::Vector3 half(extent(rng), extent(rng), extent(rng));
+		return Math::AABB(center - half, center + half);
+	}
+
+	// LoEfBOۂ̃oEfBO܂݁A₢킹̌ʂ(LoEfBOƂ̏dȂ)
+	// 傤ǓŁAۂɏdȂvLV肱ڂȂ
+	void CheckQuery(const Math::DynamicAabbTree& tree, const Reference& reference, const Math::AABB& query)
+	{
+		std::vector<uint32_t> found;
+		tree.Query(query, [&found](uint32_t proxy) { found.push_back(proxy); });
+		std::sort(found.begin(), found.end());
+		FALU_CHECK(std::adjacent_find(found.begin(), found.end()) == found.end());
+
+		std::vector<uint32_t> expected;
+		for (uint32_t proxy : reference.live)
+		{
+			if (tree.GetFatBounds(proxy).Intersects(query))
+				expected.push_back(proxy);
+		}
+		std::sort(expected.begin(), expected.end());
+		FALU_CHECK(found == expected);
+
+		for (uint32_t proxy : reference.live)
+		{
+			if (reference.bounds[proxy].Intersects(query))
+				FALU_CHECK(std::binary_search(found.begin(), found.end(), proxy));
+		}
+	}
+
+	void CheckTree(const Math::DynamicAabbTree& tree, const Reference& reference)
+	{
+		FALU_CHECK(tree.GetProxyCount() == reference.live.size());
+		for (uint32_t proxy : reference.live)
+		{
+			FALU_CHECK(ContainsBox(tree.GetFatBounds(proxy), reference.bounds[proxy]));
+			FALU_CHECK(tree.GetUserData(proxy) == reference.userData[proxy]);
+		}
+
+		// ] AVL ؂Ɠނ荇ۂ̂ŁA 1.44 log2(t̐ + 2) Ɏ܂
+		double bound = 1.45 * std::log2(static_cast<double>(reference.live.size()) + 2.0);
+		FALU_CHECK(tree.GetHeight() <= static_cast<int>(bound));
+	}
+
+	// 5000 ̔_ɒǉAړA폜ArŉxƔׂ
+	void TestRandomOperations()
+	{
+		const float worldSize = 100.0f;
+		std::mt19937 rng(5000);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_int_distribution<int> operation(0, 9);
+
+		Math::DynamicAabbTree tree(0.5f);
+		Reference reference;
+
+		// userData ͍邽тɕʂ̒lɂAID g񂵂ĂႦȂƂm߂
+		std::vector<int> tokens(30000);
+		size_t nextToken = 0;
+		auto create = [&](const Math::AABB& box)
+		{
+			void* userData = &tokens[nextToken++];
+			uint32_t proxy = tree.CreateProxy(box, userData);
+			FALU_CHECK(proxy >= reference.alive.size() || !reference.alive[proxy]);
+			reference.Set(proxy, box);
+			reference.userData[proxy] = userData;
+		};
+
+		for (int i = 0; i < 5000; ++i)
+			create(RandomBox(rng, worldSize));
+		FALU_CHECK(tree.GetProxyCount() == 5000);
+
+		for (int step = 0; step < 20000; ++step)
+		{
+			int op = operation(rng);
+			if (op < 6 && !reference.live.empty())
+			{
+				// ړBȈړ̓}[W̒Ɏ܂
+				uint32_t proxy = reference.live[rng() % reference.live.size()];
+				float distance = (op < 3) ? 0.2f : 5.0f;
+				Math::Vector3 offset(unit(rng) * distance, unit(rng) * distance, unit(rng) * distance);
+				Math::AABB box(reference.bounds[proxy].min + offset, reference.bounds[proxy].max + offset);
+				Math::AABB fat = tree.GetFatBounds(proxy);
+				bool moved = tree.MoveProxy(proxy, box);
+				FALU_CHECK(moved == !ContainsBox(fat, box));
+				reference.Set(proxy, box);
+			}
+			else if (op < 8 && !reference.live.empty())
+			{
+				uint32_t proxy = reference.live[rng() % reference.live.size()];
+				tree.DestroyProxy(proxy);
+				reference.Remove(proxy);
+			}
+			else
+			{
+				create(RandomBox(rng, worldSize));
+			}
+
+			if (step % 1000 == 999)
+			{
+				CheckTree(tree, reference);
+				for (int q = 0; q < 20; ++q)
+				{
+					std::uniform_real_distribution<float> size(0.1f, 30.0f);
+					Math::AABB query = RandomBox(rng, worldSize);
+					float grow = size(rng);
+					query.min = query.min - Math::Vector3(grow, grow, grow);
+					query.max = query.max + Math::Vector3(grow, grow, grow);
+					CheckQuery(tree, reference, query);
+				}
+			}
+		}
+
+		// ׂďƋɂȂA₢킹͉ԂȂ
+		std::vector<uint32_t> remaining = reference.live;
+		for (uint32_t proxy : remaining)
+		{
+			tree.DestroyProxy(proxy);
+			reference.Remove(proxy);
+		}
+		FALU_CHECK(tree.GetProxyCount() == 0);
+		FALU_CHECK(tree.GetHeight() == 0);
+		CheckQuery(tree, reference, Math::AABB(Math::Vector3(-1e6f, -1e6f, -1e6f), Math::Vector3(1e6f, 1e6f, 1e6f)));
+	}
+
+	// ꒼ɕׂĒǉĂA]Ȃΐ`ɂȂc[ނ荇
+	void TestSortedInsert()
+	{
+		std::mt19937 rng(17);
+		Math::DynamicAabbTree tree(0.1f);
+		Reference reference;
+		for (uint32_t i = 0; i < 5000; ++i)
+		{
+			Math::Vector3 center(i * 3.0f, 0.0f, 0.0f);
+			Math::AABB box(center - Math::Vector3(1.0f, 1.0f, 1.0f), center + Math::Vector3(1.0f, 1.0f, 1.0f));
+			uint32_t proxy = tree.CreateProxy(box, nullptr);
+			reference.Set(proxy, box);
+		}
+		CheckTree(tree, reference);
+
+		std::uniform_real_distribution<float> along(-10.0f, 15010.0f);
+		for (int q = 0; q < 100; ++q)
+		{
+			float x = along(rng);
+			CheckQuery(tree, reference, Math::AABB(Math::Vector3(x, -1.0f, -1.0f), Math::Vector3(x + 20.0f, 1.0f, 1.0f)));
+		}
+	}
+}
+
+int main()
+{
+	TestRandomOperations();
+	TestSortedInsert();
+	return Test::Result();
+}
@@ -0,0 +1,289 @@
+/*****************************************************************//**
+ * \file   LightClustersTest.cpp
+ * \brief  LightClusterGrid ̃Cg蓖Ă𑍓ƔׂeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/LightClusterGrid.h"
+#include "Falu/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Falu;
+
+namespace
+{
+	// sxNg` PerspectiveFovLH
+	Math::Matrix4 Perspective(float fovY, float aspect, float zNear, float zFar)
+	{
+		float yScale = 1.0f / std::tan(fovY * 0.5f);
+		float xScale = yScale / aspect;
+		float q = zFar / (zFar - zNear);
+		return Math::Matrix4(
+			xScale, 0.0f, 0.0f, 0.0f,
+			0.0f, yScale, 0.0f, 0.0f,
+			0.0f, 0.0f, q, 1.0f,
+			0.0f, 0.0f, -zNear * q, 0.0f);
+	}
+
+	// sxNg` OrthographicLH
+	Math::Matrix4 Orthographic(float width, float height, float zNear, float zFar)
+	{
+		return Math::Matrix4(
+			2.0f / width, 0.0f, 0.0f, 0.0f,
+			0.0f, 2.0f / height, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f / (zFar - zNear), 0.0f,
+			0.0f, 0.0f, zNear / (zNear - zFar), 1.0f);
+	}
+
+	Math::Matrix4 CameraView(const Math::Vector3& position, float pitch, float yaw)
+	{
+		Math::Matrix4 world = Math::Matrix4::TRS(position, Math::Quaternion::FromEuler(pitch, yaw, 0.0f), Math::Vector3(1.0f, 1.0f, 1.0f));
+		return Math::Inverse(world);
+	}
+
+	// r[[x z  NDC (x, y) Ɏʂr[Ԃ̓_
+	Math::Vector3 Unproject(const Math::Matrix4& projection, float ndcX, float ndcY, float z)
+	{
+		const float(&m)[4][4] = projection.m;
+		float w = z * m[2][3] + m[3][3];
+		return Math::Vector3((ndcX * w - z * m[2][0] - m[3][0]) / m[0][0], (ndcY * w - z * m[2][1] - m[3][1]) / m[1][1], z);
+	}
+
+	// J̑OɃ|CgCgƃX|bgCg𔼁Xɒu
+	std::vector<ClusterLight> RandomLights(std::mt19937& rng, const Math::Matrix4& view, uint32_t count, float depth)
+	{
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> along(0.0f, depth);
+		Math::Matrix4 cameraWorld = Math::Inverse(view);
+
+		std::vector<ClusterLight> lights(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			ClusterLight& light = lights[i];
+			float z = along(rng);
+			Math::Vector3 viewPosition(unit(rng) * (z + 2.0f), unit(rng) * (z + 2.0f), z);
+			light.position = Math::TransformPoint(viewPosition, cameraWorld);
+			light.range = 0.5f + 4.0f * (unit(rng) * 0.5f + 0.5f);
+			light.color = Math::Vector3(1.0f, 1.0f, 1.0f);
+			if (i % 2 == 0)
+			{
+				light.direction = Math::Vector3(0.0f, 0.0f, 1.0f);
+				light.cosOuter = ClusterLight::kNoCone;
+				light.cosInner = ClusterLight::kNoCone;
+			}
+			else
+			{
+				light.direction = Math::Normalize(Math::Vector3(unit(rng), unit(rng), unit(rng) + 0.01f));
+				light.cosOuter = std::cos(0.2f + 0.6f * (unit(rng) * 0.5f + 0.5f));
+				light.cosInner = std::min(1.0f, light.cosOuter + 0.05f);
+			}
+		}
+		return lights;
+	}
+
+	// r[Ԃ̓_CgɏƂ炳邩(VF[_[Ɠ͈͂Ɖ~̔)
+	bool Lit(const ClusterLight& light, const Math::Vector3& lightPosition, const Math::Vector3& lightDirection, const Math::Vector3& point)
+	{
+		Math::Vector3 toPoint = point - lightPosition;
+		float distance = Math::Length(toPoint);
+		// E傤ǂ̓_͕_̌덷łǂɂ]Ԃ̂ŊO
+		if (distance > light.range * 0.999f)
+			return false;
+		if (light.cosOuter <= 0.0f || distance < 1e-4f)
+			return true;
+		return Math::Dot(toPoint, lightDirection) / distance >= light.cosOuter + 1e-4f;
+	}
+
+	struct Cell
+	{
+		Math::Vector3 minimum;
+		Math::Vector3 maximum;
+	};
+
+	// NX^[ (i, j, k)  8 _͂ރr[Ԃ AABB
+	Cell ClusterCell(const LightClusterGrid& grid, const Math::Matrix4& projection, uint32_t i, uint32_t j, uint32_t k)
+	{
+		const LightClusterSettings& settings = grid.GetSettings();
+		float ratio = grid.GetFarZ() / grid.GetNearZ();
+		float z0 = grid.GetNearZ() * std::pow(ratio, static_cast<float>(k) / settings.slices);
+		float z1 = grid.GetNearZ() * std::pow(ratio, static_cast<float>(k + 1) / settings.slices);
+		float x0 = -1.0f + 2.0f * i / settings.tilesX, x1 = -1.0f + 2.0f * (i + 1) / settings.tilesX;
+		float y0 = 1.0f - 2.0f * (j + 1) / settings.tilesY, y1 = 1.0f - 2.0f * j / settings.tilesY;
+
+		Cell cell = { Math::Vector3(1e30f, 1e30f, 1e30f), Math::Vector3(-1e30f, -1e30f, -1e30f) };
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			Math::Vector3 p = Unproject(projection, (corner & 1) ? x1 : x0, (corner & 2) ? y1 : y0, (corner & 4) ? z1 : z0);
+			cell.minimum = Math::Vector3(std::min(cell.minimum.x, p.x), std::min(cell.minimum.y, p.y), std::min(cell.minimum.z, p.z));
+			cell.maximum = Math::Vector3(std::max(cell.maximum.x, p.x), std::max(cell.maximum.y, p.y), std::max(cell.maximum.z, p.z));
+		}
+		return cell;
+	}
+
+	// 1 ̃Obh𑍓Ŋm߂B
+	// Ƃ炳ꂽW{_̐ԂB
+	// Eranges NX^[ indices ԂȂA1 NX^[ɓCgxȂ
+	// ENX^[̓_Ƃ炷CǵAŐ؂ĂȂ肻̃NX^[ɓĂ
+	// EĂ郉Cg̋̓NX^[̃ZɏdȂ
+	uint64_t CheckGrid(const LightClusterGrid& grid, const std::vector<ClusterLight>& lights,
+		const Math::Matrix4& view, const Math::Matrix4& projection, std::mt19937& rng)
+	{
+		const LightClusterSettings& settings = grid.GetSettings();
+		const std::vector<ClusterRange>& ranges = grid.GetRanges();
+		const std::vector<uint32_t>& indices = grid.GetIndices();
+		FALU_CHECK(ranges.size() == grid.GetClusterCount());
+		FALU_CHECK(grid.GetStats().indexCount == indices.size());
+		FALU_CHECK(grid.GetStats().maxClusterLights <= settings.maxLightsPerCluster);
+
+		std::vector<Math::Vector3> positions(lights.size());
+		std::vector<Math::Vector3> directions(lights.size());
+		for (size_t l = 0; l < lights.size(); ++l)
+		{
+			positions[l] = Math::TransformPoint(lights[l].position, view);
+			directions[l] = Math::Normalize(Math::TransformVector(lights[l].direction, view));
+		}
+
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		const float ratio = grid.GetFarZ() / grid.GetNearZ();
+		uint32_t expectedOffset = 0;
+		uint64_t litSamples = 0;
+		std::vector<uint8_t> listed(lights.size());
+		for (uint32_t k = 0; k < settings.slices; ++k)
+		{
+			for (uint32_t j = 0; j < settings.tilesY; ++j)
+			{
+				for (uint32_t i = 0; i < settings.tilesX; ++i)
+				{
+					const ClusterRange& range = ranges[(k * settings.tilesY + j) * settings.tilesX + i];
+					// ̃NX^[ offset ͎gȂ
+					if (range.count > 0)
+						FALU_CHECK(range.offset == expectedOffset);
+					FALU_CHECK(range.count <= settings.maxLightsPerCluster);
+					expectedOffset += range.count;
+					if (range.offset + range.count > indices.size())
+						return litSamples;
+
+					std::fill(listed.begin(), listed.end(), 0);
+					Cell cell = ClusterCell(grid, projection, i, j, k);
+					for (uint32_t n = 0; n < range.count; ++n)
+					{
+						uint32_t id = indices[range.offset + n];
+						FALU_CHECK(id < lights.size());
+						if (id >= lights.size())
+							continue;
+						FALU_CHECK(!listed[id]);
+						listed[id] = 1;
+
+						const Math::Vector3& p = positions[id];
+						float dx = std::max(std::max(cell.minimum.x - p.x, p.x - cell.maximum.x), 0.0f);
+						float dy = std::max(std::max(cell.minimum.y - p.y, p.y - cell.maximum.y), 0.0f);
+						float dz = std::max(std::max(cell.minimum.z - p.z, p.z - cell.maximum.z), 0.0f);
+						float reach = lights[id].range * 1.001f + 1e-4f;
+						FALU_CHECK(dx * dx + dy * dy + dz * dz <= reach * reach);
+					}
+					if (range.count == settings.maxLightsPerCluster)
+						continue;
+
+					for (int s = 0; s < 8; ++s)
+					{
+						float ndcX = -1.0f + 2.0f * (i + unit(rng)) / settings.tilesX;
+						float ndcY = 1.0f - 2.0f * (j + unit(rng)) / settings.tilesY;
+						float z = grid.GetNearZ() * std::pow(ratio, (k + unit(rng)) / settings.slices);
+						Math::Vector3 point = Unproject(projection, ndcX, ndcY, z);
+						for (size_t l = 0; l < lights.size(); ++l)
+						{
+							if (Lit(lights[l], positions[l], directions[l], point))
+							{
+								FALU_CHECK(listed[l]);
+								++litSamples;
+							}
+						}
+					}
+				}
+			}
+		}
+		FALU_CHECK(expectedOffset == indices.size());
+		return litSamples;
+	}
+
+	void TestPerspective()
+	{
+		std::mt19937 rng(4242);
+		LightClusterGrid grid;
+		for (int trial = 0; trial < 4; ++trial)
+		{
+			Math::Matrix4 view = CameraView(Math::Vector3(2.0f * trial, 1.0f, -5.0f), 0.2f * trial, 0.7f * trial);
+			Math::Matrix4 projection = Perspective(1.0f, 16.0f / 9.0f, 0.1f, 60.0f);
+			std::vector<ClusterLight> lights = RandomLights(rng, view, 200, 50.0f);
+			grid.Build(lights.data(), static_cast<uint32_t>(lights.size()), view, projection);
+			FALU_CHECK(grid.GetStats().lightCount == lights.size());
+			// Ƃ炳ꂽ_ȂΔr肵Ă
+			FALU_CHECK(CheckGrid(grid, lights, view, projection, rng) > 0);
+		}
+	}
+
+	void TestOrthographic()
+	{
+		std::mt19937 rng(99);
+		LightClusterSettings settings;
+		settings.tilesX = 8;
+		settings.tilesY = 8;
+		settings.slices = 12;
+		LightClusterGrid grid(settings);
+
+		Math::Matrix4 view = CameraView(Math::Vector3(0.0f, 10.0f, -3.0f), 0.9f, 0.4f);
+		Math::Matrix4 projection = Orthographic(40.0f, 40.0f, 0.5f, 80.0f);
+		std::vector<ClusterLight> lights = RandomLights(rng, view, 150, 70.0f);
+		grid.Build(lights.data(), static_cast<uint32_t>(lights.size()), view, projection);
+		FALU_CHECK(CheckGrid(grid, lights, view, projection, rng) > 0);
+	}
+
+	// dȂCgNX^[͏Ő؂B͈ 0 ̃Cg͓Ȃ
+	void TestClusterCap()
+	{
+		std::mt19937 rng(7);
+		LightClusterSettings settings;
+		settings.tilesX = 4;
+		settings.tilesY = 4;
+		settings.slices = 4;
+		settings.maxLightsPerCluster = 8;
+		LightClusterGrid grid(settings);
+
+		Math::Matrix4 view = Math::Matrix4::Identity();
+		Math::Matrix4 projection = Perspective(1.0f, 1.0f, 0.1f, 20.0f);
+		std::vector<ClusterLight> lights = RandomLights(rng, view, 64, 10.0f);
+		for (ClusterLight& light : lights)
+		{
+			light.position = Math::Vector3(0.0f, 0.0f, 5.0f);
+			light.range = 100.0f;
+			light.cosOuter = ClusterLight::kNoCone;
+		}
+		lights[3].range = 0.0f;
+		grid.Build(lights.data(), static_cast<uint32_t>(lights.size()), view, projection);
+
+		FALU_CHECK(grid.GetStats().lightCount == lights.size() - 1);
+		FALU_CHECK(grid.GetStats().maxClusterLights == settings.maxLightsPerCluster);
+		for (const ClusterRange& range : grid.GetRanges())
+			FALU_CHECK(range.count == settings.maxLightsPerCluster);
+		for (uint32_t id : grid.GetIndices())
+			FALU_CHECK(id != 3);
+		CheckGrid(grid, lights, view, projection, rng);
+	}
+}
+
+int main()
+{
+	JobSystem::GetInstance().Initialize(3);
+
+	TestPerspective();
+	TestOrthographic();
+	TestClusterCap();
+
+	JobSystem::GetInstance().Shutdown();
+	return Test::Result();
+}
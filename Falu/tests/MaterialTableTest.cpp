@@ -0,0 +1,185 @@
+/*****************************************************************//**
+ * \file   MaterialTableTest.cpp
+ * \brief  }eAe[u̍ڍXṼeXg(DeviceStub ̋UfoCX)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/Material.h"
+#include "Renderer/MaterialTable.h"
+#include "Renderer/Texture.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace Falu;
+
+namespace
+{
+	// g CPU Ɏobt@BUpdateSubresource ݂̏󂯂
+	struct FakeBuffer : ID3D11Buffer
+	{
+		D3D11_BUFFER_DESC desc = {};
+		std::vector<unsigned char> bytes;
+
+		void GetDesc(D3D11_BUFFER_DESC* outDesc) override { *outDesc = desc; }
+	};
+
+	struct FakeTexture : ID3D11Texture2D
+	{
+		D3D11_TEXTURE2D_DESC desc = {};
+
+		void GetDesc(D3D11_TEXTURE2D_DESC* outDesc) override { *outDesc = desc; }
+	};
+
+	struct FakeDevice : ID3D11Device
+	{
+		FakeBuffer* lastStructuredBuffer = nullptr;
+
+		HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA*, ID3D11Buffer** outBuffer) override
+		{
+			FakeBuffer* buffer = new FakeBuffer();
+			buffer->desc = *desc;
+			buffer->bytes.assign(desc->ByteWidth, 0);
+			if (desc->MiscFlags & D3D11_RESOURCE_MISC_BUFFER_STRUCTURED)
+				lastStructuredBuffer = buffer;
+			*outBuffer = buffer;
+			return S_OK;
+		}
+
+		HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA*, ID3D11Texture2D** outTexture) override
+		{
+			FakeTexture* texture = new FakeTexture();
+			texture->desc = *desc;
+			*outTexture = texture;
+			return S_OK;
+		}
+
+		HRESULT CreateShaderResourceView(ID3D11Resource*, const D3D11_SHADER_RESOURCE_VIEW_DESC*, ID3D11ShaderResourceView** outView) override
+		{
+			*outView = new ID3D11ShaderResourceView();
+			return S_OK;
+		}
+	};
+
+	struct FakeContext : ID3D11DeviceContext
+	{
+		int updateCount = 0;
+
+		void UpdateSubresource(ID3D11Resource* resource, UINT, const D3D11_BOX* box, const void* data, UINT, UINT) override
+		{
+			FakeBuffer* buffer = static_cast<FakeBuffer*>(resource);
+			std::memcpy(buffer->bytes.data() + box->left, data, box->right - box->left);
+			++updateCount;
+		}
+	};
+
+	bool CreateTexture(FakeDevice& device, Texture& texture)
+	{
+		std::vector<unsigned char> pixels(4 * 4 * 4, 0xFF);
+		return texture.CreateFromData(&device, pixels.data(), 4, 4, 4);
+	}
+
+	// GPU ̃e[uɓ͂Ă鍀
+	MaterialTableEntry ReadEntry(const FakeDevice& device, const Material& material)
+	{
+		MaterialTableEntry entry;
+		std::memcpy(&entry, device.lastStructuredBuffer->bytes.data() + material.GetMaterialId() * sizeof(MaterialTableEntry), sizeof(entry));
+		return entry;
+	}
+
+	bool Update(MaterialTable& table, FakeContext& context, const Material& material)
+	{
+		MaterialSnapshot snapshot;
+		material.ExtractSnapshot(snapshot);
+		bool resident = table.Update(&context, snapshot);
+		table.Flush(&context);
+		return resident;
+	}
+
+	// AxhȊÕeNX`ւĂAڂ̃XCXς
+	void TestTextureSwap()
+	{
+		FakeDevice device;
+		FakeContext context;
+		MaterialTable table;
+		FALU_CHECK(table.Initialize(&device));
+
+		Texture albedo, normalA, normalB, metallic, roughness;
+		FALU_CHECK(CreateTexture(device, albedo));
+		FALU_CHECK(CreateTexture(device, normalA));
+		FALU_CHECK(CreateTexture(device, normalB));
+		FALU_CHECK(CreateTexture(device, metallic));
+		FALU_CHECK(CreateTexture(device, roughness));
+
+		Material material;
+		material.SetAlbedoTexture(&albedo);
+		material.SetNormalTexture(&normalA);
+		FALU_CHECK(Update(table, context, material));
+		MaterialTableEntry first = ReadEntry(device, material);
+		FALU_CHECK(first.textures[0] != TextureSlice::kNone);
+		FALU_CHECK(first.textures[1] != TextureSlice::kNone);
+		FALU_CHECK(first.textures[2] == TextureSlice::kNone);
+		FALU_CHECK(first.textures[3] == TextureSlice::kNone);
+
+		uint64_t version = material.GetVersion();
+		material.SetNormalTexture(&normalB);
+		FALU_CHECK(material.GetVersion() != version);
+		FALU_CHECK(Update(table, context, material));
+		MaterialTableEntry swapped = ReadEntry(device, material);
+		FALU_CHECK(swapped.textures[0] == first.textures[0]);
+		FALU_CHECK(swapped.textures[1] != TextureSlice::kNone);
+		FALU_CHECK(swapped.textures[1] != first.textures[1]);
+
+		version = material.GetVersion();
+		material.SetMetallicTexture(&metallic);
+		FALU_CHECK(material.GetVersion() != version);
+		version = material.GetVersion();
+		material.SetRoughnessTexture(&roughness);
+		FALU_CHECK(material.GetVersion() != version);
+		FALU_CHECK(Update(table, context, material));
+		MaterialTableEntry full = ReadEntry(device, material);
+		FALU_CHECK(full.textures[2] != TextureSlice::kNone);
+		FALU_CHECK(full.textures[3] != TextureSlice::kNone);
+		FALU_CHECK(full.textures[2] != full.textures[3]);
+
+		// ςĂȂΑ蒼Ȃ
+		int updateCount = context.updateCount;
+		FALU_CHECK(Update(table, context, material));
+		FALU_CHECK(context.updateCount == updateCount);
+	}
+
+	// ڂȂeNX`́Ao[WςȂĂ Update ōڂ
+	void TestNonResidentRetry()
+	{
+		FakeDevice device;
+		FakeContext context;
+		MaterialTable table;
+		FALU_CHECK(table.Initialize(&device));
+
+		Texture streaming;	// ܂ GPU ̃eNX`Ȃ
+		Material material;
+		material.SetNormalTexture(&streaming);
+		FALU_CHECK(!Update(table, context, material));
+		FALU_CHECK(ReadEntry(device, material).textures[1] == TextureSlice::kNone);
+
+		// ڂȂ܂܂Ȃ瓯gȂ̂ő蒼Ȃ
+		int updateCount = context.updateCount;
+		FALU_CHECK(!Update(table, context, material));
+		FALU_CHECK(context.updateCount == updateCount);
+
+		uint64_t version = material.GetVersion();
+		FALU_CHECK(CreateTexture(device, streaming));
+		FALU_CHECK(material.GetVersion() == version);
+		FALU_CHECK(Update(table, context, material));
+		FALU_CHECK(ReadEntry(device, material).textures[1] != TextureSlice::kNone);
+	}
+}
+
+int main()
+{
+	TestTextureSwap();
+	TestNonResidentRetry();
+	return Test::Result();
+}
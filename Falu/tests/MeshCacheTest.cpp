@@ -0,0 +1,501 @@
+/*****************************************************************//**
+ * \file   MeshCacheTest.cpp
+ * \brief  Ăft@C̏oƓǂݍ݁Aꂽt@CeƂ̃eXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/MeshCache.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/ModelLoader.h"
+#include "Include/Utils/MappedFile.h"
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Falu;
+
+namespace
+{
+	const std::string kSourceDirectory = "assets/models";
+
+	// (columns + 1) x (rows + 1) _̔głiq
+	void MakeGrid(uint32_t columns, uint32_t rows, std::vector<Vertex>& outVertices, std::vector<uint32_t>& outIndices)
+	{
+		outVertices.clear();
+		outIndices.clear();
+		for (uint32_t z = 0; z <= rows; ++z)
+		{
+			for (uint32_t x = 0; x <= columns; ++x)
+			{
+				float u = float(x) / columns;
+				float v = float(z) / rows;
+				Math::Vector3 position(u * 10.0f - 5.0f, std::sin(u * 7.0f) * std::cos(v * 5.0f), v * 8.0f - 4.0f);
+				outVertices.emplace_back(position, Math::Normalize(Math::Vector3(-std::cos(u * 7.0f), 1.0f, 0.3f)),
+					Math::Vector2(u, v), Math::Color(u, v, 0.5f, 1.0f));
+			}
+		}
+		for (uint32_t z = 0; z < rows; ++z)
+		{
+			for (uint32_t x = 0; x < columns; ++x)
+			{
+				uint32_t i = z * (columns + 1) + x;
+				uint32_t quad[6] = { i, i + columns + 1, i + 1, i + 1, i + columns + 1, i + columns + 2 };
+				outIndices.insert(outIndices.end(), quad, quad + 6);
+			}
+		}
+	}
+
+	std::shared_ptr<Mesh> MakeMesh(uint32_t columns, uint32_t rows, uint32_t vertexFormat, uint32_t cpuAccess, bool meshlets)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeGrid(columns, rows, vertices, indices);
+
+		std::vector<Meshlet> built;
+		if (meshlets)
+			built = Meshlets::Build(vertices, indices, 64, 124);
+
+		auto mesh = std::make_shared<Mesh>();
+		mesh->Prepare(std::move(vertices), std::vector<unsigned int>(indices.begin(), indices.end()), vertexFormat, cpuAccess);
+		if (meshlets)
+			mesh->SetMeshlets(std::move(built));
+		return mesh;
+	}
+
+	// C|[^[̂̑BWrite ΂ SubMesh 
+	struct Import
+	{
+		std::vector<ImportedMaterial> materials;
+		std::vector<ImportedSubMesh> subMeshes;
+		ModelLoadReport report;
+	};
+
+	Import MakeImport(bool large)
+	{
+		Import import;
+
+		ImportedMaterial painted;
+		painted.properties.albedo = Math::Color(0.8f, 0.2f, 0.1f, 1.0f);
+		painted.properties.metallic = 0.25f;
+		painted.properties.roughness = 0.75f;
+		painted.properties.emissive = Math::Vector3(0.0f, 0.5f, 1.0f);
+		painted.albedoPath = kSourceDirectory + "/textures/albedo.png";	// fBNg̑΂Ŏ
+		painted.normalPath = "shared/textures/normal.png";				// fBNg̊O͂̂܂
+		import.materials.push_back(painted);
+		import.materials.push_back(ImportedMaterial());
+
+		// bVbg CPU ̒_W`A LOD
+		ImportedSubMesh terrain;
+		terrain.mesh = MakeMesh(24, 24, VertexFormat::Standard, MeshCpuAccess::Raycast, true);
+		terrain.mesh->AddLod(MakeMesh(10, 10, VertexFormat::Standard, MeshCpuAccess::None, false), 0.25f);
+		terrain.mesh->AddLod(MakeMesh(4, 4, VertexFormat::Standard, MeshCpuAccess::None, true), 0.05f);
+		terrain.material = 0;
+		terrain.name = "Terrain";
+		import.subMeshes.push_back(terrain);
+
+		ImportedSubMesh empty;
+		empty.material = 0;
+		empty.name = "Empty";
+		import.subMeshes.push_back(empty);
+
+		// l߂_`BCPU ̒_͕ʂ̉ɂȂ
+		ImportedSubMesh compact;
+		compact.mesh = MakeMesh(30, 20, VertexFormat::Compact | VertexFormat::Color | VertexFormat::QuantizedPosition,
+			MeshCpuAccess::Occluder, true);
+		compact.material = 1;
+		compact.name = "Compact";
+		import.subMeshes.push_back(compact);
+
+		// 65535 _𒴂̂ 32 rbgCfbNX
+		if (large)
+		{
+			ImportedSubMesh big;
+			big.mesh = MakeMesh(260, 260, VertexFormat::Standard, MeshCpuAccess::None, false);
+			big.material = 1;
+			big.name = "Big";
+			import.subMeshes.push_back(big);
+		}
+
+		import.report.vertexBytes = 12345;
+		import.report.vertexBytesUncompressed = 67890;
+		import.report.indexBytes = 4242;
+		import.report.lodMeshCount = 2;
+		import.report.meshletCount = 77;
+		import.report.optimization.before.transformCount = 999;
+		import.report.optimization.after.triangleCount = 321;
+		return import;
+	}
+
+	std::vector<uint8_t> LoadBytes(const std::filesystem::path& path)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		return std::vector<uint8_t>((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	}
+
+	void SaveBytes(const std::filesystem::path& path, const std::vector<uint8_t>& bytes)
+	{
+		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+		stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	bool SameBytes(const void* a, const void* b, size_t size)
+	{
+		return size == 0 || std::memcmp(a, b, size) == 0;
+	}
+
+	void CheckMesh(Mesh& expected, Mesh& actual)
+	{
+		FALU_CHECK(actual.IsUploadPending());
+		FALU_CHECK(actual.GetVertexFormat() == expected.GetVertexFormat());
+		FALU_CHECK(actual.GetVertexCount() == expected.GetVertexCount());
+		FALU_CHECK(actual.GetIndexCount() == expected.GetIndexCount());
+		FALU_CHECK(actual.GetIndexFormat() == expected.GetIndexFormat());
+		FALU_CHECK(actual.GetCpuAccess() == expected.GetCpuAccess());
+		FALU_CHECK(actual.GetVertexBufferSize() == expected.GetVertexBufferSize());
+		FALU_CHECK(SameBytes(actual.GetUploadVertexData(), expected.GetUploadVertexData(), expected.GetVertexBufferSize()));
+		FALU_CHECK(SameBytes(actual.GetUploadIndexData(), expected.GetUploadIndexData(), expected.GetIndexBufferSize()));
+		FALU_CHECK(actual.GetBounds().min == expected.GetBounds().min && actual.GetBounds().max == expected.GetBounds().max);
+		FALU_CHECK(actual.GetPositionTransform().scale == expected.GetPositionTransform().scale);
+		FALU_CHECK(actual.GetPositionTransform().offset == expected.GetPositionTransform().offset);
+
+		FALU_CHECK(actual.GetMeshlets().size() == expected.GetMeshlets().size());
+		if (actual.GetMeshlets().size() == expected.GetMeshlets().size())
+			FALU_CHECK(SameBytes(actual.GetMeshlets().data(), expected.GetMeshlets().data(), expected.GetMeshlets().size() * sizeof(Meshlet)));
+
+		// CPU ̒_ BVH  cpuAccess ̂Ƃ߂(̃bV Upload ܂ł͒_Ă)
+		if (expected.HasCpuData())
+		{
+			FALU_CHECK(actual.GetVertices().size() == expected.GetVertices().size());
+			if (actual.GetVertices().size() == expected.GetVertices().size())
+				FALU_CHECK(SameBytes(actual.GetVertices().data(), expected.GetVertices().data(), expected.GetVertices().size() * sizeof(Vertex)));
+		}
+		else
+		{
+			FALU_CHECK(actual.GetVertices().empty());
+		}
+		FALU_CHECK(actual.HasBvh() == expected.HasBvh());
+	}
+
+	void CheckReport(const ModelLoadReport& expected, const ModelLoadReport& actual)
+	{
+		FALU_CHECK(actual.vertexBytes == expected.vertexBytes);
+		FALU_CHECK(actual.vertexBytesUncompressed == expected.vertexBytesUncompressed);
+		FALU_CHECK(actual.indexBytes == expected.indexBytes);
+		FALU_CHECK(actual.lodMeshCount == expected.lodMeshCount);
+		FALU_CHECK(actual.meshletCount == expected.meshletCount);
+		FALU_CHECK(actual.optimization.before.transformCount == expected.optimization.before.transformCount);
+		FALU_CHECK(actual.optimization.after.triangleCount == expected.optimization.after.triangleCount);
+	}
+
+	// ǂ߂AbVŵׂ͂ă}bv̒ɂ邱
+	bool PointsIntoMap(const MappedFile& file, const Mesh& mesh)
+	{
+		const uint8_t* begin = file.GetData();
+		const uint8_t* end = begin + file.GetSize();
+		auto inside = [&](const void* data, size_t size)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			return bytes >= begin && bytes <= end && size <= static_cast<size_t>(end - bytes);
+		};
+		return inside(mesh.GetUploadVertexData(), mesh.GetVertexBufferSize()) &&
+			inside(mesh.GetUploadIndexData(), mesh.GetIndexBufferSize());
+	}
+
+	void TestRoundTrip(const std::filesystem::path& directory)
+	{
+		Import import = MakeImport(true);
+		const uint64_t key = 0x0123456789ABCDEFull;
+		std::string path = MeshCache::GetCookedPath(directory.u8string(), key);
+		FALU_CHECK(path == directory.u8string() + "/0123456789abcdef.fmc");
+		FALU_CHECK(import.subMeshes[3].mesh->GetIndexFormat() == DXGI_FORMAT_R32_UINT);
+		FALU_CHECK(import.subMeshes[0].mesh->GetIndexFormat() == DXGI_FORMAT_R16_UINT);
+
+		FALU_CHECK(MeshCache::Write(path, key, kSourceDirectory, import.materials, import.subMeshes, import.report));
+		// ꎞt@C͎cȂ
+		size_t fileCount = 0;
+		for (const auto& entry : std::filesystem::directory_iterator(directory))
+		{
+			(void)entry;
+			++fileCount;
+		}
+		FALU_CHECK(fileCount == 1);
+
+		// fBNgĂA̒̃eNX`͐VꏊwBʂ͏o͂ɒǉ
+		std::vector<ImportedMaterial> materials(1);
+		std::vector<ImportedSubMesh> subMeshes(1);
+		ModelLoadReport report;
+		std::shared_ptr<MappedFile> file = MeshCache::Read(path, key, "moved/models", materials, subMeshes, report);
+		FALU_CHECK(file != nullptr);
+		if (!file)
+			return;
+
+		FALU_CHECK(materials.size() == 1 + import.materials.size());
+		for (size_t i = 0; i + 1 < materials.size() && i < import.materials.size(); ++i)
+		{
+			const MaterialProperties& expected = import.materials[i].properties;
+			const MaterialProperties& actual = materials[i + 1].properties;
+			FALU_CHECK(SameBytes(&actual, &expected, sizeof(MaterialProperties)));
+		}
+		FALU_CHECK(materials[1].albedoPath == "moved/models/textures/albedo.png");
+		FALU_CHECK(materials[1].normalPath == "shared/textures/normal.png");
+		FALU_CHECK(materials[2].albedoPath.empty() && materials[2].normalPath.empty());
+
+		//  SubMesh ͏ĂȂ
+		FALU_CHECK(subMeshes.size() == 1 + 3);
+		const ImportedSubMesh* expectedSubMeshes[] = { &import.subMeshes[0], &import.subMeshes[2], &import.subMeshes[3] };
+		for (size_t i = 0; i < 3 && i + 1 < subMeshes.size(); ++i)
+		{
+			const ImportedSubMesh& expected = *expectedSubMeshes[i];
+			const ImportedSubMesh& actual = subMeshes[i + 1];
+			FALU_CHECK(actual.name == expected.name);
+			FALU_CHECK(actual.material == expected.material);
+			FALU_CHECK(actual.mesh != nullptr);
+			if (!actual.mesh)
+				continue;
+
+			FALU_CHECK(actual.mesh->GetLodCount() == expected.mesh->GetLodCount());
+			for (uint32_t level = 0; level < expected.mesh->GetLodCount() && level < actual.mesh->GetLodCount(); ++level)
+			{
+				FALU_CHECK(actual.mesh->GetLodScreenSize(level) == expected.mesh->GetLodScreenSize(level));
+				CheckMesh(*expected.mesh->GetLod(level), *actual.mesh->GetLod(level));
+				FALU_CHECK(PointsIntoMap(*file, *actual.mesh->GetLod(level)));
+			}
+		}
+		CheckReport(import.report, report);
+
+		// L[ŏĂƒu(Â}bv͓ǂݏI܂ŐĂ)
+		FALU_CHECK(MeshCache::Write(path, key, kSourceDirectory, import.materials, import.subMeshes, import.report));
+		materials.clear();
+		subMeshes.clear();
+		FALU_CHECK(MeshCache::Read(path, key, kSourceDirectory, materials, subMeshes, report) != nullptr);
+		FALU_CHECK(materials.size() == 2 && subMeshes.size() == 3);
+	}
+
+	// Read qbgȂƁBo͂ɂ͉ǉȂ
+	bool Misses(const std::string& path, uint64_t key)
+	{
+		std::vector<ImportedMaterial> materials(1);
+		std::vector<ImportedSubMesh> subMeshes(1);
+		ModelLoadReport report;
+		std::shared_ptr<MappedFile> file = MeshCache::Read(path, key, kSourceDirectory, materials, subMeshes, report);
+		return !file && materials.size() == 1 && subMeshes.size() == 1;
+	}
+
+	// wb_[̃nbV꒼Bwb_[̑傫̓nbVʒu狁߂
+	size_t FindBodyOffset(const std::vector<uint8_t>& bytes, uint64_t contentHash)
+	{
+		for (size_t offset = 8; offset < bytes.size() && offset < 4096; offset += 8)
+		{
+			if (MeshCache::Hash(bytes.data() + offset, bytes.size() - offset) == contentHash)
+				return offset;
+		}
+		return 0;
+	}
+
+	// 0 珇 magicAversionAkeyAfileSizeAcontentHash
+	constexpr size_t kContentHashOffset = 24;
+
+	void Resign(std::vector<uint8_t>& bytes, size_t bodyOffset)
+	{
+		uint64_t hash = MeshCache::Hash(bytes.data() + bodyOffset, bytes.size() - bodyOffset);
+		std::memcpy(bytes.data() + kContentHashOffset, &hash, sizeof(hash));
+	}
+
+	// data ̐擪̐oCgt@Ĉǂɂ邩(R[hẅʒu)
+	size_t FindBlob(const std::vector<uint8_t>& bytes, const void* data, size_t size)
+	{
+		const uint8_t* needle = static_cast<const uint8_t*>(data);
+		size = std::min<size_t>(size, 64);
+		for (size_t offset = 0; offset + size <= bytes.size(); offset += 16)
+		{
+			if (std::memcmp(bytes.data() + offset, needle, size) == 0)
+				return offset;
+		}
+		return 0;
+	}
+
+	// [begin, end) ̒ value  8 oCg̈ʒu(R[h̃ItZbg̃tB[h)
+	size_t FindField(const std::vector<uint8_t>& bytes, size_t begin, size_t end, uint64_t value)
+	{
+		for (size_t offset = begin; offset + sizeof(value) <= end; offset += 8)
+		{
+			uint64_t field;
+			std::memcpy(&field, bytes.data() + offset, sizeof(field));
+			if (field == value)
+				return offset;
+		}
+		return 0;
+	}
+
+	void TestRejectsBadFiles(const std::filesystem::path& directory)
+	{
+		Import import = MakeImport(false);
+		const uint64_t key = 0xFEEDull;
+		std::string path = MeshCache::GetCookedPath(directory.u8string(), key);
+		FALU_CHECK(MeshCache::Write(path, key, kSourceDirectory, import.materials, import.subMeshes, import.report));
+		const std::vector<uint8_t> original = LoadBytes(std::filesystem::u8path(path));
+		FALU_CHECK(original.size() > 1024);
+
+		// ႤL[ƂȂt@C
+		FALU_CHECK(!Misses(path, key));
+		FALU_CHECK(Misses(path, key + 1));
+		FALU_CHECK(Misses(MeshCache::GetCookedPath(directory.u8string(), key + 1), key + 1));
+
+		// rŐ؂ꂽt@CƁAɗ]vȂ̂tt@C
+		const size_t lengths[] = { 0, 4, 24, 100, original.size() / 2, original.size() - 1, original.size() + 1 };
+		for (size_t length : lengths)
+		{
+			std::vector<uint8_t> bytes = original;
+			bytes.resize(length, 0);
+			SaveBytes(path, bytes);
+			FALU_CHECK(Misses(path, key));
+		}
+
+		// {̂ 1 oCgς΃nbVȂ
+		for (size_t offset = 40; offset < original.size(); offset += original.size() / 13)
+		{
+			std::vector<uint8_t> bytes = original;
+			bytes[offset] ^= 0x10;
+			SaveBytes(path, bytes);
+			FALU_CHECK(Misses(path, key));
+		}
+
+		// Ⴄo[W
+		{
+			std::vector<uint8_t> bytes = original;
+			uint32_t version = MeshCache::kVersion + 1;
+			std::memcpy(bytes.data() + 4, &version, sizeof(version));
+			SaveBytes(path, bytes);
+			FALU_CHECK(Misses(path, key));
+		}
+
+		uint64_t contentHash;
+		std::memcpy(&contentHash, original.data() + kContentHashOffset, sizeof(contentHash));
+		size_t bodyOffset = FindBodyOffset(original, contentHash);
+		FALU_CHECK(bodyOffset > kContentHashOffset);
+		if (bodyOffset <= kContentHashOffset)
+			return;
+
+		// nbV꒼̃t@C͂̂܂ܓǂ߂
+		{
+			std::vector<uint8_t> bytes = original;
+			Resign(bytes, bodyOffset);
+			SaveBytes(path, bytes);
+			FALU_CHECK(!Misses(path, key));
+		}
+
+		// nbV܂ō킹Ĕ͈͊OA̋ڂ炸ꂽwItZbgBǂ̃ItZbg͈͂̊mF
+		Mesh& terrain = *import.subMeshes[0].mesh;
+		Mesh& compact = *import.subMeshes[2].mesh;
+		struct Blob { const void* data; size_t size; };
+		const Blob blobs[] = {
+			{ compact.GetUploadVertexData(), compact.GetVertexBufferSize() },
+			{ compact.GetUploadIndexData(), compact.GetIndexBufferSize() },
+			{ compact.GetMeshlets().data(), compact.GetMeshlets().size() * sizeof(Meshlet) },
+			{ compact.GetVertices().data(), compact.GetVertices().size() * sizeof(Vertex) },
+			{ terrain.GetUploadVertexData(), terrain.GetVertexBufferSize() },
+			{ terrain.GetUploadIndexData(), terrain.GetIndexBufferSize() },
+			{ terrain.GetMeshlets().data(), terrain.GetMeshlets().size() * sizeof(Meshlet) },
+		};
+		size_t tableEnd = original.size();
+		std::vector<size_t> blobOffsets;
+		for (const Blob& blob : blobs)
+		{
+			blobOffsets.push_back(FindBlob(original, blob.data, blob.size));
+			FALU_CHECK(blobOffsets.back() > bodyOffset);
+			tableEnd = std::min(tableEnd, blobOffsets.back());
+		}
+		for (size_t blobOffset : blobOffsets)
+		{
+			size_t field = FindField(original, bodyOffset, tableEnd, blobOffset);
+			FALU_CHECK(field != 0);
+			if (field == 0)
+				continue;
+
+			const uint64_t values[] = { original.size() - 8, original.size(), original.size() + 4096, ~0ull - 15, blobOffset + 4 };
+			for (uint64_t value : values)
+			{
+				std::vector<uint8_t> bytes = original;
+				std::memcpy(bytes.data() + field, &value, sizeof(value));
+				Resign(bytes, bodyOffset);
+				SaveBytes(path, bytes);
+				FALU_CHECK(Misses(path, key));
+			}
+		}
+
+		// \ׂ̂Ă 4 oCgɒ[ȒlɕςBqbgȂAqbgĂbV̓}bv̒w
+		uint32_t rejected = 0, accepted = 0;
+		for (size_t offset = 8; offset + 4 <= tableEnd; offset += 4)
+		{
+			if (offset >= 16 && offset < kContentHashOffset + 8)
+				continue;
+
+			const uint32_t values[] = { 0, 1, 0x7FFFFFF0u, 0xFFFFFFFFu, static_cast<uint32_t>(original.size()) };
+			for (uint32_t value : values)
+			{
+				std::vector<uint8_t> bytes = original;
+				std::memcpy(bytes.data() + offset, &value, sizeof(value));
+				Resign(bytes, bodyOffset);
+				SaveBytes(path, bytes);
+
+				std::vector<ImportedMaterial> materials;
+				std::vector<ImportedSubMesh> subMeshes;
+				ModelLoadReport report;
+				std::shared_ptr<MappedFile> file = MeshCache::Read(path, key, kSourceDirectory, materials, subMeshes, report);
+				if (!file)
+				{
+					++rejected;
+					continue;
+				}
+				++accepted;
+				for (const ImportedSubMesh& subMesh : subMeshes)
+				{
+					for (uint32_t level = 0; level < subMesh.mesh->GetLodCount(); ++level)
+						FALU_CHECK(PointsIntoMap(*file, *subMesh.mesh->GetLod(level)));
+				}
+			}
+		}
+		FALU_CHECK(rejected > 0 && accepted > 0);
+	}
+
+	void TestHash()
+	{
+		// XXH64 ̊m̒l
+		FALU_CHECK(MeshCache::Hash("", 0) == 0xEF46DB3751D8E999ull);
+
+		// AV[hA1 rbg̈ႢŕςB32 oCg̃ubN̋ڂ̑O
+		std::vector<uint8_t> data(100);
+		for (size_t i = 0; i < data.size(); ++i)
+			data[i] = static_cast<uint8_t>(i * 31 + 7);
+		for (size_t size : { 1, 4, 8, 31, 32, 33, 64, 99 })
+		{
+			uint64_t hash = MeshCache::Hash(data.data(), size);
+			FALU_CHECK(hash == MeshCache::Hash(data.data(), size));
+			FALU_CHECK(hash != MeshCache::Hash(data.data(), size + 1));
+			FALU_CHECK(hash != MeshCache::Hash(data.data(), size, 1));
+			data[size - 1] ^= 1;
+			FALU_CHECK(hash != MeshCache::Hash(data.data(), size));
+			data[size - 1] ^= 1;
+		}
+	}
+}
+
+int main()
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "FaluMeshCacheTest";
+	std::filesystem::remove_all(directory);
+
+	TestHash();
+	TestRoundTrip(directory / "roundtrip");
+	TestRejectsBadFiles(directory / "corrupt");
+
+	std::filesystem::remove_all(directory);
+	return Test::Result();
+}
@@ -0,0 +1,172 @@
+/*****************************************************************//**
+ * \file   MeshOptimizerTest.cpp
+ * \brief  bVœKpX̃eXg(ACMR ̉PƎOp`̕ۑ)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/MeshOptimizer.h"
+#include "Renderer/VertexTypes.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace Falu;
+
+namespace
+{
+	// Op`Vbt size x size ̃Obh
+	void MakeShuffledGrid(uint32_t size, std::vector<Vertex>& outVertices, std::vector<uint32_t>& outIndices)
+	{
+		outVertices.clear();
+		for (uint32_t y = 0; y <= size; ++y)
+		{
+			for (uint32_t x = 0; x <= size; ++x)
+			{
+				Vertex vertex;
+				vertex.position = Math::Vector3(float(x), 0.0f, float(y));
+				outVertices.push_back(vertex);
+			}
+		}
+
+		std::vector<std::array<uint32_t, 3>> triangles;
+		for (uint32_t y = 0; y < size; ++y)
+		{
+			for (uint32_t x = 0; x < size; ++x)
+			{
+				uint32_t i0 = y * (size + 1) + x;
+				uint32_t i1 = i0 + 1;
+				uint32_t i2 = i0 + size + 1;
+				uint32_t i3 = i2 + 1;
+				triangles.push_back({ i0, i2, i1 });
+				triangles.push_back({ i1, i2, i3 });
+			}
+		}
+		std::mt19937 rng(99);
+		std::shuffle(triangles.begin(), triangles.end(), rng);
+
+		outIndices.clear();
+		for (const auto& triangle : triangles)
+			outIndices.insert(outIndices.end(), triangle.begin(), triangle.end());
+	}
+
+	using Triangle = std::array<float, 9>;
+
+	// Op`𒸓_̈ʒuŕ\Aۂ܂܉񂵂Ĕׂ`ɂ
+	std::vector<Triangle> CanonicalTriangles(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		std::vector<Triangle> triangles;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			std::array<std::array<float, 3>, 3> corners;
+			for (int k = 0; k < 3; ++k)
+			{
+				const Math::Vector3& p = vertices[indices[i + k]].position;
+				corners[k] = { p.x, p.y, p.z };
+			}
+			int first = static_cast<int>(std::min_element(corners.begin(), corners.end()) - corners.begin());
+			Triangle triangle;
+			for (int k = 0; k < 3; ++k)
+			{
+				const auto& corner = corners[(first + k) % 3];
+				std::copy(corner.begin(), corner.end(), triangle.begin() + k * 3);
+			}
+			triangles.push_back(triangle);
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	void TestVertexCache()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeShuffledGrid(100, vertices, indices);
+		std::vector<Triangle> original = CanonicalTriangles(vertices, indices);
+
+		MeshOptimizer::VertexCacheStats before = MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+		MeshOptimizer::OptimizeVertexCache(indices, vertices.size());
+		MeshOptimizer::VertexCacheStats after = MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+
+		FALU_CHECK(after.triangleCount == before.triangleCount);
+		FALU_CHECK(after.vertexCount == before.vertexCount);
+		// VbtObh͂قڍň 3 ɋ߂Bבւ 1 ؂
+		FALU_CHECK(before.GetACMR() > 2.5f);
+		FALU_CHECK(after.GetACMR() < 1.0f);
+		FALU_CHECK(CanonicalTriangles(vertices, indices) == original);
+	}
+
+	void TestOverdrawAndFetch()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeShuffledGrid(60, vertices, indices);
+		std::vector<Triangle> original = CanonicalTriangles(vertices, indices);
+
+		MeshOptimizer::OptimizeVertexCache(indices, vertices.size());
+		float cacheAcmr = MeshOptimizer::AnalyzeVertexCache(indices, vertices.size()).GetACMR();
+
+		MeshOptimizer::OptimizeOverdraw(indices, vertices);
+		FALU_CHECK(CanonicalTriangles(vertices, indices) == original);
+		// NX^[Pʂ̕בւȂ̂ŁALbV̌͂قƂǕςȂ
+		FALU_CHECK(MeshOptimizer::AnalyzeVertexCache(indices, vertices.size()).GetACMR() < cacheAcmr * 1.1f);
+
+		// QƂȂ_𑫂ĂƁAtFb`̍œKŏ
+		size_t usedCount = vertices.size();
+		vertices.push_back(Vertex());
+		MeshOptimizer::OptimizeVertexFetch(vertices, indices);
+		FALU_CHECK(vertices.size() == usedCount);
+		FALU_CHECK(CanonicalTriangles(vertices, indices) == original);
+
+		// _͍ŏɎg鏇ɕ
+		uint32_t next = 0;
+		for (uint32_t index : indices)
+		{
+			FALU_CHECK(index <= next);
+			if (index == next)
+				++next;
+		}
+	}
+
+	void TestOptimizeAll()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeShuffledGrid(80, vertices, indices);
+		std::vector<Triangle> original = CanonicalTriangles(vertices, indices);
+
+		MeshOptimizer::Settings settings;
+		MeshOptimizer::Report report;
+		MeshOptimizer::Optimize(vertices, indices, settings, &report);
+		FALU_CHECK(report.after.GetACMR() < report.before.GetACMR());
+		FALU_CHECK(report.after.GetATVR() < report.before.GetATVR());
+		FALU_CHECK(CanonicalTriangles(vertices, indices) == original);
+	}
+
+	// ͈͊ÕCfbNX΁Aǂ̃pXXgɐGȂ
+	void TestInvalidIndices()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeShuffledGrid(8, vertices, indices);
+		indices[7] = static_cast<uint32_t>(vertices.size());
+		const std::vector<uint32_t> broken = indices;
+
+		MeshOptimizer::OptimizeVertexCache(indices, vertices.size());
+		FALU_CHECK(indices == broken);
+		MeshOptimizer::OptimizeOverdraw(indices, vertices);
+		FALU_CHECK(indices == broken);
+	}
+}
+
+int main()
+{
+	TestVertexCache();
+	TestOverdrawAndFetch();
+	TestOptimizeAll();
+	TestInvalidIndices();
+	return Test::Result();
+}
@@ -0,0 +1,319 @@
+/*****************************************************************//**
+ * \file   MeshletTest.cpp
+ * \brief  bVbg̕ƃNX^[JÕeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/Meshlet.h"
+#include "Renderer/VertexTypes.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+using namespace Falu;
+
+namespace
+{
+	using Triangle = std::array<uint32_t, 3>;
+
+	// sxNg` PerspectiveFovLH
+	Math::Matrix4 Perspective(float fovY, float aspect, float zNear, float zFar)
+	{
+		float yScale = 1.0f / std::tan(fovY * 0.5f);
+		float xScale = yScale / aspect;
+		float q = zFar / (zFar - zNear);
+		return Math::Matrix4(
+			xScale, 0.0f, 0.0f, 0.0f,
+			0.0f, yScale, 0.0f, 0.0f,
+			0.0f, 0.0f, q, 1.0f,
+			0.0f, 0.0f, -zNear * q, 0.0f);
+	}
+
+	Vertex MakeVertex(const Math::Vector3& position)
+	{
+		return Vertex(position, Math::Vector3(0.0f, 1.0f, 0.0f), Math::Vector2(0.0f, 0.0f), Math::Color(1.0f, 1.0f, 1.0f, 1.0f));
+	}
+
+	Math::Vector3 FaceNormal(const std::vector<Vertex>& vertices, const uint32_t* tri)
+	{
+		const Math::Vector3& a = vertices[tri[0]].position;
+		return Math::Cross(vertices[tri[1]].position - a, vertices[tri[2]].position - a);
+	}
+
+	// _𒆐SƂ锼a 1  UV B\(cross(b - a, c - a))OAOp`͍̏Ă
+	void MakeSphere(uint32_t rings, uint32_t segments, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		const float pi = 3.14159265f;
+		vertices.clear();
+		indices.clear();
+		for (uint32_t r = 0; r <= rings; ++r)
+		{
+			float theta = pi * r / rings;
+			for (uint32_t s = 0; s <= segments; ++s)
+			{
+				float phi = 2.0f * pi * s / segments;
+				vertices.push_back(MakeVertex(Math::Vector3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi))));
+			}
+		}
+
+		std::vector<Triangle> triangles;
+		auto add = [&](uint32_t a, uint32_t b, uint32_t c)
+		{
+			Triangle tri = { a, b, c };
+			Math::Vector3 n = FaceNormal(vertices, tri.data());
+			if (Math::Dot(n, n) <= 1e-12f)
+				return;
+			Math::Vector3 centroid = vertices[a].position + vertices[b].position + vertices[c].position;
+			if (Math::Dot(n, centroid) < 0.0f)
+				std::swap(tri[1], tri[2]);
+			triangles.push_back(tri);
+		};
+		for (uint32_t r = 0; r < rings; ++r)
+		{
+			for (uint32_t s = 0; s < segments; ++s)
+			{
+				uint32_t i0 = r * (segments + 1) + s, i1 = i0 + 1;
+				uint32_t i2 = i0 + segments + 1, i3 = i2 + 1;
+				add(i0, i1, i2);
+				add(i1, i3, i2);
+			}
+		}
+
+		std::mt19937 rng(rings * 31 + segments);
+		std::shuffle(triangles.begin(), triangles.end(), rng);
+		for (const Triangle& tri : triangles)
+			indices.insert(indices.end(), tri.begin(), tri.end());
+	}
+
+	// 菇ۂ܂܁Aԏԍn܂悤ɉ
+	std::vector<Triangle> CanonicalTriangles(const std::vector<uint32_t>& indices)
+	{
+		std::vector<Triangle> triangles;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			Triangle tri = { indices[i], indices[i + 1], indices[i + 2] };
+			std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+			triangles.push_back(tri);
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	// Op`͂傤 1 ̃bVbgɓAbVbg̓CfbNXobt@ɌԂȂA
+	// _ƎOp`̏BEׂ͂Ă̒_܂݁A@R[ׂ͂Ă̕\̖@܂
+	void CheckMeshlets(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& before,
+		const std::vector<uint32_t>& after, const std::vector<Meshlet>& meshlets, uint32_t maxVertices, uint32_t maxTriangles)
+	{
+		FALU_CHECK(after.size() == before.size());
+		FALU_CHECK(CanonicalTriangles(after) == CanonicalTriangles(before));
+
+		uint32_t offset = 0;
+		for (const Meshlet& meshlet : meshlets)
+		{
+			FALU_CHECK(meshlet.indexOffset == offset);
+			FALU_CHECK(meshlet.triangleCount > 0);
+			FALU_CHECK(meshlet.triangleCount <= maxTriangles);
+			FALU_CHECK(meshlet.vertexCount <= maxVertices);
+			offset += meshlet.triangleCount * 3;
+			if (offset > after.size())
+				return;
+
+			const uint32_t* indices = &after[meshlet.indexOffset];
+			std::vector<uint32_t> unique(indices, indices + meshlet.triangleCount * 3);
+			std::sort(unique.begin(), unique.end());
+			unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+			FALU_CHECK(unique.size() == meshlet.vertexCount);
+
+			for (uint32_t v : unique)
+			{
+				Math::Vector3 d = vertices[v].position - meshlet.center;
+				FALU_CHECK(Math::Length(d) <= meshlet.radius * 1.0001f + 1e-6f);
+			}
+
+			if (meshlet.coneCutoff < 1.0f)
+			{
+				float minDot = std::sqrt(1.0f - meshlet.coneCutoff * meshlet.coneCutoff);
+				for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+				{
+					Math::Vector3 n = FaceNormal(vertices, indices + t * 3);
+					float length = Math::Length(n);
+					if (length > 0.0f)
+						FALU_CHECK(Math::Dot(n, meshlet.coneAxis) / length >= minDot - 1e-4f);
+				}
+			}
+		}
+		FALU_CHECK(offset == after.size());
+	}
+
+	void TestBuildSphere()
+	{
+		const uint32_t limits[][2] = { { Meshlets::kMaxVertices, Meshlets::kMaxTriangles }, { 16, 8 }, { 3, 1 }, { 4, 124 }, { 255, 512 } };
+		for (const auto& limit : limits)
+		{
+			std::vector<Vertex> vertices;
+			std::vector<uint32_t> indices;
+			MakeSphere(24, 48, vertices, indices);
+			std::vector<uint32_t> before = indices;
+
+			std::vector<Meshlet> meshlets = Meshlets::Build(vertices, indices, limit[0], limit[1]);
+			CheckMeshlets(vertices, before, indices, meshlets, limit[0], limit[1]);
+			if (limit[1] == 1)
+				FALU_CHECK(meshlets.size() == before.size() / 3);
+		}
+	}
+
+	// _LȂOp`ƁAOp`̏d 1 񂸂o
+	void TestBuildDisconnected()
+	{
+		std::mt19937 rng(5);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		for (uint32_t t = 0; t < 500; ++t)
+		{
+			uint32_t base = static_cast<uint32_t>(vertices.size());
+			for (int k = 0; k < 3; ++k)
+				vertices.push_back(MakeVertex(Math::Vector3(unit(rng), unit(rng), unit(rng))));
+			indices.insert(indices.end(), { base, base + 1, base + 2 });
+			if (t % 50 == 0)
+				indices.insert(indices.end(), { base, base + 1, base + 2 });
+		}
+		std::vector<uint32_t> before = indices;
+
+		std::vector<Meshlet> meshlets = Meshlets::Build(vertices, indices, 64, 124);
+		CheckMeshlets(vertices, before, indices, meshlets, 64, 124);
+
+		std::vector<uint32_t> empty;
+		FALU_CHECK(Meshlets::Build(vertices, empty).empty());
+	}
+
+	// JO͕ێI: ŗbVbg͑S_ 1 ̃Nbvʂ̊OA
+	// ŗbVbg͑SOp`JɗB͈͂͌郁bVbg傤Ǖ
+	void TestCull()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeSphere(32, 64, vertices, indices);
+		std::vector<Meshlet> meshlets = Meshlets::Build(vertices, indices, 32, 32);
+
+		std::mt19937 rng(2718);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		Math::Matrix4 projection = Perspective(0.8f, 1.0f, 0.1f, 100.0f);
+		Meshlets::CullStats total;
+		for (int trial = 0; trial < 200; ++trial)
+		{
+			Math::Vector3 translation(unit(rng) * 3.0f, unit(rng) * 3.0f, unit(rng) * 3.0f);
+			Math::Quaternion rotation = Math::Quaternion::FromEuler(unit(rng) * 3.0f, unit(rng) * 3.0f, unit(rng) * 3.0f);
+			float scale = 0.5f + unit(rng) * 0.25f + 0.25f;
+			Math::Matrix4 world = Math::Matrix4::TRS(translation, rotation, Math::Vector3(scale, scale, scale));
+
+			Math::Vector3 cameraPosition(unit(rng) * 8.0f, unit(rng) * 8.0f, -4.0f - 4.0f * (unit(rng) * 0.5f + 0.5f));
+			Math::Quaternion cameraRotation = Math::Quaternion::FromEuler(unit(rng) * 0.6f, unit(rng) * 0.6f, 0.0f);
+			Math::Matrix4 view = Math::Inverse(Math::Matrix4::TRS(cameraPosition, cameraRotation, Math::Vector3(1.0f, 1.0f, 1.0f)));
+			Math::Matrix4 viewProjection = view * projection;
+
+			Meshlets::CullView cullView = Meshlets::MakeCullView(world, viewProjection, cameraPosition);
+			FALU_CHECK(cullView.coneCulling);
+
+			std::vector<IndexRange> ranges;
+			Meshlets::CullStats stats;
+			size_t added = Meshlets::Cull(meshlets, cullView, ranges, &stats);
+			FALU_CHECK(added == ranges.size());
+			FALU_CHECK(stats.meshletCount == meshlets.size());
+			FALU_CHECK(stats.rangeCount == ranges.size());
+
+			Math::Matrix4 worldViewProjection = world * viewProjection;
+			size_t nextRange = 0;
+			uint32_t visibleIndices = 0;
+			uint32_t frustumCulled = 0, backfaceCulled = 0;
+			for (const Meshlet& meshlet : meshlets)
+			{
+				// 郁bVbg͏ɔ͈͂ɓĂ
+				while (nextRange < ranges.size() && ranges[nextRange].indexOffset + ranges[nextRange].indexCount <= meshlet.indexOffset)
+					++nextRange;
+				bool inRange = nextRange < ranges.size() && ranges[nextRange].indexOffset <= meshlet.indexOffset &&
+					meshlet.indexOffset + meshlet.triangleCount * 3 <= ranges[nextRange].indexOffset + ranges[nextRange].indexCount;
+				if (inRange)
+				{
+					visibleIndices += meshlet.triangleCount * 3;
+					continue;
+				}
+
+				const uint32_t* tris = &indices[meshlet.indexOffset];
+				bool outside[6] = { true, true, true, true, true, true };
+				for (uint32_t i = 0; i < meshlet.triangleCount * 3; ++i)
+				{
+					Math::Vector4 clip = Math::Transform(Math::Vector4(vertices[tris[i]].position, 1.0f), worldViewProjection);
+					outside[0] = outside[0] && clip.x < -clip.w;
+					outside[1] = outside[1] && clip.x > clip.w;
+					outside[2] = outside[2] && clip.y < -clip.w;
+					outside[3] = outside[3] && clip.y > clip.w;
+					outside[4] = outside[4] && clip.z < 0.0f;
+					outside[5] = outside[5] && clip.z > clip.w;
+				}
+				if (std::find(outside, outside + 6, true) != outside + 6)
+				{
+					++frustumCulled;
+					continue;
+				}
+
+				++backfaceCulled;
+				for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+				{
+					Math::Vector3 a = Math::TransformPoint(vertices[tris[t * 3 + 0]].position, world);
+					Math::Vector3 b = Math::TransformPoint(vertices[tris[t * 3 + 1]].position, world);
+					Math::Vector3 c = Math::TransformPoint(vertices[tris[t * 3 + 2]].position, world);
+					FALU_CHECK(Math::Dot(Math::Cross(b - a, c - a), a - cameraPosition) >= -1e-5f);
+				}
+			}
+
+			uint32_t rangeIndices = 0;
+			for (const IndexRange& range : ranges)
+				rangeIndices += range.indexCount;
+			FALU_CHECK(rangeIndices == visibleIndices);
+			FALU_CHECK(stats.frustumCulled + stats.backfaceCulled == frustumCulled + backfaceCulled);
+
+			total.frustumCulled += stats.frustumCulled;
+			total.backfaceCulled += stats.backfaceCulled;
+		}
+		// ǂ̃JOۂɌĂ
+		FALU_CHECK(total.frustumCulled > 0);
+		FALU_CHECK(total.backfaceCulled > 0);
+	}
+
+	// f[hsł̓R[̃JO؂
+	void TestMirroredWorld()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeSphere(16, 32, vertices, indices);
+		std::vector<Meshlet> meshlets = Meshlets::Build(vertices, indices, 32, 32);
+
+		Math::Matrix4 world = Math::Matrix4::Scaling(Math::Vector3(-1.0f, 1.0f, 1.0f));
+		Math::Vector3 cameraPosition(0.0f, 0.0f, -5.0f);
+		Math::Matrix4 view = Math::Matrix4::Translation(Math::Vector3(0.0f, 0.0f, 5.0f));
+		Meshlets::CullView cullView = Meshlets::MakeCullView(world, view * Perspective(1.0f, 1.0f, 0.1f, 100.0f), cameraPosition);
+		FALU_CHECK(!cullView.coneCulling);
+
+		std::vector<IndexRange> ranges;
+		Meshlets::CullStats stats;
+		Meshlets::Cull(meshlets, cullView, ranges, &stats);
+		FALU_CHECK(stats.backfaceCulled == 0);
+		FALU_CHECK(stats.GetVisibleCount() == meshlets.size());
+		FALU_CHECK(ranges.size() == 1);
+		FALU_CHECK(ranges[0].indexOffset == 0 && ranges[0].indexCount == indices.size());
+	}
+}
+
+int main()
+{
+	TestBuildSphere();
+	TestBuildDisconnected();
+	TestCull();
+	TestMirroredWorld();
+	return Test::Result();
+}
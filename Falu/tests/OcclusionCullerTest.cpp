@@ -0,0 +1,238 @@
+/*****************************************************************//**
+ * \file   OcclusionCullerTest.cpp
+ * \brief  OcclusionCuller ̐xeXg({P[XƃCLXgƂ̓˂킹)
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/OcclusionCuller.h"
+#include "Falu/JobSystem.h"
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Falu;
+using namespace Falu::Math;
+
+namespace
+{
+	// D3D ̍np[XyNeBu (XMMatrixPerspectiveFovLH Ɠ)
+	Matrix4 Perspective(float fovY, float aspect, float nearZ, float farZ)
+	{
+		float ys = 1.0f / std::tan(fovY * 0.5f);
+		float xs = ys / aspect;
+		float range = farZ / (farZ - nearZ);
+		return Matrix4(
+			xs, 0.0f, 0.0f, 0.0f,
+			0.0f, ys, 0.0f, 0.0f,
+			0.0f, 0.0f, range, 1.0f,
+			0.0f, 0.0f, -nearZ * range, 0.0f);
+	}
+
+	struct TestMesh
+	{
+		std::vector<Vector3> positions;
+		IndexData indices;
+		AABB bounds;
+	};
+
+	// z = depth ̕ʂɒu n x n ̕ǁB_猩Ďv(\)Aflip ŗ
+	TestMesh Wall(float x0, float x1, float y0, float y1, float depth, int n, bool flip = false)
+	{
+		TestMesh mesh;
+		for (int j = 0; j <= n; ++j)
+			for (int i = 0; i <= n; ++i)
+				mesh.positions.push_back(Vector3(x0 + (x1 - x0) * i / n, y1 - (y1 - y0) * j / n, depth));
+
+		std::vector<uint32_t> indices;
+		for (int j = 0; j < n; ++j)
+			for (int i = 0; i < n; ++i)
+			{
+				uint32_t a = j * (n + 1) + i, b = a + 1, c = a + n + 2, d = a + n + 1;
+				if (flip)
+					indices.insert(indices.end(), { a, c, b, a, d, c });
+				else
+					indices.insert(indices.end(), { a, b, c, a, c, d });
+			}
+		mesh.indices.Assign(indices, mesh.positions.size());
+		mesh.bounds = AABB(Vector3(x0, y0, depth), Vector3(x1, y1, depth));
+		return mesh;
+	}
+
+	AABB Box(const Vector3& center, float half)
+	{
+		return AABB(center - Vector3(half, half, half), center + Vector3(half, half, half));
+	}
+
+	void AddOccluder(OcclusionCuller& culler, const TestMesh& mesh)
+	{
+		culler.AddOccluder(mesh.positions.data(), sizeof(Vector3), static_cast<uint32_t>(mesh.positions.size()),
+			mesh.indices, Matrix4(), mesh.bounds);
+	}
+
+	// Moller-TrumboreBorigin + dir * t (0 < t) œ t Ԃ
+	bool IntersectTriangle(const Vector3& origin, const Vector3& dir, const Vector3& a, const Vector3& b, const Vector3& c, float& t)
+	{
+		Vector3 e1 = b - a, e2 = c - a, p = Cross(dir, e2);
+		float det = Dot(e1, p);
+		if (std::fabs(det) < 1e-12f)
+			return false;
+		float invDet = 1.0f / det;
+		Vector3 s = origin - a;
+		float u = Dot(s, p) * invDet;
+		if (u < -1e-4f || u > 1.0f + 1e-4f)
+			return false;
+		Vector3 q = Cross(s, e1);
+		float v = Dot(dir, q) * invDet;
+		if (v < -1e-4f || u + v > 1.0f + 1e-4f)
+			return false;
+		t = Dot(e2, q) * invDet;
+		return t > 0.0f;
+	}
+
+	void TestBasicCases(OcclusionCuller& culler, const Matrix4& viewProjection)
+	{
+		const Vector3 eye(0.0f, 0.0f, 0.0f);
+
+		// ʂ̕ǂ͉̌BAOE͂ݏoEڐGEg͌
+		TestMesh wall = Wall(-5.0f, 5.0f, -3.0f, 3.0f, 10.0f, 1);
+		culler.Begin(viewProjection, eye, viewProjection.m[1][1]);
+		AddOccluder(culler, wall);
+		culler.Rasterize();
+		FALU_CHECK(culler.GetTriangleCount() == 2);
+		FALU_CHECK(!culler.IsVisible(Box(Vector3(0.0f, 0.0f, 15.0f), 0.5f)));
+		FALU_CHECK(culler.IsVisible(Box(Vector3(0.0f, 0.0f, 5.0f), 0.5f)));
+		FALU_CHECK(culler.IsVisible(Box(Vector3(7.5f, 0.0f, 15.0f), 0.5f)));
+		FALU_CHECK(culler.IsVisible(Box(Vector3(0.0f, 0.0f, 10.2f), 0.25f)));
+		FALU_CHECK(culler.IsVisible(Box(Vector3(0.0f, 0.0f, 0.0f), 1.0f)));
+		FALU_CHECK(culler.IsVisible(wall.bounds));
+
+		// ̕ǂ͕`Ȃ
+		TestMesh back = Wall(-5.0f, 5.0f, -3.0f, 3.0f, 10.0f, 1, true);
+		culler.Begin(viewProjection, eye, viewProjection.m[1][1]);
+		AddOccluder(culler, back);
+		culler.Rasterize();
+		FALU_CHECK(culler.GetTriangleCount() == 0);
+		FALU_CHECK(culler.IsVisible(Box(Vector3(0.0f, 0.0f, 15.0f), 0.5f)));
+
+		// jAv[܂̓NbvẢB
+		TestMesh floor;
+		floor.positions = { Vector3(-50.0f, -1.0f, -5.0f), Vector3(50.0f, -1.0f, -5.0f), Vector3(50.0f, -1.0f, 60.0f), Vector3(-50.0f, -1.0f, 60.0f) };
+		floor.indices.Assign(std::vector<uint32_t>{ 0, 3, 2, 0, 2, 1 }, floor.positions.size());
+		floor.bounds = AABB(Vector3(-50.0f, -1.0f, -5.0f), Vector3(50.0f, -1.0f, 60.0f));
+		culler.Begin(viewProjection, eye, viewProjection.m[1][1]);
+		AddOccluder(culler, floor);
+		culler.Rasterize();
+		FALU_CHECK(culler.GetTriangleCount() > 0);
+		FALU_CHECK(!culler.IsVisible(Box(Vector3(0.0f, -3.0f, 20.0f), 0.5f)));
+		FALU_CHECK(culler.IsVisible(Box(Vector3(0.0f, 0.0f, 20.0f), 0.5f)));
+	}
+
+	// _ȕǂƃ{bNXŁABꂽƔ肵{bNX̕\ʂ{ɉBĂ邩CŊm߂B
+	// ߂l { JOꂽ, ̂Ă }
+	std::pair<int, int> CheckConservative(OcclusionCuller& culler, const Matrix4& viewProjection, int wallsPerScene, uint32_t seed)
+	{
+		const Vector3 eye(0.0f, 0.0f, 0.0f);
+		const int kSceneCount = 40;
+		const int kQueriesPerScene = 500;
+		const int kSamples = 12;
+
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> random(-1.0f, 1.0f);
+		int culledCount = 0;
+		int falseCullCount = 0;
+
+		for (int scene = 0; scene < kSceneCount; ++scene)
+		{
+			std::vector<TestMesh> walls;
+			for (int k = 0; k < wallsPerScene; ++k)
+			{
+				float cx = random(rng) * 12.0f, cy = random(rng) * 5.0f, cz = 8.0f + (random(rng) + 1.0f) * 10.0f;
+				float w = 2.0f + (random(rng) + 1.0f) * 3.0f, h = 2.0f + (random(rng) + 1.0f) * 2.0f;
+				walls.push_back(Wall(cx - w, cx + w, cy - h, cy + h, cz, 3));
+			}
+
+			std::vector<Vector3> triangles;
+			culler.Begin(viewProjection, eye, viewProjection.m[1][1]);
+			for (const TestMesh& wall : walls)
+			{
+				AddOccluder(culler, wall);
+				for (size_t i = 0; i < wall.indices.GetCount(); ++i)
+					triangles.push_back(wall.positions[wall.indices[i]]);
+			}
+			culler.Rasterize();
+
+			for (int query = 0; query < kQueriesPerScene; ++query)
+			{
+				Vector3 center(random(rng) * 25.0f, random(rng) * 10.0f, 10.0f + (random(rng) + 1.0f) * 20.0f);
+				float half = 0.1f + (random(rng) + 1.0f);
+				if (culler.IsVisible(Box(center, half)))
+					continue;
+				++culledCount;
+
+				// ɂ\ʂ̃Tv_ 1 łĂΌJO
+				bool falseCull = false;
+				for (int face = 0; face < 6 && !falseCull; ++face)
+					for (int a = 0; a <= kSamples && !falseCull; ++a)
+						for (int b = 0; b <= kSamples && !falseCull; ++b)
+						{
+							float s = -half + 2.0f * half * a / kSamples;
+							float t = -half + 2.0f * half * b / kSamples;
+							float e = (face & 1) ? half : -half;
+							Vector3 offset = face < 2 ? Vector3(e, s, t) : face < 4 ? Vector3(s, e, t) : Vector3(s, t, e);
+							Vector3 point = center + offset;
+
+							Vector4 clip = Transform(Vector4(point, 1.0f), viewProjection);
+							if (clip.w <= 0.0f || std::fabs(clip.x) > clip.w || std::fabs(clip.y) > clip.w)
+								continue;
+
+							bool hidden = false;
+							for (size_t i = 0; i < triangles.size() && !hidden; i += 3)
+							{
+								float hit;
+								hidden = IntersectTriangle(eye, point, triangles[i], triangles[i + 1], triangles[i + 2], hit) && hit < 1.0f;
+							}
+							falseCull = !hidden;
+						}
+				falseCullCount += falseCull ? 1 : 0;
+			}
+		}
+
+		std::printf("random (%d walls): %d queries, %d culled, %d false culls\n",
+			wallsPerScene, kSceneCount * kQueriesPerScene, culledCount, falseCullCount);
+		return { culledCount, falseCullCount };
+	}
+
+	void TestConservative(OcclusionCuller& culler, const Matrix4& viewProjection)
+	{
+		// 1 ̃bV(̕ӂ܂)ȂJO͋NȂ
+		std::pair<int, int> single = CheckConservative(culler, viewProjection, 1, 3);
+		FALU_CHECK(single.first > 0);
+		FALU_CHECK(single.second == 0);
+
+		// ʁX̃IN[_[̊Ԃɂł 1 sNŽԂ́A̐[xōǂČȂȂ(m̗O)B
+		// ȂłʂĂ܂Ȃ悤ɁA\ȐĂ邱Ƃm߂
+		std::pair<int, int> multiple = CheckConservative(culler, viewProjection, 6, 7);
+		FALU_CHECK(multiple.first > 40 * 500 / 20);
+		FALU_CHECK(multiple.second * 500 <= multiple.first);
+	}
+}
+
+int main()
+{
+	JobSystem::GetInstance().Initialize(3);
+	std::printf("instruction set: %s\n", OcclusionCuller::GetInstructionSet());
+
+	Matrix4 viewProjection = Perspective(1.0471975f, 2.0f, 0.1f, 100.0f);
+	OcclusionCuller culler;
+	culler.SetSettings(OcclusionSettings());
+
+	TestBasicCases(culler, viewProjection);
+	TestConservative(culler, viewProjection);
+
+	JobSystem::GetInstance().Shutdown();
+	return Test::Result();
+}
@@ -0,0 +1,250 @@
+/*****************************************************************//**
+ * \file   RayPacketTest.cpp
+ * \brief  4 {̃C̔ 1 {̔ƔׂeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Include/Math/RayPacket.h"
+#include "Renderer/MeshBvh.h"
+#include "Renderer/VertexTypes.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+
+using namespace Falu;
+
+namespace
+{
+	// IntersectAABB ̃[ 1 {̃Xu(XJ[̏)
+	bool ReferenceSlab(const Math::RayPacket& packet, int lane, const Math::AABB& box, float tLimit, float& tNear, float& tFar)
+	{
+		float tx1 = (box.min.x - packet.ox[lane]) * packet.invDx[lane], tx2 = (box.max.x - packet.ox[lane]) * packet.invDx[lane];
+		float ty1 = (box.min.y - packet.oy[lane]) * packet.invDy[lane], ty2 = (box.max.y - packet.oy[lane]) * packet.invDy[lane];
+		float tz1 = (box.min.z - packet.oz[lane]) * packet.invDz[lane], tz2 = (box.max.z - packet.oz[lane]) * packet.invDz[lane];
+		tNear = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+		tFar = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+		return tFar >= std::max(tNear, 0.0f) && tNear < tLimit;
+	}
+
+	// ̈ꕔ 0 ɂāAɕsȃC
+	Math::Vector3 RandomDirection(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		Math::Vector3 d(unit(rng), unit(rng), unit(rng));
+		uint32_t zeros = rng() % 8;
+		if (zeros == 1) d.x = 0.0f;
+		if (zeros == 2) d.y = 0.0f;
+		if (zeros == 3) d.z = 0.0f;
+		if (zeros == 4) d = Math::Vector3(0.0f, 0.0f, d.z < 0.0f ? -1.0f : 1.0f);
+		if (Math::Length(d) < 1e-3f)
+			d = Math::Vector3(1.0f, 0.0f, 0.0f);
+		return Math::Normalize(d);
+	}
+
+	// SSE ̔肪[Ƃ̃XJ[̔ƃrbgPʂňvA̋ԂۂɃ{bNX̒ʂ
+	void TestIntersectAABB()
+	{
+		std::mt19937 rng(38);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> positive(0.0f, 1.0f);
+		uint32_t hits = 0, misses = 0;
+		for (int trial = 0; trial < 20000; ++trial)
+		{
+			Math::Vector3 center(unit(rng) * 5.0f, unit(rng) * 5.0f, unit(rng) * 5.0f);
+			Math::Vector3 half(0.1f + positive(rng) * 3.0f, 0.1f + positive(rng) * 3.0f, 0.1f + positive(rng) * 3.0f);
+			Math::AABB box(center - half, center + half);
+
+			Math::RayPacket packet;
+			float tLimit[Math::RayPacket::kWidth];
+			for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+			{
+				// 4 { 1 {͌_{bNX̒ɒu
+				Math::Vector3 origin = (rng() % 4 == 0)
+					? center + Math::Vector3(unit(rng) * half.x, unit(rng) * half.y, unit(rng) * half.z)
+					: Math::Vector3(unit(rng) * 10.0f, unit(rng) * 10.0f, unit(rng) * 10.0f);
+				packet.SetLane(lane, Math::Ray(origin, RandomDirection(rng)));
+				tLimit[lane] = (rng() % 3 == 0) ? FLT_MAX : positive(rng) * 20.0f;
+			}
+			packet.activeMask = rng() % 16;
+
+			float tNear[Math::RayPacket::kWidth], tFar[Math::RayPacket::kWidth];
+			uint32_t mask = Math::IntersectAABB(packet, box.min, box.max, tLimit, tNear, tFar);
+			FALU_CHECK((mask & ~packet.activeMask) == 0);
+
+			for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+			{
+				float referenceNear, referenceFar;
+				bool referenceHit = ReferenceSlab(packet, lane, box, tLimit[lane], referenceNear, referenceFar);
+				FALU_CHECK(tNear[lane] == referenceNear);
+				FALU_CHECK(tFar[lane] == referenceFar);
+				bool active = (packet.activeMask & (1u << lane)) != 0;
+				FALU_CHECK(((mask >> lane) & 1u) == uint32_t(active && referenceHit));
+
+				// ȂԂ̒_̓{bNX̒BOȂ [0, tLimit) ̂ǂ̓_(k߂){bNX̊O
+				Math::Ray ray = packet.GetLane(lane);
+				if (referenceHit)
+				{
+					float t = (std::max(referenceNear, 0.0f) + std::min(referenceFar, 1e6f)) * 0.5f;
+					Math::Vector3 p = ray.GetPoint(t);
+					Math::AABB grown(box.min - Math::Vector3(1e-3f, 1e-3f, 1e-3f), box.max + Math::Vector3(1e-3f, 1e-3f, 1e-3f));
+					FALU_CHECK(grown.Contains(p));
+					++hits;
+				}
+				else
+				{
+					Math::AABB shrunk(box.min + Math::Vector3(1e-3f, 1e-3f, 1e-3f), box.max - Math::Vector3(1e-3f, 1e-3f, 1e-3f));
+					float end = std::min(tLimit[lane], 40.0f);
+					for (int s = 0; s < 64; ++s)
+						FALU_CHECK(!shrunk.Contains(ray.GetPoint(end * s / 64.0f)));
+					++misses;
+				}
+			}
+		}
+		FALU_CHECK(hits > 1000 && misses > 1000);
+	}
+
+	//  Moller-TrumboreBʂƂ
+	bool BruteForceRayCast(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+		const Math::Ray& ray, float maxDistance, float& outDistance, uint32_t& outTriangle)
+	{
+		bool found = false;
+		outDistance = maxDistance;
+		for (size_t t = 0; t < indices.size() / 3; ++t)
+		{
+			const Math::Vector3& a = vertices[indices[t * 3 + 0]].position;
+			Math::Vector3 e1 = vertices[indices[t * 3 + 1]].position - a;
+			Math::Vector3 e2 = vertices[indices[t * 3 + 2]].position - a;
+			Math::Vector3 p = Math::Cross(ray.direction, e2);
+			float det = Math::Dot(e1, p);
+			if (std::fabs(det) <= 1e-20f)
+				continue;
+			float invDet = 1.0f / det;
+			Math::Vector3 s = ray.origin - a;
+			float u = Math::Dot(s, p) * invDet;
+			Math::Vector3 q = Math::Cross(s, e1);
+			float v = Math::Dot(ray.direction, q) * invDet;
+			float distance = Math::Dot(e2, q) * invDet;
+			if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && distance >= 0.0f && distance < outDistance)
+			{
+				outDistance = distance;
+				outTriangle = static_cast<uint32_t>(t);
+				found = true;
+			}
+		}
+		return found;
+	}
+
+	// głiqƁȀɕԃ_ȎOp`
+	void MakeScene(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		std::mt19937 rng(7);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		const uint32_t size = 40;
+		for (uint32_t z = 0; z <= size; ++z)
+		{
+			for (uint32_t x = 0; x <= size; ++x)
+			{
+				float height = std::sin(x * 0.4f) * std::cos(z * 0.3f);
+				vertices.push_back(Vertex(Math::Vector3(x - 20.0f, height, z - 20.0f), Math::Vector3(0.0f, 1.0f, 0.0f),
+					Math::Vector2(0.0f, 0.0f), Math::Color(1.0f, 1.0f, 1.0f, 1.0f)));
+			}
+		}
+		for (uint32_t z = 0; z < size; ++z)
+		{
+			for (uint32_t x = 0; x < size; ++x)
+			{
+				uint32_t i0 = z * (size + 1) + x, i1 = i0 + 1, i2 = i0 + size + 1, i3 = i2 + 1;
+				indices.insert(indices.end(), { i0, i2, i1, i1, i2, i3 });
+			}
+		}
+		for (int t = 0; t < 300; ++t)
+		{
+			Math::Vector3 center(unit(rng) * 20.0f, 4.0f + unit(rng) * 2.0f, unit(rng) * 20.0f);
+			uint32_t base = static_cast<uint32_t>(vertices.size());
+			for (int k = 0; k < 3; ++k)
+			{
+				Math::Vector3 p = center + Math::Vector3(unit(rng), unit(rng), unit(rng)) * 1.5f;
+				vertices.push_back(Vertex(p, Math::Vector3(0.0f, 1.0f, 0.0f), Math::Vector2(0.0f, 0.0f), Math::Color(1.0f, 1.0f, 1.0f, 1.0f)));
+			}
+			indices.insert(indices.end(), { base, base + 1, base + 2 });
+		}
+	}
+
+	// pPbgłǂʂ 1 { RayCast ƁAꂪƈvB
+	// ̃pPbg(4 {ɂǂ)Ƃ΂΂̌̃pPbg(1 {ɗ)̗
+	void TestMeshBvhPacket()
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		MakeScene(vertices, indices);
+		IndexData indexData;
+		indexData.Assign(indices, vertices.size());
+		MeshBvh bvh;
+		bvh.Build(vertices, indexData);
+		FALU_CHECK(bvh.GetTriangleCount() == indices.size() / 3);
+
+		std::mt19937 rng(2024);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		uint32_t hitLanes = 0;
+		for (int trial = 0; trial < 3000; ++trial)
+		{
+			bool coherent = trial % 2 == 0;
+			Math::Vector3 eye(unit(rng) * 25.0f, 10.0f + unit(rng) * 5.0f, unit(rng) * 25.0f);
+			Math::Vector3 target(unit(rng) * 15.0f, 0.0f, unit(rng) * 15.0f);
+
+			Math::RayPacket packet;
+			float maxDistance[Math::RayPacket::kWidth];
+			for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+			{
+				Math::Vector3 jitter(unit(rng), unit(rng), unit(rng));
+				Math::Vector3 direction = coherent
+					? Math::Normalize(target + jitter * 2.0f - eye)
+					: RandomDirection(rng);
+				packet.SetLane(lane, Math::Ray(eye, direction));
+				maxDistance[lane] = (rng() % 4 == 0) ? 8.0f + unit(rng) * 4.0f : 1000.0f;
+			}
+			packet.activeMask = (rng() % 5 == 0) ? (rng() % 16) : Math::RayPacket::kFullMask;
+
+			MeshRayHit packetHits[Math::RayPacket::kWidth];
+			uint32_t mask = bvh.RayCastPacket(packet, maxDistance, packetHits);
+			FALU_CHECK((mask & ~packet.activeMask) == 0);
+
+			for (int lane = 0; lane < Math::RayPacket::kWidth; ++lane)
+			{
+				if (!(packet.activeMask & (1u << lane)))
+					continue;
+
+				Math::Ray ray = packet.GetLane(lane);
+				MeshRayHit single;
+				bool singleHit = bvh.RayCast(ray, maxDistance[lane], single);
+				bool packetHit = (mask & (1u << lane)) != 0;
+				FALU_CHECK(packetHit == singleHit);
+
+				float bruteDistance = 0.0f;
+				uint32_t bruteTriangle = 0;
+				bool bruteHit = BruteForceRayCast(vertices, indices, ray, maxDistance[lane], bruteDistance, bruteTriangle);
+				FALU_CHECK(singleHit == bruteHit);
+				if (!singleHit || !packetHit || !bruteHit)
+					continue;
+
+				++hitLanes;
+				// Op`𓯂Ŕ肷̂ŋ͈v(̎Op`Δԍ͈Ă悢)
+				FALU_CHECK(packetHits[lane].distance == single.distance);
+				FALU_CHECK(std::fabs(single.distance - bruteDistance) <= 1e-4f * std::max(1.0f, bruteDistance));
+				FALU_CHECK(std::fabs(Math::Length(packetHits[lane].normal) - 1.0f) < 1e-4f);
+			}
+		}
+		FALU_CHECK(hitLanes > 1000);
+	}
+}
+
+int main()
+{
+	TestIntersectAABB();
+	TestMeshBvhPacket();
+	return Test::Result();
+}
@@ -0,0 +1,194 @@
+/*****************************************************************//**
+ * \file   RingAllocatorTest.cpp
+ * \brief  tFXtOAP[^[̃eXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/RingAllocator.h"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace Falu;
+
+namespace
+{
+	// Ɏ܂Ȃmۂ͐擪ɖ߂A΂͂̃t[܂ŎgȂ
+	void TestWraparound()
+	{
+		RingAllocator ring(1000, 100);
+		FALU_CHECK(ring.GetCapacity() == 1000);
+
+		FALU_CHECK(ring.Allocate(650) == 0);		// 700 ɐ؂オ
+		ring.FinishFrame(1);
+		FALU_CHECK(ring.Allocate(200) == 700);
+		ring.FinishFrame(2);
+		FALU_CHECK(ring.GetUsedSize() == 900);
+
+		// 擪͎gpȂ̂Ŗ߂Ȃ
+		FALU_CHECK(ring.Allocate(300) == RingAllocator::kInvalidOffset);
+
+		ring.Retire(1);
+		FALU_CHECK(ring.GetUsedSize() == 200);
+		FALU_CHECK(ring.GetOldestPendingFence() == 2);
+
+		//  100 oCgɂ͓Ȃ̂ 0 Blߕ̃t[̕ɐ
+		FALU_CHECK(ring.Allocate(300) == 0);
+		FALU_CHECK(ring.GetUsedSize() == 600);
+		FALU_CHECK(ring.Allocate(400) == 300);
+		FALU_CHECK(ring.Allocate(100) == RingAllocator::kInvalidOffset);
+		ring.FinishFrame(3);
+
+		// t[ 3 ͋lߕ 100 + 300 + 400
+		ring.Retire(2);
+		FALU_CHECK(ring.GetUsedSize() == 800);
+		ring.Retire(3);
+		FALU_CHECK(ring.IsEmpty());
+
+		// cĂȂΐ擪蒼
+		FALU_CHECK(ring.Allocate(1000) == 0);
+		FALU_CHECK(ring.IsFull());
+	}
+
+	// head == tail ͋̂ƂƖt̂Ƃ̗ŋNBgpʂŌ
+	void TestHeadEqualsTail()
+	{
+		RingAllocator ring(1024, 256);
+		FALU_CHECK(ring.IsEmpty());
+		FALU_CHECK(!ring.IsFull());
+
+		FALU_CHECK(ring.Allocate(512) == 0);
+		FALU_CHECK(ring.Allocate(256) == 512);
+		ring.FinishFrame(1);
+		FALU_CHECK(ring.Allocate(256) == 768);
+		ring.FinishFrame(2);
+
+		ring.Retire(1);		// tail = 768, head = 1024
+		FALU_CHECK(ring.Allocate(512) == 0);
+		FALU_CHECK(ring.Allocate(256) == 512);
+		// head == tail == 768 Ŗt
+		FALU_CHECK(ring.IsFull());
+		FALU_CHECK(ring.Allocate(1) == RingAllocator::kInvalidOffset);
+		ring.FinishFrame(3);
+
+		// t 1 t[ԂƁA̕g
+		ring.Retire(2);
+		FALU_CHECK(ring.GetUsedSize() == 768);
+		FALU_CHECK(ring.Allocate(512) == RingAllocator::kInvalidOffset);
+		FALU_CHECK(ring.Allocate(256) == 768);
+		FALU_CHECK(ring.IsFull());
+		ring.FinishFrame(4);
+
+		ring.Retire(4);
+		FALU_CHECK(ring.IsEmpty());
+		FALU_CHECK(ring.GetOldestPendingFence() == 0);
+		FALU_CHECK(ring.Allocate(1024) == 0);
+	}
+
+	// tFXt[AÂɉ
+	void TestFenceRetirement()
+	{
+		RingAllocator ring(4096, 256);
+
+		// mۂ̂Ȃt[͋L^Ȃ
+		ring.FinishFrame(1);
+		FALU_CHECK(ring.GetOldestPendingFence() == 0);
+
+		for (uint64_t fence = 2; fence <= 5; ++fence)
+		{
+			FALU_CHECK(ring.Allocate(256) != RingAllocator::kInvalidOffset);
+			ring.FinishFrame(fence);
+		}
+		FALU_CHECK(ring.GetUsedSize() == 1024);
+		FALU_CHECK(ring.GetOldestPendingFence() == 2);
+
+		// ܂ǂIĂȂ
+		ring.Retire(1);
+		FALU_CHECK(ring.GetUsedSize() == 1024);
+
+		// l܂Ƃ߂Đi߂ƁA܂ł̃t[ׂĉ
+		ring.Retire(4);
+		FALU_CHECK(ring.GetUsedSize() == 256);
+		FALU_CHECK(ring.GetOldestPendingFence() == 5);
+
+		// ߂ĂȂmۂ͉Ȃ
+		FALU_CHECK(ring.Allocate(256) != RingAllocator::kInvalidOffset);
+		ring.Retire(100);
+		FALU_CHECK(ring.GetUsedSize() == 256);
+		FALU_CHECK(ring.GetOldestPendingFence() == 0);
+		ring.FinishFrame(101);
+		ring.Retire(101);
+		FALU_CHECK(ring.IsEmpty());
+	}
+
+	// GPU xĒǂ󋵂͂AĂ͈͂dȂȂƂm߂
+	void TestRandomFrames()
+	{
+		struct Range
+		{
+			uint64_t fence;
+			uint64_t offset;
+			uint64_t size;
+		};
+
+		const uint64_t kCapacity = 64 * 1024;
+		const uint64_t kAlignment = 256;
+		RingAllocator ring(kCapacity, kAlignment);
+		std::mt19937 rng(2024);
+		std::deque<Range> live;
+		uint64_t completed = 0;
+		int failures = 0;
+
+		for (uint64_t fence = 1; fence <= 3000; ++fence)
+		{
+			int allocations = static_cast<int>(rng() % 12);
+			for (int a = 0; a < allocations; ++a)
+			{
+				uint64_t size = 1 + rng() % 6000;
+				uint64_t offset = ring.Allocate(size);
+				if (offset == RingAllocator::kInvalidOffset)
+				{
+					++failures;
+					continue;
+				}
+
+				uint64_t alignedSize = (size + kAlignment - 1) / kAlignment * kAlignment;
+				FALU_CHECK(offset % kAlignment == 0);
+				FALU_CHECK(offset + alignedSize <= kCapacity);
+				for (const Range& range : live)
+					FALU_CHECK(offset + alignedSize <= range.offset || range.offset + range.size <= offset);
+				live.push_back({ fence, offset, alignedSize });
+			}
+			ring.FinishFrame(fence);
+			FALU_CHECK(ring.GetUsedSize() <= kCapacity);
+
+			// GPU  0`3 t[x
+			uint64_t target = fence > 3 ? fence - rng() % 4 : 0;
+			if (target > completed)
+				completed = target;
+			ring.Retire(completed);
+			while (!live.empty() && live.front().fence <= completed)
+				live.pop_front();
+
+			if (live.empty())
+				FALU_CHECK(ring.IsEmpty());
+			else
+				FALU_CHECK(ring.GetOldestPendingFence() == live.front().fence);
+		}
+
+		// tɂȂʂʂĂ
+		FALU_CHECK(failures > 0);
+	}
+}
+
+int main()
+{
+	TestWraparound();
+	TestHeadEqualsTail();
+	TestFenceRetirement();
+	TestRandomFrames();
+	return Test::Result();
+}
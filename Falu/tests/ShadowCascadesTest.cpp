@@ -0,0 +1,205 @@
+/*****************************************************************//**
+ * \file   ShadowCascadesTest.cpp
+ * \brief  JXP[h̕ƔzũeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Renderer/ShadowCascades.h"
+
+#include <cmath>
+#include <random>
+
+using namespace Falu;
+
+namespace
+{
+	// sxNg` PerspectiveFovLH
+	Math::Matrix4 Perspective(float fovY, float aspect, float zNear, float zFar)
+	{
+		float yScale = 1.0f / std::tan(fovY * 0.5f);
+		float xScale = yScale / aspect;
+		float q = zFar / (zFar - zNear);
+		return Math::Matrix4(
+			xScale, 0.0f, 0.0f, 0.0f,
+			0.0f, yScale, 0.0f, 0.0f,
+			0.0f, 0.0f, q, 1.0f,
+			0.0f, 0.0f, -zNear * q, 0.0f);
+	}
+
+	// sxNg` OrthographicLH
+	Math::Matrix4 Orthographic(float width, float height, float zNear, float zFar)
+	{
+		return Math::Matrix4(
+			2.0f / width, 0.0f, 0.0f, 0.0f,
+			0.0f, 2.0f / height, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f / (zFar - zNear), 0.0f,
+			0.0f, 0.0f, zNear / (zNear - zFar), 1.0f);
+	}
+
+	Math::Matrix4 CameraView(const Math::Vector3& position, float pitch, float yaw)
+	{
+		Math::Matrix4 world = Math::Matrix4::TRS(position, Math::Quaternion::FromEuler(pitch, yaw, 0.0f), Math::Vector3(1.0f, 1.0f, 1.0f));
+		return Math::Inverse(world);
+	}
+
+	// CgԂ xy A[h̓_̈ʒũeNZPʂɒ
+	void ToTexel(const ShadowCascade& cascade, const Math::Vector3& point, uint32_t resolution, float& outX, float& outY)
+	{
+		Math::Vector4 clip = Math::Transform(Math::Vector4(point, 1.0f), cascade.viewProjection);
+		outX = (clip.x * 0.5f + 0.5f) * resolution;
+		outY = (clip.y * 0.5f + 0.5f) * resolution;
+	}
+
+	// ͋`PŁAjA艜n܂t@[ŏI
+	void TestSplitsMonotonic()
+	{
+		const float lambdas[] = { 0.0f, 0.3f, 0.75f, 1.0f, -1.0f, 2.0f };
+		const float nears[] = { 0.01f, 0.1f, 1.0f, 10.0f };
+		for (float lambda : lambdas)
+		{
+			for (float nearZ : nears)
+			{
+				for (uint32_t count = 1; count <= ShadowCascades::kMaxCascades; ++count)
+				{
+					float farZ = nearZ * 5000.0f;
+					float splits[ShadowCascades::kMaxCascades];
+					ShadowCascades::ComputeSplits(nearZ, farZ, count, lambda, splits);
+
+					float previous = nearZ;
+					for (uint32_t c = 0; c < count; ++c)
+					{
+						FALU_CHECK(splits[c] > previous);
+						previous = splits[c];
+					}
+					FALU_CHECK(splits[count - 1] == farZ);
+				}
+			}
+		}
+
+		// Fit ̋ԂԂȂȂ
+		ShadowSettings settings;
+		ShadowCascade cascades[ShadowCascades::kMaxCascades];
+		Math::Matrix4 view = CameraView(Math::Vector3(3.0f, 2.0f, -7.0f), 0.3f, 1.1f);
+		uint32_t count = ShadowCascades::Fit(view, Perspective(1.0f, 16.0f / 9.0f, 0.1f, 500.0f),
+			Math::Vector3(0.3f, -1.0f, 0.2f), settings, cascades);
+		FALU_CHECK(count == settings.cascadeCount);
+		FALU_CHECK(std::fabs(cascades[0].splitNear - 0.1f) < 1e-4f);
+		for (uint32_t c = 1; c < count; ++c)
+		{
+			FALU_CHECK(cascades[c].splitNear == cascades[c - 1].splitFar);
+			FALU_CHECK(cascades[c].splitFar > cascades[c].splitNear);
+			FALU_CHECK(cascades[c].texelSize >= cascades[c - 1].texelSize);
+		}
+		FALU_CHECK(cascades[count - 1].splitFar == settings.maxDistance);
+	}
+
+	// ̊eԂ 8 _ÃJXP[h̃NbvԂɓ
+	void TestCascadesContainSlices()
+	{
+		std::mt19937 rng(12345);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		const float halfSize = 0.5f;
+		for (int iteration = 0; iteration < 200; ++iteration)
+		{
+			bool perspective = iteration % 4 != 3;
+			float aspect = 1.0f + 0.8f * (unit(rng) + 1.0f);
+			float fovY = 0.6f + 0.5f * (unit(rng) + 1.0f);
+			Math::Matrix4 projection = perspective
+				? Perspective(fovY, aspect, 0.1f, 300.0f)
+				: Orthographic(40.0f * aspect, 40.0f, 0.5f, 300.0f);
+			Math::Vector3 position(unit(rng) * 100.0f, unit(rng) * 20.0f, unit(rng) * 100.0f);
+			Math::Matrix4 view = CameraView(position, unit(rng) * 1.5f, unit(rng) * 3.14159f);
+
+			// ^(CgԂ̏؂ւ)
+			Math::Vector3 light = iteration % 5 == 0
+				? Math::Vector3(0.0f, -1.0f, 0.0f)
+				: Math::Vector3(unit(rng), -1.0f, unit(rng));
+
+			ShadowSettings settings;
+			settings.cascadeCount = 1 + iteration % ShadowCascades::kMaxCascades;
+			ShadowCascade cascades[ShadowCascades::kMaxCascades];
+			uint32_t count = ShadowCascades::Fit(view, projection, light, settings, cascades);
+			FALU_CHECK(count == settings.cascadeCount);
+
+			Math::Matrix4 cameraToWorld = Math::Inverse(view);
+			float halfWidth = perspective ? 1.0f / projection.m[0][0] : 20.0f * aspect;
+			float halfHeight = perspective ? 1.0f / projection.m[1][1] : 20.0f;
+			for (uint32_t c = 0; c < count; ++c)
+			{
+				const float depths[2] = { cascades[c].splitNear, cascades[c].splitFar };
+				for (float z : depths)
+				{
+					float scale = perspective ? z : 1.0f;
+					for (int corner = 0; corner < 4; ++corner)
+					{
+						float x = (corner & 1 ? halfWidth : -halfWidth) * scale;
+						float y = (corner & 2 ? halfHeight : -halfHeight) * scale;
+						Math::Vector3 world = Math::TransformPoint(Math::Vector3(x, y, z), cameraToWorld);
+						Math::Vector4 clip = Math::Transform(Math::Vector4(world, 1.0f), cascades[c].viewProjection);
+						const float epsilon = 1e-3f;
+						FALU_CHECK(std::fabs(clip.x) <= 1.0f + epsilon);
+						FALU_CHECK(std::fabs(clip.y) <= 1.0f + epsilon);
+						FALU_CHECK(clip.z >= -epsilon && clip.z <= 1.0f + epsilon);
+
+						// Ԃ̒̓_̃{bNX͂̃JXP[h̃LX^[ɓ
+						Math::AABB box(world - Math::Vector3(halfSize, halfSize, halfSize), world + Math::Vector3(halfSize, halfSize, halfSize));
+						FALU_CHECK((ShadowCascades::GetCasterMask(cascades, count, box) & (1u << c)) != 0);
+					}
+				}
+			}
+		}
+	}
+
+	// JĂςĂAeNZ̑傫ƃ[h̓_̃eNZ̈ʒu͕ςȂ
+	void TestTexelSnapping()
+	{
+		ShadowSettings settings;
+		Math::Matrix4 projection = Perspective(1.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+		Math::Vector3 light(0.4f, -1.0f, 0.25f);
+		const Math::Vector3 points[] = {
+			Math::Vector3(1.3f, 0.2f, 4.7f),
+			Math::Vector3(-2.1f, 1.0f, 9.4f),
+		};
+
+		ShadowCascade reference[ShadowCascades::kMaxCascades];
+		ShadowCascades::Fit(CameraView(Math::Vector3(0.0f, 2.0f, 0.0f), 0.2f, 0.0f), projection, light, settings, reference);
+
+		std::mt19937 rng(777);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		for (int frame = 0; frame < 100; ++frame)
+		{
+			// Ȃς
+			Math::Vector3 position(unit(rng) * 0.5f, 2.0f + unit(rng) * 0.1f, unit(rng) * 0.5f);
+			Math::Matrix4 view = CameraView(position, 0.2f + unit(rng) * 0.3f, unit(rng) * 3.14159f);
+
+			ShadowCascade cascades[ShadowCascades::kMaxCascades];
+			uint32_t count = ShadowCascades::Fit(view, projection, light, settings, cascades);
+			for (uint32_t c = 0; c < count; ++c)
+			{
+				FALU_CHECK(cascades[c].texelSize == reference[c].texelSize);
+				for (const Math::Vector3& point : points)
+				{
+					float x0, y0, x1, y1;
+					ToTexel(reference[c], point, settings.resolution, x0, y0);
+					ToTexel(cascades[c], point, settings.resolution, x1, y1);
+					// VhE}bv̓eNZPʂłȂ
+					float dx = x1 - x0;
+					float dy = y1 - y0;
+					FALU_CHECK(std::fabs(dx - std::round(dx)) < 2e-3f);
+					FALU_CHECK(std::fabs(dy - std::round(dy)) < 2e-3f);
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	TestSplitsMonotonic();
+	TestCascadesContainSlices();
+	TestTexelSnapping();
+	return Test::Result();
+}
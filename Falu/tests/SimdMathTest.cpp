@@ -0,0 +1,144 @@
+/*****************************************************************//**
+ * \file   SimdMathTest.cpp
+ * \brief  SimdMath ̈ꊇJ[lXJ[ł̊֐ƔׂeXg
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "TestCheck.h"
+#include "Include/Math/SimdMath.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Falu;
+
+namespace
+{
+	// e[̓XJ[łƓZ𓯂ōŝŁAʂ̓rbgPʂňv
+	bool SameBits(const Math::Vector3& a, const Math::Vector3& b)
+	{
+		return std::memcmp(&a, &b, sizeof(Math::Vector3)) == 0;
+	}
+
+	std::vector<Math::Vector3> RandomVectors(std::mt19937& rng, size_t count)
+	{
+		std::uniform_real_distribution<float> unit(-100.0f, 100.0f);
+		std::vector<Math::Vector3> vectors(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			// Ƃǂ 0 xNg(Normalize  0 / 0)
+			vectors[i] = (rng() % 7 == 0) ? Math::Vector3(0.0f, 0.0f, 0.0f) : Math::Vector3(unit(rng), unit(rng), unit(rng));
+		}
+		return vectors;
+	}
+
+	Math::Matrix4 RandomMatrix(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> unit(-3.0f, 3.0f);
+		return Math::Matrix4(
+			unit(rng), unit(rng), unit(rng), 0.0f,
+			unit(rng), unit(rng), unit(rng), 0.0f,
+			unit(rng), unit(rng), unit(rng), 0.0f,
+			unit(rng) * 10.0f, unit(rng) * 10.0f, unit(rng) * 10.0f, 1.0f);
+	}
+
+	// [̈邽߁A(4 / 8)̑ǑƁAz̓rn܂(ĂȂ)͂Ŕׂ
+	const size_t kCounts[] = { 0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 1000, 1003 };
+
+	void TestTransform()
+	{
+		std::mt19937 rng(39);
+		for (size_t count : kCounts)
+		{
+			for (size_t offset = 0; offset < 3; ++offset)
+			{
+				std::vector<Math::Vector3> storage = RandomVectors(rng, count + offset);
+				const Math::Vector3* in = storage.data() + offset;
+				Math::Matrix4 matrix = RandomMatrix(rng);
+
+				std::vector<Math::Vector3> points(count + 1), vectors(count + 1);
+				Math::Simd::TransformPoints(matrix, in, points.data() + 1, count);
+				Math::Simd::TransformVectors(matrix, in, vectors.data() + 1, count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					FALU_CHECK(SameBits(points[i + 1], Math::TransformPoint(in[i], matrix)));
+					FALU_CHECK(SameBits(vectors[i + 1], Math::TransformVector(in[i], matrix)));
+				}
+
+				// in  out z
+				std::vector<Math::Vector3> inPlace(in, in + count);
+				Math::Simd::TransformPoints(matrix, inPlace.data(), inPlace.data(), count);
+				for (size_t i = 0; i < count; ++i)
+					FALU_CHECK(SameBits(inPlace[i], points[i + 1]));
+			}
+		}
+	}
+
+	void TestNormalize()
+	{
+		std::mt19937 rng(40);
+		for (size_t count : kCounts)
+		{
+			std::vector<Math::Vector3> in = RandomVectors(rng, count);
+			std::vector<Math::Vector3> out(count);
+			Math::Simd::Normalize(in.data(), out.data(), count);
+			for (size_t i = 0; i < count; ++i)
+				FALU_CHECK(SameBits(out[i], Math::Normalize(in[i])));
+
+			Math::Simd::Normalize(in.data(), in.data(), count);
+			for (size_t i = 0; i < count; ++i)
+				FALU_CHECK(SameBits(in[i], out[i]));
+		}
+	}
+
+	void TestDotCross()
+	{
+		std::mt19937 rng(41);
+		for (size_t count : kCounts)
+		{
+			std::vector<Math::Vector3> a = RandomVectors(rng, count);
+			std::vector<Math::Vector3> b = RandomVectors(rng, count);
+			std::vector<float> dots(count);
+			std::vector<Math::Vector3> crosses(count);
+			Math::Simd::Dot(a.data(), b.data(), dots.data(), count);
+			Math::Simd::Cross(a.data(), b.data(), crosses.data(), count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				float dot = Math::Dot(a[i], b[i]);
+				FALU_CHECK(std::memcmp(&dots[i], &dot, sizeof(float)) == 0);
+				FALU_CHECK(SameBits(crosses[i], Math::Cross(a[i], b[i])));
+			}
+
+			// o͂ 1 Ԗڂ̓͂Ɠz
+			std::vector<Math::Vector3> inPlace = a;
+			Math::Simd::Cross(inPlace.data(), b.data(), inPlace.data(), count);
+			for (size_t i = 0; i < count; ++i)
+				FALU_CHECK(SameBits(inPlace[i], crosses[i]));
+		}
+	}
+}
+
+int main()
+{
+	// SimdMathAvxTest  SimdMath.cpp  AVX ɃrhBAVX ̂Ȃ CPU ł͔΂
+#if defined(__AVX__) && (defined(__GNUC__) || defined(__clang__))
+	if (!__builtin_cpu_supports("avx"))
+	{
+		std::printf("AVX is not available, skipped\n");
+		return 0;
+	}
+#endif
+	std::printf("instruction set: %s\n", Math::Simd::GetInstructionSet());
+#if defined(__AVX__)
+	FALU_CHECK(std::strcmp(Math::Simd::GetInstructionSet(), "AVX") == 0);
+#elif defined(__SSE2__) || defined(_M_X64)
+	FALU_CHECK(std::strcmp(Math::Simd::GetInstructionSet(), "SSE") == 0);
+#endif
+
+	TestTransform();
+	TestNormalize();
+	TestDotCross();
+	return Test::Result();
+}
@@ -0,0 +1,37 @@
+/*****************************************************************//**
+ * \file   TestCheck.h
+ * \brief  eXgp̍ŏ̃`FbN}N
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#pragma once
+
+#include <cstdio>
+
+namespace Falu
+{
+	namespace Test
+	{
+		inline int failureCount = 0;
+
+		// main ̖߂lBs 1 ł ctest ɎsԂ
+		inline int Result()
+		{
+			if (failureCount == 0)
+				std::printf("passed\n");
+			else
+				std::printf("%d check(s) failed\n", failureCount);
+			return failureCount == 0 ? 0 : 1;
+		}
+	}
+}
+
+// sĂ~߂ɑA܂Ƃ߂ĕ񍐂
+#define FALU_CHECK(expr) \
+	do { \
+		if (!(expr)) { \
+			std::fprintf(stderr, "%s:%d: FALU_CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+			++Falu::Test::failureCount; \
+		} \
+	} while (0)
@@ -0,0 +1,163 @@
+/*****************************************************************//**
+ * \file   ModelLoadBench.cpp
+ * \brief  ModelLoader ̃R[h(C|[g)ƃEH[(MeshCache)̓ǂݍݎԂ̔r
+ *
+ * \author tsunn
+ * \date   2026/10/19
+ *********************************************************************/
+#include "Renderer/ModelLoader.h"
+#include "Renderer/MeshCache.h"
+#include "Renderer/Model.h"
+#include "Falu/JobSystem.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace Falu;
+
+namespace
+{
+	// ꂽobt@̒g܂Ƃ߂邾̃foCXBGPU ̎Ԃ͑Ȃ
+	class NullDevice : public ID3D11Device
+	{
+	public:
+		HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Buffer** buffer) override
+		{
+			if (data && data->pSysMem)
+			{
+				// Abv[h̏ԂɍEȂ悤ɑ킹
+				m_digest += MeshCache::Hash(data->pSysMem, desc->ByteWidth);
+				m_bytes += desc->ByteWidth;
+			}
+			++m_bufferCount;
+			*buffer = new ID3D11Buffer();
+			return S_OK;
+		}
+
+		void ResetDigest() { m_digest = 0; m_bytes = 0; m_bufferCount = 0; }
+		uint64_t GetDigest() const { return m_digest; }
+		size_t GetBytes() const { return m_bytes; }
+		size_t GetBufferCount() const { return m_bufferCount; }
+
+	private:
+		uint64_t m_digest = 0;
+		size_t m_bytes = 0;
+		size_t m_bufferCount = 0;
+	};
+
+	// meshCount ̋(ܓxox n )ʁX̃IuWFNgƂďo
+	bool WriteSpheres(const std::string& path, int meshCount, int n)
+	{
+		std::ofstream file(path);
+		if (!file)
+			return false;
+
+		const float pi = 3.14159265f;
+		int base = 1;
+		for (int mesh = 0; mesh < meshCount; ++mesh)
+		{
+			file << "o Sphere" << mesh << "\n";
+			float offset = mesh * 3.0f;
+			for (int j = 0; j <= n; ++j)
+			{
+				float theta = pi * j / n;
+				for (int i = 0; i <= n; ++i)
+				{
+					float phi = 2.0f * pi * i / n;
+					float x = std::sin(theta) * std::cos(phi), y = std::cos(theta), z = std::sin(theta) * std::sin(phi);
+					file << "v " << x + offset << " " << y << " " << z << "\n";
+					file << "vt " << static_cast<float>(i) / n << " " << static_cast<float>(j) / n << "\n";
+					file << "vn " << x << " " << y << " " << z << "\n";
+				}
+			}
+			for (int j = 0; j < n; ++j)
+				for (int i = 0; i < n; ++i)
+				{
+					int a = base + j * (n + 1) + i, b = a + 1, c = a + n + 2, d = a + n + 1;
+					file << "f " << a << "/" << a << "/" << a << " " << b << "/" << b << "/" << b << " " << c << "/" << c << "/" << c << "\n";
+					file << "f " << a << "/" << a << "/" << a << " " << c << "/" << c << "/" << c << " " << d << "/" << d << "/" << d << "\n";
+				}
+			base += (n + 1) * (n + 1);
+		}
+		return static_cast<bool>(file);
+	}
+
+	double Milliseconds(std::chrono::steady_clock::time_point begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+	}
+}
+
+// g: ModelLoadBench [bV] [] [ƃfBNg]
+int main(int argc, char** argv)
+{
+	int meshCount = argc > 1 ? std::atoi(argv[1]) : 8;
+	int divisions = argc > 2 ? std::atoi(argv[2]) : 180;
+	std::filesystem::path work = argc > 3 ? argv[3] : "ModelLoadBench.work";
+	const int kWarmRuns = 5;
+
+	std::error_code ec;
+	std::filesystem::remove_all(work, ec);
+	std::filesystem::create_directories(work / "cache", ec);
+	std::string modelPath = (work / "Spheres.obj").string();
+	if (meshCount <= 0 || divisions < 3 || !WriteSpheres(modelPath, meshCount, divisions))
+	{
+		std::fprintf(stderr, "cannot write %s\n", modelPath.c_str());
+		return 1;
+	}
+
+	JobSystem::GetInstance().Initialize();
+	ModelLoader& loader = ModelLoader::GetInstance();
+	loader.SetCacheDirectory((work / "cache").string());
+
+	NullDevice device;
+	int result = 0;
+
+	// 1 ڂ̓LbVȂ̂ŃC|[gĂĂ
+	auto begin = std::chrono::steady_clock::now();
+	std::unique_ptr<Model> cold = loader.LoadModel(&device, modelPath);
+	double coldMs = Milliseconds(begin);
+	uint64_t coldDigest = device.GetDigest();
+	size_t coldBytes = device.GetBytes();
+	size_t bufferCount = device.GetBufferCount();
+	if (!cold)
+	{
+		std::fprintf(stderr, "cold load failed\n");
+		result = 1;
+	}
+	cold.reset();
+
+	double warmMs = 0.0;
+	for (int run = 0; run < kWarmRuns && result == 0; ++run)
+	{
+		device.ResetDigest();
+		begin = std::chrono::steady_clock::now();
+		std::unique_ptr<Model> warm = loader.LoadModel(&device, modelPath);
+		warmMs += Milliseconds(begin);
+
+		// LbVǂł GPU ɓn钆g͓łȂ΂ȂȂ
+		if (!warm || device.GetDigest() != coldDigest || device.GetBytes() != coldBytes)
+		{
+			std::fprintf(stderr, "warm load %d differs from the cold load\n", run);
+			result = 1;
+		}
+	}
+
+	if (result == 0)
+	{
+		warmMs /= kWarmRuns;
+		std::printf("%d meshes, %d divisions: %zu buffers, %.1f MB uploaded\n",
+			meshCount, divisions, bufferCount, coldBytes / (1024.0 * 1024.0));
+		std::printf("cold %.1f ms, warm %.1f ms (average of %d), %.1fx\n",
+			coldMs, warmMs, kWarmRuns, coldMs / (warmMs > 0.0 ? warmMs : 1e-3));
+	}
+
+	JobSystem::GetInstance().Shutdown();
+	std::filesystem::remove_all(work, ec);
+	return result;
+}